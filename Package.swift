@@ -8,10 +8,20 @@ let package = Package(
     products: [
         .library(
             name: "Csmd",type: .static,targets: ["Csmd"]),
+        .executable(
+            name: "CsmdBenchmark",targets: ["CsmdBenchmark"]),
+        .executable(
+            name: "CsmdCascadeConverter",targets: ["CsmdCascadeConverter"]),
         ],
     targets: [
         .target(
             name:"Csmd",dependencies:[],path:"Sources/simdlib"
+        ),
+        .target(
+            name:"CsmdBenchmark",dependencies:["Csmd"],path:"Sources/benchmark"
+        ),
+        .target(
+            name:"CsmdCascadeConverter",dependencies:["Csmd"],path:"Sources/cascadeconverter"
         )
     ]
 )
\ No newline at end of file
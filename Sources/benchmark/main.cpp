@@ -0,0 +1,1521 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "SimdLib.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define BENCHMARK_RDTSC
+#endif
+
+/*
+* Micro-benchmark of Simd Library C API.
+*
+* Every registered function is called on the same input for every ISA level supported by the current CPU 
+* (the level is selected with SimdSetCpuInfoMask), for every image size and for aligned and unaligned images. 
+* With -check option every SIMD level is instead compared against Base output (tiny and odd image sizes by default).
+* If -thr=N is given together with -check then output of every level with N threads must be bit exact to its output with 1 thread.
+* Usage: CsmdBenchmark [-s=WxH]... [-f=filter] [-t=seconds] [-thr=threads] [-csv] [-check]
+*/
+
+namespace Benchmark
+{
+    typedef std::chrono::high_resolution_clock Clock;
+
+    struct Level
+    {
+        const char * name;
+        int mask;
+    };
+
+    const int SSE2 = (1 << SimdCpuInfoSse) | (1 << SimdCpuInfoSse2);
+    const int SSSE3 = SSE2 | (1 << SimdCpuInfoSse3) | (1 << SimdCpuInfoSsse3);
+    const int SSE41 = SSSE3 | (1 << SimdCpuInfoSse41) | (1 << SimdCpuInfoSse42);
+    const int AVX2 = SSE41 | (1 << SimdCpuInfoAvx) | (1 << SimdCpuInfoAvx2);
+    const int AVX512BW = AVX2 | (1 << SimdCpuInfoAvx512f) | (1 << SimdCpuInfoAvx512bw);
+    const int VSX = (1 << SimdCpuInfoVmx) | (1 << SimdCpuInfoVsx);
+
+    const Level LEVELS[] =
+    {
+        { "Base", 0 },
+        { "Sse2", SSE2 },
+        { "Ssse3", SSSE3 },
+        { "Sse41", SSE41 },
+        { "Avx2", AVX2 },
+        { "Avx512bw", AVX512BW },
+        { "Vmx", 1 << SimdCpuInfoVmx },
+        { "Vsx", VSX },
+        { "Neon", 1 << SimdCpuInfoNeon },
+        { "Msa", 1 << SimdCpuInfoMsa },
+    };
+
+    /* All images of a case share the same stride which fits 4-channel image of given width.
+    * Unaligned images are shifted by 2 bytes in order to keep 16-bit outputs (Laplace, Sobel) valid.
+    * Functions with scalar outputs (sums, statistic, histogram, batch tensors) copy them to the begin of dst[0].
+    * src[3] is a mask with values 0 and 0xFF which is used by masked functions (with index 0xFF) and by segmentation. */
+    struct Case
+    {
+        size_t width, height, stride, size;
+        bool aligned;
+        uint8_t * src[4];
+        uint8_t * dst[4];
+
+        static const size_t SCALAR_SIZE_MAX = 4 * 3 * 16 * 16 * sizeof(float); // Float tensor of CropResizeBatch.
+
+        Case(size_t w, size_t h, bool a)
+            : width(w), height(h), aligned(a)
+        {
+            stride = SimdAlign(4 * width, SimdAlignment()) + Shift();
+            size = std::max<size_t>(stride * height, SCALAR_SIZE_MAX) + SimdAlignment() - Shift();
+            for (size_t i = 0; i < 4; ++i)
+            {
+                src[i] = Allocate(i + 1);
+                dst[i] = Allocate(0);
+            }
+            for (size_t i = 0; i < size; ++i)
+                src[3][i] = src[3][i] < 0x80 ? 0 : 0xFF;
+        }
+
+        ~Case()
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                SimdFree(src[i] - Shift());
+                SimdFree(dst[i] - Shift());
+            }
+        }
+
+    private:
+        uint8_t * Allocate(size_t seed)
+        {
+            uint8_t * data = (uint8_t*)SimdAllocate(size + Shift(), SimdAlignment());
+            uint32_t random = uint32_t(seed);
+            for (size_t i = 0; i < size + Shift(); ++i)
+            {
+                random = random * 1664525 + 1013904223;
+                data[i] = seed ? uint8_t(random >> 24) : 0;
+            }
+            return data + Shift();
+        }
+
+        size_t Shift() const
+        {
+            return aligned ? 0 : 2;
+        }
+
+        Case(const Case &);
+        Case & operator = (const Case &);
+    };
+
+    typedef void(*Function)(const Case & c);
+
+    typedef std::vector<uint8_t> Buffer;
+
+    /* Describes the part of dst[i] which is written by the function and is compared with Base output in check mode. */
+    struct Output
+    {
+        enum Area
+        {
+            None, // dst[i] is unused.
+            Full, // width x height.
+            Even, // width x height rounded down to even.
+            Half, // (width / 2) x (height / 2).
+            Reduced, // ((width + 1) / 2) x ((height + 1) / 2).
+            Resized, // (width / 2 + 1) x (height / 2 + 1).
+            Narrow, // (width / 2) x height.
+            Row, // Single row of width pixels.
+            Column, // Single row of height pixels.
+            Flat, // Single row of width x height pixels (image without stride).
+            Scalar, // Single row of pixelSize bytes.
+        } area;
+        size_t pixelSize;
+        int error; // Allowed absolute difference from Base output (0 by default).
+
+        void Size(const Case & c, size_t & rowSize, size_t & rows) const
+        {
+            size_t w = c.width, h = c.height;
+            switch (area)
+            {
+            case Full: break;
+            case Even: w &= ~size_t(1), h &= ~size_t(1); break;
+            case Half: w /= 2, h /= 2; break;
+            case Reduced: w = (w + 1) / 2, h = (h + 1) / 2; break;
+            case Resized: w = w / 2 + 1, h = h / 2 + 1; break;
+            case Narrow: w /= 2; break;
+            case Row: h = 1; break;
+            case Column: w = h, h = 1; break;
+            case Flat: w *= h, h = 1; break;
+            case Scalar: w = 1, h = 1; break;
+            default: w = 0, h = 0;
+            }
+            rowSize = w * pixelSize;
+            rows = h;
+        }
+    };
+
+    struct Entry
+    {
+        const char * name;
+        Function function;
+        Output output[4];
+    };
+
+#define BENCHMARK_ENTRY(name, ...) { #name, Bench##name, { __VA_ARGS__ } }
+
+    void BenchAbsDifferenceSum(const Case & c)
+    {
+        uint64_t sum;
+        SimdAbsDifferenceSum(c.src[0], c.stride, c.src[1], c.stride, c.width, c.height, &sum);
+        memcpy(c.dst[0], &sum, sizeof(sum));
+    }
+
+    void BenchAbsDifferenceSumMasked(const Case & c)
+    {
+        uint64_t sum;
+        SimdAbsDifferenceSumMasked(c.src[0], c.stride, c.src[1], c.stride, c.src[3], c.stride, 0xFF, c.width, c.height, &sum);
+        memcpy(c.dst[0], &sum, sizeof(sum));
+    }
+
+    void BenchAbsDifferenceSums3x3(const Case & c)
+    {
+        uint64_t sums[9];
+        if (c.width > 2 && c.height > 2)
+        {
+            SimdAbsDifferenceSums3x3(c.src[0], c.stride, c.src[1], c.stride, c.width, c.height, sums);
+            memcpy(c.dst[0], sums, sizeof(sums));
+        }
+    }
+
+    void BenchAbsDifferenceSums3x3Masked(const Case & c)
+    {
+        uint64_t sums[9];
+        if (c.width > 2 && c.height > 2)
+        {
+            SimdAbsDifferenceSums3x3Masked(c.src[0], c.stride, c.src[1], c.stride, c.src[3], c.stride, 0xFF, c.width, c.height, sums);
+            memcpy(c.dst[0], sums, sizeof(sums));
+        }
+    }
+
+    void BenchAbsGradientSaturatedSum(const Case & c)
+    {
+        SimdAbsGradientSaturatedSum(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchAbsSecondDerivativeHistogram(const Case & c)
+    {
+        uint32_t histogram[256];
+        if (c.width > 4 && c.height > 4)
+        {
+            SimdAbsSecondDerivativeHistogram(c.src[0], c.width, c.height, c.stride, 1, 2, histogram);
+            memcpy(c.dst[0], histogram, sizeof(histogram));
+        }
+    }
+
+    void BenchAddFeatureDifference(const Case & c)
+    {
+        SimdAddFeatureDifference(c.src[0], c.stride, c.width, c.height, c.src[1], c.stride, c.src[2], c.stride, 0x4000, c.dst[0], c.stride);
+    }
+
+    void BenchAlphaBlending(const Case & c)
+    {
+        SimdAlphaBlending(c.src[0], c.stride, c.width, c.height, 4, c.src[1], c.stride, c.dst[0], c.stride);
+    }
+
+    void BenchAveragingBinarization(const Case & c)
+    {
+        SimdAveragingBinarization(c.src[0], c.stride, c.width, c.height, 128, std::min<size_t>(5, std::min(c.width, c.height) - 1), 10, 255, 0, c.dst[0], c.stride, SimdCompareGreater);
+    }
+
+    void BenchBackgroundAdjustRange(const Case & c)
+    {
+        SimdBackgroundAdjustRange(c.dst[0], c.stride, c.width, c.height, c.dst[1], c.stride, c.dst[2], c.stride, c.dst[3], c.stride, 1);
+    }
+
+    void BenchBackgroundAdjustRangeMasked(const Case & c)
+    {
+        SimdBackgroundAdjustRangeMasked(c.dst[0], c.stride, c.width, c.height, c.dst[1], c.stride, c.dst[2], c.stride, c.dst[3], c.stride, 1, c.src[3], c.stride);
+    }
+
+    void BenchBackgroundGrowRangeFast(const Case & c)
+    {
+        SimdBackgroundGrowRangeFast(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride, c.dst[1], c.stride);
+    }
+
+    void BenchBackgroundGrowRangeSlow(const Case & c)
+    {
+        SimdBackgroundGrowRangeSlow(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride, c.dst[1], c.stride);
+    }
+
+    void BenchBackgroundIncrementCount(const Case & c)
+    {
+        SimdBackgroundIncrementCount(c.src[0], c.stride, c.width, c.height, c.src[1], c.stride, c.src[2], c.stride, c.dst[0], c.stride, c.dst[1], c.stride);
+    }
+
+    void BenchBackgroundInitMask(const Case & c)
+    {
+        SimdBackgroundInitMask(c.src[3], c.stride, c.width, c.height, 0xFF, 1, c.dst[0], c.stride);
+    }
+
+    void BenchBackgroundShiftRange(const Case & c)
+    {
+        SimdBackgroundShiftRange(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride, c.dst[1], c.stride);
+    }
+
+    void BenchBackgroundShiftRangeMasked(const Case & c)
+    {
+        SimdBackgroundShiftRangeMasked(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride, c.dst[1], c.stride, c.src[3], c.stride);
+    }
+
+    void BenchBayerToBgr(const Case & c)
+    {
+        SimdBayerToBgr(c.src[0], c.width & ~size_t(1), c.height & ~size_t(1), c.stride, SimdPixelFormatBayerGrbg, c.dst[0], c.stride);
+    }
+
+    void BenchBayerToBgra(const Case & c)
+    {
+        SimdBayerToBgra(c.src[0], c.width & ~size_t(1), c.height & ~size_t(1), c.stride, SimdPixelFormatBayerGrbg, c.dst[0], c.stride, 0xFF);
+    }
+
+    void BenchBgr48pToBgra32(const Case & c)
+    {
+        SimdBgr48pToBgra32(c.src[0], c.stride, c.width, c.height, c.src[1], c.stride, c.src[2], c.stride, c.dst[0], c.stride, 0xFF);
+    }
+
+    void BenchBgraToBayer(const Case & c)
+    {
+        SimdBgraToBayer(c.src[0], c.width & ~size_t(1), c.height & ~size_t(1), c.stride, c.dst[0], c.stride, SimdPixelFormatBayerGrbg);
+    }
+
+    void BenchBgraToBgr(const Case & c)
+    {
+        SimdBgraToBgr(c.src[0], c.width, c.height, c.stride, c.dst[0], c.stride);
+    }
+
+    void BenchBgraToGray(const Case & c)
+    {
+        SimdBgraToGray(c.src[0], c.width, c.height, c.stride, c.dst[0], c.stride);
+    }
+
+    void BenchBgraToYuv420p(const Case & c)
+    {
+        SimdBgraToYuv420p(c.src[0], c.width & ~size_t(1), c.height & ~size_t(1), c.stride, c.dst[0], c.stride, c.dst[1], c.stride, c.dst[2], c.stride);
+    }
+
+    void BenchBgraToYuv422p(const Case & c)
+    {
+        SimdBgraToYuv422p(c.src[0], c.width & ~size_t(1), c.height, c.stride, c.dst[0], c.stride, c.dst[1], c.stride, c.dst[2], c.stride);
+    }
+
+    void BenchBgraToYuv444p(const Case & c)
+    {
+        SimdBgraToYuv444p(c.src[0], c.width, c.height, c.stride, c.dst[0], c.stride, c.dst[1], c.stride, c.dst[2], c.stride);
+    }
+
+    void BenchBgrToBayer(const Case & c)
+    {
+        SimdBgrToBayer(c.src[0], c.width & ~size_t(1), c.height & ~size_t(1), c.stride, c.dst[0], c.stride, SimdPixelFormatBayerGrbg);
+    }
+
+    void BenchBgrToBgra(const Case & c)
+    {
+        SimdBgrToBgra(c.src[0], c.width, c.height, c.stride, c.dst[0], c.stride, 0xFF);
+    }
+
+    void BenchBgrToGray(const Case & c)
+    {
+        SimdBgrToGray(c.src[0], c.width, c.height, c.stride, c.dst[0], c.stride);
+    }
+
+    void BenchBgrToHsl(const Case & c)
+    {
+        SimdBgrToHsl(c.src[0], c.width, c.height, c.stride, c.dst[0], c.stride);
+    }
+
+    void BenchBgrToHsv(const Case & c)
+    {
+        SimdBgrToHsv(c.src[0], c.width, c.height, c.stride, c.dst[0], c.stride);
+    }
+
+    void BenchBgrToYuv420p(const Case & c)
+    {
+        SimdBgrToYuv420p(c.src[0], c.width & ~size_t(1), c.height & ~size_t(1), c.stride, c.dst[0], c.stride, c.dst[1], c.stride, c.dst[2], c.stride);
+    }
+
+    void BenchBgrToYuv422p(const Case & c)
+    {
+        SimdBgrToYuv422p(c.src[0], c.width & ~size_t(1), c.height, c.stride, c.dst[0], c.stride, c.dst[1], c.stride, c.dst[2], c.stride);
+    }
+
+    void BenchBgrToYuv444p(const Case & c)
+    {
+        SimdBgrToYuv444p(c.src[0], c.width, c.height, c.stride, c.dst[0], c.stride, c.dst[1], c.stride, c.dst[2], c.stride);
+    }
+
+    void BenchBilateralFilter(const Case & c)
+    {
+        SimdBilateralFilter(c.src[0], c.stride, c.width, c.height, 1, SimdBilateralFilterExact, 2.0f, 30.0f, 0, c.dst[0], c.stride);
+    }
+
+    void BenchBilateralFilterFast(const Case & c)
+    {
+        SimdBilateralFilter(c.src[0], c.stride, c.width, c.height, 3, SimdBilateralFilterFast, 10.0f, 30.0f, 0, c.dst[0], c.stride);
+    }
+
+    void BenchBinarization(const Case & c)
+    {
+        SimdBinarization(c.src[0], c.stride, c.width, c.height, 128, 255, 0, c.dst[0], c.stride, SimdCompareGreater);
+    }
+
+    void BenchBoxFilter(const Case & c)
+    {
+        SimdBoxFilter(c.src[0], c.stride, c.width, c.height, 1, 15, 15, c.dst[0], c.stride);
+    }
+
+    void BenchCanny(const Case & c)
+    {
+        SimdCanny(c.src[0], c.stride, c.width, c.height, 200, 400, c.dst[0], c.stride);
+    }
+
+    void BenchConditionalCount16i(const Case & c)
+    {
+        uint32_t count;
+        SimdConditionalCount16i(c.src[0], c.stride, c.width, c.height, 0, SimdCompareGreater, &count);
+        memcpy(c.dst[0], &count, sizeof(count));
+    }
+
+    void BenchConditionalCount8u(const Case & c)
+    {
+        uint32_t count;
+        SimdConditionalCount8u(c.src[0], c.stride, c.width, c.height, 128, SimdCompareGreater, &count);
+        memcpy(c.dst[0], &count, sizeof(count));
+    }
+
+    void BenchConditionalFill(const Case & c)
+    {
+        SimdConditionalFill(c.src[0], c.stride, c.width, c.height, 128, SimdCompareGreater, 255, c.dst[0], c.stride);
+    }
+
+    void BenchConditionalSquareGradientSum(const Case & c)
+    {
+        uint64_t sum;
+        SimdConditionalSquareGradientSum(c.src[0], c.stride, c.width, c.height, c.src[1], c.stride, 128, SimdCompareGreater, &sum);
+        memcpy(c.dst[0], &sum, sizeof(sum));
+    }
+
+    void BenchConditionalSquareSum(const Case & c)
+    {
+        uint64_t sum;
+        SimdConditionalSquareSum(c.src[0], c.stride, c.width, c.height, c.src[1], c.stride, 128, SimdCompareGreater, &sum);
+        memcpy(c.dst[0], &sum, sizeof(sum));
+    }
+
+    void BenchConditionalSum(const Case & c)
+    {
+        uint64_t sum;
+        SimdConditionalSum(c.src[0], c.stride, c.width, c.height, c.src[1], c.stride, 128, SimdCompareGreater, &sum);
+        memcpy(c.dst[0], &sum, sizeof(sum));
+    }
+
+    void BenchContourAnchors(const Case & c)
+    {
+        SimdContourAnchors(c.src[0], c.stride, c.width, c.height, 3, 0, c.dst[0], c.stride);
+    }
+
+    void BenchContourMetrics(const Case & c)
+    {
+        SimdContourMetrics(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchContourMetricsMasked(const Case & c)
+    {
+        SimdContourMetricsMasked(c.src[0], c.stride, c.width, c.height, c.src[3], c.stride, 0xFF, c.dst[0], c.stride);
+    }
+
+    void BenchCopy(const Case & c)
+    {
+        SimdCopy(c.src[0], c.stride, c.width, c.height, 4, c.dst[0], c.stride);
+    }
+
+    void BenchCopyFrame(const Case & c)
+    {
+        SimdCopyFrame(c.src[0], c.stride, c.width, c.height, 4, c.width / 4, c.height / 4, c.width - c.width / 4, c.height - c.height / 4, c.dst[0], c.stride);
+    }
+
+    void BenchCorrelationSum(const Case & c)
+    {
+        uint64_t sum;
+        SimdCorrelationSum(c.src[0], c.stride, c.src[1], c.stride, c.width, c.height, &sum);
+        memcpy(c.dst[0], &sum, sizeof(sum));
+    }
+
+    void BenchCrc32c(const Case & c)
+    {
+        uint32_t crc = SimdCrc32c(c.src[0], c.width * c.height * 4);
+        memcpy(c.dst[0], &crc, sizeof(crc));
+    }
+
+    /* 4 crops of 3-channel image (quarters and center) are resized to batch of 16x16 images. */
+    void CropResizeBatch(const Case & c, SimdCropResizeOutputType output)
+    {
+        const ptrdiff_t w = c.width, h = c.height;
+        const ptrdiff_t rects[4][4] = { { 0, 0, w / 2, h / 2 }, { w / 2, 0, w, h / 2 }, { 0, h / 2, w / 2, h }, { w / 4, h / 4, w - w / 4, h - h / 4 } };
+        SimdCropResizeBatch(c.src[0], c.stride, c.width, c.height, 3, rects[0], 4, 16, 16, SimdResizeMethodBilinear, output, 1.0f / 255.0f, -0.5f, c.dst[0]);
+    }
+
+    void BenchCropResizeBatch(const Case & c)
+    {
+        CropResizeBatch(c, SimdCropResizeOutputFloatChw);
+    }
+
+    void BenchCropResizeBatchUint8(const Case & c)
+    {
+        CropResizeBatch(c, SimdCropResizeOutputUint8);
+    }
+
+    void BenchDeinterleaveBgr(const Case & c)
+    {
+        SimdDeinterleaveBgr(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride, c.dst[1], c.stride, c.dst[2], c.stride);
+    }
+
+    void BenchDeinterleaveBgra(const Case & c)
+    {
+        SimdDeinterleaveBgra(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride, c.dst[1], c.stride, c.dst[2], c.stride, c.dst[3], c.stride);
+    }
+
+    void BenchDeinterleaveUv(const Case & c)
+    {
+        SimdDeinterleaveUv(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride, c.dst[1], c.stride);
+    }
+
+    /* Binary cascade for DetectionLoadMemory. It is made once from synthetic LBP cascade (written as OpenCV XML, 
+    * loaded by SimdDetectionLoadA and converted by SimdDetectionSaveA), so the benchmark doesn't need any data files. */
+    const Buffer & Cascade()
+    {
+        static Buffer cascade;
+        if (cascade.size())
+            return cascade;
+        const char * xml = "CsmdBenchmarkCascade.xml", * bin = "CsmdBenchmarkCascade.bin";
+        const int STAGES = 16, TREES = 8, FEATURES = STAGES * TREES, SIZE = 24;
+        FILE * file = fopen(xml, "w");
+        if (file == NULL)
+            return cascade;
+        fprintf(file, "<?xml version=\"1.0\"?>\n<opencv_storage>\n<cascade>\n  <stageType>BOOST</stageType>\n  <featureType>LBP</featureType>\n");
+        fprintf(file, "  <height>%d</height>\n  <width>%d</width>\n  <stageParams>\n    <maxWeakCount>%d</maxWeakCount></stageParams>\n", SIZE, SIZE, TREES);
+        fprintf(file, "  <featureParams>\n    <maxCatCount>256</maxCatCount></featureParams>\n  <stageNum>%d</stageNum>\n  <stages>\n", STAGES);
+        uint32_t random = 1;
+        for (int stage = 0; stage < STAGES; ++stage)
+        {
+            fprintf(file, "    <_>\n      <maxWeakCount>%d</maxWeakCount>\n      <stageThreshold>-0.5</stageThreshold>\n      <weakClassifiers>\n", TREES);
+            for (int tree = 0; tree < TREES; ++tree)
+            {
+                fprintf(file, "        <_>\n          <internalNodes>0 -1 %d", stage * TREES + tree);
+                for (int i = 0; i < 8; ++i)
+                {
+                    random = random * 1664525 + 1013904223;
+                    fprintf(file, " %d", int(int32_t(random)));
+                }
+                fprintf(file, "</internalNodes>\n          <leafValues>-0.5 0.5</leafValues></_>\n");
+            }
+            fprintf(file, "      </weakClassifiers></_>\n");
+        }
+        fprintf(file, "  </stages>\n  <features>\n");
+        for (int feature = 0; feature < FEATURES; ++feature)
+            fprintf(file, "    <_>\n      <rect>%d %d %d %d</rect></_>\n", feature % 16, feature / 16 % 16, 1 + feature % 3, 1 + feature % 2);
+        fprintf(file, "  </features>\n</cascade>\n</opencv_storage>\n");
+        fclose(file);
+
+        void * data = SimdDetectionLoadA(xml);
+        if (data && SimdDetectionSaveA(data, bin) && (file = fopen(bin, "rb")) != NULL)
+        {
+            uint8_t chunk[4096];
+            for (size_t size; (size = fread(chunk, 1, sizeof(chunk), file)) > 0;)
+                cascade.insert(cascade.end(), chunk, chunk + size);
+            fclose(file);
+        }
+        if (data)
+            SimdDetectionFree(data);
+        remove(xml);
+        remove(bin);
+        return cascade;
+    }
+
+    void BenchDetectionLoadMemory(const Case & c)
+    {
+        const Buffer & cascade = Cascade();
+        size_t info[3] = { 0, 0, 0 };
+        void * data = SimdDetectionLoadMemory(cascade.data(), cascade.size());
+        if (data)
+        {
+            SimdDetectionInfoFlags flags;
+            SimdDetectionInfo(data, info + 0, info + 1, &flags);
+            info[2] = flags;
+            SimdDetectionFree(data);
+        }
+        memcpy(c.dst[0], info, sizeof(info));
+    }
+
+    void BenchDilate(const Case & c)
+    {
+        SimdDilate(c.src[0], c.stride, c.width, c.height, 15, 15, c.dst[0], c.stride);
+    }
+
+    void BenchEdgeBackgroundAdjustRange(const Case & c)
+    {
+        SimdEdgeBackgroundAdjustRange(c.dst[0], c.stride, c.width, c.height, c.dst[1], c.stride, 1);
+    }
+
+    void BenchEdgeBackgroundAdjustRangeMasked(const Case & c)
+    {
+        SimdEdgeBackgroundAdjustRangeMasked(c.dst[0], c.stride, c.width, c.height, c.dst[1], c.stride, 1, c.src[3], c.stride);
+    }
+
+    void BenchEdgeBackgroundGrowRangeFast(const Case & c)
+    {
+        SimdEdgeBackgroundGrowRangeFast(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchEdgeBackgroundGrowRangeSlow(const Case & c)
+    {
+        SimdEdgeBackgroundGrowRangeSlow(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchEdgeBackgroundIncrementCount(const Case & c)
+    {
+        SimdEdgeBackgroundIncrementCount(c.src[0], c.stride, c.width, c.height, c.src[1], c.stride, c.dst[0], c.stride);
+    }
+
+    void BenchEdgeBackgroundShiftRange(const Case & c)
+    {
+        SimdEdgeBackgroundShiftRange(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchEdgeBackgroundShiftRangeMasked(const Case & c)
+    {
+        SimdEdgeBackgroundShiftRangeMasked(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride, c.src[3], c.stride);
+    }
+
+    void BenchErode(const Case & c)
+    {
+        SimdErode(c.src[0], c.stride, c.width, c.height, 15, 15, c.dst[0], c.stride);
+    }
+
+    void BenchFill(const Case & c)
+    {
+        SimdFill(c.dst[0], c.stride, c.width, c.height, 4, 0x5A);
+    }
+
+    void BenchFillBgr(const Case & c)
+    {
+        SimdFillBgr(c.dst[0], c.stride, c.width, c.height, 0x11, 0x22, 0x33);
+    }
+
+    void BenchFillBgra(const Case & c)
+    {
+        SimdFillBgra(c.dst[0], c.stride, c.width, c.height, 0x11, 0x22, 0x33, 0xFF);
+    }
+
+    void BenchFillFrame(const Case & c)
+    {
+        SimdFillFrame(c.dst[0], c.stride, c.width, c.height, 4, c.width / 4, c.height / 4, c.width - c.width / 4, c.height - c.height / 4, 0x5A);
+    }
+
+    void BenchFilter2D8u(const Case & c)
+    {
+        static const int16_t kernel[25] = {
+            -1, -2, 0, 2, 1,
+            -2, -4, 0, 4, 2,
+            -1, -2, 8, 2, 1,
+            -2, -4, 0, 4, 2,
+            -1, -2, 0, 2, 1 };
+        SimdFilter2D8u(c.src[0], c.stride, c.width, c.height, kernel, 5, 5, 3, 128, c.dst[0], c.stride);
+    }
+
+    void BenchGaussianBlur3x3(const Case & c)
+    {
+        SimdGaussianBlur3x3(c.src[0], c.stride, c.width, c.height, 1, c.dst[0], c.stride);
+    }
+
+    void BenchGaussianBlur(const Case & c)
+    {
+        SimdGaussianBlur(c.src[0], c.stride, c.width, c.height, 1, 2.0f, 0, c.dst[0], c.stride);
+    }
+
+    void BenchGetAbsDxColSums(const Case & c)
+    {
+        SimdGetAbsDxColSums(c.src[0], c.stride, c.width, c.height, (uint32_t*)c.dst[0]);
+    }
+
+    void BenchGetAbsDyRowSums(const Case & c)
+    {
+        SimdGetAbsDyRowSums(c.src[0], c.stride, c.width, c.height, (uint32_t*)c.dst[0]);
+    }
+
+    void BenchGetColSums(const Case & c)
+    {
+        SimdGetColSums(c.src[0], c.stride, c.width, c.height, (uint32_t*)c.dst[0]);
+    }
+
+    void BenchGetMoments(const Case & c)
+    {
+        uint64_t moments[6];
+        SimdGetMoments(c.src[3], c.stride, c.width, c.height, 0xFF, moments + 0, moments + 1, moments + 2, moments + 3, moments + 4, moments + 5);
+        memcpy(c.dst[0], moments, sizeof(moments));
+    }
+
+    void BenchGetRowSums(const Case & c)
+    {
+        SimdGetRowSums(c.src[0], c.stride, c.width, c.height, (uint32_t*)c.dst[0]);
+    }
+
+    void BenchGetStatistic(const Case & c)
+    {
+        uint8_t min, max, average;
+        SimdGetStatistic(c.src[0], c.stride, c.width, c.height, &min, &max, &average);
+        c.dst[0][0] = min, c.dst[0][1] = max, c.dst[0][2] = average;
+    }
+
+    void BenchGrayToBgr(const Case & c)
+    {
+        SimdGrayToBgr(c.src[0], c.width, c.height, c.stride, c.dst[0], c.stride);
+    }
+
+    void BenchGrayToBgra(const Case & c)
+    {
+        SimdGrayToBgra(c.src[0], c.width, c.height, c.stride, c.dst[0], c.stride, 0xFF);
+    }
+
+    void BenchHistogram(const Case & c)
+    {
+        uint32_t histogram[256];
+        SimdHistogram(c.src[0], c.width, c.height, c.stride, histogram);
+        memcpy(c.dst[0], histogram, sizeof(histogram));
+    }
+
+    void BenchHistogramConditional(const Case & c)
+    {
+        uint32_t histogram[256];
+        SimdHistogramConditional(c.src[0], c.stride, c.width, c.height, c.src[1], c.stride, 128, SimdCompareGreater, histogram);
+        memcpy(c.dst[0], histogram, sizeof(histogram));
+    }
+
+    void BenchHistogramMasked(const Case & c)
+    {
+        uint32_t histogram[256];
+        SimdHistogramMasked(c.src[0], c.stride, c.width, c.height, c.src[3], c.stride, 0xFF, histogram);
+        memcpy(c.dst[0], histogram, sizeof(histogram));
+    }
+
+    void BenchInt16ToGray(const Case & c)
+    {
+        SimdInt16ToGray(c.src[0], c.width, c.height, c.stride, c.dst[0], c.stride);
+    }
+
+    void BenchInterferenceDecrement(const Case & c)
+    {
+        SimdInterferenceDecrement(c.dst[0], c.stride, c.width, c.height, 3, -0x7FFF);
+    }
+
+    void BenchInterferenceDecrementMasked(const Case & c)
+    {
+        SimdInterferenceDecrementMasked(c.dst[0], c.stride, c.width, c.height, 3, -0x7FFF, c.src[3], c.stride, 0xFF);
+    }
+
+    void BenchInterferenceIncrement(const Case & c)
+    {
+        SimdInterferenceIncrement(c.dst[0], c.stride, c.width, c.height, 3, 0x7FFF);
+    }
+
+    void BenchInterferenceIncrementMasked(const Case & c)
+    {
+        SimdInterferenceIncrementMasked(c.dst[0], c.stride, c.width, c.height, 3, 0x7FFF, c.src[3], c.stride, 0xFF);
+    }
+
+    void BenchInterleaveBgr(const Case & c)
+    {
+        SimdInterleaveBgr(c.src[0], c.stride, c.src[1], c.stride, c.src[2], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchInterleaveBgra(const Case & c)
+    {
+        SimdInterleaveBgra(c.src[0], c.stride, c.src[1], c.stride, c.src[2], c.stride, c.src[3], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchInterleaveUv(const Case & c)
+    {
+        SimdInterleaveUv(c.src[0], c.stride, c.src[1], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchLaplace(const Case & c)
+    {
+        SimdLaplace(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchLaplaceAbs(const Case & c)
+    {
+        SimdLaplaceAbs(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchLaplaceAbsSum(const Case & c)
+    {
+        uint64_t sum;
+        SimdLaplaceAbsSum(c.src[0], c.stride, c.width, c.height, &sum);
+        memcpy(c.dst[0], &sum, sizeof(sum));
+    }
+
+    void BenchLbpEstimate(const Case & c)
+    {
+        SimdLbpEstimate(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchMeanFilter3x3(const Case & c)
+    {
+        SimdMeanFilter3x3(c.src[0], c.stride, c.width, c.height, 1, c.dst[0], c.stride);
+    }
+
+    void BenchMedianFilter(const Case & c)
+    {
+        SimdMedianFilter(c.src[0], c.stride, c.width, c.height, 1, 7, c.dst[0], c.stride);
+    }
+
+    void BenchMedianFilterRhomb3x3(const Case & c)
+    {
+        SimdMedianFilterRhomb3x3(c.src[0], c.stride, c.width, c.height, 1, c.dst[0], c.stride);
+    }
+
+    void BenchMedianFilterRhomb5x5(const Case & c)
+    {
+        SimdMedianFilterRhomb5x5(c.src[0], c.stride, c.width, c.height, 1, c.dst[0], c.stride);
+    }
+
+    void BenchMedianFilterSquare3x3(const Case & c)
+    {
+        SimdMedianFilterSquare3x3(c.src[0], c.stride, c.width, c.height, 1, c.dst[0], c.stride);
+    }
+
+    void BenchMedianFilterSquare5x5(const Case & c)
+    {
+        SimdMedianFilterSquare5x5(c.src[0], c.stride, c.width, c.height, 1, c.dst[0], c.stride);
+    }
+
+    void BenchMorphology(const Case & c)
+    {
+        SimdMorphology(c.src[0], c.stride, c.width, c.height, SimdMorphologyOpen, SimdMorphologyShapeCross, 7, 7, c.dst[0], c.stride);
+    }
+
+    void BenchMorphologyMasked(const Case & c)
+    {
+        SimdMorphologyMasked(c.src[0], c.stride, c.width, c.height, SimdMorphologyOpen, SimdMorphologyShapeCross, 7, 7, c.src[3], c.stride, 0xFF, c.dst[0], c.stride);
+    }
+
+    void BenchNormalizeHistogram(const Case & c)
+    {
+        SimdNormalizeHistogram(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchNv12ToBgr(const Case & c)
+    {
+        SimdNv12ToBgr(c.src[0], c.stride, c.src[1], c.stride, c.width & ~size_t(1), c.height & ~size_t(1), c.dst[0], c.stride);
+    }
+
+    void BenchNv12ToBgra(const Case & c)
+    {
+        SimdNv12ToBgra(c.src[0], c.stride, c.src[1], c.stride, c.width & ~size_t(1), c.height & ~size_t(1), c.dst[0], c.stride, 0xFF);
+    }
+
+    void BenchOperationBinary16i(const Case & c)
+    {
+        SimdOperationBinary16i(c.src[0], c.stride, c.src[1], c.stride, c.width, c.height, c.dst[0], c.stride, SimdOperationBinary16iAddition);
+    }
+
+    void BenchOperationBinary8u(const Case & c)
+    {
+        SimdOperationBinary8u(c.src[0], c.stride, c.src[1], c.stride, c.width, c.height, 1, c.dst[0], c.stride, SimdOperationBinary8uAverage);
+    }
+
+    void BenchReduceGray2x2(const Case & c)
+    {
+        SimdReduceGray2x2(c.src[0], c.width, c.height, c.stride, c.dst[0], (c.width + 1) / 2, (c.height + 1) / 2, c.stride);
+    }
+
+    void BenchReduceGray3x3(const Case & c)
+    {
+        SimdReduceGray3x3(c.src[0], c.width, c.height, c.stride, c.dst[0], (c.width + 1) / 2, (c.height + 1) / 2, c.stride, 1);
+    }
+
+    void BenchReduceGray4x4(const Case & c)
+    {
+        if (c.width > 2)
+            SimdReduceGray4x4(c.src[0], c.width, c.height, c.stride, c.dst[0], (c.width + 1) / 2, (c.height + 1) / 2, c.stride);
+    }
+
+    void BenchReduceGray5x5(const Case & c)
+    {
+        SimdReduceGray5x5(c.src[0], c.width, c.height, c.stride, c.dst[0], (c.width + 1) / 2, (c.height + 1) / 2, c.stride, 1);
+    }
+
+    void BenchReorder16bit(const Case & c)
+    {
+        SimdReorder16bit(c.src[0], c.width * c.height * 4 / 2 * 2, c.dst[0]);
+    }
+
+    void BenchReorder32bit(const Case & c)
+    {
+        SimdReorder32bit(c.src[0], c.width * c.height * 4 / 4 * 4, c.dst[0]);
+    }
+
+    void BenchReorder64bit(const Case & c)
+    {
+        SimdReorder64bit(c.src[0], c.width * c.height * 4 / 8 * 8, c.dst[0]);
+    }
+
+    void BenchResizeArea(const Case & c)
+    {
+        SimdResizeArea(c.src[0], c.width, c.height, c.stride, c.dst[0], c.width / 2 + 1, c.height / 2 + 1, c.stride, 1);
+    }
+
+    void BenchResizeArea2(const Case & c)
+    {
+        SimdResizeArea(c.src[0], c.width, c.height, c.stride, c.dst[0], c.width / 2 + 1, c.height / 2 + 1, c.stride, 2);
+    }
+
+    void BenchResizeArea3(const Case & c)
+    {
+        SimdResizeArea(c.src[0], c.width, c.height, c.stride, c.dst[0], c.width / 2 + 1, c.height / 2 + 1, c.stride, 3);
+    }
+
+    void BenchResizeArea4(const Case & c)
+    {
+        SimdResizeArea(c.src[0], c.width, c.height, c.stride, c.dst[0], c.width / 2 + 1, c.height / 2 + 1, c.stride, 4);
+    }
+
+    void BenchResizeBicubic(const Case & c)
+    {
+        SimdResizeBicubic(c.src[0], c.width, c.height, c.stride, c.dst[0], c.width / 2 + 1, c.height / 2 + 1, c.stride, 1);
+    }
+
+    void BenchResizeBicubic2(const Case & c)
+    {
+        SimdResizeBicubic(c.src[0], c.width, c.height, c.stride, c.dst[0], c.width / 2 + 1, c.height / 2 + 1, c.stride, 2);
+    }
+
+    void BenchResizeBicubic3(const Case & c)
+    {
+        SimdResizeBicubic(c.src[0], c.width, c.height, c.stride, c.dst[0], c.width / 2 + 1, c.height / 2 + 1, c.stride, 3);
+    }
+
+    void BenchResizeBicubic4(const Case & c)
+    {
+        SimdResizeBicubic(c.src[0], c.width, c.height, c.stride, c.dst[0], c.width / 2 + 1, c.height / 2 + 1, c.stride, 4);
+    }
+
+    void BenchResizeBilinear(const Case & c)
+    {
+        SimdResizeBilinear(c.src[0], c.width, c.height, c.stride, c.dst[0], c.width / 2 + 1, c.height / 2 + 1, c.stride, 1);
+    }
+
+    void BenchResizeBilinear2(const Case & c)
+    {
+        SimdResizeBilinear(c.src[0], c.width, c.height, c.stride, c.dst[0], c.width / 2 + 1, c.height / 2 + 1, c.stride, 2);
+    }
+
+    void BenchResizeBilinear3(const Case & c)
+    {
+        SimdResizeBilinear(c.src[0], c.width, c.height, c.stride, c.dst[0], c.width / 2 + 1, c.height / 2 + 1, c.stride, 3);
+    }
+
+    void BenchResizeBilinear4(const Case & c)
+    {
+        SimdResizeBilinear(c.src[0], c.width, c.height, c.stride, c.dst[0], c.width / 2 + 1, c.height / 2 + 1, c.stride, 4);
+    }
+
+    void BenchSegmentationChangeIndex(const Case & c)
+    {
+        SimdSegmentationChangeIndex(c.dst[0], c.stride, c.width, c.height, 0, 0xFF);
+    }
+
+    void BenchSegmentationFillSingleHoles(const Case & c)
+    {
+        if (c.width > 2 && c.height > 2)
+            SimdSegmentationFillSingleHoles(c.dst[0], c.stride, c.width, c.height, 1);
+    }
+
+    void BenchSegmentationPropagate2x2(const Case & c)
+    {
+        if (c.width >= 4 && c.height >= 4)
+            SimdSegmentationPropagate2x2(c.src[3], c.stride, c.width / 2, c.height / 2, c.dst[0], c.stride, c.src[0], c.stride, 0xFF, 0xFE, 1, 128);
+    }
+
+    void BenchSegmentationShrinkRegion(const Case & c)
+    {
+        ptrdiff_t rect[4] = { 0, 0, (ptrdiff_t)c.width, (ptrdiff_t)c.height };
+        SimdSegmentationShrinkRegion(c.src[3], c.stride, c.width, c.height, 0xFF, rect + 0, rect + 1, rect + 2, rect + 3);
+        memcpy(c.dst[0], rect, sizeof(rect));
+    }
+
+    void BenchShiftBilinear(const Case & c)
+    {
+        const double shiftX = std::min(2.7, c.width - 1.0), shiftY = -std::min(1.3, c.height - 1.0);
+        SimdShiftBilinear(c.src[0], c.stride, c.width, c.height, 1, c.src[1], c.stride, &shiftX, &shiftY, 0, 0, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchSobelDx(const Case & c)
+    {
+        SimdSobelDx(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchSobelDxAbs(const Case & c)
+    {
+        SimdSobelDxAbs(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchSobelDxAbsSum(const Case & c)
+    {
+        uint64_t sum;
+        SimdSobelDxAbsSum(c.src[0], c.stride, c.width, c.height, &sum);
+        memcpy(c.dst[0], &sum, sizeof(sum));
+    }
+
+    void BenchSobelDy(const Case & c)
+    {
+        SimdSobelDy(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchSobelDyAbs(const Case & c)
+    {
+        SimdSobelDyAbs(c.src[0], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchSobelDyAbsSum(const Case & c)
+    {
+        uint64_t sum;
+        SimdSobelDyAbsSum(c.src[0], c.stride, c.width, c.height, &sum);
+        memcpy(c.dst[0], &sum, sizeof(sum));
+    }
+
+    void BenchSquaredDifferenceSum(const Case & c)
+    {
+        uint64_t sum;
+        SimdSquaredDifferenceSum(c.src[0], c.stride, c.src[1], c.stride, c.width, c.height, &sum);
+        memcpy(c.dst[0], &sum, sizeof(sum));
+    }
+
+    void BenchSquaredDifferenceSumMasked(const Case & c)
+    {
+        uint64_t sum;
+        SimdSquaredDifferenceSumMasked(c.src[0], c.stride, c.src[1], c.stride, c.src[3], c.stride, 0xFF, c.width, c.height, &sum);
+        memcpy(c.dst[0], &sum, sizeof(sum));
+    }
+
+    void BenchSquareSum(const Case & c)
+    {
+        uint64_t sum;
+        SimdSquareSum(c.src[0], c.stride, c.width, c.height, &sum);
+        memcpy(c.dst[0], &sum, sizeof(sum));
+    }
+
+    void BenchStretchGray2x2(const Case & c)
+    {
+        SimdStretchGray2x2(c.src[0], c.width, c.height, c.stride, c.dst[0], c.width * 2, c.height * 2, c.width * 2);
+    }
+
+    void BenchTextureBoostedSaturatedGradient(const Case & c)
+    {
+        SimdTextureBoostedSaturatedGradient(c.src[0], c.stride, c.width, c.height, 16, 4, c.dst[0], c.stride, c.dst[1], c.stride);
+    }
+
+    void BenchTextureBoostedUv(const Case & c)
+    {
+        SimdTextureBoostedUv(c.src[0], c.stride, c.width, c.height, 4, c.dst[0], c.stride);
+    }
+
+    void BenchTextureGetDifferenceSum(const Case & c)
+    {
+        int64_t sum;
+        SimdTextureGetDifferenceSum(c.src[0], c.stride, c.width, c.height, c.src[1], c.stride, c.src[2], c.stride, &sum);
+        memcpy(c.dst[0], &sum, sizeof(sum));
+    }
+
+    void BenchTexturePerformCompensation(const Case & c)
+    {
+        SimdTexturePerformCompensation(c.src[0], c.stride, c.width, c.height, -17, c.dst[0], c.stride);
+    }
+
+    void BenchValueSum(const Case & c)
+    {
+        uint64_t sum;
+        SimdValueSum(c.src[0], c.stride, c.width, c.height, &sum);
+        memcpy(c.dst[0], &sum, sizeof(sum));
+    }
+
+    void BenchVectorProduct(const Case & c)
+    {
+        SimdVectorProduct(c.src[0], c.src[1], c.dst[0], c.stride, c.width, c.height);
+    }
+
+    void BenchYuv420pToBgr(const Case & c)
+    {
+        SimdYuv420pToBgr(c.src[0], c.stride, c.src[1], c.stride, c.src[2], c.stride, c.width & ~size_t(1), c.height & ~size_t(1), c.dst[0], c.stride);
+    }
+
+    void BenchYuv420pToBgra(const Case & c)
+    {
+        SimdYuv420pToBgra(c.src[0], c.stride, c.src[1], c.stride, c.src[2], c.stride, c.width & ~size_t(1), c.height & ~size_t(1), c.dst[0], c.stride, 0xFF);
+    }
+
+    void BenchYuv420pToHue(const Case & c)
+    {
+        SimdYuv420pToHue(c.src[0], c.stride, c.src[1], c.stride, c.src[2], c.stride, c.width & ~size_t(1), c.height & ~size_t(1), c.dst[0], c.stride);
+    }
+
+    void BenchYuv422pToBgr(const Case & c)
+    {
+        SimdYuv422pToBgr(c.src[0], c.stride, c.src[1], c.stride, c.src[2], c.stride, c.width & ~size_t(1), c.height, c.dst[0], c.stride);
+    }
+
+    void BenchYuv422pToBgra(const Case & c)
+    {
+        SimdYuv422pToBgra(c.src[0], c.stride, c.src[1], c.stride, c.src[2], c.stride, c.width & ~size_t(1), c.height, c.dst[0], c.stride, 0xFF);
+    }
+
+    void BenchYuv444pToBgr(const Case & c)
+    {
+        SimdYuv444pToBgr(c.src[0], c.stride, c.src[1], c.stride, c.src[2], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchYuv444pToBgra(const Case & c)
+    {
+        SimdYuv444pToBgra(c.src[0], c.stride, c.src[1], c.stride, c.src[2], c.stride, c.width, c.height, c.dst[0], c.stride, 0xFF);
+    }
+
+    void BenchYuv444pToHsl(const Case & c)
+    {
+        SimdYuv444pToHsl(c.src[0], c.stride, c.src[1], c.stride, c.src[2], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+    void BenchYuv444pToHsv(const Case & c)
+    {
+        SimdYuv444pToHsv(c.src[0], c.stride, c.src[1], c.stride, c.src[2], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+    void BenchYuv444pToHue(const Case & c)
+    {
+        SimdYuv444pToHue(c.src[0], c.stride, c.src[1], c.stride, c.src[2], c.stride, c.width, c.height, c.dst[0], c.stride);
+    }
+
+
+    const Entry ENTRIES[] =
+    {
+        BENCHMARK_ENTRY(AbsDifferenceSum, { Output::Scalar, 8 }),
+        BENCHMARK_ENTRY(AbsDifferenceSumMasked, { Output::Scalar, 8 }),
+        BENCHMARK_ENTRY(AbsDifferenceSums3x3, { Output::Scalar, 9 * 8 }),
+        BENCHMARK_ENTRY(AbsDifferenceSums3x3Masked, { Output::Scalar, 9 * 8 }),
+        BENCHMARK_ENTRY(AbsGradientSaturatedSum, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(AbsSecondDerivativeHistogram, { Output::Scalar, 256 * sizeof(uint32_t) }),
+        BENCHMARK_ENTRY(AddFeatureDifference, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(AlphaBlending, { Output::Full, 4 }),
+        BENCHMARK_ENTRY(AveragingBinarization, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(BackgroundAdjustRange, { Output::Full, 1 }, { Output::Full, 1 }, { Output::Full, 1 }, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(BackgroundAdjustRangeMasked, { Output::Full, 1 }, { Output::Full, 1 }, { Output::Full, 1 }, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(BackgroundGrowRangeFast, { Output::Full, 1 }, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(BackgroundGrowRangeSlow, { Output::Full, 1 }, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(BackgroundIncrementCount, { Output::Full, 1 }, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(BackgroundInitMask, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(BackgroundShiftRange, { Output::Full, 1 }, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(BackgroundShiftRangeMasked, { Output::Full, 1 }, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(BayerToBgr, { Output::Even, 3 }),
+        BENCHMARK_ENTRY(BayerToBgra, { Output::Even, 4 }),
+        BENCHMARK_ENTRY(Bgr48pToBgra32, { Output::Full, 4 }),
+        BENCHMARK_ENTRY(BgraToBayer, { Output::Even, 1 }),
+        BENCHMARK_ENTRY(BgraToBgr, { Output::Full, 3 }),
+        BENCHMARK_ENTRY(BgraToGray, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(BgraToYuv420p, { Output::Even, 1 }, { Output::Half, 1 }, { Output::Half, 1 }),
+        BENCHMARK_ENTRY(BgraToYuv422p, { Output::Even, 1 }, { Output::Narrow, 1 }, { Output::Narrow, 1 }),
+        BENCHMARK_ENTRY(BgraToYuv444p, { Output::Full, 1 }, { Output::Full, 1 }, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(BgrToBayer, { Output::Even, 1 }),
+        BENCHMARK_ENTRY(BgrToBgra, { Output::Full, 4 }),
+        BENCHMARK_ENTRY(BgrToGray, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(BgrToHsl, { Output::Full, 3 }),
+        BENCHMARK_ENTRY(BgrToHsv, { Output::Full, 3 }),
+        BENCHMARK_ENTRY(BgrToYuv420p, { Output::Even, 1 }, { Output::Half, 1 }, { Output::Half, 1 }),
+        BENCHMARK_ENTRY(BgrToYuv422p, { Output::Even, 1 }, { Output::Narrow, 1 }, { Output::Narrow, 1 }),
+        BENCHMARK_ENTRY(BgrToYuv444p, { Output::Full, 1 }, { Output::Full, 1 }, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(BilateralFilter, { Output::Full, 1, 1 }),
+        BENCHMARK_ENTRY(BilateralFilterFast, { Output::Full, 3, 1 }),
+        BENCHMARK_ENTRY(Binarization, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(BoxFilter, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(Canny, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(ConditionalCount16i, { Output::Scalar, 4 }),
+        BENCHMARK_ENTRY(ConditionalCount8u, { Output::Scalar, 4 }),
+        BENCHMARK_ENTRY(ConditionalFill, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(ConditionalSquareGradientSum, { Output::Scalar, 8 }),
+        BENCHMARK_ENTRY(ConditionalSquareSum, { Output::Scalar, 8 }),
+        BENCHMARK_ENTRY(ConditionalSum, { Output::Scalar, 8 }),
+        BENCHMARK_ENTRY(ContourAnchors, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(ContourMetrics, { Output::Full, 2 }),
+        BENCHMARK_ENTRY(ContourMetricsMasked, { Output::Full, 2 }),
+        BENCHMARK_ENTRY(Copy, { Output::Full, 4 }),
+        BENCHMARK_ENTRY(CopyFrame, { Output::Full, 4 }),
+        BENCHMARK_ENTRY(CorrelationSum, { Output::Scalar, 8 }),
+        BENCHMARK_ENTRY(Crc32c, { Output::Scalar, 4 }),
+        BENCHMARK_ENTRY(CropResizeBatch, { Output::Scalar, 4 * 3 * 16 * 16 * sizeof(float) }),
+        BENCHMARK_ENTRY(CropResizeBatchUint8, { Output::Scalar, 4 * 3 * 16 * 16 }),
+        BENCHMARK_ENTRY(DeinterleaveBgr, { Output::Full, 1 }, { Output::Full, 1 }, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(DeinterleaveBgra, { Output::Full, 1 }, { Output::Full, 1 }, { Output::Full, 1 }, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(DeinterleaveUv, { Output::Full, 1 }, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(DetectionLoadMemory, { Output::Scalar, 3 * sizeof(size_t) }),
+        BENCHMARK_ENTRY(Dilate, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(EdgeBackgroundAdjustRange, { Output::Full, 1 }, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(EdgeBackgroundAdjustRangeMasked, { Output::Full, 1 }, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(EdgeBackgroundGrowRangeFast, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(EdgeBackgroundGrowRangeSlow, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(EdgeBackgroundIncrementCount, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(EdgeBackgroundShiftRange, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(EdgeBackgroundShiftRangeMasked, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(Erode, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(Fill, { Output::Full, 4 }),
+        BENCHMARK_ENTRY(FillBgr, { Output::Full, 3 }),
+        BENCHMARK_ENTRY(FillBgra, { Output::Full, 4 }),
+        BENCHMARK_ENTRY(FillFrame, { Output::Full, 4 }),
+        BENCHMARK_ENTRY(Filter2D8u, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(GaussianBlur3x3, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(GaussianBlur, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(GetAbsDxColSums, { Output::Row, 4 }),
+        BENCHMARK_ENTRY(GetAbsDyRowSums, { Output::Column, 4 }),
+        BENCHMARK_ENTRY(GetColSums, { Output::Row, 4 }),
+        BENCHMARK_ENTRY(GetMoments, { Output::Scalar, 6 * 8 }),
+        BENCHMARK_ENTRY(GetRowSums, { Output::Column, 4 }),
+        BENCHMARK_ENTRY(GetStatistic, { Output::Scalar, 3 }),
+        BENCHMARK_ENTRY(GrayToBgr, { Output::Full, 3 }),
+        BENCHMARK_ENTRY(GrayToBgra, { Output::Full, 4 }),
+        BENCHMARK_ENTRY(Histogram, { Output::Scalar, 256 * sizeof(uint32_t) }),
+        BENCHMARK_ENTRY(HistogramConditional, { Output::Scalar, 256 * sizeof(uint32_t) }),
+        BENCHMARK_ENTRY(HistogramMasked, { Output::Scalar, 256 * sizeof(uint32_t) }),
+        BENCHMARK_ENTRY(Int16ToGray, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(InterferenceDecrement, { Output::Full, 2 }),
+        BENCHMARK_ENTRY(InterferenceDecrementMasked, { Output::Full, 2 }),
+        BENCHMARK_ENTRY(InterferenceIncrement, { Output::Full, 2 }),
+        BENCHMARK_ENTRY(InterferenceIncrementMasked, { Output::Full, 2 }),
+        BENCHMARK_ENTRY(InterleaveBgr, { Output::Full, 3 }),
+        BENCHMARK_ENTRY(InterleaveBgra, { Output::Full, 4 }),
+        BENCHMARK_ENTRY(InterleaveUv, { Output::Full, 2 }),
+        BENCHMARK_ENTRY(Laplace, { Output::Full, 2 }),
+        BENCHMARK_ENTRY(LaplaceAbs, { Output::Full, 2 }),
+        BENCHMARK_ENTRY(LaplaceAbsSum, { Output::Scalar, 8 }),
+        BENCHMARK_ENTRY(LbpEstimate, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(MeanFilter3x3, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(MedianFilter, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(MedianFilterRhomb3x3, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(MedianFilterRhomb5x5, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(MedianFilterSquare3x3, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(MedianFilterSquare5x5, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(Morphology, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(MorphologyMasked, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(NormalizeHistogram, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(Nv12ToBgr, { Output::Even, 3 }),
+        BENCHMARK_ENTRY(Nv12ToBgra, { Output::Even, 4 }),
+        BENCHMARK_ENTRY(OperationBinary16i, { Output::Full, 2 }),
+        BENCHMARK_ENTRY(OperationBinary8u, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(ReduceGray2x2, { Output::Reduced, 1 }),
+        BENCHMARK_ENTRY(ReduceGray3x3, { Output::Reduced, 1 }),
+        BENCHMARK_ENTRY(ReduceGray4x4, { Output::Reduced, 1 }),
+        BENCHMARK_ENTRY(ReduceGray5x5, { Output::Reduced, 1 }),
+        BENCHMARK_ENTRY(Reorder16bit, { Output::Flat, 4 }),
+        BENCHMARK_ENTRY(Reorder32bit, { Output::Flat, 4 }),
+        BENCHMARK_ENTRY(Reorder64bit, { Output::Flat, 4 }),
+        BENCHMARK_ENTRY(ResizeArea, { Output::Resized, 1, 1 }),
+        BENCHMARK_ENTRY(ResizeArea2, { Output::Resized, 2, 1 }),
+        BENCHMARK_ENTRY(ResizeArea3, { Output::Resized, 3, 1 }),
+        BENCHMARK_ENTRY(ResizeArea4, { Output::Resized, 4, 1 }),
+        BENCHMARK_ENTRY(ResizeBicubic, { Output::Resized, 1, 1 }),
+        BENCHMARK_ENTRY(ResizeBicubic2, { Output::Resized, 2, 1 }),
+        BENCHMARK_ENTRY(ResizeBicubic3, { Output::Resized, 3, 1 }),
+        BENCHMARK_ENTRY(ResizeBicubic4, { Output::Resized, 4, 1 }),
+        BENCHMARK_ENTRY(ResizeBilinear, { Output::Resized, 1 }),
+        BENCHMARK_ENTRY(ResizeBilinear2, { Output::Resized, 2 }),
+        BENCHMARK_ENTRY(ResizeBilinear3, { Output::Resized, 3 }),
+        BENCHMARK_ENTRY(ResizeBilinear4, { Output::Resized, 4 }),
+        BENCHMARK_ENTRY(SegmentationChangeIndex, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(SegmentationFillSingleHoles, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(SegmentationPropagate2x2, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(SegmentationShrinkRegion, { Output::Scalar, 4 * sizeof(ptrdiff_t) }),
+        BENCHMARK_ENTRY(ShiftBilinear, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(SobelDx, { Output::Full, 2 }),
+        BENCHMARK_ENTRY(SobelDxAbs, { Output::Full, 2 }),
+        BENCHMARK_ENTRY(SobelDxAbsSum, { Output::Scalar, 8 }),
+        BENCHMARK_ENTRY(SobelDy, { Output::Full, 2 }),
+        BENCHMARK_ENTRY(SobelDyAbs, { Output::Full, 2 }),
+        BENCHMARK_ENTRY(SobelDyAbsSum, { Output::Scalar, 8 }),
+        BENCHMARK_ENTRY(SquaredDifferenceSum, { Output::Scalar, 8 }),
+        BENCHMARK_ENTRY(SquaredDifferenceSumMasked, { Output::Scalar, 8 }),
+        BENCHMARK_ENTRY(SquareSum, { Output::Scalar, 8 }),
+        BENCHMARK_ENTRY(StretchGray2x2, { Output::Flat, 4 }),
+        BENCHMARK_ENTRY(TextureBoostedSaturatedGradient, { Output::Full, 1 }, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(TextureBoostedUv, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(TextureGetDifferenceSum, { Output::Scalar, 8 }),
+        BENCHMARK_ENTRY(TexturePerformCompensation, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(ValueSum, { Output::Scalar, 8 }),
+        BENCHMARK_ENTRY(VectorProduct, { Output::Full, 1 }),
+        BENCHMARK_ENTRY(Yuv420pToBgr, { Output::Even, 3 }),
+        BENCHMARK_ENTRY(Yuv420pToBgra, { Output::Even, 4 }),
+        BENCHMARK_ENTRY(Yuv420pToHue, { Output::Even, 1 }),
+        BENCHMARK_ENTRY(Yuv422pToBgr, { Output::Even, 3 }),
+        BENCHMARK_ENTRY(Yuv422pToBgra, { Output::Even, 4 }),
+        BENCHMARK_ENTRY(Yuv444pToBgr, { Output::Full, 3 }),
+        BENCHMARK_ENTRY(Yuv444pToBgra, { Output::Full, 4 }),
+        BENCHMARK_ENTRY(Yuv444pToHsl, { Output::Full, 3 }),
+        BENCHMARK_ENTRY(Yuv444pToHsv, { Output::Full, 3 }),
+        BENCHMARK_ENTRY(Yuv444pToHue, { Output::Full, 1 }),
+    };
+
+    struct Result
+    {
+        double seconds, cycles;
+        size_t calls;
+    };
+
+    inline uint64_t Ticks()
+    {
+#ifdef BENCHMARK_RDTSC
+        return __rdtsc();
+#else
+        return 0;
+#endif
+    }
+
+    Result Measure(Function function, const Case & c, double minTime)
+    {
+        function(c);
+        Result result = { 0, 0, 0 };
+        Clock::time_point start = Clock::now();
+        uint64_t ticks = Ticks();
+        do
+        {
+            function(c);
+            result.calls++;
+            result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        } while (result.seconds < minTime);
+        result.cycles = double(Ticks() - ticks);
+        return result;
+    }
+
+    void Run(const Entry & entry, const Case & c, Buffer & output)
+    {
+        output.clear();
+        for (size_t i = 0; i < 4; ++i)
+            memset(c.dst[i], 0, c.size);
+        entry.function(c);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            size_t rowSize, rows;
+            entry.output[i].Size(c, rowSize, rows);
+            for (size_t row = 0; row < rows; ++row)
+                output.insert(output.end(), c.dst[i] + row * c.stride, c.dst[i] + row * c.stride + rowSize);
+        }
+    }
+
+    /* Compares output with control. Allowed difference of every dst[i] is used if exact is false. */
+    bool Compare(const Entry & entry, const Case & c, const char * isa, const char * reference, bool exact, const Buffer & control, const Buffer & output)
+    {
+        size_t errors = 0, plane = 0, first = 0, offset = 0;
+        int maxDifference = 0;
+        for (size_t i = 0; i < 4; ++i)
+        {
+            size_t rowSize, rows;
+            entry.output[i].Size(c, rowSize, rows);
+            for (size_t j = 0; j < rowSize * rows; ++j, ++offset)
+            {
+                int difference = abs(int(control[offset]) - int(output[offset]));
+                if (difference > (exact ? 0 : entry.output[i].error))
+                {
+                    if (errors++ == 0)
+                        plane = i, first = j;
+                    maxDifference = std::max(maxDifference, difference);
+                }
+            }
+        }
+        if (errors)
+        {
+            size_t rowSize, rows;
+            entry.output[plane].Size(c, rowSize, rows);
+            printf("%s %s %zux%zu %s: %zu bytes differ from %s (max difference %d), first in dst[%zu] at row %zu, byte %zu.\n", 
+                entry.name, isa, c.width, c.height, c.aligned ? "aligned" : "unaligned", errors, reference, maxDifference, plane, first / rowSize, first % rowSize);
+        }
+        return errors == 0;
+    }
+
+    struct Options
+    {
+        std::vector<std::pair<size_t, size_t>> sizes;
+        std::string filter;
+        double minTime;
+        size_t threads;
+        bool csv, check;
+
+        Options(int argc, char * argv[])
+            : minTime(0.1), threads(1), csv(false), check(false)
+        {
+            for (int i = 1; i < argc; ++i)
+            {
+                std::string arg = argv[i];
+                size_t w, h;
+                if (arg.find("-s=") == 0 && sscanf(arg.c_str() + 3, "%zux%zu", &w, &h) == 2 && w > 0 && h > 0)
+                    sizes.push_back(std::make_pair(w, h));
+                else if (arg.find("-f=") == 0)
+                    filter = arg.substr(3);
+                else if (arg.find("-t=") == 0)
+                    minTime = atof(arg.c_str() + 3);
+                else if (arg.find("-thr=") == 0)
+                    threads = atoi(arg.c_str() + 5);
+                else if (arg == "-csv")
+                    csv = true;
+                else if (arg == "-check")
+                    check = true;
+                else
+                {
+                    fprintf(stderr, "Unknown option '%s'!\n", argv[i]);
+                    fprintf(stderr, "Usage: %s [-s=WxH]... [-f=filter] [-t=seconds] [-thr=threads] [-csv] [-check]\n", argv[0]);
+                    exit(1);
+                }
+            }
+            if (sizes.empty() && check)
+            {
+                const size_t SIZES[][2] = { { 2, 2 }, { 3, 7 }, { 17, 9 }, { 63, 5 }, { 65, 3 }, { 127, 31 }, { 333, 101 }, { 640, 480 } };
+                for (size_t i = 0; i < sizeof(SIZES) / sizeof(SIZES[0]); ++i)
+                    sizes.push_back(std::make_pair(SIZES[i][0], SIZES[i][1]));
+            }
+            if (sizes.empty())
+            {
+                sizes.push_back(std::make_pair(size_t(320), size_t(240)));
+                sizes.push_back(std::make_pair(size_t(1920), size_t(1080)));
+            }
+        }
+    };
+}
+
+int main(int argc, char * argv[])
+{
+    using namespace Benchmark;
+
+    Options options(argc, argv);
+    SimdSetThreadNumber(options.threads);
+
+    const int info = SimdCpuInfo();
+    std::vector<Level> levels;
+    for (size_t l = 0; l < sizeof(LEVELS) / sizeof(LEVELS[0]); ++l)
+    {
+        if ((info & LEVELS[l].mask) == LEVELS[l].mask && (l == 0 || SimdSetCpuInfoMask(LEVELS[l].mask) != SimdSetCpuInfoMask(levels.back().mask)))
+            levels.push_back(LEVELS[l]);
+    }
+
+    if (options.check)
+    {
+        size_t checked = 0, failed = 0;
+        Buffer control, output, threaded;
+        for (size_t s = 0; s < options.sizes.size(); ++s)
+        {
+            for (int aligned = 1; aligned >= 0; --aligned)
+            {
+                Case c(options.sizes[s].first, options.sizes[s].second, aligned != 0);
+                for (size_t e = 0; e < sizeof(ENTRIES) / sizeof(ENTRIES[0]); ++e)
+                {
+                    if (options.filter.size() && std::string(ENTRIES[e].name).find(options.filter) == std::string::npos)
+                        continue;
+                    SimdSetThreadNumber(1);
+                    SimdSetCpuInfoMask(levels[0].mask);
+                    Run(ENTRIES[e], c, control);
+                    for (size_t l = 0; l < levels.size(); ++l)
+                    {
+                        SimdSetCpuInfoMask(levels[l].mask);
+                        if (l)
+                        {
+                            SimdSetThreadNumber(1);
+                            Run(ENTRIES[e], c, output);
+                            checked++;
+                            if (!Compare(ENTRIES[e], c, levels[l].name, "Base", false, control, output))
+                                failed++;
+                        }
+                        if (options.threads > 1)
+                        {
+                            SimdSetThreadNumber(options.threads);
+                            Run(ENTRIES[e], c, threaded);
+                            checked++;
+                            if (!Compare(ENTRIES[e], c, levels[l].name, "1 thread", true, l ? output : control, threaded))
+                                failed++;
+                        }
+                        fflush(stdout);
+                    }
+                }
+            }
+        }
+        SimdSetCpuInfoMask(-1);
+        SimdSetThreadNumber(options.threads);
+        printf("%zu checks of %zu ISA levels with %zu threads: %zu failed.\n", checked, levels.size() - 1, std::max<size_t>(options.threads, 1), failed);
+        return failed ? 1 : 0;
+    }
+
+    if (options.csv)
+        printf("function,isa,width,height,aligned,calls,us_per_call,mpixel_per_s,cycles_per_pixel\n");
+    else
+        printf("%-32s %-9s %11s %5s %12s %12s %12s\n", "Function", "ISA", "Size", "Align", "us/call", "MPixel/s", "cycles/pixel");
+
+    for (size_t s = 0; s < options.sizes.size(); ++s)
+    {
+        for (int aligned = 1; aligned >= 0; --aligned)
+        {
+            Case c(options.sizes[s].first, options.sizes[s].second, aligned != 0);
+            double pixels = double(c.width*c.height);
+            for (size_t e = 0; e < sizeof(ENTRIES) / sizeof(ENTRIES[0]); ++e)
+            {
+                if (options.filter.size() && std::string(ENTRIES[e].name).find(options.filter) == std::string::npos)
+                    continue;
+                for (size_t l = 0; l < levels.size(); ++l)
+                {
+                    SimdSetCpuInfoMask(levels[l].mask);
+                    Result r = Measure(ENTRIES[e].function, c, options.minTime);
+                    double seconds = r.seconds / r.calls;
+                    double cycles = r.cycles / r.calls / pixels;
+                    if (options.csv)
+                        printf("%s,%s,%zu,%zu,%d,%zu,%.3f,%.1f,%.3f\n", ENTRIES[e].name, levels[l].name, c.width, c.height, 
+                            aligned, r.calls, seconds*1000000.0, pixels / seconds / 1000000.0, cycles);
+                    else
+                        printf("%-32s %-9s %5zux%-5zu %5s %12.3f %12.1f %12.3f\n", ENTRIES[e].name, levels[l].name, c.width, c.height, 
+                            aligned ? "yes" : "no", seconds*1000000.0, pixels / seconds / 1000000.0, cycles);
+                    fflush(stdout);
+                }
+            }
+        }
+    }
+    SimdSetCpuInfoMask(-1);
+    return 0;
+}
@@ -0,0 +1,61 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "SimdLib.h"
+
+#include <cstdio>
+
+/*
+* Converts classifier cascades (OpenCV HAAR or LBP in XML format) into Simd binary cascade format, 
+* which is loaded by SimdDetectionLoadA (and Simd::Detection::Load) without any parsing.
+* Usage: CsmdCascadeConverter input.xml output.bin [input.xml output.bin]...
+*/
+
+int main(int argc, char * argv[])
+{
+    if (argc < 3 || argc % 2 == 0)
+    {
+        printf("Usage: %s input.xml output.bin [input.xml output.bin]...\n", argv[0]);
+        return 1;
+    }
+    int errors = 0;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        void * data = SimdDetectionLoadA(argv[i]);
+        if (data == NULL)
+        {
+            printf("Can't load cascade '%s'!\n", argv[i]);
+            errors++;
+            continue;
+        }
+        if (SimdDetectionSaveA(data, argv[i + 1]))
+            printf("'%s' -> '%s'\n", argv[i], argv[i + 1]);
+        else
+        {
+            printf("Can't save cascade '%s'!\n", argv[i + 1]);
+            errors++;
+        }
+        SimdDetectionFree(data);
+    }
+    return errors ? 1 : 0;
+}
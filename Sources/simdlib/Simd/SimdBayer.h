@@ -0,0 +1,579 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdBayer_h__
+#define __SimdBayer_h__
+
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template <SimdPixelFormatType bayerFormat> SIMD_INLINE void BayerToBgr(const uint8_t * src[6], 
+            size_t col0, size_t col2, size_t col4, uint8_t * dst, size_t stride)
+        {
+            BayerToBgr<bayerFormat>(src, 
+                col0, col0 + 1, col2, col2 + 1, col4, col4 + 1, 
+                dst, dst + 3, dst + stride, dst + stride + 3);
+        }
+
+        template <SimdPixelFormatType bayerFormat> SIMD_INLINE void BayerToBgra(const uint8_t * src[6], 
+            size_t col0, size_t col2, size_t col4, uint8_t * dst0, size_t stride, uint8_t alpha)
+        {
+            uint8_t * dst1 = dst0 + stride;
+            BayerToBgr<bayerFormat>(src, col0, col0 + 1, col2, col2 + 1, col4, col4 + 1, dst0, dst0 + 4, dst1, dst1 + 4);
+            dst0[3] = alpha;
+            dst0[7] = alpha;
+            dst1[3] = alpha;
+            dst1[7] = alpha;
+        }
+
+        SIMD_INLINE void BayerSetRows(const uint8_t * bayer, size_t bayerStride, size_t row, size_t height, const uint8_t * src[6])
+        {
+            src[0] = (row == 0 ? bayer : bayer - 2*bayerStride);
+            src[1] = src[0] + bayerStride;
+            src[2] = bayer;
+            src[3] = src[2] + bayerStride;
+            src[4] = (row == height - 2 ? bayer : bayer + 2*bayerStride);
+            src[5] = src[4] + bayerStride;
+        }
+    }
+
+    /*
+    * Vectorized demosaicing processes a block of two rows and A columns starting from even column col.
+    * Every 16-bit lane holds one 2x2 Bayer cell, so s[row][0..5] are even and odd pixels of the cells 
+    * at col - 2, col and col + 2 (it corresponds to col0..col5 in Base::BayerToBgr). 
+    * The output d[12] contains blue, green and red of the pixels 00, 01, 10 and 11 of every cell.
+    */
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        SIMD_INLINE __m128i Average16(const __m128i & s0, const __m128i & s1)
+        {
+            return _mm_avg_epu16(s0, s1);
+        }
+
+        SIMD_INLINE __m128i Average16(const __m128i & s0, const __m128i & s1, const __m128i & s2, const __m128i & s3)
+        {
+            return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(_mm_add_epi16(s0, s1), _mm_add_epi16(s2, s3)), K16_0002), 2);
+        }
+
+        SIMD_INLINE __m128i BayerToGreen(const __m128i & greenLeft, const __m128i & greenTop, const __m128i & greenRight, const __m128i & greenBottom, 
+            const __m128i & blueOrRedLeft, const __m128i & blueOrRedTop, const __m128i & blueOrRedRight, const __m128i & blueOrRedBottom)
+        {
+            __m128i verticalAbsDifference = AbsDifferenceU8(blueOrRedTop, blueOrRedBottom);
+            __m128i horizontalAbsDifference = AbsDifferenceU8(blueOrRedLeft, blueOrRedRight);
+            __m128i green = Average16(greenLeft, greenTop, greenRight, greenBottom);
+            green = Combine(_mm_cmplt_epi16(verticalAbsDifference, horizontalAbsDifference), Average16(greenTop, greenBottom), green);
+            return Combine(_mm_cmpgt_epi16(verticalAbsDifference, horizontalAbsDifference), Average16(greenRight, greenLeft), green);
+        }
+
+        SIMD_INLINE void LoadBayer(const uint8_t * src, __m128i s[6])
+        {
+            __m128i left = _mm_loadu_si128((__m128i*)(src - 2));
+            __m128i center = _mm_loadu_si128((__m128i*)src);
+            __m128i right = _mm_loadu_si128((__m128i*)(src + 2));
+            s[0] = _mm_and_si128(left, K16_00FF);
+            s[1] = _mm_srli_epi16(left, 8);
+            s[2] = _mm_and_si128(center, K16_00FF);
+            s[3] = _mm_srli_epi16(center, 8);
+            s[4] = _mm_and_si128(right, K16_00FF);
+            s[5] = _mm_srli_epi16(right, 8);
+        }
+
+        SIMD_INLINE void LoadBayer(const uint8_t * src[6], size_t col, __m128i s[6][6])
+        {
+            for (size_t i = 0; i < 6; ++i)
+                LoadBayer(src[i] + col, s[i]);
+        }
+
+        SIMD_INLINE __m128i Merge16(const __m128i & even, const __m128i & odd)
+        {
+            return _mm_or_si128(even, _mm_slli_epi16(odd, 8));
+        }
+
+        template <SimdPixelFormatType bayerFormat> void BayerToBgr(const __m128i s[6][6], __m128i d[12]);
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerGrbg>(const __m128i s[6][6], __m128i d[12])
+        {
+            d[0] = Average16(s[1][2], s[3][2]);
+            d[1] = s[2][2];
+            d[2] = Average16(s[2][1], s[2][3]);
+
+            d[3] = Average16(s[1][2], s[1][4], s[3][2], s[3][4]);
+            d[4] = BayerToGreen(s[2][2], s[1][3], s[2][4], s[3][3], s[2][1], s[0][3], s[2][5], s[4][3]);
+            d[5] = s[2][3];
+
+            d[6] = s[3][2];
+            d[7] = BayerToGreen(s[3][1], s[2][2], s[3][3], s[4][2], s[3][0], s[1][2], s[3][4], s[5][2]);
+            d[8] = Average16(s[2][1], s[2][3], s[4][1], s[4][3]);
+
+            d[9] = Average16(s[3][2], s[3][4]);
+            d[10] = s[3][3];
+            d[11] = Average16(s[2][3], s[4][3]);
+        }
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerGbrg>(const __m128i s[6][6], __m128i d[12])
+        {
+            d[0] = Average16(s[2][1], s[2][3]);
+            d[1] = s[2][2];
+            d[2] = Average16(s[1][2], s[3][2]);
+
+            d[3] = s[2][3];
+            d[4] = BayerToGreen(s[2][2], s[1][3], s[2][4], s[3][3], s[2][1], s[0][3], s[2][5], s[4][3]);
+            d[5] = Average16(s[1][2], s[1][4], s[3][2], s[3][4]);
+
+            d[6] = Average16(s[2][1], s[2][3], s[4][1], s[4][3]);
+            d[7] = BayerToGreen(s[3][1], s[2][2], s[3][3], s[4][2], s[3][0], s[1][2], s[3][4], s[5][2]);
+            d[8] = s[3][2];
+
+            d[9] = Average16(s[2][3], s[4][3]);
+            d[10] = s[3][3];
+            d[11] = Average16(s[3][2], s[3][4]);
+        }
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerRggb>(const __m128i s[6][6], __m128i d[12])
+        {
+            d[0] = Average16(s[1][1], s[1][3], s[3][1], s[3][3]);
+            d[1] = BayerToGreen(s[2][1], s[1][2], s[2][3], s[3][2], s[2][0], s[0][2], s[2][4], s[4][2]);
+            d[2] = s[2][2];
+
+            d[3] = Average16(s[1][3], s[3][3]);
+            d[4] = s[2][3];
+            d[5] = Average16(s[2][2], s[2][4]);
+
+            d[6] = Average16(s[3][1], s[3][3]);
+            d[7] = s[3][2];
+            d[8] = Average16(s[2][2], s[4][2]);
+
+            d[9] = s[3][3];
+            d[10] = BayerToGreen(s[3][2], s[2][3], s[3][4], s[4][3], s[3][1], s[1][3], s[3][5], s[5][3]);
+            d[11] = Average16(s[2][2], s[2][4], s[4][2], s[4][4]);
+        }
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerBggr>(const __m128i s[6][6], __m128i d[12])
+        {
+            d[0] = s[2][2];
+            d[1] = BayerToGreen(s[2][1], s[1][2], s[2][3], s[3][2], s[2][0], s[0][2], s[2][4], s[4][2]);
+            d[2] = Average16(s[1][1], s[1][3], s[3][1], s[3][3]);
+
+            d[3] = Average16(s[2][2], s[2][4]);
+            d[4] = s[2][3];
+            d[5] = Average16(s[1][3], s[3][3]);
+
+            d[6] = Average16(s[2][2], s[4][2]);
+            d[7] = s[3][2];
+            d[8] = Average16(s[3][1], s[3][3]);
+
+            d[9] = Average16(s[2][2], s[2][4], s[4][2], s[4][4]);
+            d[10] = BayerToGreen(s[3][2], s[2][3], s[3][4], s[4][3], s[3][1], s[1][3], s[3][5], s[5][3]);
+            d[11] = s[3][3];
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i Average16(const __m256i & s0, const __m256i & s1)
+        {
+            return _mm256_avg_epu16(s0, s1);
+        }
+
+        SIMD_INLINE __m256i Average16(const __m256i & s0, const __m256i & s1, const __m256i & s2, const __m256i & s3)
+        {
+            return _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(_mm256_add_epi16(s0, s1), _mm256_add_epi16(s2, s3)), K16_0002), 2);
+        }
+
+        SIMD_INLINE __m256i BayerToGreen(const __m256i & greenLeft, const __m256i & greenTop, const __m256i & greenRight, const __m256i & greenBottom, 
+            const __m256i & blueOrRedLeft, const __m256i & blueOrRedTop, const __m256i & blueOrRedRight, const __m256i & blueOrRedBottom)
+        {
+            __m256i verticalAbsDifference = AbsDifferenceU8(blueOrRedTop, blueOrRedBottom);
+            __m256i horizontalAbsDifference = AbsDifferenceU8(blueOrRedLeft, blueOrRedRight);
+            __m256i green = Average16(greenLeft, greenTop, greenRight, greenBottom);
+            green = _mm256_blendv_epi8(green, Average16(greenTop, greenBottom), _mm256_cmpgt_epi16(horizontalAbsDifference, verticalAbsDifference));
+            return _mm256_blendv_epi8(green, Average16(greenRight, greenLeft), _mm256_cmpgt_epi16(verticalAbsDifference, horizontalAbsDifference));
+        }
+
+        SIMD_INLINE void LoadBayer(const uint8_t * src, __m256i s[6])
+        {
+            __m256i left = _mm256_loadu_si256((__m256i*)(src - 2));
+            __m256i center = _mm256_loadu_si256((__m256i*)src);
+            __m256i right = _mm256_loadu_si256((__m256i*)(src + 2));
+            s[0] = _mm256_and_si256(left, K16_00FF);
+            s[1] = _mm256_srli_epi16(left, 8);
+            s[2] = _mm256_and_si256(center, K16_00FF);
+            s[3] = _mm256_srli_epi16(center, 8);
+            s[4] = _mm256_and_si256(right, K16_00FF);
+            s[5] = _mm256_srli_epi16(right, 8);
+        }
+
+        SIMD_INLINE void LoadBayer(const uint8_t * src[6], size_t col, __m256i s[6][6])
+        {
+            for (size_t i = 0; i < 6; ++i)
+                LoadBayer(src[i] + col, s[i]);
+        }
+
+        SIMD_INLINE __m256i Merge16(const __m256i & even, const __m256i & odd)
+        {
+            return _mm256_or_si256(even, _mm256_slli_epi16(odd, 8));
+        }
+
+        template <SimdPixelFormatType bayerFormat> void BayerToBgr(const __m256i s[6][6], __m256i d[12]);
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerGrbg>(const __m256i s[6][6], __m256i d[12])
+        {
+            d[0] = Average16(s[1][2], s[3][2]);
+            d[1] = s[2][2];
+            d[2] = Average16(s[2][1], s[2][3]);
+
+            d[3] = Average16(s[1][2], s[1][4], s[3][2], s[3][4]);
+            d[4] = BayerToGreen(s[2][2], s[1][3], s[2][4], s[3][3], s[2][1], s[0][3], s[2][5], s[4][3]);
+            d[5] = s[2][3];
+
+            d[6] = s[3][2];
+            d[7] = BayerToGreen(s[3][1], s[2][2], s[3][3], s[4][2], s[3][0], s[1][2], s[3][4], s[5][2]);
+            d[8] = Average16(s[2][1], s[2][3], s[4][1], s[4][3]);
+
+            d[9] = Average16(s[3][2], s[3][4]);
+            d[10] = s[3][3];
+            d[11] = Average16(s[2][3], s[4][3]);
+        }
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerGbrg>(const __m256i s[6][6], __m256i d[12])
+        {
+            d[0] = Average16(s[2][1], s[2][3]);
+            d[1] = s[2][2];
+            d[2] = Average16(s[1][2], s[3][2]);
+
+            d[3] = s[2][3];
+            d[4] = BayerToGreen(s[2][2], s[1][3], s[2][4], s[3][3], s[2][1], s[0][3], s[2][5], s[4][3]);
+            d[5] = Average16(s[1][2], s[1][4], s[3][2], s[3][4]);
+
+            d[6] = Average16(s[2][1], s[2][3], s[4][1], s[4][3]);
+            d[7] = BayerToGreen(s[3][1], s[2][2], s[3][3], s[4][2], s[3][0], s[1][2], s[3][4], s[5][2]);
+            d[8] = s[3][2];
+
+            d[9] = Average16(s[2][3], s[4][3]);
+            d[10] = s[3][3];
+            d[11] = Average16(s[3][2], s[3][4]);
+        }
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerRggb>(const __m256i s[6][6], __m256i d[12])
+        {
+            d[0] = Average16(s[1][1], s[1][3], s[3][1], s[3][3]);
+            d[1] = BayerToGreen(s[2][1], s[1][2], s[2][3], s[3][2], s[2][0], s[0][2], s[2][4], s[4][2]);
+            d[2] = s[2][2];
+
+            d[3] = Average16(s[1][3], s[3][3]);
+            d[4] = s[2][3];
+            d[5] = Average16(s[2][2], s[2][4]);
+
+            d[6] = Average16(s[3][1], s[3][3]);
+            d[7] = s[3][2];
+            d[8] = Average16(s[2][2], s[4][2]);
+
+            d[9] = s[3][3];
+            d[10] = BayerToGreen(s[3][2], s[2][3], s[3][4], s[4][3], s[3][1], s[1][3], s[3][5], s[5][3]);
+            d[11] = Average16(s[2][2], s[2][4], s[4][2], s[4][4]);
+        }
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerBggr>(const __m256i s[6][6], __m256i d[12])
+        {
+            d[0] = s[2][2];
+            d[1] = BayerToGreen(s[2][1], s[1][2], s[2][3], s[3][2], s[2][0], s[0][2], s[2][4], s[4][2]);
+            d[2] = Average16(s[1][1], s[1][3], s[3][1], s[3][3]);
+
+            d[3] = Average16(s[2][2], s[2][4]);
+            d[4] = s[2][3];
+            d[5] = Average16(s[1][3], s[3][3]);
+
+            d[6] = Average16(s[2][2], s[4][2]);
+            d[7] = s[3][2];
+            d[8] = Average16(s[3][1], s[3][3]);
+
+            d[9] = Average16(s[2][2], s[2][4], s[4][2], s[4][4]);
+            d[10] = BayerToGreen(s[3][2], s[2][3], s[3][4], s[4][3], s[3][1], s[1][3], s[3][5], s[5][3]);
+            d[11] = s[3][3];
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512i Average16(const __m512i & s0, const __m512i & s1)
+        {
+            return _mm512_avg_epu16(s0, s1);
+        }
+
+        SIMD_INLINE __m512i Average16(const __m512i & s0, const __m512i & s1, const __m512i & s2, const __m512i & s3)
+        {
+            return _mm512_srli_epi16(_mm512_add_epi16(_mm512_add_epi16(_mm512_add_epi16(s0, s1), _mm512_add_epi16(s2, s3)), K16_0002), 2);
+        }
+
+        SIMD_INLINE __m512i BayerToGreen(const __m512i & greenLeft, const __m512i & greenTop, const __m512i & greenRight, const __m512i & greenBottom, 
+            const __m512i & blueOrRedLeft, const __m512i & blueOrRedTop, const __m512i & blueOrRedRight, const __m512i & blueOrRedBottom)
+        {
+            __m512i verticalAbsDifference = AbsDifferenceU8(blueOrRedTop, blueOrRedBottom);
+            __m512i horizontalAbsDifference = AbsDifferenceU8(blueOrRedLeft, blueOrRedRight);
+            __m512i green = Average16(greenLeft, greenTop, greenRight, greenBottom);
+            green = _mm512_mask_blend_epi16(_mm512_cmplt_epu16_mask(verticalAbsDifference, horizontalAbsDifference), green, Average16(greenTop, greenBottom));
+            return _mm512_mask_blend_epi16(_mm512_cmpgt_epu16_mask(verticalAbsDifference, horizontalAbsDifference), green, Average16(greenRight, greenLeft));
+        }
+
+        SIMD_INLINE void LoadBayer(const uint8_t * src, __m512i s[6])
+        {
+            __m512i left = _mm512_loadu_si512(src - 2);
+            __m512i center = _mm512_loadu_si512(src);
+            __m512i right = _mm512_loadu_si512(src + 2);
+            s[0] = _mm512_and_si512(left, K16_00FF);
+            s[1] = _mm512_srli_epi16(left, 8);
+            s[2] = _mm512_and_si512(center, K16_00FF);
+            s[3] = _mm512_srli_epi16(center, 8);
+            s[4] = _mm512_and_si512(right, K16_00FF);
+            s[5] = _mm512_srli_epi16(right, 8);
+        }
+
+        SIMD_INLINE void LoadBayer(const uint8_t * src[6], size_t col, __m512i s[6][6])
+        {
+            for (size_t i = 0; i < 6; ++i)
+                LoadBayer(src[i] + col, s[i]);
+        }
+
+        SIMD_INLINE __m512i Merge16(const __m512i & even, const __m512i & odd)
+        {
+            return _mm512_or_si512(even, _mm512_slli_epi16(odd, 8));
+        }
+
+        template <SimdPixelFormatType bayerFormat> void BayerToBgr(const __m512i s[6][6], __m512i d[12]);
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerGrbg>(const __m512i s[6][6], __m512i d[12])
+        {
+            d[0] = Average16(s[1][2], s[3][2]);
+            d[1] = s[2][2];
+            d[2] = Average16(s[2][1], s[2][3]);
+
+            d[3] = Average16(s[1][2], s[1][4], s[3][2], s[3][4]);
+            d[4] = BayerToGreen(s[2][2], s[1][3], s[2][4], s[3][3], s[2][1], s[0][3], s[2][5], s[4][3]);
+            d[5] = s[2][3];
+
+            d[6] = s[3][2];
+            d[7] = BayerToGreen(s[3][1], s[2][2], s[3][3], s[4][2], s[3][0], s[1][2], s[3][4], s[5][2]);
+            d[8] = Average16(s[2][1], s[2][3], s[4][1], s[4][3]);
+
+            d[9] = Average16(s[3][2], s[3][4]);
+            d[10] = s[3][3];
+            d[11] = Average16(s[2][3], s[4][3]);
+        }
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerGbrg>(const __m512i s[6][6], __m512i d[12])
+        {
+            d[0] = Average16(s[2][1], s[2][3]);
+            d[1] = s[2][2];
+            d[2] = Average16(s[1][2], s[3][2]);
+
+            d[3] = s[2][3];
+            d[4] = BayerToGreen(s[2][2], s[1][3], s[2][4], s[3][3], s[2][1], s[0][3], s[2][5], s[4][3]);
+            d[5] = Average16(s[1][2], s[1][4], s[3][2], s[3][4]);
+
+            d[6] = Average16(s[2][1], s[2][3], s[4][1], s[4][3]);
+            d[7] = BayerToGreen(s[3][1], s[2][2], s[3][3], s[4][2], s[3][0], s[1][2], s[3][4], s[5][2]);
+            d[8] = s[3][2];
+
+            d[9] = Average16(s[2][3], s[4][3]);
+            d[10] = s[3][3];
+            d[11] = Average16(s[3][2], s[3][4]);
+        }
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerRggb>(const __m512i s[6][6], __m512i d[12])
+        {
+            d[0] = Average16(s[1][1], s[1][3], s[3][1], s[3][3]);
+            d[1] = BayerToGreen(s[2][1], s[1][2], s[2][3], s[3][2], s[2][0], s[0][2], s[2][4], s[4][2]);
+            d[2] = s[2][2];
+
+            d[3] = Average16(s[1][3], s[3][3]);
+            d[4] = s[2][3];
+            d[5] = Average16(s[2][2], s[2][4]);
+
+            d[6] = Average16(s[3][1], s[3][3]);
+            d[7] = s[3][2];
+            d[8] = Average16(s[2][2], s[4][2]);
+
+            d[9] = s[3][3];
+            d[10] = BayerToGreen(s[3][2], s[2][3], s[3][4], s[4][3], s[3][1], s[1][3], s[3][5], s[5][3]);
+            d[11] = Average16(s[2][2], s[2][4], s[4][2], s[4][4]);
+        }
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerBggr>(const __m512i s[6][6], __m512i d[12])
+        {
+            d[0] = s[2][2];
+            d[1] = BayerToGreen(s[2][1], s[1][2], s[2][3], s[3][2], s[2][0], s[0][2], s[2][4], s[4][2]);
+            d[2] = Average16(s[1][1], s[1][3], s[3][1], s[3][3]);
+
+            d[3] = Average16(s[2][2], s[2][4]);
+            d[4] = s[2][3];
+            d[5] = Average16(s[1][3], s[3][3]);
+
+            d[6] = Average16(s[2][2], s[4][2]);
+            d[7] = s[3][2];
+            d[8] = Average16(s[3][1], s[3][3]);
+
+            d[9] = Average16(s[2][2], s[2][4], s[4][2], s[4][4]);
+            d[10] = BayerToGreen(s[3][2], s[2][3], s[3][4], s[4][3], s[3][1], s[1][3], s[3][5], s[5][3]);
+            d[11] = s[3][3];
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        SIMD_INLINE uint16x8_t Average16(const uint16x8_t & s0, const uint16x8_t & s1)
+        {
+            return vrhaddq_u16(s0, s1);
+        }
+
+        SIMD_INLINE uint16x8_t Average16(const uint16x8_t & s0, const uint16x8_t & s1, const uint16x8_t & s2, const uint16x8_t & s3)
+        {
+            return vrshrq_n_u16(vaddq_u16(vaddq_u16(s0, s1), vaddq_u16(s2, s3)), 2);
+        }
+
+        SIMD_INLINE uint16x8_t BayerToGreen(const uint16x8_t & greenLeft, const uint16x8_t & greenTop, const uint16x8_t & greenRight, const uint16x8_t & greenBottom, 
+            const uint16x8_t & blueOrRedLeft, const uint16x8_t & blueOrRedTop, const uint16x8_t & blueOrRedRight, const uint16x8_t & blueOrRedBottom)
+        {
+            uint16x8_t verticalAbsDifference = vabdq_u16(blueOrRedTop, blueOrRedBottom);
+            uint16x8_t horizontalAbsDifference = vabdq_u16(blueOrRedLeft, blueOrRedRight);
+            uint16x8_t green = Average16(greenLeft, greenTop, greenRight, greenBottom);
+            green = vbslq_u16(vcltq_u16(verticalAbsDifference, horizontalAbsDifference), Average16(greenTop, greenBottom), green);
+            return vbslq_u16(vcgtq_u16(verticalAbsDifference, horizontalAbsDifference), Average16(greenRight, greenLeft), green);
+        }
+
+        SIMD_INLINE void LoadBayer(const uint8_t * src, uint16x8_t s[6])
+        {
+            uint16x8_t left = vreinterpretq_u16_u8(vld1q_u8(src - 2));
+            uint16x8_t center = vreinterpretq_u16_u8(vld1q_u8(src));
+            uint16x8_t right = vreinterpretq_u16_u8(vld1q_u8(src + 2));
+            s[0] = vandq_u16(left, K16_00FF);
+            s[1] = vshrq_n_u16(left, 8);
+            s[2] = vandq_u16(center, K16_00FF);
+            s[3] = vshrq_n_u16(center, 8);
+            s[4] = vandq_u16(right, K16_00FF);
+            s[5] = vshrq_n_u16(right, 8);
+        }
+
+        SIMD_INLINE void LoadBayer(const uint8_t * src[6], size_t col, uint16x8_t s[6][6])
+        {
+            for (size_t i = 0; i < 6; ++i)
+                LoadBayer(src[i] + col, s[i]);
+        }
+
+        SIMD_INLINE uint8x16_t Merge16(const uint16x8_t & even, const uint16x8_t & odd)
+        {
+            return vreinterpretq_u8_u16(vorrq_u16(even, vshlq_n_u16(odd, 8)));
+        }
+
+        template <SimdPixelFormatType bayerFormat> void BayerToBgr(const uint16x8_t s[6][6], uint16x8_t d[12]);
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerGrbg>(const uint16x8_t s[6][6], uint16x8_t d[12])
+        {
+            d[0] = Average16(s[1][2], s[3][2]);
+            d[1] = s[2][2];
+            d[2] = Average16(s[2][1], s[2][3]);
+
+            d[3] = Average16(s[1][2], s[1][4], s[3][2], s[3][4]);
+            d[4] = BayerToGreen(s[2][2], s[1][3], s[2][4], s[3][3], s[2][1], s[0][3], s[2][5], s[4][3]);
+            d[5] = s[2][3];
+
+            d[6] = s[3][2];
+            d[7] = BayerToGreen(s[3][1], s[2][2], s[3][3], s[4][2], s[3][0], s[1][2], s[3][4], s[5][2]);
+            d[8] = Average16(s[2][1], s[2][3], s[4][1], s[4][3]);
+
+            d[9] = Average16(s[3][2], s[3][4]);
+            d[10] = s[3][3];
+            d[11] = Average16(s[2][3], s[4][3]);
+        }
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerGbrg>(const uint16x8_t s[6][6], uint16x8_t d[12])
+        {
+            d[0] = Average16(s[2][1], s[2][3]);
+            d[1] = s[2][2];
+            d[2] = Average16(s[1][2], s[3][2]);
+
+            d[3] = s[2][3];
+            d[4] = BayerToGreen(s[2][2], s[1][3], s[2][4], s[3][3], s[2][1], s[0][3], s[2][5], s[4][3]);
+            d[5] = Average16(s[1][2], s[1][4], s[3][2], s[3][4]);
+
+            d[6] = Average16(s[2][1], s[2][3], s[4][1], s[4][3]);
+            d[7] = BayerToGreen(s[3][1], s[2][2], s[3][3], s[4][2], s[3][0], s[1][2], s[3][4], s[5][2]);
+            d[8] = s[3][2];
+
+            d[9] = Average16(s[2][3], s[4][3]);
+            d[10] = s[3][3];
+            d[11] = Average16(s[3][2], s[3][4]);
+        }
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerRggb>(const uint16x8_t s[6][6], uint16x8_t d[12])
+        {
+            d[0] = Average16(s[1][1], s[1][3], s[3][1], s[3][3]);
+            d[1] = BayerToGreen(s[2][1], s[1][2], s[2][3], s[3][2], s[2][0], s[0][2], s[2][4], s[4][2]);
+            d[2] = s[2][2];
+
+            d[3] = Average16(s[1][3], s[3][3]);
+            d[4] = s[2][3];
+            d[5] = Average16(s[2][2], s[2][4]);
+
+            d[6] = Average16(s[3][1], s[3][3]);
+            d[7] = s[3][2];
+            d[8] = Average16(s[2][2], s[4][2]);
+
+            d[9] = s[3][3];
+            d[10] = BayerToGreen(s[3][2], s[2][3], s[3][4], s[4][3], s[3][1], s[1][3], s[3][5], s[5][3]);
+            d[11] = Average16(s[2][2], s[2][4], s[4][2], s[4][4]);
+        }
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerBggr>(const uint16x8_t s[6][6], uint16x8_t d[12])
+        {
+            d[0] = s[2][2];
+            d[1] = BayerToGreen(s[2][1], s[1][2], s[2][3], s[3][2], s[2][0], s[0][2], s[2][4], s[4][2]);
+            d[2] = Average16(s[1][1], s[1][3], s[3][1], s[3][3]);
+
+            d[3] = Average16(s[2][2], s[2][4]);
+            d[4] = s[2][3];
+            d[5] = Average16(s[1][3], s[3][3]);
+
+            d[6] = Average16(s[2][2], s[4][2]);
+            d[7] = s[3][2];
+            d[8] = Average16(s[3][1], s[3][3]);
+
+            d[9] = Average16(s[2][2], s[2][4], s[4][2], s[4][4]);
+            d[10] = BayerToGreen(s[3][2], s[2][3], s[3][4], s[4][3], s[3][1], s[1][3], s[3][5], s[5][3]);
+            d[11] = s[3][3];
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
+
+#endif//__SimdBayer_h__
@@ -0,0 +1,74 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdBilateralFilter_h__
+#define __SimdBilateralFilter_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        /*
+            Bilateral filter: dst[p] = sum(src[q]*S(|p - q|)*R(|src[p] - src[q]|))/sum(S(|p - q|)*R(|src[p] - src[q]|)),
+            where S and R are Gaussian functions with sigmaSpace and sigmaRange. The range distance between two pixels 
+            is the sum of absolute differences of their channels, R is tabulated for all possible distances (256*channelCount values).
+        
+            Exact mode sums over circular window of given radius. The source rows are kept in a ring buffer as planar rows 
+            with replicated borders, so SIMD versions load neighbors of BILATERAL_FILTER_BLOCK_MAX pixels by one load 
+            and gather range weights from the table.
+
+            Fast mode is the recursive bilateral filter (Q. Yang, 2012): causal and anticausal first order recursive filters 
+            are applied to rows and then to columns, the feedback coefficient is alpha*R(distance between neighboring pixels). 
+            The intermediate values and the normalization factor are stored as float planes. Only the result of causal vertical pass 
+            is kept for whole image: anticausal pass restores inv*horizontal[y] as causal[y] - weight[y]*causal[y - 1]. 
+            Its cost does not depend on sigmaSpace.
+        */
+        const size_t BILATERAL_FILTER_BLOCK_MAX = 16;
+
+        struct BilateralFilterTap
+        {
+            int row, col;
+            float weight;
+        };
+
+        // Exact mode, one output row: rows[c*(2*radius + 1) + k] is channel c of source row y + k - radius (planar, with borders).
+        typedef void(*BilateralFilterExactPtr)(const uint8_t * const * rows, size_t channelCount, size_t radius, 
+            const BilateralFilterTap * taps, size_t tapCount, const float * range, size_t width, uint8_t * dst);
+
+        // Fast mode, one step of recursion for all planes (dst may be equal to prev): dst[p*stride + i] = src[p*stride + i]*inv + prev[p*stride + i]*weight[i].
+        typedef void(*BilateralFilterRecursivePtr)(const float * src, const float * prev, const float * weight, 
+            size_t width, size_t planes, size_t stride, float inv, float * dst);
+
+        size_t BilateralFilterRadius(float sigmaSpace, size_t radius);
+
+        void BilateralFilterExactRun(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, 
+            float sigmaSpace, float sigmaRange, size_t radius, uint8_t * dst, size_t dstStride, BilateralFilterExactPtr exact);
+
+        void BilateralFilterFastRun(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+            float sigmaSpace, float sigmaRange, uint8_t * dst, size_t dstStride, BilateralFilterRecursivePtr recursive);
+    }
+}
+#endif//__SimdBilateralFilter_h__
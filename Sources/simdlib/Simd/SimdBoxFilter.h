@@ -0,0 +1,51 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdBoxFilter_h__
+#define __SimdBoxFilter_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        /*
+            Box filter with running sums: 16-bit column sums of windowY rows are updated by adding of the new 
+            row and subtraction of the old one, the row sums of windowX column sums are updated by the same way. 
+            So the cost of the filtration does not depend on window size. Window size must be odd and not greater than 255.
+        */
+        const size_t BOX_FILTER_WINDOW_MAX = 255;
+
+        // Column update: cols[i] += add[i] - sub[i].
+        typedef void(*BoxFilterColPtr)(const uint8_t * add, const uint8_t * sub, size_t size, uint16_t * cols);
+
+        // Normalization: dst[i] = Round(sums[i]*scale).
+        typedef void(*BoxFilterNormPtr)(const uint32_t * sums, size_t size, float scale, uint8_t * dst);
+
+        void BoxFilterRun(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t windowX, size_t windowY,
+            uint8_t * dst, size_t dstStride, BoxFilterColPtr colUpdate, BoxFilterNormPtr normalize);
+    }
+}
+#endif//__SimdBoxFilter_h__
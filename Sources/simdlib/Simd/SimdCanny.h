@@ -0,0 +1,70 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdCanny_h__
+#define __SimdCanny_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        /*
+            Canny edge detector consists of two stages. 
+
+            The first stage streams the source image row by row: Sobel gradients and L1 magnitude (|dx| + |dy|) of the next row
+            are calculated into ring buffers, then the current row passes non-maximum suppression and double thresholding.
+            The direction of gradient is quantized into 4 sectors (tan(22.5) is approximated by 12/29, so all calculations fit into 16-bit).
+            The output of this stage is a label image: 0 - no edge, CANNY_WEAK - weak edge, CANNY_STRONG - strong edge.
+            This stage depends only on neighboring rows (radius 2), so it can be processed in parallel by stripes.
+
+            The second stage (hysteresis) marks all strong edges and weak edges connected to them by CANNY_EDGE with using of flood fill. 
+            The search of seeds (strong edges) is vectorized. If the image is processed by stripes then the edges crossing 
+            stripe boundaries are restored afterwards by CannyHysteresisSeam.
+        */
+        const uint8_t CANNY_WEAK = 1;
+        const uint8_t CANNY_STRONG = 2;
+        const uint8_t CANNY_EDGE = 0xFF;
+
+        // Gradients of one row: src0, src1, src2 are the previous, current and next source rows with replicated border (src[-1] and src[width] are valid).
+        typedef void(*CannyGradientPtr)(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t width, int16_t * dx, int16_t * dy, int16_t * mag);
+
+        // Non-maximum suppression and double threshold of one row: mag0, mag1, mag2 are the magnitudes of the previous, current and next rows 
+        // (mag[-1] and mag[width] are valid and equal to zero).
+        typedef void(*CannySuppressPtr)(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2, 
+            size_t width, int16_t low, int16_t high, uint8_t * dst);
+
+        // Returns position of the first CANNY_STRONG label in row[begin, width) or width if it is absent.
+        typedef size_t(*CannyFindPtr)(const uint8_t * row, size_t begin, size_t width);
+
+        void CannyNmsRun(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t low, uint16_t high, 
+            uint8_t * dst, size_t dstStride, CannyGradientPtr gradient, CannySuppressPtr suppress);
+
+        void CannyHysteresisRun(uint8_t * dst, size_t dstStride, size_t width, size_t height, CannyFindPtr find);
+
+        void CannyHysteresisSeam(uint8_t * dst, size_t dstStride, size_t width, size_t height, size_t row);
+    }
+}
+#endif//__SimdCanny_h__
@@ -56,6 +56,8 @@
 
 #define SIMD_LOG_ENABLE
 
+//#define SIMD_PERFORMANCE_STATISTIC
+
 #define SIMD_ALLOCATE_ASSERT
 
 #define SIMD_NEON_RCP_ITER -1
@@ -523,6 +523,87 @@ namespace Simd
                 BgrToV16(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)), 
                 BgrToV16(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
         }
+
+        template <bool align> SIMD_INLINE void LoadUv(const uint8_t * uv, __m128i & u, __m128i & v)
+        {
+            __m128i uv0 = Load<align>((__m128i*)uv + 0);
+            __m128i uv1 = Load<align>((__m128i*)uv + 1);
+            u = _mm_packus_epi16(_mm_and_si128(uv0, K16_00FF), _mm_and_si128(uv1, K16_00FF));
+            v = _mm_packus_epi16(_mm_srli_epi16(uv0, 8), _mm_srli_epi16(uv1, 8));
+        }
+
+        SIMD_INLINE __m128i HueMulDiv32(__m128i dividend, __m128i divisor, const __m128 & KF_255_DIV_6)
+        {
+            return _mm_cvttps_epi32(_mm_div_ps(_mm_mul_ps(KF_255_DIV_6, _mm_cvtepi32_ps(dividend)), _mm_cvtepi32_ps(divisor)));
+        }
+
+        SIMD_INLINE __m128i DivideU16(__m128i dividend, __m128i divisor)
+        {
+            __m128 lo = _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(dividend, K_ZERO)), _mm_cvtepi32_ps(_mm_unpacklo_epi16(divisor, K_ZERO)));
+            __m128 hi = _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(dividend, K_ZERO)), _mm_cvtepi32_ps(_mm_unpackhi_epi16(divisor, K_ZERO)));
+            return _mm_packs_epi32(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi));
+        }
+
+        SIMD_INLINE __m128i BgrToHue16(__m128i blue, __m128i green, __m128i red, __m128i max, __m128i range, const __m128 & KF_255_DIV_6)
+        {
+            const __m128i redMaxMask = _mm_cmpeq_epi16(red, max);
+            const __m128i greenMaxMask = _mm_andnot_si128(redMaxMask, _mm_cmpeq_epi16(green, max));
+            const __m128i blueMaxMask = _mm_andnot_si128(redMaxMask, _mm_andnot_si128(greenMaxMask, K_INV_ZERO));
+
+            const __m128i redMaxCase = _mm_and_si128(redMaxMask, 
+                _mm_add_epi16(_mm_sub_epi16(green, blue), _mm_mullo_epi16(range, K16_0006))); 
+            const __m128i greenMaxCase = _mm_and_si128(greenMaxMask, 
+                _mm_add_epi16(_mm_sub_epi16(blue, red), _mm_mullo_epi16(range, K16_0002))); 
+            const __m128i blueMaxCase = _mm_and_si128(blueMaxMask, 
+                _mm_add_epi16(_mm_sub_epi16(red, green), _mm_mullo_epi16(range, K16_0004))); 
+
+            const __m128i dividend = _mm_or_si128(_mm_or_si128(redMaxCase, greenMaxCase), blueMaxCase);
+            const __m128i hue = _mm_packs_epi32(
+                HueMulDiv32(_mm_unpacklo_epi16(dividend, K_ZERO), _mm_unpacklo_epi16(range, K_ZERO), KF_255_DIV_6), 
+                HueMulDiv32(_mm_unpackhi_epi16(dividend, K_ZERO), _mm_unpackhi_epi16(range, K_ZERO), KF_255_DIV_6));
+            return _mm_andnot_si128(_mm_cmpeq_epi16(range, K_ZERO), _mm_and_si128(hue, K16_00FF));
+        }
+
+        SIMD_INLINE void BgrToHsv16(__m128i blue, __m128i green, __m128i red, const __m128 & KF_255_DIV_6, __m128i & hue, __m128i & saturation, __m128i & value)
+        {
+            const __m128i max = _mm_max_epi16(red, _mm_max_epi16(green, blue));
+            const __m128i range = _mm_sub_epi16(max, _mm_min_epi16(red, _mm_min_epi16(green, blue)));
+            hue = BgrToHue16(blue, green, red, max, range, KF_255_DIV_6);
+            saturation = _mm_andnot_si128(_mm_cmpeq_epi16(range, K_ZERO), DivideU16(_mm_mullo_epi16(range, K16_00FF), max));
+            value = max;
+        }
+
+        SIMD_INLINE void BgrToHsv(__m128i blue, __m128i green, __m128i red, const __m128 & KF_255_DIV_6, __m128i & hue, __m128i & saturation, __m128i & value)
+        {
+            __m128i h[2], s[2], v[2];
+            BgrToHsv16(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red), KF_255_DIV_6, h[0], s[0], v[0]);
+            BgrToHsv16(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red), KF_255_DIV_6, h[1], s[1], v[1]);
+            hue = _mm_packus_epi16(h[0], h[1]);
+            saturation = _mm_packus_epi16(s[0], s[1]);
+            value = _mm_packus_epi16(v[0], v[1]);
+        }
+
+        SIMD_INLINE void BgrToHsl16(__m128i blue, __m128i green, __m128i red, const __m128 & KF_255_DIV_6, __m128i & hue, __m128i & saturation, __m128i & lightness)
+        {
+            const __m128i max = _mm_max_epi16(red, _mm_max_epi16(green, blue));
+            const __m128i min = _mm_min_epi16(red, _mm_min_epi16(green, blue));
+            const __m128i range = _mm_sub_epi16(max, min);
+            const __m128i sum = _mm_add_epi16(max, min);
+            const __m128i divisor = _mm_min_epi16(sum, _mm_add_epi16(_mm_sub_epi16(K16_00FF, max), _mm_sub_epi16(K16_00FF, min)));
+            hue = BgrToHue16(blue, green, red, max, range, KF_255_DIV_6);
+            saturation = _mm_andnot_si128(_mm_cmpeq_epi16(range, K_ZERO), DivideU16(_mm_mullo_epi16(range, K16_00FF), divisor));
+            lightness = _mm_srli_epi16(sum, 1);
+        }
+
+        SIMD_INLINE void BgrToHsl(__m128i blue, __m128i green, __m128i red, const __m128 & KF_255_DIV_6, __m128i & hue, __m128i & saturation, __m128i & lightness)
+        {
+            __m128i h[2], s[2], l[2];
+            BgrToHsl16(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red), KF_255_DIV_6, h[0], s[0], l[0]);
+            BgrToHsl16(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red), KF_255_DIV_6, h[1], s[1], l[1]);
+            hue = _mm_packus_epi16(h[0], h[1]);
+            saturation = _mm_packus_epi16(s[0], s[1]);
+            lightness = _mm_packus_epi16(l[0], l[1]);
+        }
     }
 #endif// SIMD_SSE2_ENABLE
 
@@ -812,6 +893,88 @@ namespace Simd
         {
             return _mm256_or_si256(_mm256_shuffle_epi8(_mm256_permute4x64_epi64(bgr, 0xE9), K8_BGRA_TO_BGR_SHUFFLE), alpha);
         }
+
+        /* U and V are returned in the same lane order as LoadPermuted gives for planar Yuv420p. */
+        template <bool align> SIMD_INLINE void LoadUv(const uint8_t * uv, __m256i & u, __m256i & v)
+        {
+            __m256i uv0 = Load<align>((__m256i*)uv + 0);
+            __m256i uv1 = Load<align>((__m256i*)uv + 1);
+            u = _mm256_packus_epi16(_mm256_and_si256(uv0, K16_00FF), _mm256_and_si256(uv1, K16_00FF));
+            v = _mm256_packus_epi16(_mm256_srli_epi16(uv0, 8), _mm256_srli_epi16(uv1, 8));
+        }
+
+        SIMD_INLINE __m256i HueMulDiv32(__m256i dividend, __m256i divisor, const __m256 & KF_255_DIV_6)
+        {
+            return _mm256_cvttps_epi32(_mm256_div_ps(_mm256_mul_ps(KF_255_DIV_6, _mm256_cvtepi32_ps(dividend)), _mm256_cvtepi32_ps(divisor)));
+        }
+
+        SIMD_INLINE __m256i DivideU16(__m256i dividend, __m256i divisor)
+        {
+            __m256 lo = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_unpacklo_epi16(dividend, K_ZERO)), _mm256_cvtepi32_ps(_mm256_unpacklo_epi16(divisor, K_ZERO)));
+            __m256 hi = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_unpackhi_epi16(dividend, K_ZERO)), _mm256_cvtepi32_ps(_mm256_unpackhi_epi16(divisor, K_ZERO)));
+            return _mm256_packs_epi32(_mm256_cvttps_epi32(lo), _mm256_cvttps_epi32(hi));
+        }
+
+        SIMD_INLINE __m256i BgrToHue16(__m256i blue, __m256i green, __m256i red, __m256i max, __m256i range, const __m256 & KF_255_DIV_6)
+        {
+            const __m256i redMaxMask = _mm256_cmpeq_epi16(red, max);
+            const __m256i greenMaxMask = _mm256_andnot_si256(redMaxMask, _mm256_cmpeq_epi16(green, max));
+            const __m256i blueMaxMask = _mm256_andnot_si256(redMaxMask, _mm256_andnot_si256(greenMaxMask, K_INV_ZERO));
+
+            const __m256i redMaxCase = _mm256_and_si256(redMaxMask, 
+                _mm256_add_epi16(_mm256_sub_epi16(green, blue), _mm256_mullo_epi16(range, K16_0006))); 
+            const __m256i greenMaxCase = _mm256_and_si256(greenMaxMask, 
+                _mm256_add_epi16(_mm256_sub_epi16(blue, red), _mm256_mullo_epi16(range, K16_0002))); 
+            const __m256i blueMaxCase = _mm256_and_si256(blueMaxMask, 
+                _mm256_add_epi16(_mm256_sub_epi16(red, green), _mm256_mullo_epi16(range, K16_0004))); 
+
+            const __m256i dividend = _mm256_or_si256(_mm256_or_si256(redMaxCase, greenMaxCase), blueMaxCase);
+            const __m256i hue = _mm256_packs_epi32(
+                HueMulDiv32(_mm256_unpacklo_epi16(dividend, K_ZERO), _mm256_unpacklo_epi16(range, K_ZERO), KF_255_DIV_6), 
+                HueMulDiv32(_mm256_unpackhi_epi16(dividend, K_ZERO), _mm256_unpackhi_epi16(range, K_ZERO), KF_255_DIV_6));
+            return _mm256_andnot_si256(_mm256_cmpeq_epi16(range, K_ZERO), _mm256_and_si256(hue, K16_00FF));
+        }
+
+        SIMD_INLINE void BgrToHsv16(__m256i blue, __m256i green, __m256i red, const __m256 & KF_255_DIV_6, __m256i & hue, __m256i & saturation, __m256i & value)
+        {
+            const __m256i max = _mm256_max_epi16(red, _mm256_max_epi16(green, blue));
+            const __m256i range = _mm256_sub_epi16(max, _mm256_min_epi16(red, _mm256_min_epi16(green, blue)));
+            hue = BgrToHue16(blue, green, red, max, range, KF_255_DIV_6);
+            saturation = _mm256_andnot_si256(_mm256_cmpeq_epi16(range, K_ZERO), DivideU16(_mm256_mullo_epi16(range, K16_00FF), max));
+            value = max;
+        }
+
+        SIMD_INLINE void BgrToHsv(__m256i blue, __m256i green, __m256i red, const __m256 & KF_255_DIV_6, __m256i & hue, __m256i & saturation, __m256i & value)
+        {
+            __m256i h[2], s[2], v[2];
+            BgrToHsv16(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red), KF_255_DIV_6, h[0], s[0], v[0]);
+            BgrToHsv16(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red), KF_255_DIV_6, h[1], s[1], v[1]);
+            hue = _mm256_packus_epi16(h[0], h[1]);
+            saturation = _mm256_packus_epi16(s[0], s[1]);
+            value = _mm256_packus_epi16(v[0], v[1]);
+        }
+
+        SIMD_INLINE void BgrToHsl16(__m256i blue, __m256i green, __m256i red, const __m256 & KF_255_DIV_6, __m256i & hue, __m256i & saturation, __m256i & lightness)
+        {
+            const __m256i max = _mm256_max_epi16(red, _mm256_max_epi16(green, blue));
+            const __m256i min = _mm256_min_epi16(red, _mm256_min_epi16(green, blue));
+            const __m256i range = _mm256_sub_epi16(max, min);
+            const __m256i sum = _mm256_add_epi16(max, min);
+            const __m256i divisor = _mm256_min_epi16(sum, _mm256_add_epi16(_mm256_sub_epi16(K16_00FF, max), _mm256_sub_epi16(K16_00FF, min)));
+            hue = BgrToHue16(blue, green, red, max, range, KF_255_DIV_6);
+            saturation = _mm256_andnot_si256(_mm256_cmpeq_epi16(range, K_ZERO), DivideU16(_mm256_mullo_epi16(range, K16_00FF), divisor));
+            lightness = _mm256_srli_epi16(sum, 1);
+        }
+
+        SIMD_INLINE void BgrToHsl(__m256i blue, __m256i green, __m256i red, const __m256 & KF_255_DIV_6, __m256i & hue, __m256i & saturation, __m256i & lightness)
+        {
+            __m256i h[2], s[2], l[2];
+            BgrToHsl16(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red), KF_255_DIV_6, h[0], s[0], l[0]);
+            BgrToHsl16(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red), KF_255_DIV_6, h[1], s[1], l[1]);
+            hue = _mm256_packus_epi16(h[0], h[1]);
+            saturation = _mm256_packus_epi16(s[0], s[1]);
+            lightness = _mm256_packus_epi16(l[0], l[1]);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 
@@ -937,6 +1100,17 @@ namespace Simd
 				_mm512_madd_epi16(g16_1, K16_GV_RT)), Base::BGR_TO_YUV_AVERAGING_SHIFT);
 		}
 
+		SIMD_INLINE void DeinterleaveBgr(const __m512i & bgr0, const __m512i & bgr1, const __m512i & bgr2, __m512i & blue, __m512i & green, __m512i & red)
+		{
+			const __m512i sp0 = _mm512_shuffle_epi8(_mm512_permutexvar_epi32(K32_PERMUTE_BGR_TO_BGRA_0, bgr0), K8_SHUFFLE_DEINTERLEAVE_BGR);
+			const __m512i sp1 = _mm512_shuffle_epi8(_mm512_permutex2var_epi32(bgr0, K32_PERMUTE_BGR_TO_BGRA_1, bgr1), K8_SHUFFLE_DEINTERLEAVE_BGR);
+			const __m512i sp2 = _mm512_shuffle_epi8(_mm512_permutex2var_epi32(bgr1, K32_PERMUTE_BGR_TO_BGRA_2, bgr2), K8_SHUFFLE_DEINTERLEAVE_BGR);
+			const __m512i sp3 = _mm512_shuffle_epi8(_mm512_permutexvar_epi32(K32_PERMUTE_BGR_TO_BGRA_3, bgr2), K8_SHUFFLE_DEINTERLEAVE_BGR);
+			blue = _mm512_or_si512(_mm512_permutex2var_epi32(sp0, K32_PERMUTE_BGR_B0, sp1), _mm512_permutex2var_epi32(sp2, K32_PERMUTE_BGR_B1, sp3));
+			green = _mm512_or_si512(_mm512_permutex2var_epi32(sp0, K32_PERMUTE_BGR_G0, sp1), _mm512_permutex2var_epi32(sp2, K32_PERMUTE_BGR_G1, sp3));
+			red = _mm512_or_si512(_mm512_permutex2var_epi32(sp0, K32_PERMUTE_BGR_R0, sp1), _mm512_permutex2var_epi32(sp2, K32_PERMUTE_BGR_R1, sp3));
+		}
+
 		template <int index> __m512i InterleaveBgr(__m512i blue, __m512i green, __m512i red);
 
 		template<> SIMD_INLINE __m512i InterleaveBgr<0>(__m512i blue, __m512i green, __m512i red)
@@ -962,6 +1136,81 @@ namespace Simd
 				_mm512_or_si512(_mm512_shuffle_epi8(_mm512_permutexvar_epi32(K32_PERMUTE_COLOR_TO_BGR2, green), K8_SHUFFLE_GREEN_TO_BGR2),
 				_mm512_shuffle_epi8(_mm512_permutexvar_epi32(K32_PERMUTE_COLOR_TO_BGR2, red), K8_SHUFFLE_RED_TO_BGR2)));
 		}
+
+		/* U and V are returned in the same order as K64_PERMUTE_FOR_UNPACK gives for planar Yuv420p. */
+		template <bool align, bool mask> SIMD_INLINE void LoadUv(const uint8_t * uv, const __mmask64 * tails, __m512i & u, __m512i & v)
+		{
+			__m512i uv0 = Load<align, mask>(uv + 0, tails[0]);
+			__m512i uv1 = Load<align, mask>(uv + A, tails[1]);
+			u = _mm512_packus_epi16(_mm512_and_si512(uv0, K16_00FF), _mm512_and_si512(uv1, K16_00FF));
+			v = _mm512_packus_epi16(_mm512_srli_epi16(uv0, 8), _mm512_srli_epi16(uv1, 8));
+		}
+
+		SIMD_INLINE __m512i HueMulDiv32(__m512i dividend, __m512i divisor, const __m512 & KF_255_DIV_6)
+		{
+			return _mm512_cvttps_epi32(_mm512_div_ps(_mm512_mul_ps(KF_255_DIV_6, _mm512_cvtepi32_ps(dividend)), _mm512_cvtepi32_ps(divisor)));
+		}
+
+		SIMD_INLINE __m512i DivideU16(__m512i dividend, __m512i divisor)
+		{
+			__m512 lo = _mm512_div_ps(_mm512_cvtepi32_ps(_mm512_unpacklo_epi16(dividend, K_ZERO)), _mm512_cvtepi32_ps(_mm512_unpacklo_epi16(divisor, K_ZERO)));
+			__m512 hi = _mm512_div_ps(_mm512_cvtepi32_ps(_mm512_unpackhi_epi16(dividend, K_ZERO)), _mm512_cvtepi32_ps(_mm512_unpackhi_epi16(divisor, K_ZERO)));
+			return _mm512_packs_epi32(_mm512_cvttps_epi32(lo), _mm512_cvttps_epi32(hi));
+		}
+
+		SIMD_INLINE __m512i BgrToHue16(__m512i blue, __m512i green, __m512i red, __m512i max, __m512i range, const __m512 & KF_255_DIV_6)
+		{
+			__m512i dividend = _mm512_add_epi16(_mm512_sub_epi16(red, green), _mm512_mullo_epi16(range, K16_0004));
+			dividend = _mm512_mask_blend_epi16(_mm512_cmpeq_epi16_mask(green, max), dividend, 
+				_mm512_add_epi16(_mm512_sub_epi16(blue, red), _mm512_mullo_epi16(range, K16_0002)));
+			dividend = _mm512_mask_blend_epi16(_mm512_cmpeq_epi16_mask(red, max), dividend, 
+				_mm512_add_epi16(_mm512_sub_epi16(green, blue), _mm512_mullo_epi16(range, K16_0006)));
+			const __m512i hue = _mm512_packs_epi32(
+				HueMulDiv32(_mm512_unpacklo_epi16(dividend, K_ZERO), _mm512_unpacklo_epi16(range, K_ZERO), KF_255_DIV_6),
+				HueMulDiv32(_mm512_unpackhi_epi16(dividend, K_ZERO), _mm512_unpackhi_epi16(range, K_ZERO), KF_255_DIV_6));
+			return _mm512_maskz_mov_epi16(_mm512_cmpneq_epi16_mask(range, K_ZERO), _mm512_and_si512(hue, K16_00FF));
+		}
+
+		SIMD_INLINE void BgrToHsv16(__m512i blue, __m512i green, __m512i red, const __m512 & KF_255_DIV_6, __m512i & hue, __m512i & saturation, __m512i & value)
+		{
+			const __m512i max = _mm512_max_epi16(red, _mm512_max_epi16(green, blue));
+			const __m512i range = _mm512_sub_epi16(max, _mm512_min_epi16(red, _mm512_min_epi16(green, blue)));
+			hue = BgrToHue16(blue, green, red, max, range, KF_255_DIV_6);
+			saturation = _mm512_maskz_mov_epi16(_mm512_cmpneq_epi16_mask(range, K_ZERO), DivideU16(_mm512_mullo_epi16(range, K16_00FF), max));
+			value = max;
+		}
+
+		SIMD_INLINE void BgrToHsv(__m512i blue, __m512i green, __m512i red, const __m512 & KF_255_DIV_6, __m512i & hue, __m512i & saturation, __m512i & value)
+		{
+			__m512i h[2], s[2], v[2];
+			BgrToHsv16(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red), KF_255_DIV_6, h[0], s[0], v[0]);
+			BgrToHsv16(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red), KF_255_DIV_6, h[1], s[1], v[1]);
+			hue = _mm512_packus_epi16(h[0], h[1]);
+			saturation = _mm512_packus_epi16(s[0], s[1]);
+			value = _mm512_packus_epi16(v[0], v[1]);
+		}
+
+		SIMD_INLINE void BgrToHsl16(__m512i blue, __m512i green, __m512i red, const __m512 & KF_255_DIV_6, __m512i & hue, __m512i & saturation, __m512i & lightness)
+		{
+			const __m512i max = _mm512_max_epi16(red, _mm512_max_epi16(green, blue));
+			const __m512i min = _mm512_min_epi16(red, _mm512_min_epi16(green, blue));
+			const __m512i range = _mm512_sub_epi16(max, min);
+			const __m512i sum = _mm512_add_epi16(max, min);
+			const __m512i divisor = _mm512_min_epi16(sum, _mm512_add_epi16(_mm512_sub_epi16(K16_00FF, max), _mm512_sub_epi16(K16_00FF, min)));
+			hue = BgrToHue16(blue, green, red, max, range, KF_255_DIV_6);
+			saturation = _mm512_maskz_mov_epi16(_mm512_cmpneq_epi16_mask(range, K_ZERO), DivideU16(_mm512_mullo_epi16(range, K16_00FF), divisor));
+			lightness = _mm512_srli_epi16(sum, 1);
+		}
+
+		SIMD_INLINE void BgrToHsl(__m512i blue, __m512i green, __m512i red, const __m512 & KF_255_DIV_6, __m512i & hue, __m512i & saturation, __m512i & lightness)
+		{
+			__m512i h[2], s[2], l[2];
+			BgrToHsl16(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red), KF_255_DIV_6, h[0], s[0], l[0]);
+			BgrToHsl16(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red), KF_255_DIV_6, h[1], s[1], l[1]);
+			hue = _mm512_packus_epi16(h[0], h[1]);
+			saturation = _mm512_packus_epi16(s[0], s[1]);
+			lightness = _mm512_packus_epi16(l[0], l[1]);
+		}
 	}
 #endif//SIMD_AVX512BW_ENABLE 
 
@@ -1261,6 +1510,72 @@ namespace Simd
 			bgr.val[1] = PackSaturatedI16(YuvToGreen(yLo, uLo, vLo), YuvToGreen(yHi, uHi, vHi));
 			bgr.val[2] = PackSaturatedI16(YuvToRed(yLo, vLo), YuvToRed(yHi, vHi));
 		}
+
+		SIMD_INLINE int32x4_t HueMulDiv(const int32x4_t & dividend, const int32x4_t & divisor, const float32x4_t & KF_255_DIV_6)
+		{
+			return vcvtq_s32_f32(Div<SIMD_NEON_RCP_ITER>(vmulq_f32(KF_255_DIV_6, vcvtq_f32_s32(dividend)), vcvtq_f32_s32(divisor)));
+		}
+
+		SIMD_INLINE int16x8_t DivideI16(const int16x8_t & dividend, const int16x8_t & divisor)
+		{
+			float32x4_t lo = Div<SIMD_NEON_RCP_ITER>(vcvtq_f32_u32(UnpackU16<0>((uint16x8_t)dividend)), vcvtq_f32_u32(UnpackU16<0>((uint16x8_t)divisor)));
+			float32x4_t hi = Div<SIMD_NEON_RCP_ITER>(vcvtq_f32_u32(UnpackU16<1>((uint16x8_t)dividend)), vcvtq_f32_u32(UnpackU16<1>((uint16x8_t)divisor)));
+			return PackI32(vcvtq_s32_f32(lo), vcvtq_s32_f32(hi));
+		}
+
+		SIMD_INLINE int16x8_t BgrToHue(const int16x8_t & blue, const int16x8_t & green, const int16x8_t & red, const int16x8_t & max, const int16x8_t & range, const float32x4_t & KF_255_DIV_6)
+		{
+			int16x8_t dividend = vaddq_s16(vsubq_s16(red, green), vmulq_s16(range, (int16x8_t)K16_0004));
+			dividend = vbslq_s16(vceqq_s16(green, max), vaddq_s16(vsubq_s16(blue, red), vmulq_s16(range, (int16x8_t)K16_0002)), dividend);
+			dividend = vbslq_s16(vceqq_s16(red, max), vaddq_s16(vsubq_s16(green, blue), vmulq_s16(range, (int16x8_t)K16_0006)), dividend);
+			int16x8_t hue = PackI32(HueMulDiv(UnpackI16<0>(dividend), UnpackI16<0>(range), KF_255_DIV_6), HueMulDiv(UnpackI16<1>(dividend), UnpackI16<1>(range), KF_255_DIV_6));
+			return vbslq_s16(vceqq_s16(range, (int16x8_t)K16_0000), (int16x8_t)K16_0000, vandq_s16(hue, (int16x8_t)K16_00FF));
+		}
+
+		SIMD_INLINE void BgrToHsv(const int16x8_t & blue, const int16x8_t & green, const int16x8_t & red, const float32x4_t & KF_255_DIV_6, int16x8_t & hue, int16x8_t & saturation, int16x8_t & value)
+		{
+			int16x8_t max = vmaxq_s16(blue, vmaxq_s16(green, red));
+			int16x8_t range = vsubq_s16(max, vminq_s16(blue, vminq_s16(green, red)));
+			hue = BgrToHue(blue, green, red, max, range, KF_255_DIV_6);
+			saturation = vbslq_s16(vceqq_s16(range, (int16x8_t)K16_0000), (int16x8_t)K16_0000, DivideI16(vmulq_s16(range, (int16x8_t)K16_00FF), max));
+			value = max;
+		}
+
+		SIMD_INLINE uint8x16x3_t BgrToHsv(const uint8x16_t & blue, const uint8x16_t & green, const uint8x16_t & red, const float32x4_t & KF_255_DIV_6)
+		{
+			int16x8_t h[2], s[2], v[2];
+			BgrToHsv((int16x8_t)UnpackU8<0>(blue), (int16x8_t)UnpackU8<0>(green), (int16x8_t)UnpackU8<0>(red), KF_255_DIV_6, h[0], s[0], v[0]);
+			BgrToHsv((int16x8_t)UnpackU8<1>(blue), (int16x8_t)UnpackU8<1>(green), (int16x8_t)UnpackU8<1>(red), KF_255_DIV_6, h[1], s[1], v[1]);
+			uint8x16x3_t hsv;
+			hsv.val[0] = PackU16((uint16x8_t)h[0], (uint16x8_t)h[1]);
+			hsv.val[1] = PackU16((uint16x8_t)s[0], (uint16x8_t)s[1]);
+			hsv.val[2] = PackU16((uint16x8_t)v[0], (uint16x8_t)v[1]);
+			return hsv;
+		}
+
+		SIMD_INLINE void BgrToHsl(const int16x8_t & blue, const int16x8_t & green, const int16x8_t & red, const float32x4_t & KF_255_DIV_6, int16x8_t & hue, int16x8_t & saturation, int16x8_t & lightness)
+		{
+			int16x8_t max = vmaxq_s16(blue, vmaxq_s16(green, red));
+			int16x8_t min = vminq_s16(blue, vminq_s16(green, red));
+			int16x8_t range = vsubq_s16(max, min);
+			int16x8_t sum = vaddq_s16(max, min);
+			int16x8_t divisor = vminq_s16(sum, vaddq_s16(vsubq_s16((int16x8_t)K16_00FF, max), vsubq_s16((int16x8_t)K16_00FF, min)));
+			hue = BgrToHue(blue, green, red, max, range, KF_255_DIV_6);
+			saturation = vbslq_s16(vceqq_s16(range, (int16x8_t)K16_0000), (int16x8_t)K16_0000, DivideI16(vmulq_s16(range, (int16x8_t)K16_00FF), divisor));
+			lightness = vshrq_n_s16(sum, 1);
+		}
+
+		SIMD_INLINE uint8x16x3_t BgrToHsl(const uint8x16_t & blue, const uint8x16_t & green, const uint8x16_t & red, const float32x4_t & KF_255_DIV_6)
+		{
+			int16x8_t h[2], s[2], l[2];
+			BgrToHsl((int16x8_t)UnpackU8<0>(blue), (int16x8_t)UnpackU8<0>(green), (int16x8_t)UnpackU8<0>(red), KF_255_DIV_6, h[0], s[0], l[0]);
+			BgrToHsl((int16x8_t)UnpackU8<1>(blue), (int16x8_t)UnpackU8<1>(green), (int16x8_t)UnpackU8<1>(red), KF_255_DIV_6, h[1], s[1], l[1]);
+			uint8x16x3_t hsl;
+			hsl.val[0] = PackU16((uint16x8_t)h[0], (uint16x8_t)h[1]);
+			hsl.val[1] = PackU16((uint16x8_t)s[0], (uint16x8_t)s[1]);
+			hsl.val[2] = PackU16((uint16x8_t)l[0], (uint16x8_t)l[1]);
+			return hsl;
+		}
 	}
 #endif// SIMD_NEON_ENABLE
 }
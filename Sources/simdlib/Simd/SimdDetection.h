@@ -110,6 +110,8 @@ namespace Simd
             std::vector<HaarFeature> haarFeatures;
             std::vector<LbpFeature> lbpFeatures;
 
+            Data() : isStumpBased(true), hasTilted(false), canInt16(false), stageType(0), ncategories(0) {}
+
             virtual ~Data() {}
         };
 
@@ -323,6 +325,8 @@ namespace Simd
         template<class TWeight, class TSum> inline int Detect(const HidLbpCascade<TWeight, TSum> & hid, size_t offset, int startStage)
         {
             typedef HidLbpCascade<TWeight, TSum> Hid;
+            if (startStage >= (int)hid.stages.size())
+                return 1;
 
             size_t subsetSize = (hid.ncategories + 31) / 32;
             const int * subsets = hid.subsets.data();
@@ -26,6 +26,7 @@
 
 #include "SimdLib.hpp"
 #include "SimdParallel.hpp"
+#include "SimdFrame.hpp"
 
 #include <vector>
 #include <map>
@@ -142,6 +143,7 @@ namespace Simd
 	{
 		typedef A<uint8_t> Allocator; /*!< Allocator type definition. */
         typedef Simd::View<A> View; /*!< An image type definition. */
+        typedef Simd::Frame<A> Frame; /*!< A frame type definition. */
         typedef Simd::Point<ptrdiff_t> Size; /*!< An image size type definition. */
         typedef std::vector<Size> Sizes; /*!< A vector of image sizes type definition. */
         typedef Simd::Rectangle<ptrdiff_t> Rect; /*!< A rectangle type definition. */
@@ -206,7 +208,7 @@ namespace Simd
         }
 
         /*!
-            Loads from file classifier cascade. Supports OpenCV HAAR and LBP cascades type.
+            Loads from file classifier cascade. Supports OpenCV HAAR and LBP cascades type and Simd binary cascade format.
             You can call this function more than once if you want to use several object detectors at the same time.
 
             \note Tree based cascades and old cascade formats are not supported!
@@ -217,16 +219,21 @@ namespace Simd
         */
         bool Load(const std::string & path, Tag tag = UNDEFINED_OBJECT_TAG)
         {
-            Handle handle = ::SimdDetectionLoadA(path.c_str());
-            if (handle)
-            {
-                Data data;
-                data.handle = handle;
-                data.tag = tag;
-                ::SimdDetectionInfo(handle, (size_t*)&data.size.x, (size_t*)&data.size.y, &data.flags);
-                _data.push_back(data);
-            }
-            return handle != NULL;
+            return Add(::SimdDetectionLoadA(path.c_str()), tag);
+        }
+
+        /*!
+            Loads from memory buffer classifier cascade (in XML or Simd binary format). 
+            You can call this function more than once if you want to use several object detectors at the same time.
+
+            \param [in] buffer - a pointer to the buffer with cascade (for example a memory mapped file).
+            \param [in] size - a size of the buffer.
+            \param [in] tag - an user defined tag. This tag will be inserted in output Object structure.
+            \return a result of this operation.
+        */
+        bool LoadMemory(const void * buffer, size_t size, Tag tag = UNDEFINED_OBJECT_TAG)
+        {
+            return Add(::SimdDetectionLoadMemory(buffer, size), tag);
         }
 
         /*!
@@ -250,7 +257,12 @@ namespace Simd
             _imageSize = imageSize;
             ptrdiff_t threadNumberMax = std::thread::hardware_concurrency();
             _threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
-            return InitLevels(scaleFactor, sizeMin, sizeMax, roi);
+            _scaleFactor = scaleFactor;
+            _sizeMin = sizeMin;
+            _sizeMax = sizeMax;
+            _workers.clear();
+            _workers.push_back(WorkerPtr(new Worker()));
+            return InitLevels(*_workers[0], roi);
         }
 
         /*!
@@ -268,40 +280,82 @@ namespace Simd
         bool Detect(const View & src, Objects & objects, int groupSizeMin = 3, double sizeDifferenceMax = 0.2,
             bool motionMask = false, const Rects & motionRegions = Rects())
         {
-            if (_levels.empty() || src.Size() != _imageSize)
+            SIMD_CHECK_PERFORMANCE();
+
+            if (_workers.empty() || src.Size() != _imageSize)
                 return false;
 
-            FillLevels(src);
+            Worker & worker = *_workers[0];
+            FillLevels(worker, src, motionMask, motionRegions, _threadNumber);
+            RunJobs(worker, _threadNumber);
+            GetObjects(worker, objects, groupSizeMin, sizeDifferenceMax);
 
-            typedef std::map<Tag, Objects> Candidates;
-            Candidates candidates;
+            return true;
+        }
 
-            for (size_t i = 0; i < _levels.size(); ++i)
-            {
-                Level & level = *_levels[i];
-                View mask = level.roi;
-                Rect rect = level.rect;
-                if (motionMask)
-                {
-                    FillMotionMask(motionRegions, level, rect);
-                    mask = level.mask;
-                }
-                if (rect.Empty())
-                    continue;
-                for (size_t j = 0; j < level.hids.size(); ++j)
-                {
-                    Hid & hid = level.hids[j];
+        /*!
+            Detects objects at given frame.
 
-                    hid.Detect(mask, rect, level.dst, _threadNumber, level.throughColumn);
+            Gray frames and Y planes of NV12 and YUV420P frames are used by the detector in place without any conversion 
+            and copying. BGR and BGRA frames are converted to gray directly into the first scaled image. 
 
-                    AddObjects(candidates[hid.data->tag], level.dst, rect, hid.data->size, level.scale,
-                        level.throughColumn ? 2 : 1, hid.data->tag);
-                }
-            }
+            \param [in] frame - a input frame.
+            \param [out] objects - detected objects.
+            \param [in] groupSizeMin - a minimal weight (number of elementary detections) of detected image. 
+            \param [in] sizeDifferenceMax - a parameter to group elementary detections.
+            \param [in] motionMask - an using of motion detection flag. Useful for dynamical restriction of detection region to addition to ROI.
+            \param [in] motionRegions - a set of rectangles (motion regions) to restrict detection region to addition to ROI.
+                                        The regions affect to the center of detected object.
+            \return a result of this operation.
+        */
+        bool Detect(const Frame & frame, Objects & objects, int groupSizeMin = 3, double sizeDifferenceMax = 0.2,
+            bool motionMask = false, const Rects & motionRegions = Rects())
+        {
+            if (frame.format == Frame::None)
+                return false;
+            return Detect(frame.planes[0], objects, groupSizeMin, sizeDifferenceMax, motionMask, motionRegions);
+        }
 
-            objects.clear();
-            for (typename Candidates::iterator it = candidates.begin(); it != candidates.end(); ++it)
-                GroupObjects(objects, it->second, groupSizeMin, sizeDifferenceMax);
+        /*!
+            Detects objects at batch of images. 
+
+            All images must have the same size (which was passed to Detection::Init). The images are distributed between 
+            threads: every thread has its own set of scaled images and integrals (they are created at first call), 
+            so the levels and cascades are initialized once for all frames of the batch. It is useful for many small 
+            video streams, when parallelization of one frame is not effective.
+
+            \param [in] srcs - a batch of input images.
+            \param [out] objects - detected objects (for every image of the batch).
+            \param [in] groupSizeMin - a minimal weight (number of elementary detections) of detected image. 
+            \param [in] sizeDifferenceMax - a parameter to group elementary detections.
+            \return a result of this operation.
+        */
+        bool Detect(const std::vector<View> & srcs, std::vector<Objects> & objects, int groupSizeMin = 3, double sizeDifferenceMax = 0.2)
+        {
+            SIMD_CHECK_PERFORMANCE();
+
+            if (_workers.empty())
+                return false;
+            for (size_t i = 0; i < srcs.size(); ++i)
+                if (srcs[i].Size() != _imageSize)
+                    return false;
+
+            objects.resize(srcs.size());
+            size_t threadNumber = std::min<size_t>(_threadNumber, srcs.size());
+            size_t frameThreadNumber = std::max<size_t>(_threadNumber / std::max<size_t>(threadNumber, 1), 1);
+            if (!InitWorkers(threadNumber))
+                return false;
+
+            Parallel(0, srcs.size(), [&](size_t thread, size_t begin, size_t end)
+            {
+                Worker & worker = *_workers[thread];
+                for (size_t i = begin; i < end; ++i)
+                {
+                    FillLevels(worker, srcs[i], false, Rects(), frameThreadNumber);
+                    RunJobs(worker, frameThreadNumber);
+                    GetObjects(worker, objects[i], groupSizeMin, sizeDifferenceMax);
+                }
+            }, threadNumber);
 
             return true;
         }
@@ -325,32 +379,43 @@ namespace Simd
         typedef void(*DetectPtr)(const void * hid, const uint8_t * mask, size_t maskStride,
             ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
-        struct Worker;
-        typedef std::shared_ptr<Worker> WorkerPtr;
-        typedef std::vector<WorkerPtr> WorkerPtrs;
-
         struct Hid
         {
             Handle handle;
             Data * data;
             DetectPtr detect;
 
-            void Detect(const View & mask, const Rect & rect, View & dst, size_t threadNumber, bool throughColumn)
+            View mask; // a region of the level mask for the current frame.
+            Rect rect; // positions of window (its top left corner) to check at the current frame.
+            View dst; // an own output of the cascade, so cascades of the same level can work in parallel.
+
+            void Prepare(const View & levelMask, const Rect & levelRect)
             {
                 Size s = dst.Size() - data->size;
-                View m = mask.Region(s, View::MiddleCenter);
-                Rect r = rect.Shifted(-data->size / 2).Intersection(Rect(s));
+                mask = levelMask.Region(s, View::MiddleCenter);
+                rect = levelRect.Empty() ? Rect() : levelRect.Shifted(-data->size / 2).Intersection(Rect(s));
                 Simd::Fill(dst, 0);
-                ::SimdDetectionPrepare(handle);
+                if (!rect.Empty())
+                    ::SimdDetectionPrepare(handle);
+            }
 
-                Parallel(r.top, r.bottom, [&](size_t thread, size_t begin, size_t end)
-                {
-                    detect(handle, m.data, m.stride, r.left, begin, r.right, end, dst.data, dst.stride);
-                }, threadNumber, throughColumn ? 2 : 1);
+            void Detect(ptrdiff_t top, ptrdiff_t bottom) const
+            {
+                detect(handle, mask.data, mask.stride, rect.left, top, rect.right, bottom, dst.data, dst.stride);
             }
         };
         typedef std::vector<Hid> Hids;
 
+        /*
+            A band of rows of one cascade at one level. All jobs of a frame are executed as one parallel task.
+        */
+        struct Job
+        {
+            const Hid * hid;
+            ptrdiff_t top, bottom;
+        };
+        typedef std::vector<Job> Jobs;
+
         struct Level
         {
             Hids hids;
@@ -366,8 +431,6 @@ namespace Simd
             View sqsum;
             View tilted;
 
-            View dst;
-
             bool throughColumn;
             bool needSqsum;
             bool needTilted;
@@ -381,17 +444,49 @@ namespace Simd
 		typedef std::unique_ptr<Level> LevelPtr;
         typedef std::vector<LevelPtr> LevelPtrs;
 
+        /*
+            A set of levels with all buffers needed to process one frame. Batch detection uses one worker per thread.
+        */
+        struct Worker
+        {
+            LevelPtrs levels;
+            Jobs jobs;
+            View gray;
+        };
+        typedef std::shared_ptr<Worker> WorkerPtr;
+        typedef std::vector<WorkerPtr> WorkerPtrs;
+
         std::vector<Data> _data;
         Size _imageSize;
+        double _scaleFactor;
+        Size _sizeMin, _sizeMax;
         bool _needNormalization;
         ptrdiff_t _threadNumber;
-        LevelPtrs _levels;
+        WorkerPtrs _workers;
+
+        static const size_t JOBS_PER_THREAD = 8;
+
+        bool Add(Handle handle, Tag tag)
+        {
+            if (handle)
+            {
+                Data data;
+                data.handle = handle;
+                data.tag = tag;
+                ::SimdDetectionInfo(handle, (size_t*)&data.size.x, (size_t*)&data.size.y, &data.flags);
+                _data.push_back(data);
+            }
+            return handle != NULL;
+        }
 
-        bool InitLevels(double scaleFactor, const Size & sizeMin, const Size & sizeMax, const View & roi)
+        bool InitLevels(Worker & worker, const View & roi)
         {
+            const double & scaleFactor = _scaleFactor;
+            const Size & sizeMin = _sizeMin, & sizeMax = _sizeMax;
+            LevelPtrs & levels = worker.levels;
             _needNormalization = false;
-            _levels.clear();
-            _levels.reserve(100);
+            levels.clear();
+            levels.reserve(100);
             double scale = 1.0;
             do
             {
@@ -413,8 +508,8 @@ namespace Simd
 
                 if (insert)
                 {
-                    _levels.push_back(LevelPtr(new Level()));
-                    Level & level = *_levels.back();
+                    levels.push_back(LevelPtr(new Level()));
+                    Level & level = *levels.back();
 
                     level.scale = scale;
                     level.throughColumn = scale <= 2.0;
@@ -428,8 +523,6 @@ namespace Simd
                     level.sqsum.Recreate(scaledSize + Size(1, 1), View::Int32);
                     level.tilted.Recreate(scaledSize + Size(1, 1), View::Int32);
 
-                    level.dst.Recreate(scaledSize, View::Gray8);
-
                     level.needSqsum = false, level.needTilted = false;
                     for (size_t i = 0; i < _data.size(); ++i)
                     {
@@ -459,6 +552,8 @@ namespace Simd
                         level.needTilted = level.needTilted | _data[i].Tilted();
                         _needNormalization = _needNormalization | _data[i].Haar();
                     }
+                    for (size_t i = 0; i < level.hids.size(); ++i)
+                        level.hids[i].dst.Recreate(scaledSize, View::Gray8);
 
                     level.rect = Rect(level.roi.Size());
                     if (roi.format == View::None)
@@ -472,41 +567,160 @@ namespace Simd
                 }
                 scale *= scaleFactor;
             } while (true);
-            return !_levels.empty();
+            return !levels.empty();
         }
 
-        void FillLevels(View src)
+        bool InitWorkers(size_t count)
         {
-            View gray;
+            while (_workers.size() < count)
+            {
+                WorkerPtr worker(new Worker());
+                if (!InitLevels(*worker, View()))
+                    return false;
+                const LevelPtrs & levels = _workers[0]->levels;
+                for (size_t i = 0; i < levels.size(); ++i)
+                {
+                    Simd::Copy(levels[i]->roi, worker->levels[i]->roi);
+                    worker->levels[i]->rect = levels[i]->rect;
+                }
+                _workers.push_back(worker);
+            }
+            return true;
+        }
+
+        /*
+            Builds the scaled images and their integrals. A color image is converted to gray directly into the first level 
+            and a gray image (or a Y plane of a frame) of the first level size is used in place, so the full size image 
+            is not copied. The other levels are resized from the first one.
+        */
+        void FillLevels(Worker & worker, const View & src, bool motionMask, const Rects & motionRegions, size_t threadNumber)
+        {
+            SIMD_CHECK_PERFORMANCE();
+
+            LevelPtrs & levels = worker.levels;
+            View top = src;
             if (src.format != View::Gray8)
             {
-                gray.Recreate(src.Size(), View::Gray8);
-                Convert(src, gray);
-                src = gray;
+                if (EqualSize(src, levels[0]->src))
+                    top = levels[0]->src;
+                else
+                {
+                    worker.gray.Recreate(src.Size(), View::Gray8);
+                    top = worker.gray;
+                }
+                Convert(src, top);
             }
 
-            Simd::ResizeBilinear(src, _levels[0]->src);
-            if (_needNormalization)
-                Simd::NormalizeHistogram(_levels[0]->src, _levels[0]->src);
-            EstimateIntegral(*_levels[0]);
-            for (size_t i = 1; i < _levels.size(); ++i)
+            if (!EqualSize(top, levels[0]->src) || (_needNormalization && top.data != levels[0]->src.data))
             {
-                Simd::ResizeBilinear(_levels[0]->src, _levels[i]->src);
-                EstimateIntegral(*_levels[i]);
+                Simd::ResizeBilinear(top, levels[0]->src);
+                top = levels[0]->src;
             }
+            if (_needNormalization)
+                Simd::NormalizeHistogram(top, top);
+
+            Parallel(0, levels.size(), [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    Level & level = *levels[i];
+                    if (i)
+                        Simd::ResizeBilinear(top, level.src);
+                    EstimateIntegral(i ? level.src : top, level);
+                    View mask = level.roi;
+                    Rect rect = level.rect;
+                    if (motionMask)
+                    {
+                        FillMotionMask(motionRegions, level, rect);
+                        mask = level.mask;
+                    }
+                    for (size_t j = 0; j < level.hids.size(); ++j)
+                        level.hids[j].Prepare(mask, rect);
+                }
+            }, threadNumber);
         }
 
-        void EstimateIntegral(Level & level)        
+        void EstimateIntegral(const View & src, Level & level)
         {
             if (level.needSqsum)
             {
                 if (level.needTilted)
-                    Simd::Integral(level.src, level.sum, level.sqsum, level.tilted);
+                    Simd::Integral(src, level.sum, level.sqsum, level.tilted);
                 else
-                    Simd::Integral(level.src, level.sum, level.sqsum);
+                    Simd::Integral(src, level.sum, level.sqsum);
             }
             else
-                Simd::Integral(level.src, level.sum);
+                Simd::Integral(src, level.sum);
+        }
+
+        /*
+            Splits all (level, cascade) pairs into bands of rows with nearly equal cost (a number of checked windows) 
+            and executes them as one parallel task. So small levels do not leave threads idle and big levels are shared 
+            between all threads.
+        */
+        void RunJobs(Worker & worker, size_t threadNumber)
+        {
+            SIMD_CHECK_PERFORMANCE();
+
+            const LevelPtrs & levels = worker.levels;
+            Jobs & jobs = worker.jobs;
+            jobs.clear();
+            double total = 0;
+            for (size_t i = 0; i < levels.size(); ++i)
+                for (size_t j = 0; j < levels[i]->hids.size(); ++j)
+                    total += Cost(levels[i]->hids[j], levels[i]->throughColumn ? 2 : 1, levels[i]->hids[j].rect.Height());
+            if (total == 0)
+                return;
+
+            double cost = total / (threadNumber * JOBS_PER_THREAD);
+            for (size_t i = 0; i < levels.size(); ++i)
+            {
+                ptrdiff_t step = levels[i]->throughColumn ? 2 : 1;
+                for (size_t j = 0; j < levels[i]->hids.size(); ++j)
+                {
+                    const Hid & hid = levels[i]->hids[j];
+                    if (hid.rect.Empty())
+                        continue;
+                    ptrdiff_t band = std::max<ptrdiff_t>(ptrdiff_t(cost / Cost(hid, step, step)), 1)*step;
+                    for (ptrdiff_t top = hid.rect.top; top < hid.rect.bottom; top += band)
+                    {
+                        Job job = { &hid, top, std::min(top + band, hid.rect.bottom) };
+                        jobs.push_back(job);
+                    }
+                }
+            }
+
+            Parallel(0, jobs.size(), [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                    jobs[i].hid->Detect(jobs[i].top, jobs[i].bottom);
+            }, threadNumber);
+        }
+
+        void GetObjects(const Worker & worker, Objects & objects, int groupSizeMin, double sizeDifferenceMax)
+        {
+            typedef std::map<Tag, Objects> Candidates;
+            Candidates candidates;
+
+            for (size_t i = 0; i < worker.levels.size(); ++i)
+            {
+                const Level & level = *worker.levels[i];
+                for (size_t j = 0; j < level.hids.size(); ++j)
+                {
+                    const Hid & hid = level.hids[j];
+                    AddObjects(candidates[hid.data->tag], hid.dst, hid.rect, hid.data->size, level.scale,
+                        level.throughColumn ? 2 : 1, hid.data->tag);
+                }
+            }
+
+            objects.clear();
+            for (typename Candidates::iterator it = candidates.begin(); it != candidates.end(); ++it)
+                GroupObjects(objects, it->second, groupSizeMin, sizeDifferenceMax);
+        }
+
+        static double Cost(const Hid & hid, ptrdiff_t step, ptrdiff_t rows)
+        {
+            return double((hid.rect.Width() + step - 1) / step)*((rows + step - 1) / step);
         }
 
         void FillMotionMask(const Rects & rects, Level & level, Rect & rect) const
@@ -523,10 +737,10 @@ namespace Simd
             Simd::OperationBinary8u(level.mask, level.roi, level.mask, SimdOperationBinary8uAnd);
         }
 
-        void AddObjects(Objects & objects, const View & dst, const Rect & rect, const Size & size, double scale, size_t step, Tag tag)
+        void AddObjects(Objects & objects, const View & dst, const Rect & r, const Size & size, double scale, size_t step, Tag tag)
         {
-            Size s = dst.Size() - size;
-            Rect r = rect.Shifted(-size / 2).Intersection(Rect(s));
+            SIMD_CHECK_PERFORMANCE();
+
             for (ptrdiff_t row = r.top; row < r.bottom; row += step)
             {
                 const uint8_t * mask = dst.data + row*dst.stride;
@@ -637,6 +851,8 @@ namespace Simd
 
         void GroupObjects(Objects & dst, const Objects & src, size_t groupSizeMin, double sizeDifferenceMax)
         {
+            SIMD_CHECK_PERFORMANCE();
+
             if (groupSizeMin == 0 || src.size() < groupSizeMin)
                 return;
 
@@ -26,6 +26,8 @@
 
 #include "SimdDefs.h"
 
+#include <atomic>
+
 #if defined(_MSC_VER)
 
 #define NOMINMAX
@@ -588,85 +590,92 @@ namespace Simd
             return sizeof(void *);
     }
 
+    // Alignment for all extensions supported by CPU. It is not reduced by ::SimdSetCpuInfoMask, so buffers allocated with it are suitable for any of them.
     const size_t ALIGNMENT = Alignment();
+
+    namespace Dispatch
+    {
+        // Runtime switches of SIMD extensions which are used by dispatcher of the Simd Library (see ::SimdSetCpuInfoMask).
+        extern std::atomic<bool> Sse, Sse2, Sse3, Ssse3, Sse41, Sse42, Avx, Avx2, Avx512f, Avx512bw, Vmx, Vsx, Neon, Msa;
+    }
 }
 
 #define SIMD_BASE_FUNC(func) Simd::Base::func
 
 #ifdef SIMD_SSE_ENABLE
-#define SIMD_SSE_FUNC(func) Simd::Sse::Enable ? Simd::Sse::func : 
+#define SIMD_SSE_FUNC(func) Simd::Dispatch::Sse ? Simd::Sse::func : 
 #else
 #define SIMD_SSE_FUNC(func) 
 #endif
 
 #ifdef SIMD_SSE2_ENABLE
-#define SIMD_SSE2_FUNC(func) Simd::Sse2::Enable ? Simd::Sse2::func : 
+#define SIMD_SSE2_FUNC(func) Simd::Dispatch::Sse2 ? Simd::Sse2::func : 
 #else
 #define SIMD_SSE2_FUNC(func) 
 #endif
 
 #ifdef SIMD_SSE3_ENABLE
-#define SIMD_SSE3_FUNC(func) Simd::Sse3::Enable ? Simd::Sse3::func : 
+#define SIMD_SSE3_FUNC(func) Simd::Dispatch::Sse3 ? Simd::Sse3::func : 
 #else
 #define SIMD_SSE3_FUNC(func) 
 #endif
 
 #ifdef SIMD_SSSE3_ENABLE
-#define SIMD_SSSE3_FUNC(func) Simd::Ssse3::Enable ? Simd::Ssse3::func : 
+#define SIMD_SSSE3_FUNC(func) Simd::Dispatch::Ssse3 ? Simd::Ssse3::func : 
 #else
 #define SIMD_SSSE3_FUNC(func) 
 #endif
 
 #ifdef SIMD_SSE41_ENABLE
-#define SIMD_SSE41_FUNC(func) Simd::Sse41::Enable ? Simd::Sse41::func : 
+#define SIMD_SSE41_FUNC(func) Simd::Dispatch::Sse41 ? Simd::Sse41::func : 
 #else
 #define SIMD_SSE41_FUNC(func) 
 #endif
 
 #ifdef SIMD_SSE42_ENABLE
-#define SIMD_SSE42_FUNC(func) Simd::Sse42::Enable ? Simd::Sse42::func : 
+#define SIMD_SSE42_FUNC(func) Simd::Dispatch::Sse42 ? Simd::Sse42::func : 
 #else
 #define SIMD_SSE42_FUNC(func) 
 #endif
 
 #ifdef SIMD_AVX_ENABLE
-#define SIMD_AVX_FUNC(func) Simd::Avx::Enable ? Simd::Avx::func : 
+#define SIMD_AVX_FUNC(func) Simd::Dispatch::Avx ? Simd::Avx::func : 
 #else
 #define SIMD_AVX_FUNC(func)
 #endif
 
 #ifdef SIMD_AVX2_ENABLE
-#define SIMD_AVX2_FUNC(func) Simd::Avx2::Enable ? Simd::Avx2::func : 
+#define SIMD_AVX2_FUNC(func) Simd::Dispatch::Avx2 ? Simd::Avx2::func : 
 #else
 #define SIMD_AVX2_FUNC(func)
 #endif
 
 #ifdef SIMD_AVX512F_ENABLE
-#define SIMD_AVX512F_FUNC(func) Simd::Avx512f::Enable ? Simd::Avx512f::func : 
+#define SIMD_AVX512F_FUNC(func) Simd::Dispatch::Avx512f ? Simd::Avx512f::func : 
 #else
 #define SIMD_AVX512F_FUNC(func)
 #endif
 
 #ifdef SIMD_AVX512BW_ENABLE
-#define SIMD_AVX512BW_FUNC(func) Simd::Avx512bw::Enable ? Simd::Avx512bw::func : 
+#define SIMD_AVX512BW_FUNC(func) Simd::Dispatch::Avx512bw ? Simd::Avx512bw::func : 
 #else
 #define SIMD_AVX512BW_FUNC(func)
 #endif
 
 #ifdef SIMD_VMX_ENABLE
-#define SIMD_VMX_FUNC(func) Simd::Vmx::Enable ? Simd::Vmx::func : 
+#define SIMD_VMX_FUNC(func) Simd::Dispatch::Vmx ? Simd::Vmx::func : 
 #else
 #define SIMD_VMX_FUNC(func)
 #endif
 
 #ifdef SIMD_VSX_ENABLE
-#define SIMD_VSX_FUNC(func) Simd::Vsx::Enable ? Simd::Vsx::func : 
+#define SIMD_VSX_FUNC(func) Simd::Dispatch::Vsx ? Simd::Vsx::func : 
 #else
 #define SIMD_VSX_FUNC(func)
 #endif
 
 #ifdef SIMD_NEON_ENABLE
-#define SIMD_NEON_FUNC(func) Simd::Neon::Enable ? Simd::Neon::func : 
+#define SIMD_NEON_FUNC(func) Simd::Dispatch::Neon ? Simd::Neon::func : 
 #else
 #define SIMD_NEON_FUNC(func)
 #endif
@@ -679,4 +688,91 @@ namespace Simd
 #define SIMD_FUNC5(func, EXT1, EXT2, EXT3, EXT4, EXT5) EXT1(func) EXT2(func) EXT3(func) EXT4(func) EXT5(func) SIMD_BASE_FUNC(func)
 #define SIMD_FUNC6(func, EXT1, EXT2, EXT3, EXT4, EXT5, EXT6) EXT1(func) EXT2(func) EXT3(func) EXT4(func) EXT5(func) EXT6(func) SIMD_BASE_FUNC(func)
 
+// Items of function table (see SIMD_DISPATCH_TABLE): implementation of given extension and minimal value of table key (image width as usual) which it supports.
+#define SIMD_BASE_ITEM(func) {0, 0, Simd::Base::func},
+
+#ifdef SIMD_SSE_ENABLE
+#define SIMD_SSE_ITEM(func, min) {1 << SimdCpuInfoSse, min, Simd::Sse::func},
+#else
+#define SIMD_SSE_ITEM(func, min)
+#endif
+
+#ifdef SIMD_SSE2_ENABLE
+#define SIMD_SSE2_ITEM(func, min) {1 << SimdCpuInfoSse2, min, Simd::Sse2::func},
+#else
+#define SIMD_SSE2_ITEM(func, min)
+#endif
+
+#ifdef SIMD_SSE3_ENABLE
+#define SIMD_SSE3_ITEM(func, min) {1 << SimdCpuInfoSse3, min, Simd::Sse3::func},
+#else
+#define SIMD_SSE3_ITEM(func, min)
+#endif
+
+#ifdef SIMD_SSSE3_ENABLE
+#define SIMD_SSSE3_ITEM(func, min) {1 << SimdCpuInfoSsse3, min, Simd::Ssse3::func},
+#else
+#define SIMD_SSSE3_ITEM(func, min)
+#endif
+
+#ifdef SIMD_SSE41_ENABLE
+#define SIMD_SSE41_ITEM(func, min) {1 << SimdCpuInfoSse41, min, Simd::Sse41::func},
+#else
+#define SIMD_SSE41_ITEM(func, min)
+#endif
+
+#ifdef SIMD_SSE42_ENABLE
+#define SIMD_SSE42_ITEM(func, min) {1 << SimdCpuInfoSse42, min, Simd::Sse42::func},
+#else
+#define SIMD_SSE42_ITEM(func, min)
+#endif
+
+#ifdef SIMD_AVX_ENABLE
+#define SIMD_AVX_ITEM(func, min) {1 << SimdCpuInfoAvx, min, Simd::Avx::func},
+#else
+#define SIMD_AVX_ITEM(func, min)
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+#define SIMD_AVX2_ITEM(func, min) {1 << SimdCpuInfoAvx2, min, Simd::Avx2::func},
+#else
+#define SIMD_AVX2_ITEM(func, min)
+#endif
+
+#ifdef SIMD_AVX512F_ENABLE
+#define SIMD_AVX512F_ITEM(func, min) {1 << SimdCpuInfoAvx512f, min, Simd::Avx512f::func},
+#else
+#define SIMD_AVX512F_ITEM(func, min)
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+#define SIMD_AVX512BW_ITEM(func, min) {1 << SimdCpuInfoAvx512bw, min, Simd::Avx512bw::func},
+#else
+#define SIMD_AVX512BW_ITEM(func, min)
+#endif
+
+#ifdef SIMD_VMX_ENABLE
+#define SIMD_VMX_ITEM(func, min) {1 << SimdCpuInfoVmx, min, Simd::Vmx::func},
+#else
+#define SIMD_VMX_ITEM(func, min)
+#endif
+
+#ifdef SIMD_VSX_ENABLE
+#define SIMD_VSX_ITEM(func, min) {1 << SimdCpuInfoVsx, min, Simd::Vsx::func},
+#else
+#define SIMD_VSX_ITEM(func, min)
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+#define SIMD_NEON_ITEM(func, min) {1 << SimdCpuInfoNeon, min, Simd::Neon::func},
+#else
+#define SIMD_NEON_ITEM(func, min)
+#endif
+
+#ifdef SIMD_MSA_ENABLE
+#define SIMD_MSA_ITEM(func, min) {1 << SimdCpuInfoMsa, min, Simd::Msa::func},
+#else
+#define SIMD_MSA_ITEM(func, min)
+#endif
+
 #endif//__SimdEnable_h__
@@ -0,0 +1,74 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdFilter2D_h__
+#define __SimdFilter2D_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        /*
+            2D correlation with arbitrary kernel (up to FILTER2D_SIZE_MAX x FILTER2D_SIZE_MAX) and replicated border. 
+            The anchor of kernel is its center (kernelX/2, kernelY/2).
+
+            Gray8 version accumulates products in 16-bit integers with saturation (the order of accumulation is fixed: 
+            row by row of the kernel), so all versions give identical results. If the kernel is an outer product of two 
+            integer vectors and the saturation is impossible, it is applied as two 1D filters (the horizontal pass stores 
+            16-bit rows, the vertical pass accumulates in 32-bit), the result is the same.
+
+            Float version accumulates products in float. If the kernel is an outer product of two vectors 
+            (with relative error FILTER2D_SEPARABLE_EPS) it is applied as two 1D filters.
+
+            Wide images are processed by vertical blocks so that kernelY rows of the block stay in L2 cache.
+        */
+        const size_t FILTER2D_SIZE_MAX = 15;
+        const size_t FILTER2D_CACHE = 256 * 1024;
+        const float FILTER2D_SEPARABLE_EPS = 1.0e-6f;
+
+        // Direct filter of one row: rows[ky][x + kx] is the source pixel for output x.
+        typedef void(*Filter2D8uDirectPtr)(const uint8_t * const * rows, size_t width, const int16_t * kernel, size_t kernelX, size_t kernelY, int shift, int16_t bias, uint8_t * dst);
+
+        // Horizontal pass of separable filter: dst[x] = sum(src[x + k]*kernel[k]), where k = [0, size).
+        typedef void(*Filter2D8uRowPtr)(const uint8_t * src, size_t width, const int16_t * kernel, size_t size, int16_t * dst);
+
+        // Vertical pass of separable filter: dst[x] = Saturate(((sum(rows[k][x]*kernel[k]) + round) >> shift) + bias), where k = [0, size), size is even.
+        typedef void(*Filter2D8uColPtr)(const int16_t * const * rows, size_t width, const int16_t * kernel, size_t size, int shift, int16_t bias, uint8_t * dst);
+
+        typedef void(*Filter2D32fDirectPtr)(const float * const * rows, size_t width, const float * kernel, size_t kernelX, size_t kernelY, float * dst);
+
+        typedef void(*Filter2D32fRowPtr)(const float * src, size_t width, const float * kernel, size_t size, float * dst);
+
+        typedef void(*Filter2D32fColPtr)(const float * const * rows, size_t width, const float * kernel, size_t size, float * dst);
+
+        void Filter2D8uRun(const uint8_t * src, size_t srcStride, size_t width, size_t height, const int16_t * kernel, size_t kernelX, size_t kernelY, 
+            int shift, int16_t bias, uint8_t * dst, size_t dstStride, Filter2D8uDirectPtr direct, Filter2D8uRowPtr row, Filter2D8uColPtr col);
+
+        void Filter2D32fRun(const float * src, size_t srcStride, size_t width, size_t height, const float * kernel, size_t kernelX, size_t kernelY,
+            float * dst, size_t dstStride, Filter2D32fDirectPtr direct, Filter2D32fRowPtr row, Filter2D32fColPtr col);
+    }
+}
+#endif//__SimdFilter2D_h__
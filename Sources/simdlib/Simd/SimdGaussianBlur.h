@@ -0,0 +1,67 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdGaussianBlur_h__
+#define __SimdGaussianBlur_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        /*
+            Separable Gaussian blur in fixed point: the kernel weights are 16-bit integers with sum equal to 
+            1 << GAUSSIAN_BLUR_WEIGHT_BITS. The horizontal pass stores rows as 16-bit integers with 
+            GAUSSIAN_BLUR_ROW_BITS fractional bits, the vertical pass rounds the result back to 8 bits.
+            The kernel has 2*radius + 1 taps and is padded by zero weight to even size (SIMD versions process taps by pairs).
+        */
+        const int GAUSSIAN_BLUR_WEIGHT_BITS = 14;
+        const int GAUSSIAN_BLUR_ROW_BITS = 7;
+        const int GAUSSIAN_BLUR_ROW_SHIFT = GAUSSIAN_BLUR_WEIGHT_BITS - GAUSSIAN_BLUR_ROW_BITS;
+        const int GAUSSIAN_BLUR_ROW_ROUND = 1 << (GAUSSIAN_BLUR_ROW_SHIFT - 1);
+        const int GAUSSIAN_BLUR_COL_SHIFT = GAUSSIAN_BLUR_WEIGHT_BITS + GAUSSIAN_BLUR_ROW_BITS;
+        const int GAUSSIAN_BLUR_COL_ROUND = 1 << (GAUSSIAN_BLUR_COL_SHIFT - 1);
+
+        /*
+            Size of the ring buffer of horizontally filtered rows: wide images are processed by vertical blocks 
+            so that 2*radius + 1 filtered rows of the block stay in L2 cache.
+        */
+        const size_t GAUSSIAN_BLUR_CACHE = 256 * 1024;
+
+        // Horizontal pass: dst[i] = (sum(src[i + k*step]*weights[k]) + ROW_ROUND) >> ROW_SHIFT, where k = [0, size).
+        typedef void(*GaussianBlurRowPtr)(const uint8_t * src, size_t width, size_t step, const int16_t * weights, size_t size, int16_t * dst);
+
+        // Vertical pass: dst[i] = (sum(rows[k][i]*weights[k]) + COL_ROUND) >> COL_SHIFT, where k = [0, size).
+        typedef void(*GaussianBlurColPtr)(const int16_t * const * rows, size_t width, const int16_t * weights, size_t size, uint8_t * dst);
+
+        size_t GaussianBlurRadius(float sigma, size_t radius);
+
+        void GaussianBlurKernel(float sigma, size_t radius, Array<int16_t> & weights);
+
+        void GaussianBlurRun(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, float sigma, size_t radius, 
+            uint8_t * dst, size_t dstStride, GaussianBlurRowPtr rowFilter, GaussianBlurColPtr colFilter);
+    }
+}
+#endif//__SimdGaussianBlur_h__
@@ -30,9 +30,67 @@
 #ifndef __SimdLib_hpp__
 #define __SimdLib_hpp__
 
+#ifndef SIMD_FUNCTION
+#if defined(__GNUC__)
+#define SIMD_FUNCTION __PRETTY_FUNCTION__
+#elif defined(_MSC_VER)
+#define SIMD_FUNCTION __FUNCSIG__
+#else
+#define SIMD_FUNCTION __FUNCTION__
+#endif
+#endif
+
+#ifndef SIMD_CHECK_PERFORMANCE
+#ifdef SIMD_PERFORMANCE_STATISTIC
+#define SIMD_CHECK_PERFORMANCE() Simd::PerformanceScope _simdPerformanceScope(SIMD_FUNCTION)
+#else
+#define SIMD_CHECK_PERFORMANCE()
+#endif
+#endif
+
 /*! \namespace Simd */
 namespace Simd
 {
+    /*! @ingroup cpp_performance
+
+        \short Measures execution time of the scope where it is created.
+
+        The time is added to internal performance statistics of %Simd Library (see function ::SimdPerformanceStatistic).
+        Macro SIMD_CHECK_PERFORMANCE() creates such an object for the current function if macro SIMD_PERFORMANCE_STATISTIC is defined.
+
+        \note This class is a C++ wrapper for functions ::SimdPerformanceMeasurerEnter and ::SimdPerformanceMeasurerLeave.
+    */
+    class PerformanceScope
+    {
+    public:
+        /*!
+            Starts measurement of the scope.
+
+            \param [in] name - a name of the scope. It must be a static string.
+            \param [in] pixels - a number of pixels processed in the scope (0 if the throughput is not required).
+        */
+        SIMD_INLINE PerformanceScope(const char * name, size_t pixels = 0)
+            : _measurer(SimdPerformanceMeasurerEnter(name))
+            , _pixels(pixels)
+        {
+        }
+
+        /*!
+            Finishes measurement of the scope.
+        */
+        SIMD_INLINE ~PerformanceScope()
+        {
+            SimdPerformanceMeasurerLeave(_measurer, _pixels);
+        }
+
+    private:
+        PerformanceScope(const PerformanceScope &);
+        PerformanceScope & operator = (const PerformanceScope &);
+
+        void * _measurer;
+        size_t _pixels;
+    };
+
     /*! @ingroup correlation
 
         \fn void AbsDifferenceSum(const View<A>& a, const View<A>& b, uint64_t & sum)
@@ -880,6 +938,31 @@ namespace Simd
         SimdBgrToYuv444p(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
     }
 
+    /*! @ingroup other_filter
+
+        \fn void BilateralFilter(const View<A>& src, float sigmaSpace, float sigmaRange, View<A>& dst, SimdBilateralFilterType type = SimdBilateralFilterExact, size_t radius = 0)
+
+        \short Performs bilateral (edge-preserving) filtration of the image. 
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdBilateralFilter.
+
+        \param [in] src - a source image.
+        \param [in] sigmaSpace - a standard deviation of spatial Gaussian (in pixels). It must be positive.
+        \param [in] sigmaRange - a standard deviation of range Gaussian (in intensity units). It must be positive.
+        \param [out] dst - a destination image.
+        \param [in] type - a type of the filter (see ::SimdBilateralFilterType). By default it is ::SimdBilateralFilterExact.
+        \param [in] radius - a radius of the window of exact filter. By default it is calculated from sigmaSpace.
+    */
+    template<template<class> class A> SIMD_INLINE void BilateralFilter(const View<A>& src, float sigmaSpace, float sigmaRange, View<A>& dst, 
+        SimdBilateralFilterType type = SimdBilateralFilterExact, size_t radius = 0)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+
+        SimdBilateralFilter(src.data, src.stride, src.width, src.height, src.ChannelCount(), type, sigmaSpace, sigmaRange, radius, dst.data, dst.stride);
+    }
+
     /*! @ingroup binarization
 
         \fn void Binarization(const View<A>& src, uint8_t value, uint8_t positive, uint8_t negative, View<A>& dst, SimdCompareType compareType)
@@ -956,6 +1039,29 @@ namespace Simd
             neighborhood, threshold, positive, negative, dst.data, dst.stride, compareType);
     }
 
+    /*! @ingroup other_filter
+
+        \fn void BoxFilter(const View<A>& src, size_t windowX, size_t windowY, View<A>& dst)
+
+        \short Performs an averaging with rectangular window of arbitrary odd size. 
+
+        Border pixels are replicated. The cost of the function does not depend on window size.
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdBoxFilter.
+
+        \param [in] src - a source image.
+        \param [in] windowX - a width of the window. It must be odd and not greater than 255.
+        \param [in] windowY - a height of the window. It must be odd and not greater than 255.
+        \param [out] dst - a destination image.
+    */
+    template<template<class> class A> SIMD_INLINE void BoxFilter(const View<A>& src, size_t windowX, size_t windowY, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1 && windowX % 2 == 1 && windowY % 2 == 1);
+
+        SimdBoxFilter(src.data, src.stride, src.width, src.height, src.ChannelCount(), windowX, windowY, dst.data, dst.stride);
+    }
+
     /*! @ingroup conditional
 
         \fn void ConditionalCount8u(const View<A> & src, uint8_t value, SimdCompareType compareType, uint32_t & count)
@@ -1528,6 +1634,55 @@ namespace Simd
         SimdFillBgra(dst.data, dst.stride, dst.width, dst.height, blue, green, red, alpha);
     }
 
+    /*! @ingroup other_filter
+
+        \fn void Filter2D(const View<A>& src, const int16_t * kernel, size_t kernelX, size_t kernelY, int shift, int16_t bias, View<A>& dst)
+
+        \short Performs a 2D filtration of 8-bit gray image with arbitrary integer kernel.
+
+        Products are accumulated in 16-bit integers with saturation, the sum is rounded, shifted right and biased. 
+        Border pixels are replicated. All images must have 8-bit gray format and the same size.
+
+        \note This function is a C++ wrapper for function ::SimdFilter2D8u.
+
+        \param [in] src - a source image.
+        \param [in] kernel - a pointer to the kernel (kernelX*kernelY values in range [-128, 128], row by row).
+        \param [in] kernelX - a width of the kernel. It must be in range [1, 15].
+        \param [in] kernelY - a height of the kernel. It must be in range [1, 15].
+        \param [in] shift - a right shift of the sum. It must be in range [0, 15].
+        \param [in] bias - a value which is added to the shifted sum.
+        \param [out] dst - a destination image.
+    */
+    template<template<class> class A> SIMD_INLINE void Filter2D(const View<A>& src, const int16_t * kernel, size_t kernelX, size_t kernelY, int shift, int16_t bias, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.format == View<A>::Gray8);
+
+        SimdFilter2D8u(src.data, src.stride, src.width, src.height, kernel, kernelX, kernelY, shift, bias, dst.data, dst.stride);
+    }
+
+    /*! @ingroup other_filter
+
+        \fn void Filter2D(const View<A>& src, const float * kernel, size_t kernelX, size_t kernelY, View<A>& dst)
+
+        \short Performs a 2D filtration of 32-bit float image with arbitrary kernel.
+
+        Border pixels are replicated. All images must have 32-bit float format and the same size.
+
+        \note This function is a C++ wrapper for function ::SimdFilter2D32f.
+
+        \param [in] src - a source image.
+        \param [in] kernel - a pointer to the kernel (kernelX*kernelY values, row by row).
+        \param [in] kernelX - a width of the kernel. It must be in range [1, 15].
+        \param [in] kernelY - a height of the kernel. It must be in range [1, 15].
+        \param [out] dst - a destination image.
+    */
+    template<template<class> class A> SIMD_INLINE void Filter2D(const View<A>& src, const float * kernel, size_t kernelX, size_t kernelY, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.format == View<A>::Float && src.stride % sizeof(float) == 0 && dst.stride % sizeof(float) == 0);
+
+        SimdFilter2D32f((float*)src.data, src.stride / sizeof(float), src.width, src.height, kernel, kernelX, kernelY, (float*)dst.data, dst.stride / sizeof(float));
+    }
+
     /*! @ingroup other_filter
 
         \fn void GaussianBlur3x3(const View<A>& src, View<A>& dst)
@@ -1554,6 +1709,29 @@ namespace Simd
         SimdGaussianBlur3x3(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
     }
 
+    /*! @ingroup other_filter
+
+        \fn void GaussianBlur(const View<A>& src, View<A>& dst, float sigma, size_t radius = 0)
+
+        \short Performs Gaussian blur filtration with arbitrary sigma. 
+
+        The filter is separable, border pixels are replicated. 
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdGaussianBlur.
+
+        \param [in] src - a source image.
+        \param [out] dst - a destination image.
+        \param [in] sigma - a standard deviation of Gaussian kernel.
+        \param [in] radius - a radius of Gaussian kernel. By default it is calculated from sigma as ceil(3*sigma).
+    */
+    template<template<class> class A> SIMD_INLINE void GaussianBlur(const View<A>& src, View<A>& dst, float sigma, size_t radius = 0)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+
+        SimdGaussianBlur(src.data, src.stride, src.width, src.height, src.ChannelCount(), sigma, radius, dst.data, dst.stride);
+    }
+
     /*! @ingroup gray_conversion
 
         \fn void GrayToBgr(const View<A>& gray, View<A>& bgr)
@@ -2247,6 +2425,124 @@ namespace Simd
         SimdMedianFilterSquare5x5(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
     }
 
+    /*! @ingroup median_filter
+
+        \fn void MedianFilter(const View<A>& src, size_t radius, View<A>& dst)
+
+        \short Performs median filtration of input image with square window of arbitrary size (2*radius + 1)x(2*radius + 1). 
+
+        Every channel is filtered independently. Border pixels are replicated. The cost per pixel does not depend on radius.
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdMedianFilter.
+
+        \param [in] src - an original input image.
+        \param [in] radius - a radius of the window. It must not be greater than 127.
+        \param [out] dst - a filtered output image.
+    */
+    template<template<class> class A> SIMD_INLINE void MedianFilter(const View<A>& src, size_t radius, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+
+        SimdMedianFilter(src.data, src.stride, src.width, src.height, src.ChannelCount(), radius, dst.data, dst.stride);
+    }
+
+    /*! @ingroup other_filter
+
+        \fn void Erode(const View<A>& src, size_t windowX, size_t windowY, View<A>& dst)
+
+        \short Performs erosion of 8-bit gray image with rectangular structuring element. 
+
+        All images must have the same width and height. Input and output images must be different.
+
+        \note This function is a C++ wrapper for function ::SimdErode.
+
+        \param [in] src - an input 8-bit gray image.
+        \param [in] windowX - a width of structuring element. It must be odd.
+        \param [in] windowY - a height of structuring element. It must be odd.
+        \param [out] dst - an output 8-bit gray image.
+    */
+    template<template<class> class A> SIMD_INLINE void Erode(const View<A>& src, size_t windowX, size_t windowY, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.format == View<A>::Gray8);
+
+        SimdErode(src.data, src.stride, src.width, src.height, windowX, windowY, dst.data, dst.stride);
+    }
+
+    /*! @ingroup other_filter
+
+        \fn void Dilate(const View<A>& src, size_t windowX, size_t windowY, View<A>& dst)
+
+        \short Performs dilation of 8-bit gray image with rectangular structuring element. 
+
+        All images must have the same width and height. Input and output images must be different.
+
+        \note This function is a C++ wrapper for function ::SimdDilate.
+
+        \param [in] src - an input 8-bit gray image.
+        \param [in] windowX - a width of structuring element. It must be odd.
+        \param [in] windowY - a height of structuring element. It must be odd.
+        \param [out] dst - an output 8-bit gray image.
+    */
+    template<template<class> class A> SIMD_INLINE void Dilate(const View<A>& src, size_t windowX, size_t windowY, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.format == View<A>::Gray8);
+
+        SimdDilate(src.data, src.stride, src.width, src.height, windowX, windowY, dst.data, dst.stride);
+    }
+
+    /*! @ingroup other_filter
+
+        \fn void Morphology(const View<A>& src, SimdMorphologyType type, SimdMorphologyShapeType shape, size_t windowX, size_t windowY, View<A>& dst)
+
+        \short Performs morphological operation (erosion, dilation, opening or closing) of 8-bit gray image. 
+
+        All images must have the same width and height. Input and output images must be different.
+
+        \note This function is a C++ wrapper for function ::SimdMorphology.
+
+        \param [in] src - an input 8-bit gray image.
+        \param [in] type - a type of morphological operation (see ::SimdMorphologyType).
+        \param [in] shape - a shape of structuring element (see ::SimdMorphologyShapeType).
+        \param [in] windowX - a width of structuring element. It must be odd.
+        \param [in] windowY - a height of structuring element. It must be odd.
+        \param [out] dst - an output 8-bit gray image.
+    */
+    template<template<class> class A> SIMD_INLINE void Morphology(const View<A>& src, SimdMorphologyType type, SimdMorphologyShapeType shape, size_t windowX, size_t windowY, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.format == View<A>::Gray8);
+
+        SimdMorphology(src.data, src.stride, src.width, src.height, type, shape, windowX, windowY, dst.data, dst.stride);
+    }
+
+    /*! @ingroup other_filter
+
+        \fn void Morphology(const View<A>& src, SimdMorphologyType type, SimdMorphologyShapeType shape, size_t windowX, size_t windowY, const View<A>& mask, uint8_t index, View<A>& dst)
+
+        \short Performs morphological operation of 8-bit gray image based on gray 8-bit mask. 
+
+        Only points where mask[i] == index are changed, other points are copied from input image.
+        All images must have the same width and height. Input and output images must be different.
+
+        \note This function is a C++ wrapper for function ::SimdMorphologyMasked.
+
+        \param [in] src - an input 8-bit gray image.
+        \param [in] type - a type of morphological operation (see ::SimdMorphologyType).
+        \param [in] shape - a shape of structuring element (see ::SimdMorphologyShapeType).
+        \param [in] windowX - a width of structuring element. It must be odd.
+        \param [in] windowY - a height of structuring element. It must be odd.
+        \param [in] mask - a 8-bit gray mask image.
+        \param [in] index - a mask index.
+        \param [out] dst - an output 8-bit gray image.
+    */
+    template<template<class> class A> SIMD_INLINE void Morphology(const View<A>& src, SimdMorphologyType type, SimdMorphologyShapeType shape, size_t windowX, size_t windowY, 
+        const View<A>& mask, uint8_t index, View<A>& dst)
+    {
+        assert(Compatible(src, mask, dst) && src.format == View<A>::Gray8);
+
+        SimdMorphologyMasked(src.data, src.stride, src.width, src.height, type, shape, windowX, windowY, mask.data, mask.stride, index, dst.data, dst.stride);
+    }
+
     /*! @ingroup neural
 
         \fn void NeuralConvert(const View<A> & src, float * dst, size_t stride, bool inversion)
@@ -2274,6 +2570,55 @@ namespace Simd
         SimdNeuralConvert(src.data, src.stride, src.width, src.height, dst, stride, inversion ? 1 : 0);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr)
+
+        \short Converts NV12 image to 24-bit BGR image. 
+
+        The input Y and output BGR images must have the same width and height. 
+        The input UV image must have half size relative to Y component. 
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgr.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr)
+    {
+        assert(y.width == 2*uv.width && y.height == 2*uv.height && uv.format == View<A>::Uv16);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdNv12ToBgr(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF)
+
+        \short Converts NV12 image to 32-bit BGRA image. 
+
+        The input Y and output BGRA images must have the same width and height. 
+        The input UV image must have half size relative to Y component. 
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgra.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF)
+    {
+        assert(y.width == 2*uv.width && y.height == 2*uv.height && uv.format == View<A>::Uv16);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdNv12ToBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
+    }
+
     /*! @ingroup operation
 
         \fn void OperationBinary8u(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary8uType type)
@@ -2519,6 +2864,75 @@ namespace Simd
         }
     }
 
+    /*! @ingroup resizing
+
+        \fn void Resize(const View<A> & src, View<A> & dst, SimdResizeMethodType method = SimdResizeMethodBilinear)
+
+        \short Performs resizing of input image with using of given method.
+
+        All images must have the same format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA). 
+
+        \note This function is a C++ wrapper for functions ::SimdResizeBilinear, ::SimdResizeArea and ::SimdResizeBicubic.
+
+        \param [in] src - an original input image.
+        \param [out] dst - a resized output image.
+        \param [in] method - a resizing method. By default it is equal to ::SimdResizeMethodBilinear.
+    */
+    template<template<class> class A> SIMD_INLINE void Resize(const View<A> & src, View<A> & dst, SimdResizeMethodType method = SimdResizeMethodBilinear)
+    {
+        assert(src.format == dst.format && src.ChannelSize() == 1);
+
+        if (EqualSize(src, dst))
+        {
+            Copy(src, dst);
+            return;
+        }
+
+        switch (method)
+        {
+        case SimdResizeMethodBilinear:
+            SimdResizeBilinear(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride, src.ChannelCount());
+            break;
+        case SimdResizeMethodArea:
+            SimdResizeArea(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride, src.ChannelCount());
+            break;
+        case SimdResizeMethodBicubic:
+            SimdResizeBicubic(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride, src.ChannelCount());
+            break;
+        default:
+            assert(0);
+        }
+    }
+
+    /*! @ingroup resizing
+
+        \fn void CropResizeBatch(const View<A> & src, const std::vector<Rectangle<ptrdiff_t>> & rects, size_t width, size_t height, SimdCropResizeOutputType output, float scale, float shift, void * dst, SimdResizeMethodType method = SimdResizeMethodBilinear)
+
+        \short Crops a set of rectangles from input image and resizes each of them to the same output size. 
+
+        Input image must have 8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA format. 
+
+        \note This function is a C++ wrapper for function ::SimdCropResizeBatch.
+
+        \param [in] src - an original input image.
+        \param [in] rects - a set of rectangles (for example, objects found by Simd::Detection).
+        \param [in] width - a width of output images.
+        \param [in] height - a height of output images.
+        \param [in] output - a format of output tensor.
+        \param [in] scale - a scale of float output values.
+        \param [in] shift - a shift of float output values.
+        \param [out] dst - a pointer to output tensor. Its size must be equal to rects.size()*width*height*src.ChannelCount() elements.
+        \param [in] method - a resizing method. By default it is equal to ::SimdResizeMethodBilinear.
+    */
+    template<template<class> class A> SIMD_INLINE void CropResizeBatch(const View<A> & src, const std::vector<Rectangle<ptrdiff_t>> & rects, size_t width, size_t height, 
+        SimdCropResizeOutputType output, float scale, float shift, void * dst, SimdResizeMethodType method = SimdResizeMethodBilinear)
+    {
+        assert(src.ChannelSize() == 1);
+
+        SimdCropResizeBatch(src.data, src.stride, src.width, src.height, src.ChannelCount(), (const ptrdiff_t*)rects.data(), rects.size(), 
+            width, height, method, output, scale, shift, dst);
+    }
+
     /*! @ingroup segmentation
 
         \fn void SegmentationChangeIndex(View<A> & mask, uint8_t oldIndex, uint8_t newIndex)
@@ -2882,6 +3296,31 @@ namespace Simd
         SimdContourAnchors(src.data, src.stride, src.width, src.height, step, threshold, dst.data, dst.stride);
     }
 
+    /*! @ingroup contour
+
+        \fn void Canny(const View<A>& src, View<A>& dst, uint16_t low, uint16_t high)
+
+        \short Detects edges in the image with using of Canny algorithm. 
+
+        All images must have the same width and height. Input and output images must have 8-bit gray format. 
+        Magnitude of the gradient is estimated as abs(dx) + abs(dy) of Sobel's filter (it is in range [0, 2040]). 
+        Strong edges (local maxima with magnitude greater than high threshold) and weak edges (local maxima with magnitude 
+        greater than low threshold) connected with them are marked by 255 in the output mask.
+
+        \note This function is a C++ wrapper for function ::SimdCanny.
+
+        \param [in] src - an input 8-bit gray image.
+        \param [out] dst - an output 8-bit gray edge mask.
+        \param [in] low - a low threshold of gradient magnitude.
+        \param [in] high - a high threshold of gradient magnitude.
+    */
+    template<template<class> class A> SIMD_INLINE void Canny(const View<A>& src, View<A>& dst, uint16_t low, uint16_t high)
+    {
+        assert(EqualSize(src, dst) && src.format == View<A>::Gray8 && dst.format == View<A>::Gray8);
+
+        SimdCanny(src.data, src.stride, src.width, src.height, low, high, dst.data, dst.stride);
+    }
+
     /*! @ingroup correlation
 
         \fn void SquaredDifferenceSum(const View<A>& a, const View<A>& b, uint64_t & sum)
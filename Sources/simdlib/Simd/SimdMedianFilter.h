@@ -0,0 +1,155 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMedianFilter_h__
+#define __SimdMedianFilter_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        /*
+            Median filter of arbitrary radius with constant time per pixel (S. Perreault, P. Hebert, 2007).
+            Every column of the image has a two-level histogram (16 coarse and 256 fine 16-bit bins) of 2*radius + 1 
+            neighboring rows. It is updated per row by subtraction of the old row and addition of the new one.
+            The kernel histogram is updated per pixel by addition of right and subtraction of left column histogram.
+            Fine bins of the kernel are updated lazily: only the coarse bucket containing the median is brought up to date.
+            The image is processed by vertical stripes to keep column histograms in cache. 
+            Histogram addition, subtraction and search of the median bin (16 bins) are given by Hist class of the specific instruction set.
+        */
+        const size_t MEDIAN_FILTER_RADIUS_MAX = 127;
+        const size_t MEDIAN_FILTER_STRIPE = 512;
+
+        struct MedianHistogram
+        {
+            static SIMD_INLINE void Add(const uint16_t * src, uint16_t * dst)
+            {
+                for (size_t i = 0; i < 16; ++i)
+                    dst[i] += src[i];
+            }
+
+            static SIMD_INLINE void Sub(const uint16_t * src, uint16_t * dst)
+            {
+                for (size_t i = 0; i < 16; ++i)
+                    dst[i] -= src[i];
+            }
+
+            static SIMD_INLINE void AddSub(const uint16_t * add, const uint16_t * sub, uint16_t * dst)
+            {
+                for (size_t i = 0; i < 16; ++i)
+                    dst[i] += add[i] - sub[i];
+            }
+
+            static SIMD_INLINE size_t Find(const uint16_t * hist, size_t & sum, size_t threshold)
+            {
+                size_t index = 0;
+                for (; sum + hist[index] <= threshold; ++index)
+                    sum += hist[index];
+                return index;
+            }
+        };
+
+        SIMD_INLINE void MedianFilterUpdate(const uint8_t * src, size_t width, size_t channelCount, ptrdiff_t begin, size_t columns, 
+            uint16_t delta, uint16_t * coarse, uint16_t * fine)
+        {
+            for (size_t j = 0; j < columns; ++j)
+            {
+                const uint8_t * s = src + Simd::RestrictRange<ptrdiff_t>(begin + j, 0, width - 1)*channelCount;
+                for (size_t c = 0; c < channelCount; ++c)
+                {
+                    size_t value = s[c];
+                    coarse[(c*columns + j) * 16 + (value >> 4)] += delta;
+                    fine[((c * 16 + (value >> 4))*columns + j) * 16 + (value & 15)] += delta;
+                }
+            }
+        }
+
+        template<class Hist> void MedianFilterRun(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, 
+            size_t radius, uint8_t * dst, size_t dstStride)
+        {
+            assert(radius <= MEDIAN_FILTER_RADIUS_MAX);
+
+            const size_t window = 2 * radius + 1, threshold = 2 * radius*(radius + 1);
+            const size_t stripe = Simd::Min(Simd::Max(MEDIAN_FILTER_STRIPE / channelCount, window), width);
+            const ptrdiff_t last = height - 1;
+            Array<uint16_t> coarse(channelCount*(stripe + 2 * radius) * 16);
+            Array<uint16_t> fine(channelCount*(stripe + 2 * radius) * 16 * 16);
+            SIMD_ALIGNED(32) uint16_t kernelCoarse[16];
+            SIMD_ALIGNED(32) uint16_t kernelFine[16 * 16];
+            size_t update[16];
+
+            for (size_t x = 0; x < width; x += stripe)
+            {
+                size_t count = Simd::Min(stripe, width - x), columns = count + 2 * radius;
+                ptrdiff_t begin = x - radius;
+                coarse.Clear();
+                fine.Clear();
+                for (ptrdiff_t dy = -ptrdiff_t(radius); dy <= ptrdiff_t(radius); ++dy)
+                    MedianFilterUpdate(src + Simd::RestrictRange<ptrdiff_t>(dy, 0, last)*srcStride, width, channelCount, begin, columns, 1, coarse.data, fine.data);
+                for (ptrdiff_t y = 0; y <= last; ++y)
+                {
+                    if (y)
+                    {
+                        MedianFilterUpdate(src + Simd::Max<ptrdiff_t>(y - radius - 1, 0)*srcStride, width, channelCount, begin, columns, uint16_t(-1), coarse.data, fine.data);
+                        MedianFilterUpdate(src + Simd::Min<ptrdiff_t>(y + radius, last)*srcStride, width, channelCount, begin, columns, 1, coarse.data, fine.data);
+                    }
+                    uint8_t * d = dst + y*dstStride + x*channelCount;
+                    for (size_t c = 0; c < channelCount; ++c)
+                    {
+                        const uint16_t * hc = coarse.data + c*columns * 16;
+                        const uint16_t * hf = fine.data + c * 16 * columns * 16;
+                        memset(kernelCoarse, 0, sizeof(kernelCoarse));
+                        memset(update, 0, sizeof(update));
+                        for (size_t j = 0; j < window; ++j)
+                            Hist::Add(hc + j * 16, kernelCoarse);
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            size_t sum = 0, k = Hist::Find(kernelCoarse, sum, threshold);
+                            uint16_t * kf = kernelFine + k * 16;
+                            const uint16_t * hfk = hf + k*columns * 16;
+                            if (update[k] <= i)
+                            {
+                                memset(kf, 0, 16 * sizeof(uint16_t));
+                                for (size_t j = i; j < i + window; ++j)
+                                    Hist::Add(hfk + j * 16, kf);
+                                update[k] = i + window;
+                            }
+                            else
+                            {
+                                for (; update[k] < i + window; ++update[k])
+                                    Hist::AddSub(hfk + update[k] * 16, hfk + (update[k] - window) * 16, kf);
+                            }
+                            if (i + 1 < count)
+                                Hist::AddSub(hc + (i + window) * 16, hc + i * 16, kernelCoarse);
+                            d[i*channelCount + c] = uint8_t(k * 16 + Hist::Find(kf, sum, threshold));
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+#endif//__SimdMedianFilter_h__
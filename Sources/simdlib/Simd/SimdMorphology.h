@@ -0,0 +1,56 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMorphology_h__
+#define __SimdMorphology_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        // Elementwise row operation: dst[i] = min(a[i], b[i]) for erosion or max(a[i], b[i]) for dilation. It must support dst == a.
+        typedef void(*MorphologyRowPtr)(const uint8_t * a, const uint8_t * b, size_t size, uint8_t * dst);
+
+        // Masked blending: dst[i] = mask[i] == index ? dst[i] : src[i].
+        typedef void(*MorphologyBlendPtr)(const uint8_t * src, const uint8_t * mask, uint8_t index, size_t size, uint8_t * dst);
+
+        struct MorphologyFuncs
+        {
+            MorphologyRowPtr min, max;
+            MorphologyBlendPtr blend;
+        };
+
+        /*
+            Morphology with rectangular or cross structuring element. The vertical pass uses van Herk/Gil-Werman algorithm 
+            (3 row operations per output row for any window height), the horizontal pass uses doubling of window 
+            (log2(windowX) + 1 row operations per row), so all passes consist of vectorizable operations over whole rows.
+            If mask is not null then only points where mask is equal to index are changed.
+        */
+        void MorphologyRun(const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdMorphologyType type, SimdMorphologyShapeType shape, 
+            size_t windowX, size_t windowY, const uint8_t * mask, size_t maskStride, uint8_t index, uint8_t * dst, size_t dstStride, const MorphologyFuncs & funcs);
+    }
+}
+#endif//__SimdMorphology_h__
@@ -32,10 +32,6 @@
 #include <vector>
 #include <stack>
 
-#ifndef SIMD_CHECK_PERFORMANCE
-#define SIMD_CHECK_PERFORMANCE()
-#endif
-
 namespace Simd
 {
     namespace Motion
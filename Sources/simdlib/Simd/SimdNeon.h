@@ -79,6 +79,10 @@ namespace Simd
 		void BackgroundInitMask(const uint8_t * src, size_t srcStride, size_t width, size_t height,
 			uint8_t index, uint8_t value, uint8_t * dst, size_t dstStride);
 
+        void BayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride);
+
+        void BayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
         void BgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat);
 
         void BgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride);
@@ -100,12 +104,19 @@ namespace Simd
 
         void BgrToGray(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride);
 
+		void BgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride);
+
+		void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride);
+
 		void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
 		void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
 		void BgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+		void BilateralFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, SimdBilateralFilterType type,
+		    float sigmaSpace, float sigmaRange, size_t radius, uint8_t * dst, size_t dstStride);
+
 		void Binarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
 			uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType);
 
@@ -113,6 +124,8 @@ namespace Simd
 			uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative,
 			uint8_t * dst, size_t dstStride, SimdCompareType compareType);
 
+		void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride);
+
 		void ConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
 			uint8_t value, SimdCompareType compareType, uint32_t * count);
 
@@ -179,6 +192,12 @@ namespace Simd
 
         void FillBgra(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha);
 
+        void Filter2D8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, const int16_t * kernel, size_t kernelX, size_t kernelY,
+            int shift, int16_t bias, uint8_t * dst, size_t dstStride);
+
+        void Filter2D32f(const float * src, size_t srcStride, size_t width, size_t height, const float * kernel, size_t kernelX, size_t kernelY,
+            float * dst, size_t dstStride);
+
 #ifdef SIMD_NEON_FP16_ENABLE
         void Float32ToFloat16(const float * src, size_t size, uint16_t * dst);
 
@@ -194,6 +213,8 @@ namespace Simd
         void GaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
 			size_t channelCount, uint8_t * dst, size_t dstStride);
 
+        void GaussianBlur(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, float sigma, size_t radius, uint8_t * dst, size_t dstStride);
+
 		void GrayToBgr(const uint8_t *gray, size_t width, size_t height, size_t grayStride, uint8_t *bgr, size_t bgrStride);
 
 		void GrayToBgra(const uint8_t *gray, size_t width, size_t height, size_t grayStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha);
@@ -258,6 +279,11 @@ namespace Simd
 		void MedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
 			size_t channelCount, uint8_t * dst, size_t dstStride);
 
+		void MedianFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+
+		void Morphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdMorphologyType type, SimdMorphologyShapeType shape,
+		    size_t windowX, size_t windowY, const uint8_t * mask, size_t maskStride, uint8_t index, uint8_t * dst, size_t dstStride);
+
         void NeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
 
         void NeuralProductSum(const float * a, const float * b, size_t size, float * sum);
@@ -316,6 +342,12 @@ namespace Simd
 
         void NeuralPooling2x2Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
 
+        void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, 
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+        void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, 
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
         void OperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
 			size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
 
@@ -342,6 +374,12 @@ namespace Simd
 
 		void Reorder64bit(const uint8_t * src, size_t size, uint8_t * dst);
 
+		void ResizeArea(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+			uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
+
+		void ResizeBicubic(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+			uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
+
 		void ResizeBilinear(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
 			uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
 
@@ -380,6 +418,10 @@ namespace Simd
 		void ContourAnchors(const uint8_t * src, size_t srcStride, size_t width, size_t height,
 			size_t step, int16_t threshold, uint8_t * dst, size_t dstStride);
 
+		void CannyNms(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t low, uint16_t high, uint8_t * dst, size_t dstStride);
+
+		void CannyHysteresis(uint8_t * dst, size_t dstStride, size_t width, size_t height);
+
 		void SquaredDifferenceSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
 			size_t width, size_t height, uint64_t * sum);
 
@@ -450,6 +492,12 @@ namespace Simd
 
 		void Yuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
 			size_t width, size_t height, uint8_t * hue, size_t hueStride);
+
+		void Yuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+			size_t width, size_t height, uint8_t * hsl, size_t hslStride);
+
+		void Yuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+			size_t width, size_t height, uint8_t * hsv, size_t hsvStride);
 	}
 #endif// SIMD_NEON_ENABLE
 }
@@ -32,10 +32,6 @@
 #include <numeric>
 #include <random>
 
-#ifndef SIMD_CHECK_PERFORMANCE
-#define SIMD_CHECK_PERFORMANCE()
-#endif
-
 //#define SIMD_CHECK_OVERFLOW
 
 #if defined(SIMD_CHECK_OVERFLOW) && !defined(NDEBUG)
@@ -25,35 +25,284 @@
 #define __SimdParallel_hpp__
 
 #include <thread>
-#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <vector>
+#include <list>
+#include <memory>
+#include <algorithm>
+#include <exception>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 namespace Simd
 {
-    template<class Function> inline void Parallel(size_t begin, size_t end, const Function & function, size_t threadNumber, size_t blockStepMin = 1) 
+    /*! @ingroup cpp_parallel
+
+        \short Persistent pool of work threads.
+
+        The pool creates its threads once and reuses them for all parallel tasks. 
+        A task is split into row bands which are distributed between participating threads. 
+        A thread which has finished its own bands steals bands of other threads.
+        The calling thread always takes part in execution of its task, so nested tasks are safe.
+
+        \note Process-wide pool is available by function Simd::ThreadPool::Global and it is used by default by function Simd::Parallel.
+    */
+    class ThreadPool
     {
-        threadNumber = std::min<size_t>(threadNumber, std::thread::hardware_concurrency());
-        if (threadNumber <= 1)
-            function(0, begin, end);
-        else
+    public:
+        /*!
+            Creates a new pool of work threads.
+
+            \param [in] threadNumber - a maximal number of threads (including calling thread) which can execute one task.
+            \param [in] affinity - a hint to bind work threads to separate CPU cores (it is supported only on Linux).
+        */
+        ThreadPool(size_t threadNumber = std::thread::hardware_concurrency(), bool affinity = false)
+            : _stop(false)
+        {
+            size_t cores = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+            for (size_t i = 1; i < threadNumber; ++i)
+            {
+                _threads.push_back(std::thread(&ThreadPool::Work, this));
+                if (affinity)
+                    SetAffinity(_threads.back(), i%cores);
+            }
+        }
+
+        /*!
+            Stops and joins all work threads.
+        */
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _wakeup.notify_all();
+            for (size_t i = 0; i < _threads.size(); ++i)
+                _threads[i].join();
+        }
+
+        /*!
+            Gets maximal number of threads (including calling thread) which can execute one task.
+
+            \return a number of threads.
+        */
+        size_t Size() const
+        {
+            return _threads.size() + 1;
+        }
+
+        /*!
+            Executes function for range [begin, end) with using of several threads.
+
+            \param [in] begin - a begin of the range.
+            \param [in] end - an end of the range.
+            \param [in] function - a function with signature void(size_t thread, size_t begin, size_t end). 
+                                   Index of thread is unique for concurrently executed calls and is lesser than threadNumber.
+            \param [in] threadNumber - a number of threads.
+            \param [in] blockStepMin - a minimal step of the bands (begin of every band is aligned to this step).
+
+            \note If function throws then the rest bands are skipped and the exception is rethrown on the calling thread 
+                  (the first one if it is thrown by several threads) after all work threads have left the task.
+        */
+        template<class Function> void Run(size_t begin, size_t end, const Function & function, size_t threadNumber, size_t blockStepMin = 1)
+        {
+            threadNumber = std::min(threadNumber, Size());
+            blockStepMin = std::max<size_t>(blockStepMin, 1);
+            size_t blockCount = (end - begin + blockStepMin - 1) / blockStepMin;
+            if (threadNumber <= 1 || blockCount <= 1)
+            {
+                function(0, begin, end);
+                return;
+            }
+
+            Task task;
+            task.function = &function;
+            task.execute = Execute<Function>;
+            task.begin = begin;
+            task.end = end;
+            task.threadNumber = std::min(threadNumber, blockCount);
+            size_t bandCount = std::min(task.threadNumber * BANDS_PER_THREAD, blockCount);
+            task.bandSize = (blockCount + bandCount - 1) / bandCount * blockStepMin;
+            bandCount = (end - begin + task.bandSize - 1) / task.bandSize;
+            task.queues.reset(new Queue[task.threadNumber]);
+            for (size_t i = 0; i < task.threadNumber; ++i)
+            {
+                task.queues[i].next = bandCount * i / task.threadNumber;
+                task.queues[i].last = bandCount * (i + 1) / task.threadNumber;
+            }
+            task.slot = 1;
+            task.active = 0;
+
+            Guard guard(*this, task);
+            _wakeup.notify_all();
+
+            Process(task, 0);
+            guard.Finish();
+            if (task.error)
+                std::rethrow_exception(task.error);
+        }
+
+        /*!
+            Gets process-wide pool of work threads. The pool is created at first call.
+
+            \return a reference to the pool.
+        */
+        static ThreadPool & Global()
+        {
+            static ThreadPool pool;
+            return pool;
+        }
+
+    private:
+        static const size_t BANDS_PER_THREAD = 4;
+
+        struct Queue
+        {
+            std::atomic<size_t> next;
+            size_t last;
+        };
+
+        struct Task
+        {
+            const void * function;
+            void(*execute)(const void * function, size_t thread, size_t begin, size_t end);
+            size_t begin, end, bandSize, threadNumber, slot, active;
+            std::unique_ptr<Queue[]> queues;
+            std::exception_ptr error;
+        };
+
+        /* Publishes the task on the caller's stack and unpublishes it on any exit from Run: 
+           if function throws on the calling thread the remaining bands are dropped and 
+           the guard waits for work threads which are still executing the task before unwinding. */
+        struct Guard
         {
-            std::vector<std::future<void>> futures;
+            Guard(ThreadPool & pool, Task & task)
+                : _pool(pool), _task(task), _finished(false)
+            {
+                std::lock_guard<std::mutex> lock(_pool._mutex);
+                _it = _pool._tasks.insert(_pool._tasks.end(), &_task);
+            }
 
-            size_t blockSize = (end - begin + threadNumber - 1)/threadNumber;
-            if (blockStepMin > 1)
-                blockSize += blockSize%blockStepMin;
-            size_t blockBegin = begin;
-            size_t blockEnd = blockBegin + blockSize;
+            void Finish()
+            {
+                if (_finished)
+                    return;
+                _finished = true;
+                Drop(_task);
+                std::unique_lock<std::mutex> lock(_pool._mutex);
+                _pool._tasks.erase(_it);
+                _pool._finish.wait(lock, [this] { return _task.active == 0; });
+            }
 
-            for (size_t thread = 0; thread < threadNumber && blockBegin < end; ++thread)
+            ~Guard()
             {
-                futures.push_back(std::move(std::async(std::launch::async, [blockBegin, blockEnd, thread, &function] { function(thread, blockBegin, blockEnd); })));
-                blockBegin += blockSize;
-                blockEnd = std::min(blockBegin + blockSize, end);
+                Finish();
             }
 
-            for (size_t i = 0; i < futures.size(); ++i)
-                futures[i].wait();        
+        private:
+            ThreadPool & _pool;
+            Task & _task;
+            std::list<Task*>::iterator _it;
+            bool _finished;
+        };
+
+        std::vector<std::thread> _threads;
+        std::list<Task*> _tasks;
+        std::mutex _mutex;
+        std::condition_variable _wakeup, _finish;
+        bool _stop;
+
+        template<class Function> static void Execute(const void * function, size_t thread, size_t begin, size_t end)
+        {
+            (*(const Function*)function)(thread, begin, end);
+        }
+
+        static void Drop(Task & task)
+        {
+            for (size_t i = 0; i < task.threadNumber; ++i)
+                task.queues[i].next = task.queues[i].last;
         }
+
+        static void Process(Task & task, size_t slot)
+        {
+            for (size_t i = 0; i < task.threadNumber; ++i)
+            {
+                Queue & queue = task.queues[(slot + i) % task.threadNumber];
+                for (size_t band = queue.next++; band < queue.last; band = queue.next++)
+                {
+                    size_t begin = task.begin + band*task.bandSize;
+                    task.execute(task.function, slot, begin, std::min(begin + task.bandSize, task.end));
+                }
+            }
+        }
+
+        void Work()
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (!_stop)
+            {
+                Task * task = NULL;
+                for (std::list<Task*>::iterator it = _tasks.begin(); it != _tasks.end() && task == NULL; ++it)
+                    if ((*it)->slot < (*it)->threadNumber)
+                        task = *it;
+                if (task == NULL)
+                {
+                    _wakeup.wait(lock);
+                    continue;
+                }
+                size_t slot = task->slot++;
+                task->active++;
+                lock.unlock();
+                std::exception_ptr error;
+                try
+                {
+                    Process(*task, slot);
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                    Drop(*task);
+                }
+                lock.lock();
+                if (error && !task->error)
+                    task->error = error;
+                if (--task->active == 0)
+                    _finish.notify_all();
+            }
+        }
+
+        static void SetAffinity(std::thread & thread, size_t core)
+        {
+#if defined(__linux__)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(core, &set);
+            pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &set);
+#else
+            (void)thread;
+            (void)core;
+#endif
+        }
+    };
+
+    template<class Function> inline void Parallel(size_t begin, size_t end, const Function & function, size_t threadNumber, size_t blockStepMin, ThreadPool & pool)
+    {
+        pool.Run(begin, end, function, threadNumber, blockStepMin);
+    }
+
+    template<class Function> inline void Parallel(size_t begin, size_t end, const Function & function, size_t threadNumber, size_t blockStepMin = 1) 
+    {
+        threadNumber = std::min<size_t>(threadNumber, std::thread::hardware_concurrency());
+        if (threadNumber <= 1)
+            function(0, begin, end);
+        else
+            ThreadPool::Global().Run(begin, end, function, threadNumber, blockStepMin);
     }
 }
 
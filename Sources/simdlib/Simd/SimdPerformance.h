@@ -0,0 +1,165 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdPerformance_h__
+#define __SimdPerformance_h__
+
+#include "Simd/SimdDefs.h"
+
+#ifdef SIMD_PERFORMANCE_STATISTIC
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(SIMD_X86_ENABLE) || defined(SIMD_X64_ENABLE)
+#include <x86intrin.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE uint64_t PerformanceTicks()
+        {
+#if defined(SIMD_X86_ENABLE) || defined(SIMD_X64_ENABLE)
+            return __rdtsc();
+#else
+            return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+        }
+
+        class PerformanceMeasurer
+        {
+        public:
+            PerformanceMeasurer();
+
+            // Is called only by the thread which owns the measurer, so it needs no lock. 
+            // Counters are atomic only to be read safely by Report from other thread.
+            SIMD_INLINE void Add(uint64_t ticks, size_t pixels)
+            {
+                Store(_count, Load(_count) + 1);
+                Store(_total, Load(_total) + ticks);
+                Store(_min, std::min(Load(_min), ticks));
+                Store(_max, std::max(Load(_max), ticks));
+                Store(_pixels, Load(_pixels) + pixels);
+            }
+
+            void Combine(const PerformanceMeasurer & other);
+
+            uint64_t Count() const { return Load(_count); }
+
+            void Reset();
+
+            std::string Statistic(double ticksPerMs) const;
+
+        private:
+            typedef std::atomic<uint64_t> Counter;
+            Counter _count, _total, _min, _max, _pixels;
+
+            static SIMD_INLINE uint64_t Load(const Counter & counter) { return counter.load(std::memory_order_relaxed); }
+            static SIMD_INLINE void Store(Counter & counter, uint64_t value) { counter.store(value, std::memory_order_relaxed); }
+        };
+
+        class PerformanceMeasurerStorage
+        {
+        public:
+            static PerformanceMeasurerStorage s_storage;
+
+            PerformanceMeasurerStorage();
+
+            // Returns measurer of given block for current thread.
+            PerformanceMeasurer * Get(const char * name);
+
+            // The same as Get but name must be a static string (it is cached by its address).
+            PerformanceMeasurer * GetStatic(const char * name);
+
+            // Scopes measured with SimdPerformanceMeasurerEnter/Leave keep their start time in stack of current thread.
+            void Push(uint64_t ticks);
+            uint64_t Pop();
+
+            std::string Report();
+
+            void Reset();
+
+        private:
+            // Only owner thread modifies its measurers. The mutex guards insertion into measurers against concurrent Report and Reset.
+            struct Thread
+            {
+                std::mutex mutex;
+                std::map<std::string, PerformanceMeasurer> measurers;
+                std::map<const char *, PerformanceMeasurer *> statics;
+                std::vector<uint64_t> starts;
+            };
+            typedef std::unique_ptr<Thread> ThreadPtr;
+
+            Thread * Current();
+
+            std::mutex _mutex;
+            std::vector<ThreadPtr> _threads;
+            uint64_t _ticks;
+            std::chrono::steady_clock::time_point _time;
+        };
+
+        class PerformanceMeasurerHolder
+        {
+        public:
+            SIMD_INLINE PerformanceMeasurerHolder(const char * name, size_t pixels = 0)
+                : _measurer(name ? PerformanceMeasurerStorage::s_storage.GetStatic(name) : NULL)
+                , _pixels(pixels)
+                , _start(_measurer ? PerformanceTicks() : 0)
+            {
+            }
+
+            SIMD_INLINE ~PerformanceMeasurerHolder()
+            {
+                if (_measurer)
+                    _measurer->Add(PerformanceTicks() - _start, _pixels);
+            }
+
+        private:
+            PerformanceMeasurer * _measurer;
+            size_t _pixels;
+            uint64_t _start;
+        };
+    }
+}
+
+#define SIMD_PERF_FUNC() Simd::Base::PerformanceMeasurerHolder _simdPerformanceMeasurerHolder(__FUNCTION__)
+#define SIMD_PERF_BLOCK(name, pixels) Simd::Base::PerformanceMeasurerHolder _simdPerformanceMeasurerHolder(name, pixels)
+
+#else//SIMD_PERFORMANCE_STATISTIC
+
+#define SIMD_PERF_FUNC()
+#define SIMD_PERF_BLOCK(name, pixels)
+
+#endif//SIMD_PERFORMANCE_STATISTIC
+
+#endif//__SimdPerformance_h__
@@ -0,0 +1,390 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdPoolAllocator_hpp__
+#define __SimdPoolAllocator_hpp__
+
+#include "SimdAllocator.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <atomic>
+#include <vector>
+
+namespace Simd
+{
+    /*! @ingroup cpp_allocator
+
+        \short Process-wide pool of aligned memory blocks.
+
+        Released blocks are not returned to the system but are kept in the pool and reused by next allocations of the same size class.
+        Size classes grow with step of 1/4 of power of 2, so the size of a block exceeds the requested size no more than by 25%.
+        Every thread has its own small cache of free blocks, so the most of allocations and releases do not lock the pool.
+        Blocks greater than 2 GB or with alignment greater than 64 are not cached.
+
+        \note It is used by Simd::PoolAllocator. Cached memory is returned to the system by function Simd::MemoryPool::Clear.
+    */
+    class MemoryPool
+    {
+    public:
+        /*!
+            \short Statistics of the pool.
+        */
+        struct Statistic
+        {
+            size_t allocations; /*!< \brief A total number of allocations. */
+            size_t hits; /*!< \brief A number of allocations which reused cached blocks. */
+            size_t used; /*!< \brief A total size (in bytes) of blocks which are currently used. */
+            size_t cached; /*!< \brief A total size (in bytes) of blocks which are currently cached by the pool. */
+            size_t peak; /*!< \brief A peak total size (in bytes) of used and cached blocks. */
+        };
+
+        /*!
+            Gets process-wide memory pool. 
+
+            \note The pool is never destroyed, so it can be safely used from destructors of static objects and from work threads.
+
+            \return a reference to the global pool.
+        */
+        static MemoryPool & Global()
+        {
+            static MemoryPool * pool = new MemoryPool();
+            return *pool;
+        }
+
+        /*!
+            Allocates aligned memory block.
+
+            \param [in] size - a size of required memory block.
+            \param [in] align - an align of allocated memory address.
+            \return a pointer to allocated memory.
+        */
+        void * Allocate(size_t size, size_t align)
+        {
+            _allocations++;
+            size_t index, capacity;
+            if (!Class(size, align, index, capacity))
+                return Create(size, align, CLASS_COUNT, size);
+            Cache * cache = ThreadCache();
+            void * ptr = NULL;
+            if (cache && cache->blocks[index].size())
+            {
+                ptr = cache->blocks[index].back();
+                cache->blocks[index].pop_back();
+                cache->size -= capacity;
+            }
+            else
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_blocks[index].size())
+                {
+                    ptr = _blocks[index].back();
+                    _blocks[index].pop_back();
+                }
+            }
+            if (ptr == NULL)
+                return Create(capacity, ALIGN, index, capacity);
+            _hits++;
+            _cached -= capacity;
+            _used += capacity;
+            return ptr;
+        }
+
+        /*!
+            Releases memory block allocated by function Simd::MemoryPool::Allocate.
+
+            \param [in] ptr - a pointer to the memory block (it can be NULL).
+        */
+        void Free(void * ptr)
+        {
+            if (ptr == NULL)
+                return;
+            Header & header = GetHeader(ptr);
+            _used -= header.capacity;
+            if (header.index == CLASS_COUNT)
+            {
+                Destroy(ptr);
+                return;
+            }
+            _cached += header.capacity;
+            Cache * cache = ThreadCache();
+            if (cache && cache->blocks[header.index].size() < CACHE_BLOCKS && cache->size + header.capacity <= CACHE_SIZE)
+            {
+                cache->blocks[header.index].push_back(ptr);
+                cache->size += header.capacity;
+            }
+            else
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _blocks[header.index].push_back(ptr);
+            }
+        }
+
+        /*!
+            Returns all blocks cached by the pool (except of blocks cached by other threads) to the system.
+        */
+        void Clear()
+        {
+            Cache * cache = ThreadCache();
+            if (cache)
+                Release(*cache);
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (size_t i = 0; i < CLASS_COUNT; ++i)
+            {
+                for (size_t j = 0; j < _blocks[i].size(); ++j)
+                {
+                    _cached -= GetHeader(_blocks[i][j]).capacity;
+                    Destroy(_blocks[i][j]);
+                }
+                _blocks[i].clear();
+            }
+        }
+
+        /*!
+            Gets current statistics of the pool.
+
+            \return the statistics.
+        */
+        Statistic GetStatistic() const
+        {
+            Statistic statistic;
+            statistic.allocations = _allocations;
+            statistic.hits = _hits;
+            statistic.used = _used;
+            statistic.cached = _cached;
+            statistic.peak = _peak;
+            return statistic;
+        }
+
+    private:
+        enum
+        {
+            ALIGN = 64,
+            CLASS_MIN = 6,
+            CLASS_MAX = 31,
+            CLASS_COUNT = (CLASS_MAX - CLASS_MIN) * 4,
+            CACHE_BLOCKS = 4,
+            CACHE_SIZE = 64 * 1024 * 1024,
+        };
+
+        struct Header
+        {
+            void * raw;
+            size_t index, capacity;
+        };
+
+        struct Cache
+        {
+            std::vector<void*> blocks[CLASS_COUNT];
+            size_t size;
+            bool & destroyed;
+
+            Cache(bool & d) : size(0), destroyed(d) {}
+
+            ~Cache()
+            {
+                Global().Release(*this);
+                destroyed = true;
+            }
+        };
+
+        std::mutex _mutex;
+        std::vector<void*> _blocks[CLASS_COUNT];
+        std::atomic<size_t> _allocations, _hits, _used, _cached, _peak;
+
+        MemoryPool()
+            : _allocations(0), _hits(0), _used(0), _cached(0), _peak(0)
+        {
+        }
+
+        MemoryPool(const MemoryPool &);
+        MemoryPool & operator = (const MemoryPool &);
+
+        // Returns NULL if the cache of current thread is already destroyed (for example in destructors of static objects).
+        static Cache * ThreadCache()
+        {
+            thread_local bool destroyed = false;
+            if (destroyed)
+                return NULL;
+            thread_local Cache cache(destroyed);
+            return &cache;
+        }
+
+        static bool Class(size_t size, size_t align, size_t & index, size_t & capacity)
+        {
+            if (align > ALIGN)
+                return false;
+            size = std::max<size_t>(size, (size_t(1) << CLASS_MIN) + 1) - 1;
+            size_t log = CLASS_MIN;
+            while ((size >> log) > 1)
+                log++;
+            if (log >= CLASS_MAX)
+                return false;
+            size_t step = (size_t(1) << log) / 4;
+            size_t quarter = (size - (size_t(1) << log)) / step;
+            index = (log - CLASS_MIN) * 4 + quarter;
+            capacity = (size_t(1) << log) + (quarter + 1) * step;
+            return true;
+        }
+
+        static SIMD_INLINE Header & GetHeader(void * ptr)
+        {
+            return ((Header*)ptr)[-1];
+        }
+
+        void * Create(size_t size, size_t align, size_t index, size_t capacity)
+        {
+            size_t prefix = Allocator<char>::Align(sizeof(Header), std::max<size_t>(align, ALIGN));
+            void * raw = Allocator<char>::Allocate(prefix + size, std::max<size_t>(align, ALIGN));
+            if (raw == NULL)
+                return NULL;
+            void * ptr = (char*)raw + prefix;
+            Header & header = GetHeader(ptr);
+            header.raw = raw;
+            header.index = index;
+            header.capacity = capacity;
+            size_t total = (_used += capacity) + _cached;
+            for (size_t peak = _peak; total > peak && !_peak.compare_exchange_weak(peak, total);)
+                ;
+            return ptr;
+        }
+
+        static void Destroy(void * ptr)
+        {
+            Allocator<char>::Free(GetHeader(ptr).raw);
+        }
+
+        void Release(Cache & cache)
+        {
+            for (size_t i = 0; i < CLASS_COUNT; ++i)
+            {
+                for (size_t j = 0; j < cache.blocks[i].size(); ++j)
+                {
+                    _cached -= GetHeader(cache.blocks[i][j]).capacity;
+                    Destroy(cache.blocks[i][j]);
+                }
+                cache.blocks[i].clear();
+            }
+            cache.size = 0;
+        }
+    };
+
+    /*! @ingroup cpp_allocator
+
+        \short Aligned memory allocator which reuses memory blocks with using of Simd::MemoryPool.
+
+        It can be used instead of Simd::Allocator as template parameter of Simd::View, Simd::Frame, Simd::Pyramid, Simd::Detection and so on. 
+        Images which are created and destroyed for every frame (temporary buffers, Simd::View::Recreate and so on) 
+        do not call system memory allocator in steady state.
+
+        Using example:
+        \verbatim
+        #include "Simd/SimdPoolAllocator.hpp"
+        #include "Simd/SimdView.hpp"
+
+        typedef Simd::View<Simd::PoolAllocator> View;
+
+        void Process(const View & src)
+        {
+            View gray(src.Size(), View::Gray8); // The memory is taken from the pool.
+            //...
+        }
+        \endverbatim
+
+        \note Also it can be used as an allocator for STL containers.
+    */
+    template <class T> struct PoolAllocator : public Allocator<T>
+    {
+        /*!
+            \fn void * Allocate(size_t size, size_t align);
+
+            \short Allocates aligned memory block from the pool.
+
+            \note The memory allocated by this function is must be deleted by function Simd::PoolAllocator::Free.
+
+            \param [in] size - a size of required memory block.
+            \param [in] align - an align of allocated memory address.
+            \return a pointer to allocated memory.
+        */
+        static SIMD_INLINE void * Allocate(size_t size, size_t align)
+        {
+            return MemoryPool::Global().Allocate(size, align);
+        }
+
+        /*!
+            \fn void Free(void * ptr);
+
+            \short Returns aligned memory block to the pool.
+
+            \note This function frees a memory allocated by function Simd::PoolAllocator::Allocate.
+
+            \param [in] ptr - a pointer to the memory to be deleted.
+        */
+        static SIMD_INLINE void Free(void * ptr)
+        {
+            MemoryPool::Global().Free(ptr);
+        }
+
+        //---------------------------------------------------------------------
+        // STL allocator interface implementation:
+
+        typedef typename Allocator<T>::pointer pointer;
+        typedef typename Allocator<T>::size_type size_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef PoolAllocator<U> other;
+        };
+
+        SIMD_INLINE PoolAllocator()
+        {
+        }
+
+        template <typename U> SIMD_INLINE PoolAllocator(const PoolAllocator<U> & a)
+        {
+        }
+
+        SIMD_INLINE pointer allocate(size_type size, const void * ptr = NULL)
+        {
+            return static_cast<pointer>(Allocate(size * sizeof(T), Allocator<T>::Alignment()));
+        }
+
+        SIMD_INLINE void deallocate(pointer ptr, size_type size)
+        {
+            Free(ptr);
+        }
+    };
+
+    template<typename T1, typename T2> SIMD_INLINE bool operator == (const PoolAllocator<T1> & a1, const PoolAllocator<T2> & a2)
+    {
+        return true;
+    }
+
+    template<typename T1, typename T2> SIMD_INLINE bool operator != (const PoolAllocator<T1> & a1, const PoolAllocator<T2> & a2)
+    {
+        return false;
+    }
+}
+
+#endif//__SimdPoolAllocator_hpp__
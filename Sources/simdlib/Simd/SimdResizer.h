@@ -0,0 +1,451 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdResizer_h__
+#define __SimdResizer_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        /*
+            Table of area averaging: destination pixel i covers source interval [i*src/dst, (i+1)*src/dst), 
+            the sum of weights of each destination pixel is equal to 1. Element i of destination is the sum of 
+            taps source elements index[k*size + i] with weights alpha[k*size + i] (unused taps have zero weights). 
+            Indexes are given in elements (the pixel index is multiplied by channelCount and channel offset is added).
+            Number of really covered source pixels of destination pixel i is stored in count[i].
+        */
+        struct ResizeAreaIndex
+        {
+            Array<int> index, count;
+            Array<float> alpha;
+            size_t size, taps;
+
+            void Init(size_t srcSize, size_t dstSize, size_t channelCount);
+        };
+
+        /*
+            Table of bicubic interpolation (Catmull-Rom spline, a = -0.5) with replication of border pixels.
+            Element i of destination is the sum of 4 source elements index[k*size + i] with weights alpha[k*size + i].
+            Indexes are given in elements (the pixel index is multiplied by channelCount and channel offset is added).
+        */
+        struct ResizeBicubicIndex
+        {
+            Array<int> index;
+            Array<float> alpha;
+            size_t size;
+
+            void Init(size_t srcSize, size_t dstSize, size_t channelCount);
+        };
+
+        /*
+            Cache of 4 horizontally interpolated source rows used by bicubic resizing.
+        */
+        class ResizeBicubicRows
+        {
+        public:
+            void Init(size_t size)
+            {
+                _stride = AlignHi(size, SIMD_ALIGN);
+                _buffer.Resize(4 * _stride);
+                Reset();
+            }
+
+            void Reset()
+            {
+                for (size_t k = 0; k < 4; ++k)
+                    _row[k] = -1;
+            }
+
+            float * Get(int row)
+            {
+                for (size_t k = 0; k < 4; ++k)
+                    if (_row[k] == row)
+                        return _buffer.data + k*_stride;
+                return NULL;
+            }
+
+            // Returns a buffer for given row. The buffer is taken from rows which are not needed for the current 
+            // destination row (they are stored in need[0], need[step], need[2*step], need[3*step]).
+            float * Set(int row, const int * need, size_t step)
+            {
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    if (_row[k] != need[0] && _row[k] != need[step] && _row[k] != need[2 * step] && _row[k] != need[3 * step])
+                    {
+                        _row[k] = row;
+                        return _buffer.data + k*_stride;
+                    }
+                }
+                assert(0);
+                return NULL;
+            }
+
+        private:
+            size_t _stride;
+            Array<float> _buffer;
+            int _row[4];
+        };
+
+        void ResizeAreaX(const float * src, const ResizeAreaIndex & index, size_t begin, uint8_t * dst);
+
+        void ResizeBicubicX(const uint8_t * src, const ResizeBicubicIndex & index, size_t begin, float * dst);
+
+        SIMD_INLINE uint8_t ResizeRound(float value)
+        {
+            return (uint8_t)RestrictRange(Round(value));
+        }
+
+        struct ResParam
+        {
+            size_t srcW, srcH, dstW, dstH, channels;
+            SimdResizeMethodType method;
+
+            ResParam(size_t srcW_, size_t srcH_, size_t dstW_, size_t dstH_, size_t channels_, SimdResizeMethodType method_)
+                : srcW(srcW_), srcH(srcH_), dstW(dstW_), dstH(dstH_), channels(channels_), method(method_)
+            {
+            }
+        };
+
+        /*
+            Resizing context: all index and coefficient tables and intermediate buffers are created once 
+            for given geometry, so Run can be called for many images without any allocations.
+        */
+        class Resizer
+        {
+        public:
+            Resizer(const ResParam & param) 
+                : _param(param) 
+            {
+                _convert.dst = NULL;
+            }
+
+            virtual ~Resizer() 
+            {
+            }
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
+
+            /*
+                Resizes image to float tensor (HWC or CHW): dst = resized*scale + shift. 
+                Every output row is converted by Next just after Run has written it to one row buffer.
+            */
+            void Run32f(const uint8_t * src, size_t srcStride, float * dst, SimdCropResizeOutputType output, float scale, float shift);
+
+            const ResParam & Param() const 
+            { 
+                return _param; 
+            }
+
+        protected:
+            // Returns a pointer to the next output row. It must be used by Run instead of dst + dstStride.
+            SIMD_INLINE uint8_t * Next(uint8_t * dst, size_t dstStride)
+            {
+                if (_convert.dst == NULL)
+                    return dst + dstStride;
+                Convert(dst);
+                return dst;
+            }
+
+            ResParam _param;
+
+        private:
+            void Convert(const uint8_t * row);
+
+            struct Converter
+            {
+                float * dst;
+                SimdCropResizeOutputType output;
+                float scale, shift;
+            } _convert;
+            Array<uint8_t> _row;
+        };
+
+        class ResizerByteBilinear : public Resizer
+        {
+        public:
+            ResizerByteBilinear(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        protected:
+            Array<int> _ax, _ix, _ay, _iy, _bx[2];
+        };
+
+        class ResizerByteArea : public Resizer
+        {
+        public:
+            ResizerByteArea(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        protected:
+            ResizeAreaIndex _ix, _iy;
+            Array<float> _bx;
+        };
+
+        class ResizerByteBicubic : public Resizer
+        {
+        public:
+            ResizerByteBicubic(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        protected:
+            ResizeBicubicIndex _ix, _iy;
+            ResizeBicubicRows _rows;
+        };
+
+        void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        class ResizerByteBilinear : public Base::Resizer
+        {
+        public:
+            ResizerByteBilinear(const Base::ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        protected:
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            Array<uint8_t> _bx[2];
+            Array<int16_t> _ax;
+            Array<int> _ix, _ay, _iy;
+        };
+
+        class ResizerByteArea : public Base::ResizerByteArea
+        {
+        public:
+            ResizerByteArea(const Base::ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        class ResizerByteBicubic : public Base::ResizerByteBicubic
+        {
+        public:
+            ResizerByteBicubic(const Base::ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_SSSE3_ENABLE    
+    namespace Ssse3
+    {
+        class ResizerByteBilinear : public Base::Resizer
+        {
+        public:
+            ResizerByteBilinear(const Base::ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            struct Index
+            {
+                int src, dst;
+                uint8_t shuffle[A];
+            };
+
+        protected:
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            void RunGray(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            size_t _blocks;
+            Array<uint8_t> _ax, _bx[2];
+            Array<int> _ix, _ay, _iy;
+            Array<Index> _ixg;
+        };
+
+        void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method);
+    }
+#endif//SIMD_SSSE3_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class ResizerByteBilinear : public Base::Resizer
+        {
+        public:
+            ResizerByteBilinear(const Base::ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            struct Index
+            {
+                int src, dst;
+                uint8_t shuffle[A];
+            };
+
+        protected:
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            void RunGray(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            size_t _blocks;
+            Array<uint8_t> _ax, _bx[2];
+            Array<int> _ix, _ay, _iy;
+            Array<Index> _ixg;
+        };
+
+        class ResizerByteArea : public Base::ResizerByteArea
+        {
+        public:
+            ResizerByteArea(const Base::ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        class ResizerByteBicubic : public Base::ResizerByteBicubic
+        {
+        public:
+            ResizerByteBicubic(const Base::ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        protected:
+            size_t _lastEnd;
+        };
+
+        void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method);
+    }
+#endif//SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class ResizerByteBilinear : public Base::Resizer
+        {
+        public:
+            ResizerByteBilinear(const Base::ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            struct Index
+            {
+                int src, dst;
+                uint8_t shuffle[Avx2::A];
+            };
+
+        protected:
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            void RunGray(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            size_t _blocks;
+            Array<uint8_t> _ax, _bx[2];
+            Array<int> _ix, _ay, _iy;
+            Array<Index> _ixg;
+        };
+
+        class ResizerByteArea : public Base::ResizerByteArea
+        {
+        public:
+            ResizerByteArea(const Base::ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        class ResizerByteBicubic : public Base::ResizerByteBicubic
+        {
+        public:
+            ResizerByteBicubic(const Base::ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        protected:
+            size_t _lastEnd;
+        };
+
+        void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method);
+    }
+#endif//SIMD_AVX512BW_ENABLE
+
+#ifdef SIMD_VMX_ENABLE    
+    namespace Vmx
+    {
+        class ResizerByteBilinear : public Base::Resizer
+        {
+        public:
+            ResizerByteBilinear(const Base::ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        protected:
+            template<size_t N, bool align> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            Array<uint8_t> _ax, _bx[2];
+            Array<int> _ix, _ay, _iy;
+        };
+
+        void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method);
+    }
+#endif//SIMD_VMX_ENABLE
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        class ResizerByteBilinear : public Base::Resizer
+        {
+        public:
+            ResizerByteBilinear(const Base::ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        protected:
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            Array<uint8_t> _ax, _bx[2];
+            Array<int> _ix, _ay, _iy;
+        };
+
+        class ResizerByteArea : public Base::ResizerByteArea
+        {
+        public:
+            ResizerByteArea(const Base::ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        class ResizerByteBicubic : public Base::ResizerByteBicubic
+        {
+        public:
+            ResizerByteBicubic(const Base::ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method);
+    }
+#endif//SIMD_NEON_ENABLE
+}
+
+#endif//__SimdResizer_h__
@@ -0,0 +1,128 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdResizer_hpp__
+#define __SimdResizer_hpp__
+
+#include "SimdLib.hpp"
+
+namespace Simd
+{
+    /*! @ingroup cpp_resizer
+
+        \short The Resizer structure keeps resize context (index and coefficient tables and row buffers) for fixed geometry.
+
+        It is useful for resizing of video frames, when sizes of input and output images are not changed.
+
+        Using example:
+        \code
+        #include "Simd/SimdResizer.hpp"
+
+        typedef Simd::View<Simd::Allocator> View;
+
+        void Resize(const std::vector<View> & src, std::vector<View> & dst)
+        {
+            Simd::Resizer resizer;
+            for (size_t i = 0; i < src.size(); ++i)
+                resizer.Run(src[i], dst[i], SimdResizeMethodArea);
+        }
+        \endcode
+
+        \note This is wrapper around low-level functions ::SimdResizerInit, ::SimdResizerRun and ::SimdResizerFree.
+    */
+    struct Resizer
+    {
+        /*!
+            Creates a new empty Resizer structure. The context is created at first call of Run.
+        */
+        Resizer()
+            : _context(NULL)
+            , _srcX(0), _srcY(0), _dstX(0), _dstY(0), _channels(0)
+            , _method(SimdResizeMethodBilinear)
+        {
+        }
+
+        /*!
+            Releases resize context.
+        */
+        ~Resizer()
+        {
+            Release();
+        }
+
+        /*!
+            Initializes resize context for given geometry. It does nothing if the context already has the same geometry.
+
+            \param [in] srcX - a width of the input image.
+            \param [in] srcY - a height of the input image.
+            \param [in] dstX - a width of the output image.
+            \param [in] dstY - a height of the output image.
+            \param [in] channels - a channel count.
+            \param [in] method - a resizing method.
+            \return a result of this operation.
+        */
+        bool Init(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method)
+        {
+            if (_context && _srcX == srcX && _srcY == srcY && _dstX == dstX && _dstY == dstY && _channels == channels && _method == method)
+                return true;
+            Release();
+            _context = ::SimdResizerInit(srcX, srcY, dstX, dstY, channels, method);
+            _srcX = srcX, _srcY = srcY, _dstX = dstX, _dstY = dstY, _channels = channels, _method = method;
+            return _context != NULL;
+        }
+
+        /*!
+            Performs resizing of input image. The context is (re)created if geometry of the images was changed.
+
+            \param [in] src - an original input image.
+            \param [out] dst - a resized output image. It must have the same format as input image.
+            \param [in] method - a resizing method. By default it is equal to ::SimdResizeMethodBilinear.
+        */
+        template<template<class> class A> void Run(const View<A> & src, View<A> & dst, SimdResizeMethodType method = SimdResizeMethodBilinear)
+        {
+            assert(src.format == dst.format && src.ChannelSize() == 1);
+
+            if (Init(src.width, src.height, dst.width, dst.height, src.ChannelCount(), method))
+                ::SimdResizerRun(_context, src.data, src.stride, dst.data, dst.stride);
+        }
+
+    private:
+        Resizer(const Resizer &);
+        Resizer & operator = (const Resizer &);
+
+        void Release()
+        {
+            if (_context)
+            {
+                ::SimdResizerFree(_context);
+                _context = NULL;
+            }
+        }
+
+        void * _context;
+        size_t _srcX, _srcY, _dstX, _dstY, _channels;
+        SimdResizeMethodType _method;
+    };
+}
+
+#endif//__SimdResizer_hpp__
@@ -699,6 +699,9 @@ namespace Simd
 
     template <template<class> class A> SIMD_INLINE void View<A>::Recreate(size_t w, size_t h, Format f, void * d, size_t align)
     {
+        if(_owner && data && d == NULL && w == width && h == height && f == format && 
+            stride == (ptrdiff_t)Allocator::Align(w*PixelSize(f), align) && Allocator::Align(data, align) == data)
+            return;
         if(_owner && data)
         {
             Allocator::Free(data);
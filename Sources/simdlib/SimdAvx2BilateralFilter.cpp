@@ -0,0 +1,121 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBilateralFilter.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        const size_t BILATERAL_FILTER_BLOCK = 8;
+
+        template<size_t channelCount> SIMD_INLINE void BilateralFilterExact(const uint8_t * const * rows, size_t window, size_t radius, 
+            const Base::BilateralFilterTap * taps, size_t tapCount, const float * range, size_t offset, uint8_t * dst)
+        {
+            __m256i center[channelCount];
+            __m256 sum[channelCount], norm = _mm256_setzero_ps();
+            for (size_t c = 0; c < channelCount; ++c)
+            {
+                center[c] = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(rows[c*window + radius] + offset)));
+                sum[c] = _mm256_setzero_ps();
+            }
+            for (size_t t = 0; t < tapCount; ++t)
+            {
+                __m256i value[channelCount], distance = K_ZERO;
+                for (size_t c = 0; c < channelCount; ++c)
+                {
+                    value[c] = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(rows[c*window + taps[t].row] + offset + taps[t].col)));
+                    distance = _mm256_add_epi32(distance, _mm256_abs_epi32(_mm256_sub_epi32(value[c], center[c])));
+                }
+                __m256 weight = _mm256_mul_ps(_mm256_set1_ps(taps[t].weight), _mm256_i32gather_ps(range, distance, 4));
+                norm = _mm256_add_ps(norm, weight);
+                for (size_t c = 0; c < channelCount; ++c)
+                    sum[c] = _mm256_fmadd_ps(_mm256_cvtepi32_ps(value[c]), weight, sum[c]);
+            }
+            SIMD_ALIGNED(16) uint8_t buffer[channelCount][Sse2::A];
+            for (size_t c = 0; c < channelCount; ++c)
+            {
+                __m256i result = _mm256_cvtps_epi32(_mm256_div_ps(sum[c], norm));
+                __m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(result), _mm256_extracti128_si256(result, 1));
+                _mm_store_si128((__m128i*)buffer[c], _mm_packus_epi16(packed, Sse2::K_ZERO));
+            }
+            for (size_t i = 0; i < BILATERAL_FILTER_BLOCK; ++i)
+                for (size_t c = 0; c < channelCount; ++c)
+                    dst[i*channelCount + c] = buffer[c][i];
+        }
+
+        template<size_t channelCount> void BilateralFilterExact(const uint8_t * const * rows, size_t radius,
+            const Base::BilateralFilterTap * taps, size_t tapCount, const float * range, size_t width, uint8_t * dst)
+        {
+            size_t window = 2 * radius + 1, alignedWidth = AlignLo(width, BILATERAL_FILTER_BLOCK);
+            for (size_t x = 0; x < alignedWidth; x += BILATERAL_FILTER_BLOCK)
+                BilateralFilterExact<channelCount>(rows, window, radius, taps, tapCount, range, x, dst + x*channelCount);
+            if (alignedWidth != width)
+            {
+                uint8_t tail[BILATERAL_FILTER_BLOCK*channelCount];
+                BilateralFilterExact<channelCount>(rows, window, radius, taps, tapCount, range, alignedWidth, tail);
+                memcpy(dst + alignedWidth*channelCount, tail, (width - alignedWidth)*channelCount);
+            }
+        }
+
+        void BilateralFilterExact(const uint8_t * const * rows, size_t channelCount, size_t radius,
+            const Base::BilateralFilterTap * taps, size_t tapCount, const float * range, size_t width, uint8_t * dst)
+        {
+            switch (channelCount)
+            {
+            case 1: BilateralFilterExact<1>(rows, radius, taps, tapCount, range, width, dst); break;
+            case 2: BilateralFilterExact<2>(rows, radius, taps, tapCount, range, width, dst); break;
+            case 3: BilateralFilterExact<3>(rows, radius, taps, tapCount, range, width, dst); break;
+            case 4: BilateralFilterExact<4>(rows, radius, taps, tapCount, range, width, dst); break;
+            }
+        }
+
+        void BilateralFilterRecursive(const float * src, const float * prev, const float * weight, size_t width, size_t planes, size_t stride, float inv, float * dst)
+        {
+            size_t alignedWidth = AlignLo(width, F);
+            __m256 _inv = _mm256_set1_ps(inv);
+            for (size_t p = 0, offset = 0; p < planes; ++p, offset += stride)
+            {
+                for (size_t x = 0; x < alignedWidth; x += F)
+                    _mm256_storeu_ps(dst + offset + x, _mm256_fmadd_ps(_mm256_loadu_ps(src + offset + x), _inv, 
+                        _mm256_mul_ps(_mm256_loadu_ps(prev + offset + x), _mm256_loadu_ps(weight + x))));
+                for (size_t x = alignedWidth; x < width; ++x)
+                    dst[offset + x] = src[offset + x] * inv + prev[offset + x] * weight[x];
+            }
+        }
+
+        void BilateralFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, SimdBilateralFilterType type,
+            float sigmaSpace, float sigmaRange, size_t radius, uint8_t * dst, size_t dstStride)
+        {
+            if (type == SimdBilateralFilterFast)
+                Base::BilateralFilterFastRun(src, srcStride, width, height, channelCount, sigmaSpace, sigmaRange, dst, dstStride, BilateralFilterRecursive);
+            else
+                Base::BilateralFilterExactRun(src, srcStride, width, height, channelCount, sigmaSpace, sigmaRange,
+                    Base::BilateralFilterRadius(sigmaSpace, radius), dst, dstStride, BilateralFilterExact);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,81 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBoxFilter.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE void BoxFilterCol(const uint8_t * add, const uint8_t * sub, uint16_t * cols)
+        {
+            __m256i _add = _mm256_loadu_si256((__m256i*)add);
+            __m256i _sub = _mm256_loadu_si256((__m256i*)sub);
+            __m256i lo = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm256_castsi256_si128(_add)), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(_sub)));
+            __m256i hi = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm256_extracti128_si256(_add, 1)), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(_sub, 1)));
+            _mm256_storeu_si256((__m256i*)cols + 0, _mm256_add_epi16(_mm256_loadu_si256((__m256i*)cols + 0), lo));
+            _mm256_storeu_si256((__m256i*)cols + 1, _mm256_add_epi16(_mm256_loadu_si256((__m256i*)cols + 1), hi));
+        }
+
+        void BoxFilterCol(const uint8_t * add, const uint8_t * sub, size_t size, uint16_t * cols)
+        {
+            size_t alignedSize = AlignLo(size, A), i = 0;
+            for (; i < alignedSize; i += A)
+                BoxFilterCol(add + i, sub + i, cols + i);
+            for (; i < size; ++i)
+                cols[i] += add[i] - sub[i];
+        }
+
+        SIMD_INLINE __m256i BoxFilterNorm(const uint32_t * sums, __m256 scale)
+        {
+            __m256i lo = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_loadu_si256((__m256i*)sums + 0)), scale));
+            __m256i hi = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_loadu_si256((__m256i*)sums + 1)), scale));
+            return PackI32ToI16(lo, hi);
+        }
+
+        SIMD_INLINE void BoxFilterNorm(const uint32_t * sums, __m256 scale, uint8_t * dst)
+        {
+            _mm256_storeu_si256((__m256i*)dst, PackU16ToU8(BoxFilterNorm(sums + 0, scale), BoxFilterNorm(sums + HA, scale)));
+        }
+
+        void BoxFilterNorm(const uint32_t * sums, size_t size, float scale, uint8_t * dst)
+        {
+            assert(size >= A);
+            __m256 _scale = _mm256_set1_ps(scale);
+            size_t alignedSize = AlignLo(size, A);
+            for (size_t i = 0; i < alignedSize; i += A)
+                BoxFilterNorm(sums + i, _scale, dst + i);
+            if (alignedSize != size)
+                BoxFilterNorm(sums + size - A, _scale, dst + size - A);
+        }
+
+        void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride)
+        {
+            Base::BoxFilterRun(src, srcStride, width, height, channelCount, windowX, windowY, dst, dstStride, BoxFilterCol, BoxFilterNorm);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,126 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdCanny.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i LoadCanny(const uint8_t * p)
+        {
+            return _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)p));
+        }
+
+        SIMD_INLINE void CannyGradientBlock(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t x, int16_t * dx, int16_t * dy, int16_t * mag)
+        {
+            __m256i s0l = LoadCanny(src0 + x - 1), s0c = LoadCanny(src0 + x), s0r = LoadCanny(src0 + x + 1);
+            __m256i s1l = LoadCanny(src1 + x - 1), s1r = LoadCanny(src1 + x + 1);
+            __m256i s2l = LoadCanny(src2 + x - 1), s2c = LoadCanny(src2 + x), s2r = LoadCanny(src2 + x + 1);
+            __m256i _dx = _mm256_sub_epi16(_mm256_add_epi16(_mm256_add_epi16(s0r, s2r), _mm256_slli_epi16(s1r, 1)),
+                _mm256_add_epi16(_mm256_add_epi16(s0l, s2l), _mm256_slli_epi16(s1l, 1)));
+            __m256i _dy = _mm256_sub_epi16(_mm256_add_epi16(_mm256_add_epi16(s2l, s2r), _mm256_slli_epi16(s2c, 1)),
+                _mm256_add_epi16(_mm256_add_epi16(s0l, s0r), _mm256_slli_epi16(s0c, 1)));
+            _mm256_storeu_si256((__m256i*)(dx + x), _dx);
+            _mm256_storeu_si256((__m256i*)(dy + x), _dy);
+            _mm256_storeu_si256((__m256i*)(mag + x), _mm256_add_epi16(_mm256_abs_epi16(_dx), _mm256_abs_epi16(_dy)));
+        }
+
+        void CannyGradient(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t width, int16_t * dx, int16_t * dy, int16_t * mag)
+        {
+            assert(width >= HA);
+            size_t alignedWidth = AlignLo(width, HA);
+            for (size_t x = 0; x < alignedWidth; x += HA)
+                CannyGradientBlock(src0, src1, src2, x, dx, dy, mag);
+            if (alignedWidth != width)
+                CannyGradientBlock(src0, src1, src2, width - HA, dx, dy, mag);
+        }
+
+        SIMD_INLINE __m256i LoadCanny(const int16_t * p)
+        {
+            return _mm256_loadu_si256((__m256i*)p);
+        }
+
+        SIMD_INLINE void CannySuppressBlock(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2,
+            size_t x, __m256i low, __m256i high, uint8_t * dst)
+        {
+            static const __m256i K16_0012 = SIMD_MM256_SET1_EPI16(12);
+            static const __m256i K16_0029 = SIMD_MM256_SET1_EPI16(29);
+            __m256i _dx = LoadCanny(dx + x), _dy = LoadCanny(dy + x);
+            __m256i adx = _mm256_abs_epi16(_dx), ady = _mm256_abs_epi16(_dy);
+            __m256i hor = _mm256_cmpgt_epi16(_mm256_mullo_epi16(adx, K16_0012), _mm256_mullo_epi16(ady, K16_0029));
+            __m256i ver = _mm256_cmpgt_epi16(_mm256_mullo_epi16(ady, K16_0012), _mm256_mullo_epi16(adx, K16_0029));
+            __m256i same = _mm256_cmpgt_epi16(_mm256_xor_si256(_dx, _dy), _mm256_set1_epi16(-1));
+            __m256i a = _mm256_blendv_epi8(LoadCanny(mag0 + x + 1), LoadCanny(mag0 + x - 1), same);
+            __m256i b = _mm256_blendv_epi8(LoadCanny(mag2 + x - 1), LoadCanny(mag2 + x + 1), same);
+            a = _mm256_blendv_epi8(a, LoadCanny(mag0 + x), ver);
+            b = _mm256_blendv_epi8(b, LoadCanny(mag2 + x), ver);
+            a = _mm256_blendv_epi8(a, LoadCanny(mag1 + x - 1), hor);
+            b = _mm256_blendv_epi8(b, LoadCanny(mag1 + x + 1), hor);
+            __m256i m = LoadCanny(mag1 + x);
+            __m256i weak = _mm256_cmpgt_epi16(m, low), strong = _mm256_cmpgt_epi16(m, high);
+            __m256i max = _mm256_andnot_si256(_mm256_cmpgt_epi16(b, m), _mm256_cmpgt_epi16(m, a));
+            __m256i label = _mm256_and_si256(max, _mm256_sub_epi16(K_ZERO, _mm256_add_epi16(weak, strong)));
+            _mm_storeu_si128((__m128i*)(dst + x), _mm_packus_epi16(_mm256_castsi256_si128(label), _mm256_extracti128_si256(label, 1)));
+        }
+
+        void CannySuppress(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2,
+            size_t width, int16_t low, int16_t high, uint8_t * dst)
+        {
+            assert(width >= HA);
+            size_t alignedWidth = AlignLo(width, HA);
+            __m256i _low = _mm256_set1_epi16(low), _high = _mm256_set1_epi16(high);
+            for (size_t x = 0; x < alignedWidth; x += HA)
+                CannySuppressBlock(dx, dy, mag0, mag1, mag2, x, _low, _high, dst);
+            if (alignedWidth != width)
+                CannySuppressBlock(dx, dy, mag0, mag1, mag2, width - HA, _low, _high, dst);
+        }
+
+        size_t CannyFind(const uint8_t * row, size_t begin, size_t width)
+        {
+            const __m256i strong = _mm256_set1_epi8(Base::CANNY_STRONG);
+            size_t x = begin;
+            for (; x + A <= width; x += A)
+                if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i*)(row + x)), strong)))
+                    break;
+            for (; x < width; ++x)
+                if (row[x] == Base::CANNY_STRONG)
+                    return x;
+            return width;
+        }
+
+        void CannyNms(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t low, uint16_t high, uint8_t * dst, size_t dstStride)
+        {
+            Base::CannyNmsRun(src, srcStride, width, height, low, high, dst, dstStride, CannyGradient, CannySuppress);
+        }
+
+        void CannyHysteresis(uint8_t * dst, size_t dstStride, size_t width, size_t height)
+        {
+            Base::CannyHysteresisRun(dst, dstStride, width, height, CannyFind);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,229 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdFilter2D.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i LoadFilter2D(const uint8_t * p)
+        {
+            return _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)p));
+        }
+
+        SIMD_INLINE void Filter2D8uDirect(const uint8_t * const * rows, size_t offset, const int16_t * kernel, size_t kernelX, size_t kernelY,
+            __m256i round, __m128i shift, __m256i bias, uint8_t * dst)
+        {
+            __m256i sum0 = _mm256_setzero_si256(), sum1 = _mm256_setzero_si256();
+            for (size_t ky = 0; ky < kernelY; ++ky, kernel += kernelX)
+            {
+                const uint8_t * row = rows[ky] + offset;
+                for (size_t kx = 0; kx < kernelX; ++kx)
+                {
+                    __m256i w = _mm256_set1_epi16(kernel[kx]);
+                    sum0 = _mm256_adds_epi16(sum0, _mm256_mullo_epi16(LoadFilter2D(row + kx), w));
+                    sum1 = _mm256_adds_epi16(sum1, _mm256_mullo_epi16(LoadFilter2D(row + kx + HA), w));
+                }
+            }
+            sum0 = _mm256_adds_epi16(_mm256_sra_epi16(_mm256_adds_epi16(sum0, round), shift), bias);
+            sum1 = _mm256_adds_epi16(_mm256_sra_epi16(_mm256_adds_epi16(sum1, round), shift), bias);
+            _mm256_storeu_si256((__m256i*)dst, PackU16ToU8(sum0, sum1));
+        }
+
+        void Filter2D8uDirect(const uint8_t * const * rows, size_t width, const int16_t * kernel, size_t kernelX, size_t kernelY, int shift, int16_t bias, uint8_t * dst)
+        {
+            assert(width >= A);
+            size_t alignedWidth = AlignLo(width, A);
+            __m256i _round = _mm256_set1_epi16(shift ? 1 << (shift - 1) : 0), _bias = _mm256_set1_epi16(bias);
+            __m128i _shift = _mm_cvtsi32_si128(shift);
+            for (size_t x = 0; x < alignedWidth; x += A)
+                Filter2D8uDirect(rows, x, kernel, kernelX, kernelY, _round, _shift, _bias, dst + x);
+            if (alignedWidth != width)
+                Filter2D8uDirect(rows, width - A, kernel, kernelX, kernelY, _round, _shift, _bias, dst + width - A);
+        }
+
+        SIMD_INLINE void Filter2D8uRow(const uint8_t * src, const int16_t * kernel, size_t size, int16_t * dst)
+        {
+            __m256i sum0 = _mm256_setzero_si256(), sum1 = _mm256_setzero_si256();
+            for (size_t k = 0; k < size; ++k)
+            {
+                __m256i w = _mm256_set1_epi16(kernel[k]);
+                sum0 = _mm256_add_epi16(sum0, _mm256_mullo_epi16(LoadFilter2D(src + k), w));
+                sum1 = _mm256_add_epi16(sum1, _mm256_mullo_epi16(LoadFilter2D(src + k + HA), w));
+            }
+            _mm256_storeu_si256((__m256i*)dst + 0, sum0);
+            _mm256_storeu_si256((__m256i*)dst + 1, sum1);
+        }
+
+        void Filter2D8uRow(const uint8_t * src, size_t width, const int16_t * kernel, size_t size, int16_t * dst)
+        {
+            assert(width >= A);
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t x = 0; x < alignedWidth; x += A)
+                Filter2D8uRow(src + x, kernel, size, dst + x);
+            if (alignedWidth != width)
+                Filter2D8uRow(src + width - A, kernel, size, dst + width - A);
+        }
+
+        SIMD_INLINE __m256i Filter2D8uColRound(__m256i sum, __m256i round, __m128i shift, __m256i bias)
+        {
+            return _mm256_add_epi32(_mm256_sra_epi32(_mm256_add_epi32(sum, round), shift), bias);
+        }
+
+        SIMD_INLINE void Filter2D8uCol(const int16_t * const * rows, size_t offset, const int16_t * kernel, size_t size,
+            __m256i round, __m128i shift, __m256i bias, uint8_t * dst)
+        {
+            __m256i sums[4] = { _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256() };
+            for (size_t k = 0; k < size; k += 2)
+            {
+                __m256i w = _mm256_set1_epi32(*(int32_t*)(kernel + k));
+                const __m256i * r0 = (__m256i*)(rows[k + 0] + offset);
+                const __m256i * r1 = (__m256i*)(rows[k + 1] + offset);
+                __m256i s0 = _mm256_loadu_si256(r0 + 0), s1 = _mm256_loadu_si256(r1 + 0);
+                sums[0] = _mm256_add_epi32(sums[0], _mm256_madd_epi16(_mm256_unpacklo_epi16(s0, s1), w));
+                sums[1] = _mm256_add_epi32(sums[1], _mm256_madd_epi16(_mm256_unpackhi_epi16(s0, s1), w));
+                s0 = _mm256_loadu_si256(r0 + 1), s1 = _mm256_loadu_si256(r1 + 1);
+                sums[2] = _mm256_add_epi32(sums[2], _mm256_madd_epi16(_mm256_unpacklo_epi16(s0, s1), w));
+                sums[3] = _mm256_add_epi32(sums[3], _mm256_madd_epi16(_mm256_unpackhi_epi16(s0, s1), w));
+            }
+            __m256i lo = _mm256_packs_epi32(Filter2D8uColRound(sums[0], round, shift, bias), Filter2D8uColRound(sums[1], round, shift, bias));
+            __m256i hi = _mm256_packs_epi32(Filter2D8uColRound(sums[2], round, shift, bias), Filter2D8uColRound(sums[3], round, shift, bias));
+            _mm256_storeu_si256((__m256i*)dst, PackU16ToU8(lo, hi));
+        }
+
+        void Filter2D8uCol(const int16_t * const * rows, size_t width, const int16_t * kernel, size_t size, int shift, int16_t bias, uint8_t * dst)
+        {
+            assert(width >= A);
+            size_t alignedWidth = AlignLo(width, A);
+            __m256i _round = _mm256_set1_epi32(shift ? 1 << (shift - 1) : 0), _bias = _mm256_set1_epi32(bias);
+            __m128i _shift = _mm_cvtsi32_si128(shift);
+            for (size_t x = 0; x < alignedWidth; x += A)
+                Filter2D8uCol(rows, x, kernel, size, _round, _shift, _bias, dst + x);
+            if (alignedWidth != width)
+                Filter2D8uCol(rows, width - A, kernel, size, _round, _shift, _bias, dst + width - A);
+        }
+
+        void Filter2D8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, const int16_t * kernel, size_t kernelX, size_t kernelY,
+            int shift, int16_t bias, uint8_t * dst, size_t dstStride)
+        {
+            Base::Filter2D8uRun(src, srcStride, width, height, kernel, kernelX, kernelY, shift, bias, dst, dstStride, Filter2D8uDirect, Filter2D8uRow, Filter2D8uCol);
+        }
+
+        template<size_t count> SIMD_INLINE void Filter2D32fDirect(const float * const * rows, size_t offset, const float * kernel, size_t kernelX, size_t kernelY, float * dst)
+        {
+            __m256 sums[count];
+            for (size_t i = 0; i < count; ++i)
+                sums[i] = _mm256_setzero_ps();
+            for (size_t ky = 0; ky < kernelY; ++ky, kernel += kernelX)
+            {
+                const float * row = rows[ky] + offset;
+                for (size_t kx = 0; kx < kernelX; ++kx)
+                {
+                    __m256 w = _mm256_set1_ps(kernel[kx]);
+                    for (size_t i = 0; i < count; ++i)
+                        sums[i] = _mm256_fmadd_ps(_mm256_loadu_ps(row + kx + i * F), w, sums[i]);
+                }
+            }
+            for (size_t i = 0; i < count; ++i)
+                _mm256_storeu_ps(dst + i * F, sums[i]);
+        }
+
+        void Filter2D32fDirect(const float * const * rows, size_t width, const float * kernel, size_t kernelX, size_t kernelY, float * dst)
+        {
+            assert(width >= F);
+            size_t widthQF = AlignLo(width, QF), widthF = AlignLo(width, F), x = 0;
+            for (; x < widthQF; x += QF)
+                Filter2D32fDirect<4>(rows, x, kernel, kernelX, kernelY, dst + x);
+            for (; x < widthF; x += F)
+                Filter2D32fDirect<1>(rows, x, kernel, kernelX, kernelY, dst + x);
+            if (widthF != width)
+                Filter2D32fDirect<1>(rows, width - F, kernel, kernelX, kernelY, dst + width - F);
+        }
+
+        template<size_t count> SIMD_INLINE void Filter2D32fRow(const float * src, const float * kernel, size_t size, float * dst)
+        {
+            __m256 sums[count];
+            for (size_t i = 0; i < count; ++i)
+                sums[i] = _mm256_setzero_ps();
+            for (size_t k = 0; k < size; ++k)
+            {
+                __m256 w = _mm256_set1_ps(kernel[k]);
+                for (size_t i = 0; i < count; ++i)
+                    sums[i] = _mm256_fmadd_ps(_mm256_loadu_ps(src + k + i * F), w, sums[i]);
+            }
+            for (size_t i = 0; i < count; ++i)
+                _mm256_storeu_ps(dst + i * F, sums[i]);
+        }
+
+        void Filter2D32fRow(const float * src, size_t width, const float * kernel, size_t size, float * dst)
+        {
+            assert(width >= F);
+            size_t widthQF = AlignLo(width, QF), widthF = AlignLo(width, F), x = 0;
+            for (; x < widthQF; x += QF)
+                Filter2D32fRow<4>(src + x, kernel, size, dst + x);
+            for (; x < widthF; x += F)
+                Filter2D32fRow<1>(src + x, kernel, size, dst + x);
+            if (widthF != width)
+                Filter2D32fRow<1>(src + width - F, kernel, size, dst + width - F);
+        }
+
+        template<size_t count> SIMD_INLINE void Filter2D32fCol(const float * const * rows, size_t offset, const float * kernel, size_t size, float * dst)
+        {
+            __m256 sums[count];
+            for (size_t i = 0; i < count; ++i)
+                sums[i] = _mm256_setzero_ps();
+            for (size_t k = 0; k < size; ++k)
+            {
+                __m256 w = _mm256_set1_ps(kernel[k]);
+                const float * row = rows[k] + offset;
+                for (size_t i = 0; i < count; ++i)
+                    sums[i] = _mm256_fmadd_ps(_mm256_loadu_ps(row + i * F), w, sums[i]);
+            }
+            for (size_t i = 0; i < count; ++i)
+                _mm256_storeu_ps(dst + i * F, sums[i]);
+        }
+
+        void Filter2D32fCol(const float * const * rows, size_t width, const float * kernel, size_t size, float * dst)
+        {
+            assert(width >= F);
+            size_t widthQF = AlignLo(width, QF), widthF = AlignLo(width, F), x = 0;
+            for (; x < widthQF; x += QF)
+                Filter2D32fCol<4>(rows, x, kernel, size, dst + x);
+            for (; x < widthF; x += F)
+                Filter2D32fCol<1>(rows, x, kernel, size, dst + x);
+            if (widthF != width)
+                Filter2D32fCol<1>(rows, width - F, kernel, size, dst + width - F);
+        }
+
+        void Filter2D32f(const float * src, size_t srcStride, size_t width, size_t height, const float * kernel, size_t kernelX, size_t kernelY,
+            float * dst, size_t dstStride)
+        {
+            Base::Filter2D32fRun(src, srcStride, width, height, kernel, kernelX, kernelY, dst, dstStride, Filter2D32fDirect, Filter2D32fRow, Filter2D32fCol);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,110 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdGaussianBlur.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i GaussianBlurRowRound(__m256i sum)
+        {
+            return _mm256_srai_epi32(_mm256_add_epi32(sum, _mm256_set1_epi32(Base::GAUSSIAN_BLUR_ROW_ROUND)), Base::GAUSSIAN_BLUR_ROW_SHIFT);
+        }
+
+        SIMD_INLINE void GaussianBlurRow(const uint8_t * src, size_t step, const int16_t * weights, size_t size, int16_t * dst)
+        {
+            __m256i sums[4] = { _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256() };
+            for (size_t k = 0; k < size; k += 2, src += 2 * step)
+            {
+                __m256i w = _mm256_set1_epi32(*(int32_t*)(weights + k));
+                __m256i s0 = _mm256_loadu_si256((__m256i*)src);
+                __m256i s1 = _mm256_loadu_si256((__m256i*)(src + step));
+                __m256i lo = _mm256_unpacklo_epi8(s0, s1), hi = _mm256_unpackhi_epi8(s0, s1);
+                sums[0] = _mm256_add_epi32(sums[0], _mm256_madd_epi16(_mm256_unpacklo_epi8(lo, K_ZERO), w));
+                sums[1] = _mm256_add_epi32(sums[1], _mm256_madd_epi16(_mm256_unpackhi_epi8(lo, K_ZERO), w));
+                sums[2] = _mm256_add_epi32(sums[2], _mm256_madd_epi16(_mm256_unpacklo_epi8(hi, K_ZERO), w));
+                sums[3] = _mm256_add_epi32(sums[3], _mm256_madd_epi16(_mm256_unpackhi_epi8(hi, K_ZERO), w));
+            }
+            __m256i lo = _mm256_packs_epi32(GaussianBlurRowRound(sums[0]), GaussianBlurRowRound(sums[1]));
+            __m256i hi = _mm256_packs_epi32(GaussianBlurRowRound(sums[2]), GaussianBlurRowRound(sums[3]));
+            _mm256_storeu_si256((__m256i*)dst + 0, _mm256_permute2x128_si256(lo, hi, 0x20));
+            _mm256_storeu_si256((__m256i*)dst + 1, _mm256_permute2x128_si256(lo, hi, 0x31));
+        }
+
+        void GaussianBlurRow(const uint8_t * src, size_t width, size_t step, const int16_t * weights, size_t size, int16_t * dst)
+        {
+            assert(width >= A);
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t i = 0; i < alignedWidth; i += A)
+                GaussianBlurRow(src + i, step, weights, size, dst + i);
+            if (alignedWidth != width)
+                GaussianBlurRow(src + width - A, step, weights, size, dst + width - A);
+        }
+
+        SIMD_INLINE __m256i GaussianBlurColRound(__m256i sum)
+        {
+            return _mm256_srai_epi32(_mm256_add_epi32(sum, _mm256_set1_epi32(Base::GAUSSIAN_BLUR_COL_ROUND)), Base::GAUSSIAN_BLUR_COL_SHIFT);
+        }
+
+        SIMD_INLINE void GaussianBlurCol(const int16_t * const * rows, const int16_t * weights, size_t size, size_t offset, uint8_t * dst)
+        {
+            __m256i sums[4] = { _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256() };
+            for (size_t k = 0; k < size; k += 2)
+            {
+                __m256i w = _mm256_set1_epi32(*(int32_t*)(weights + k));
+                const __m256i * r0 = (__m256i*)(rows[k + 0] + offset);
+                const __m256i * r1 = (__m256i*)(rows[k + 1] + offset);
+                __m256i s0 = _mm256_loadu_si256(r0 + 0), s1 = _mm256_loadu_si256(r1 + 0);
+                sums[0] = _mm256_add_epi32(sums[0], _mm256_madd_epi16(_mm256_unpacklo_epi16(s0, s1), w));
+                sums[1] = _mm256_add_epi32(sums[1], _mm256_madd_epi16(_mm256_unpackhi_epi16(s0, s1), w));
+                s0 = _mm256_loadu_si256(r0 + 1), s1 = _mm256_loadu_si256(r1 + 1);
+                sums[2] = _mm256_add_epi32(sums[2], _mm256_madd_epi16(_mm256_unpacklo_epi16(s0, s1), w));
+                sums[3] = _mm256_add_epi32(sums[3], _mm256_madd_epi16(_mm256_unpackhi_epi16(s0, s1), w));
+            }
+            __m256i lo = _mm256_packs_epi32(GaussianBlurColRound(sums[0]), GaussianBlurColRound(sums[1]));
+            __m256i hi = _mm256_packs_epi32(GaussianBlurColRound(sums[2]), GaussianBlurColRound(sums[3]));
+            _mm256_storeu_si256((__m256i*)dst, PackU16ToU8(lo, hi));
+        }
+
+        void GaussianBlurCol(const int16_t * const * rows, size_t width, const int16_t * weights, size_t size, uint8_t * dst)
+        {
+            assert(width >= A);
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t i = 0; i < alignedWidth; i += A)
+                GaussianBlurCol(rows, weights, size, i, dst + i);
+            if (alignedWidth != width)
+                GaussianBlurCol(rows, weights, size, width - A, dst + width - A);
+        }
+
+        void GaussianBlur(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, float sigma, size_t radius, uint8_t * dst, size_t dstStride)
+        {
+            radius = Base::GaussianBlurRadius(sigma, radius);
+            Base::GaussianBlurRun(src, srcStride, width, height, channelCount, sigma, radius, dst, dstStride, GaussianBlurRow, GaussianBlurCol);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -66,6 +66,55 @@ namespace Simd
             }
         }
 
+        SIMD_INLINE __m256i PrefixSum32(__m256i value)
+        {
+            value = _mm256_add_epi32(value, _mm256_slli_si256(value, 4));
+            value = _mm256_add_epi32(value, _mm256_slli_si256(value, 8));
+            return _mm256_add_epi32(value, _mm256_shuffle_epi32(_mm256_permute2x128_si256(value, value, 0x08), 0xFF));
+        }
+
+        void IntegralSumSqsum(const uint8_t * src, size_t srcStride, size_t width, size_t height, 
+            uint32_t * sum, size_t sumStride, uint32_t * sqsum, size_t sqsumStride)
+        {
+            memset(sum, 0, (width + 1)*sizeof(uint32_t));
+            sum += sumStride + 1;
+            memset(sqsum, 0, (width + 1)*sizeof(uint32_t));
+            sqsum += sqsumStride + 1;
+            size_t alignedWidth = AlignLo(width, 8);
+            __m256i K32_7 = _mm256_set1_epi32(7);
+
+            for (size_t row = 0; row < height; row++)
+            {
+                sum[-1] = 0;
+                sqsum[-1] = 0;
+                size_t col = 0;
+                __m256i _rowSum = K_ZERO, _rowSqsum = K_ZERO;
+                for (; col < alignedWidth; col += 8)
+                {
+                    __m256i _src = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src + col)));
+                    _rowSum = _mm256_add_epi32(_rowSum, PrefixSum32(_src));
+                    _rowSqsum = _mm256_add_epi32(_rowSqsum, PrefixSum32(_mm256_madd_epi16(_src, _src)));
+                    _mm256_storeu_si256((__m256i*)(sum + col), _mm256_add_epi32(_rowSum, _mm256_loadu_si256((__m256i*)(sum + col - sumStride))));
+                    _mm256_storeu_si256((__m256i*)(sqsum + col), _mm256_add_epi32(_rowSqsum, _mm256_loadu_si256((__m256i*)(sqsum + col - sqsumStride))));
+                    _rowSum = _mm256_permutevar8x32_epi32(_rowSum, K32_7);
+                    _rowSqsum = _mm256_permutevar8x32_epi32(_rowSqsum, K32_7);
+                }
+                uint32_t rowSum = sum[col - 1] - sum[col - sumStride - 1];
+                uint32_t rowSqsum = sqsum[col - 1] - sqsum[col - sqsumStride - 1];
+                for (; col < width; col++)
+                {
+                    uint32_t value = src[col];
+                    rowSum += value;
+                    rowSqsum += value*value;
+                    sum[col] = rowSum + sum[col - sumStride];
+                    sqsum[col] = rowSqsum + sqsum[col - sqsumStride];
+                }
+                src += srcStride;
+                sum += sumStride;
+                sqsum += sqsumStride;
+            }
+        }
+
         void Integral(const uint8_t * src, size_t srcStride, size_t width, size_t height, 
             uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride, 
             SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
@@ -97,11 +146,11 @@ namespace Simd
                     switch(sqsumFormat)
                     {
                     case SimdPixelFormatInt32:
-                        IntegralSumSqsum<uint32_t, uint32_t>(src, srcStride, width, height, 
+                        Avx2::IntegralSumSqsum(src, srcStride, width, height, 
                             (uint32_t*)sum, sumStride/sizeof(uint32_t), (uint32_t*)sqsum, sqsumStride/sizeof(uint32_t));
                         break;
                     case SimdPixelFormatDouble:
-                        IntegralSumSqsum<uint32_t, double>(src, srcStride, width, height, 
+                        Simd::IntegralSumSqsum<uint32_t, double>(src, srcStride, width, height, 
                             (uint32_t*)sum, sumStride/sizeof(uint32_t), (double*)sqsum, sqsumStride/sizeof(double));
                         break;
                     default:
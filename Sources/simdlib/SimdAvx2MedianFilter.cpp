@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdMedianFilter.h"
 
 namespace Simd
 {
@@ -506,6 +507,50 @@ namespace Simd
             else
                 MedianFilterSquare5x5<false>(src, srcStride, width, height, channelCount, dst, dstStride);
         }
+
+        struct MedianHistogram
+        {
+            static SIMD_INLINE void Add(const uint16_t * src, uint16_t * dst)
+            {
+                _mm256_storeu_si256((__m256i*)dst, _mm256_add_epi16(_mm256_loadu_si256((__m256i*)dst), _mm256_loadu_si256((__m256i*)src)));
+            }
+
+            static SIMD_INLINE void Sub(const uint16_t * src, uint16_t * dst)
+            {
+                _mm256_storeu_si256((__m256i*)dst, _mm256_sub_epi16(_mm256_loadu_si256((__m256i*)dst), _mm256_loadu_si256((__m256i*)src)));
+            }
+
+            static SIMD_INLINE void AddSub(const uint16_t * add, const uint16_t * sub, uint16_t * dst)
+            {
+                __m256i diff = _mm256_sub_epi16(_mm256_loadu_si256((__m256i*)add), _mm256_loadu_si256((__m256i*)sub));
+                _mm256_storeu_si256((__m256i*)dst, _mm256_add_epi16(_mm256_loadu_si256((__m256i*)dst), diff));
+            }
+
+            static SIMD_INLINE size_t Find(const uint16_t * hist, size_t & sum, size_t threshold)
+            {
+                SIMD_ALIGNED(32) uint16_t prefix[32];
+                __m256i value = _mm256_loadu_si256((__m256i*)hist);
+                value = _mm256_add_epi16(value, _mm256_slli_si256(value, 2));
+                value = _mm256_add_epi16(value, _mm256_slli_si256(value, 4));
+                value = _mm256_add_epi16(value, _mm256_slli_si256(value, 8));
+                __m256i last = _mm256_shufflehi_epi16(value, 0xFF);
+                last = _mm256_permute2x128_si256(_mm256_unpackhi_epi64(last, last), last, 0x08);
+                value = _mm256_add_epi16(_mm256_add_epi16(value, last), _mm256_set1_epi16((short)sum));
+                __m256i lesser = _mm256_cmpeq_epi16(_mm256_subs_epu16(value, _mm256_set1_epi16((short)threshold)), K_ZERO);
+                __m256i count = _mm256_sad_epu8(_mm256_and_si256(lesser, K16_0001), K_ZERO);
+                __m128i count128 = _mm_add_epi64(_mm256_castsi256_si128(count), _mm256_extracti128_si256(count, 1));
+                size_t index = _mm_cvtsi128_si32(count128) + _mm_extract_epi16(count128, 4);
+                prefix[15] = (uint16_t)sum;
+                _mm256_store_si256((__m256i*)prefix + 1, value);
+                sum = prefix[15 + index];
+                return index;
+            }
+        };
+
+        void MedianFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride)
+        {
+            Base::MedianFilterRun<MedianHistogram>(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
@@ -116,9 +116,12 @@ namespace Simd
                 {
                     size_t srcCol = srcWidth - DA - lastOddCol;
                     size_t dstCol = dstWidth - A - lastOddCol;
-                    ReduceColBody<false>(s, srcCol, lo);
-                    ReduceColBody<false>(s, srcCol + A, hi);
-                    Store<false>((__m256i*)(dst + dstCol), ReduceRow<compensation>(lo, hi));
+                    if(srcCol)
+                    {
+                        ReduceColBody<false>(s, srcCol, lo);
+                        ReduceColBody<false>(s, srcCol + A, hi);
+                        Store<false>((__m256i*)(dst + dstCol), ReduceRow<compensation>(lo, hi));
+                    }
                     if(lastOddCol)
                         dst[dstWidth - 1] = Base::GaussianBlur3x3<compensation>(s[0] + srcWidth, s[1]+ srcWidth, s[2] + srcWidth, -2, -1, -1);
                 }
@@ -0,0 +1,129 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256 ResizeBicubicX(const uint8_t * src, const int * index, const float * alpha, size_t offset)
+        {
+            __m256i value = _mm256_and_si256(_mm256_i32gather_epi32((int*)src, _mm256_loadu_si256((__m256i*)(index + offset)), 1), K32_000000FF);
+            return _mm256_mul_ps(_mm256_cvtepi32_ps(value), _mm256_loadu_ps(alpha + offset));
+        }
+
+        // Source is read by 32-bit gathers, so there must be at least 3 readable bytes after element index[k*size + i] for i < end.
+        void ResizeBicubicX(const uint8_t * src, const Base::ResizeBicubicIndex & index, size_t end, float * dst)
+        {
+            size_t size = index.size, alignedEnd = AlignLo(end, F);
+            const int * idx = index.index.data;
+            const float * alpha = index.alpha.data;
+            for (size_t i = 0; i < alignedEnd; i += F)
+            {
+                __m256 sum = ResizeBicubicX(src, idx + 0 * size, alpha + 0 * size, i);
+                sum = _mm256_add_ps(sum, ResizeBicubicX(src, idx + 1 * size, alpha + 1 * size, i));
+                sum = _mm256_add_ps(sum, ResizeBicubicX(src, idx + 2 * size, alpha + 2 * size, i));
+                sum = _mm256_add_ps(sum, ResizeBicubicX(src, idx + 3 * size, alpha + 3 * size, i));
+                _mm256_storeu_ps(dst + i, sum);
+            }
+            Base::ResizeBicubicX(src, index, alignedEnd, dst);
+        }
+
+        SIMD_INLINE __m256i ResizeBicubicY(const float * const * src, const __m256 * alpha, size_t offset)
+        {
+            __m256 sum = _mm256_mul_ps(_mm256_loadu_ps(src[0] + offset), alpha[0]);
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(src[1] + offset), alpha[1]));
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(src[2] + offset), alpha[2]));
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(src[3] + offset), alpha[3]));
+            return _mm256_cvtps_epi32(sum);
+        }
+
+        const __m256i K32_PERMUTE_BICUBIC = SIMD_MM256_SETR_EPI32(0, 4, 1, 5, 2, 6, 3, 7);
+
+        SIMD_INLINE void ResizeBicubicY(const float * const * src, const __m256 * alpha, size_t offset, uint8_t * dst)
+        {
+            __m256i lo = _mm256_packs_epi32(ResizeBicubicY(src, alpha, offset + 0 * F), ResizeBicubicY(src, alpha, offset + 1 * F));
+            __m256i hi = _mm256_packs_epi32(ResizeBicubicY(src, alpha, offset + 2 * F), ResizeBicubicY(src, alpha, offset + 3 * F));
+            _mm256_storeu_si256((__m256i*)(dst + offset), _mm256_permutevar8x32_epi32(_mm256_packus_epi16(lo, hi), K32_PERMUTE_BICUBIC));
+        }
+
+        void ResizeBicubicY(const float * const * src, const float * alpha, size_t size, uint8_t * dst)
+        {
+            assert(size >= A);
+
+            __m256 _alpha[4];
+            for (size_t k = 0; k < 4; ++k)
+                _alpha[k] = _mm256_set1_ps(alpha[k]);
+            size_t alignedSize = AlignLo(size, A);
+            for (size_t i = 0; i < alignedSize; i += A)
+                ResizeBicubicY(src, _alpha, i, dst);
+            if (alignedSize != size)
+                ResizeBicubicY(src, _alpha, size - A, dst);
+        }
+
+        ResizerByteBicubic::ResizerByteBicubic(const Base::ResParam & param)
+            : Base::ResizerByteBicubic(param)
+        {
+            _lastEnd = 0;
+            ptrdiff_t lastSize = (ptrdiff_t)(_param.srcW*_param.channels) - 3;
+            while (_lastEnd < _ix.size && _ix.index[3 * _ix.size + _lastEnd] < lastSize)
+                _lastEnd++;
+        }
+
+        void ResizerByteBicubic::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            size_t dstHeight = _param.dstH;
+            _rows.Reset();
+            for (size_t y = 0; y < dstHeight; ++y, dst = Next(dst, dstStride))
+            {
+                const float * ps[4];
+                float alpha[4];
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    int sy = _iy.index[k*dstHeight + y];
+                    ps[k] = _rows.Get(sy);
+                    if (ps[k] == NULL)
+                    {
+                        float * row = _rows.Set(sy, _iy.index.data + y, dstHeight);
+                        Avx2::ResizeBicubicX(src + sy*srcStride, _ix, (_param.srcH - 1 - sy)*srcStride >= 3 ? _ix.size : _lastEnd, row);
+                        ps[k] = row;
+                    }
+                    alpha[k] = _iy.alpha[k*dstHeight + y];
+                }
+                ResizeBicubicY(ps, alpha, _ix.size, dst);
+            }
+        }
+
+        void ResizeBicubic(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+        {
+            ResizerByteBicubic resizer(Base::ResParam(srcWidth, srcHeight, dstWidth, dstHeight, channelCount, SimdResizeMethodBicubic));
+            resizer.Run(src, srcStride, dst, dstStride);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,76 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template <bool align> SIMD_INLINE void Yuv444pToHsv(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * hsv, const __m256 & KF_255_DIV_6)
+        {
+            __m256i _y = Load<align>((__m256i*)y), _u = Load<align>((__m256i*)u), _v = Load<align>((__m256i*)v);
+            __m256i blue = YuvToBlue(_y, _u), green = YuvToGreen(_y, _u, _v), red = YuvToRed(_y, _v);
+            __m256i hue, saturation, value;
+            BgrToHsv(blue, green, red, KF_255_DIV_6, hue, saturation, value);
+            Store<align>((__m256i*)hsv + 0, InterleaveBgr<0>(hue, saturation, value));
+            Store<align>((__m256i*)hsv + 1, InterleaveBgr<1>(hue, saturation, value));
+            Store<align>((__m256i*)hsv + 2, InterleaveBgr<2>(hue, saturation, value));
+        }
+
+        template <bool align> void Yuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, 
+            size_t width, size_t height, uint8_t * hsv, size_t hsvStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(hsv) && Aligned(hsvStride));
+
+            const __m256 KF_255_DIV_6 = _mm256_set1_ps(Base::KF_255_DIV_6);
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    Yuv444pToHsv<align>(y + col, u + col, v + col, hsv + 3*col, KF_255_DIV_6);
+                if (alignedWidth != width)
+                    Yuv444pToHsv<false>(y + (width - A), u + (width - A), v + (width - A), hsv + 3*(width - A), KF_255_DIV_6);
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                hsv += hsvStride;
+            }
+        }
+
+        void Yuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, 
+            size_t width, size_t height, uint8_t * hsv, size_t hsvStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(hsv) && Aligned(hsvStride))
+                Yuv444pToHsv<true>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+            else
+                Yuv444pToHsv<false>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
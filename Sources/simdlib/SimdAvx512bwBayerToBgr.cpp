@@ -0,0 +1,93 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBayer.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE void StoreBgr(__m512i blue, __m512i green, __m512i red, uint8_t * bgr)
+        {
+            Store<false>(bgr + 0 * A, InterleaveBgr<0>(blue, green, red));
+            Store<false>(bgr + 1 * A, InterleaveBgr<1>(blue, green, red));
+            Store<false>(bgr + 2 * A, InterleaveBgr<2>(blue, green, red));
+        }
+
+        template <SimdPixelFormatType bayerFormat> SIMD_INLINE void BayerToBgr(const uint8_t * src[6], size_t col, uint8_t * bgr, size_t stride)
+        {
+            __m512i s[6][6], d[12];
+            LoadBayer(src, col, s);
+            BayerToBgr<bayerFormat>(s, d);
+            StoreBgr(Merge16(d[0], d[3]), Merge16(d[1], d[4]), Merge16(d[2], d[5]), bgr);
+            StoreBgr(Merge16(d[6], d[9]), Merge16(d[7], d[10]), Merge16(d[8], d[11]), bgr + stride);
+        }
+
+        template <SimdPixelFormatType bayerFormat> void BayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, uint8_t * bgr, size_t bgrStride)
+        {
+            const uint8_t * src[6];
+            size_t bodyEnd = 2 + AlignLo(width - 4, A);
+            for(size_t row = 0; row < height; row += 2)
+            {
+                Base::BayerSetRows(bayer, bayerStride, row, height, src);
+
+                Base::BayerToBgr<bayerFormat>(src, 0, 0, 2, bgr, bgrStride);
+                for(size_t col = 2; col < bodyEnd; col += A)
+                    BayerToBgr<bayerFormat>(src, col, bgr + 3*col, bgrStride);
+                if(bodyEnd != width - 2)
+                    BayerToBgr<bayerFormat>(src, width - 2 - A, bgr + 3*(width - 2 - A), bgrStride);
+                Base::BayerToBgr<bayerFormat>(src, width - 4, width - 2, width - 2, bgr + 3*(width - 2), bgrStride);
+
+                bayer += 2*bayerStride;
+                bgr += 2*bgrStride;
+            }
+        }
+
+        void BayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width%2 == 0) && (height%2 == 0) && (width >= A + 4));
+
+            switch(bayerFormat)
+            {
+            case SimdPixelFormatBayerGrbg: 
+                BayerToBgr<SimdPixelFormatBayerGrbg>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerGbrg:
+                BayerToBgr<SimdPixelFormatBayerGbrg>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerRggb:
+                BayerToBgr<SimdPixelFormatBayerRggb>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerBggr:
+                BayerToBgr<SimdPixelFormatBayerBggr>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
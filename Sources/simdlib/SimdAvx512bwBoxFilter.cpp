@@ -0,0 +1,75 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBoxFilter.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+	namespace Avx512bw
+	{
+		SIMD_INLINE void BoxFilterCol(const uint8_t * add, const uint8_t * sub, uint16_t * cols, __mmask32 tail = -1)
+		{
+			__m512i _add = _mm512_cvtepu8_epi16(_mm512_castsi512_si256(_mm512_maskz_loadu_epi8(__mmask64(tail), add)));
+			__m512i _sub = _mm512_cvtepu8_epi16(_mm512_castsi512_si256(_mm512_maskz_loadu_epi8(__mmask64(tail), sub)));
+			__m512i _cols = _mm512_maskz_loadu_epi16(tail, cols);
+			_mm512_mask_storeu_epi16(cols, tail, _mm512_add_epi16(_cols, _mm512_sub_epi16(_add, _sub)));
+		}
+
+		void BoxFilterCol(const uint8_t * add, const uint8_t * sub, size_t size, uint16_t * cols)
+		{
+			size_t alignedSize = AlignLo(size, HA), i = 0;
+			__mmask32 tailMask = __mmask32(-1) >> (HA + alignedSize - size);
+			for (; i < alignedSize; i += HA)
+				BoxFilterCol(add + i, sub + i, cols + i);
+			if (i < size)
+				BoxFilterCol(add + i, sub + i, cols + i, tailMask);
+		}
+
+		SIMD_INLINE void BoxFilterNorm(const uint32_t * sums, __m512 scale, uint8_t * dst, __mmask16 tail = -1)
+		{
+			__m512i _sums = _mm512_maskz_loadu_epi32(tail, sums);
+			__m512i value = _mm512_cvtps_epi32(_mm512_mul_ps(_mm512_cvtepi32_ps(_sums), scale));
+			_mm512_mask_cvtusepi32_storeu_epi8(dst, tail, value);
+		}
+
+		void BoxFilterNorm(const uint32_t * sums, size_t size, float scale, uint8_t * dst)
+		{
+			__m512 _scale = _mm512_set1_ps(scale);
+			size_t alignedSize = AlignLo(size, F), i = 0;
+			__mmask16 tailMask = __mmask16(-1) >> (F + alignedSize - size);
+			for (; i < alignedSize; i += F)
+				BoxFilterNorm(sums + i, _scale, dst + i);
+			if (i < size)
+				BoxFilterNorm(sums + i, _scale, dst + i, tailMask);
+		}
+
+		void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride)
+		{
+			Base::BoxFilterRun(src, srcStride, width, height, channelCount, windowX, windowY, dst, dstStride, BoxFilterCol, BoxFilterNorm);
+		}
+	}
+#endif// SIMD_AVX512BW_ENABLE
+}
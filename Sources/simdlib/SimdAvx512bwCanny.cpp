@@ -0,0 +1,126 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdCanny.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+	namespace Avx512bw
+	{
+		SIMD_INLINE __m512i LoadCanny(const uint8_t * p)
+		{
+			return _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)p));
+		}
+
+		SIMD_INLINE void CannyGradientBlock(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t x, int16_t * dx, int16_t * dy, int16_t * mag)
+		{
+			__m512i s0l = LoadCanny(src0 + x - 1), s0c = LoadCanny(src0 + x), s0r = LoadCanny(src0 + x + 1);
+			__m512i s1l = LoadCanny(src1 + x - 1), s1r = LoadCanny(src1 + x + 1);
+			__m512i s2l = LoadCanny(src2 + x - 1), s2c = LoadCanny(src2 + x), s2r = LoadCanny(src2 + x + 1);
+			__m512i _dx = _mm512_sub_epi16(_mm512_add_epi16(_mm512_add_epi16(s0r, s2r), _mm512_slli_epi16(s1r, 1)),
+				_mm512_add_epi16(_mm512_add_epi16(s0l, s2l), _mm512_slli_epi16(s1l, 1)));
+			__m512i _dy = _mm512_sub_epi16(_mm512_add_epi16(_mm512_add_epi16(s2l, s2r), _mm512_slli_epi16(s2c, 1)),
+				_mm512_add_epi16(_mm512_add_epi16(s0l, s0r), _mm512_slli_epi16(s0c, 1)));
+			_mm512_storeu_si512(dx + x, _dx);
+			_mm512_storeu_si512(dy + x, _dy);
+			_mm512_storeu_si512(mag + x, _mm512_add_epi16(_mm512_abs_epi16(_dx), _mm512_abs_epi16(_dy)));
+		}
+
+		void CannyGradient(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t width, int16_t * dx, int16_t * dy, int16_t * mag)
+		{
+			assert(width >= HA);
+			size_t alignedWidth = AlignLo(width, HA);
+			for (size_t x = 0; x < alignedWidth; x += HA)
+				CannyGradientBlock(src0, src1, src2, x, dx, dy, mag);
+			if (alignedWidth != width)
+				CannyGradientBlock(src0, src1, src2, width - HA, dx, dy, mag);
+		}
+
+		SIMD_INLINE __m512i LoadCanny(const int16_t * p)
+		{
+			return _mm512_loadu_si512(p);
+		}
+
+		SIMD_INLINE void CannySuppressBlock(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2,
+			size_t x, __m512i low, __m512i high, uint8_t * dst)
+		{
+			static const __m512i K16_0012 = SIMD_MM512_SET1_EPI16(12);
+			static const __m512i K16_0029 = SIMD_MM512_SET1_EPI16(29);
+			__m512i _dx = LoadCanny(dx + x), _dy = LoadCanny(dy + x);
+			__m512i adx = _mm512_abs_epi16(_dx), ady = _mm512_abs_epi16(_dy);
+			__mmask32 hor = _mm512_cmplt_epi16_mask(_mm512_mullo_epi16(ady, K16_0029), _mm512_mullo_epi16(adx, K16_0012));
+			__mmask32 ver = _mm512_cmplt_epi16_mask(_mm512_mullo_epi16(adx, K16_0029), _mm512_mullo_epi16(ady, K16_0012));
+			__mmask32 same = _mm512_cmpge_epi16_mask(_mm512_xor_si512(_dx, _dy), K_ZERO);
+			__m512i a = _mm512_mask_blend_epi16(same, LoadCanny(mag0 + x + 1), LoadCanny(mag0 + x - 1));
+			__m512i b = _mm512_mask_blend_epi16(same, LoadCanny(mag2 + x - 1), LoadCanny(mag2 + x + 1));
+			a = _mm512_mask_blend_epi16(ver, a, LoadCanny(mag0 + x));
+			b = _mm512_mask_blend_epi16(ver, b, LoadCanny(mag2 + x));
+			a = _mm512_mask_blend_epi16(hor, a, LoadCanny(mag1 + x - 1));
+			b = _mm512_mask_blend_epi16(hor, b, LoadCanny(mag1 + x + 1));
+			__m512i m = LoadCanny(mag1 + x);
+			__mmask32 max = _mm512_cmpgt_epi16_mask(m, a) & _mm512_cmpge_epi16_mask(m, b);
+			__m512i label = _mm512_add_epi16(_mm512_maskz_mov_epi16(max & _mm512_cmpgt_epi16_mask(m, low), K16_0001), 
+				_mm512_maskz_mov_epi16(max & _mm512_cmpgt_epi16_mask(m, high), K16_0001));
+			_mm256_storeu_si256((__m256i*)(dst + x), _mm512_cvtepi16_epi8(label));
+		}
+
+		void CannySuppress(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2,
+			size_t width, int16_t low, int16_t high, uint8_t * dst)
+		{
+			assert(width >= HA);
+			size_t alignedWidth = AlignLo(width, HA);
+			__m512i _low = _mm512_set1_epi16(low), _high = _mm512_set1_epi16(high);
+			for (size_t x = 0; x < alignedWidth; x += HA)
+				CannySuppressBlock(dx, dy, mag0, mag1, mag2, x, _low, _high, dst);
+			if (alignedWidth != width)
+				CannySuppressBlock(dx, dy, mag0, mag1, mag2, width - HA, _low, _high, dst);
+		}
+
+		size_t CannyFind(const uint8_t * row, size_t begin, size_t width)
+		{
+			const __m512i strong = _mm512_set1_epi8(Base::CANNY_STRONG);
+			size_t x = begin;
+			for (; x + A <= width; x += A)
+				if (_mm512_cmpeq_epi8_mask(_mm512_loadu_si512(row + x), strong))
+					break;
+			for (; x < width; ++x)
+				if (row[x] == Base::CANNY_STRONG)
+					return x;
+			return width;
+		}
+
+		void CannyNms(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t low, uint16_t high, uint8_t * dst, size_t dstStride)
+		{
+			Base::CannyNmsRun(src, srcStride, width, height, low, high, dst, dstStride, CannyGradient, CannySuppress);
+		}
+
+		void CannyHysteresis(uint8_t * dst, size_t dstStride, size_t width, size_t height)
+		{
+			Base::CannyHysteresisRun(dst, dstStride, width, height, CannyFind);
+		}
+	}
+#endif// SIMD_AVX512BW_ENABLE
+}
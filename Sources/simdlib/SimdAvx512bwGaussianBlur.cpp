@@ -0,0 +1,99 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdGaussianBlur.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+	namespace Avx512bw
+	{
+		SIMD_INLINE __m512i GaussianBlurRowRound(__m512i sum)
+		{
+			return _mm512_srai_epi32(_mm512_add_epi32(sum, _mm512_set1_epi32(Base::GAUSSIAN_BLUR_ROW_ROUND)), Base::GAUSSIAN_BLUR_ROW_SHIFT);
+		}
+
+		SIMD_INLINE void GaussianBlurRow(const uint8_t * src, size_t step, const int16_t * weights, size_t size, int16_t * dst)
+		{
+			__m512i sums[2] = { _mm512_setzero_si512(), _mm512_setzero_si512() };
+			for (size_t k = 0; k < size; k += 2, src += 2 * step)
+			{
+				__m512i w = _mm512_set1_epi32(*(int32_t*)(weights + k));
+				__m512i s0 = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)src));
+				__m512i s1 = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)(src + step)));
+				sums[0] = _mm512_add_epi32(sums[0], _mm512_madd_epi16(_mm512_unpacklo_epi16(s0, s1), w));
+				sums[1] = _mm512_add_epi32(sums[1], _mm512_madd_epi16(_mm512_unpackhi_epi16(s0, s1), w));
+			}
+			_mm512_storeu_si512(dst, _mm512_packs_epi32(GaussianBlurRowRound(sums[0]), GaussianBlurRowRound(sums[1])));
+		}
+
+		void GaussianBlurRow(const uint8_t * src, size_t width, size_t step, const int16_t * weights, size_t size, int16_t * dst)
+		{
+			assert(width >= HA);
+			size_t alignedWidth = AlignLo(width, HA);
+			for (size_t i = 0; i < alignedWidth; i += HA)
+				GaussianBlurRow(src + i, step, weights, size, dst + i);
+			if (alignedWidth != width)
+				GaussianBlurRow(src + width - HA, step, weights, size, dst + width - HA);
+		}
+
+		SIMD_INLINE __m512i GaussianBlurColRound(__m512i sum)
+		{
+			return _mm512_srai_epi32(_mm512_add_epi32(sum, _mm512_set1_epi32(Base::GAUSSIAN_BLUR_COL_ROUND)), Base::GAUSSIAN_BLUR_COL_SHIFT);
+		}
+
+		SIMD_INLINE void GaussianBlurCol(const int16_t * const * rows, const int16_t * weights, size_t size, size_t offset, uint8_t * dst)
+		{
+			__m512i sums[2] = { _mm512_setzero_si512(), _mm512_setzero_si512() };
+			for (size_t k = 0; k < size; k += 2)
+			{
+				__m512i w = _mm512_set1_epi32(*(int32_t*)(weights + k));
+				__m512i s0 = _mm512_loadu_si512(rows[k + 0] + offset);
+				__m512i s1 = _mm512_loadu_si512(rows[k + 1] + offset);
+				sums[0] = _mm512_add_epi32(sums[0], _mm512_madd_epi16(_mm512_unpacklo_epi16(s0, s1), w));
+				sums[1] = _mm512_add_epi32(sums[1], _mm512_madd_epi16(_mm512_unpackhi_epi16(s0, s1), w));
+			}
+			__m512i sum = _mm512_packs_epi32(GaussianBlurColRound(sums[0]), GaussianBlurColRound(sums[1]));
+			_mm256_storeu_si256((__m256i*)dst, _mm512_cvtusepi16_epi8(sum));
+		}
+
+		void GaussianBlurCol(const int16_t * const * rows, size_t width, const int16_t * weights, size_t size, uint8_t * dst)
+		{
+			assert(width >= HA);
+			size_t alignedWidth = AlignLo(width, HA);
+			for (size_t i = 0; i < alignedWidth; i += HA)
+				GaussianBlurCol(rows, weights, size, i, dst + i);
+			if (alignedWidth != width)
+				GaussianBlurCol(rows, weights, size, width - HA, dst + width - HA);
+		}
+
+		void GaussianBlur(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, float sigma, size_t radius, uint8_t * dst, size_t dstStride)
+		{
+			radius = Base::GaussianBlurRadius(sigma, radius);
+			Base::GaussianBlurRun(src, srcStride, width, height, channelCount, sigma, radius, dst, dstStride, GaussianBlurRow, GaussianBlurCol);
+		}
+	}
+#endif// SIMD_AVX512BW_ENABLE
+}
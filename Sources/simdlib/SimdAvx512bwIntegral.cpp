@@ -70,6 +70,56 @@ namespace Simd
             }
         }
 
+        SIMD_INLINE __m512i PrefixSum32(__m512i value)
+        {
+            value = _mm512_add_epi32(value, _mm512_alignr_epi32(value, K_ZERO, 15));
+            value = _mm512_add_epi32(value, _mm512_alignr_epi32(value, K_ZERO, 14));
+            value = _mm512_add_epi32(value, _mm512_alignr_epi32(value, K_ZERO, 12));
+            return _mm512_add_epi32(value, _mm512_alignr_epi32(value, K_ZERO, 8));
+        }
+
+        void IntegralSumSqsum(const uint8_t * src, size_t srcStride, size_t width, size_t height, 
+            uint32_t * sum, size_t sumStride, uint32_t * sqsum, size_t sqsumStride)
+        {
+            memset(sum, 0, (width + 1)*sizeof(uint32_t));
+            sum += sumStride + 1;
+            memset(sqsum, 0, (width + 1)*sizeof(uint32_t));
+            sqsum += sqsumStride + 1;
+            size_t alignedWidth = AlignLo(width, 16);
+            __m512i K32_15 = _mm512_set1_epi32(15);
+
+            for (size_t row = 0; row < height; row++)
+            {
+                sum[-1] = 0;
+                sqsum[-1] = 0;
+                size_t col = 0;
+                __m512i _rowSum = K_ZERO, _rowSqsum = K_ZERO;
+                for (; col < alignedWidth; col += 16)
+                {
+                    __m512i _src = _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)(src + col)));
+                    _rowSum = _mm512_add_epi32(_rowSum, PrefixSum32(_src));
+                    _rowSqsum = _mm512_add_epi32(_rowSqsum, PrefixSum32(_mm512_madd_epi16(_src, _src)));
+                    _mm512_storeu_si512(sum + col, _mm512_add_epi32(_rowSum, _mm512_loadu_si512(sum + col - sumStride)));
+                    _mm512_storeu_si512(sqsum + col, _mm512_add_epi32(_rowSqsum, _mm512_loadu_si512(sqsum + col - sqsumStride)));
+                    _rowSum = _mm512_permutexvar_epi32(K32_15, _rowSum);
+                    _rowSqsum = _mm512_permutexvar_epi32(K32_15, _rowSqsum);
+                }
+                uint32_t rowSum = sum[col - 1] - sum[col - sumStride - 1];
+                uint32_t rowSqsum = sqsum[col - 1] - sqsum[col - sqsumStride - 1];
+                for (; col < width; col++)
+                {
+                    uint32_t value = src[col];
+                    rowSum += value;
+                    rowSqsum += value*value;
+                    sum[col] = rowSum + sum[col - sumStride];
+                    sqsum[col] = rowSqsum + sqsum[col - sqsumStride];
+                }
+                src += srcStride;
+                sum += sumStride;
+                sqsum += sqsumStride;
+            }
+        }
+
         void Integral(const uint8_t * src, size_t srcStride, size_t width, size_t height, 
             uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride, 
             SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
@@ -101,11 +151,11 @@ namespace Simd
                     switch(sqsumFormat)
                     {
                     case SimdPixelFormatInt32:
-                        IntegralSumSqsum<uint32_t, uint32_t>(src, srcStride, width, height, 
+                        Avx512bw::IntegralSumSqsum(src, srcStride, width, height, 
                             (uint32_t*)sum, sumStride/sizeof(uint32_t), (uint32_t*)sqsum, sqsumStride/sizeof(uint32_t));
                         break;
                     case SimdPixelFormatDouble:
-                        IntegralSumSqsum<uint32_t, double>(src, srcStride, width, height, 
+                        Simd::IntegralSumSqsum<uint32_t, double>(src, srcStride, width, height, 
                             (uint32_t*)sum, sumStride/sizeof(uint32_t), (double*)sqsum, sqsumStride/sizeof(double));
                         break;
                     default:
@@ -0,0 +1,75 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMorphology.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+	namespace Avx512bw
+	{
+		template<bool dilate> SIMD_INLINE void MorphologyRow(const uint8_t * a, const uint8_t * b, uint8_t * dst, __mmask64 tail = -1)
+		{
+			__m512i _a = _mm512_maskz_loadu_epi8(tail, a);
+			__m512i _b = _mm512_maskz_loadu_epi8(tail, b);
+			_mm512_mask_storeu_epi8(dst, tail, dilate ? _mm512_max_epu8(_a, _b) : _mm512_min_epu8(_a, _b));
+		}
+
+		template<bool dilate> void MorphologyRow(const uint8_t * a, const uint8_t * b, size_t size, uint8_t * dst)
+		{
+			size_t alignedSize = AlignLo(size, A), i = 0;
+			__mmask64 tailMask = TailMask64(size - alignedSize);
+			for (; i < alignedSize; i += A)
+				MorphologyRow<dilate>(a + i, b + i, dst + i);
+			if (i < size)
+				MorphologyRow<dilate>(a + i, b + i, dst + i, tailMask);
+		}
+
+		SIMD_INLINE void MorphologyBlend(const uint8_t * src, const uint8_t * mask, __m512i index, uint8_t * dst, __mmask64 tail = -1)
+		{
+			__mmask64 _mask = _mm512_cmpneq_epu8_mask(_mm512_maskz_loadu_epi8(tail, mask), index) & tail;
+			_mm512_mask_storeu_epi8(dst, _mask, _mm512_maskz_loadu_epi8(_mask, src));
+		}
+
+		void MorphologyBlend(const uint8_t * src, const uint8_t * mask, uint8_t index, size_t size, uint8_t * dst)
+		{
+			__m512i _index = _mm512_set1_epi8(index);
+			size_t alignedSize = AlignLo(size, A), i = 0;
+			__mmask64 tailMask = TailMask64(size - alignedSize);
+			for (; i < alignedSize; i += A)
+				MorphologyBlend(src + i, mask + i, _index, dst + i);
+			if (i < size)
+				MorphologyBlend(src + i, mask + i, _index, dst + i, tailMask);
+		}
+
+		void Morphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdMorphologyType type, SimdMorphologyShapeType shape,
+			size_t windowX, size_t windowY, const uint8_t * mask, size_t maskStride, uint8_t index, uint8_t * dst, size_t dstStride)
+		{
+			Base::MorphologyFuncs funcs = { MorphologyRow<false>, MorphologyRow<true>, MorphologyBlend };
+			Base::MorphologyRun(src, srcStride, width, height, type, shape, windowX, windowY, mask, maskStride, index, dst, dstStride, funcs);
+		}
+	}
+#endif// SIMD_AVX512BW_ENABLE
+}
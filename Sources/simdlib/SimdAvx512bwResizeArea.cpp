@@ -0,0 +1,105 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template<bool first> SIMD_INLINE void ResizeAreaY(const uint8_t * src, __m512 alpha, float * dst)
+        {
+            __m512 value = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)src))), alpha);
+            _mm512_storeu_ps(dst, first ? value : _mm512_add_ps(_mm512_loadu_ps(dst), value));
+        }
+
+        template<bool first> void ResizeAreaY(const uint8_t * src, size_t size, float alpha, float * dst)
+        {
+            size_t alignedSize = AlignLo(size, A);
+            __m512 _alpha = _mm512_set1_ps(alpha);
+            for (size_t i = 0; i < alignedSize; i += A)
+            {
+                ResizeAreaY<first>(src + i + 0 * F, _alpha, dst + i + 0 * F);
+                ResizeAreaY<first>(src + i + 1 * F, _alpha, dst + i + 1 * F);
+                ResizeAreaY<first>(src + i + 2 * F, _alpha, dst + i + 2 * F);
+                ResizeAreaY<first>(src + i + 3 * F, _alpha, dst + i + 3 * F);
+            }
+            for (size_t i = alignedSize; i < size; ++i)
+                dst[i] = first ? src[i] * alpha : dst[i] + src[i] * alpha;
+        }
+
+        SIMD_INLINE void ResizeAreaX(const float * src, const Base::ResizeAreaIndex & index, size_t offset, uint8_t * dst, __mmask16 tail)
+        {
+            size_t size = index.size;
+            const int * pi = index.index.data + offset;
+            const float * pa = index.alpha.data + offset;
+            __m512 sum = _mm512_setzero_ps();
+            for (size_t k = 0; k < index.taps; ++k)
+            {
+                __m512 value = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, _mm512_maskz_loadu_epi32(tail, pi + k*size), src, 4);
+                __m512 product = _mm512_mul_ps(value, _mm512_maskz_loadu_ps(tail, pa + k*size));
+                sum = k ? _mm512_add_ps(sum, product) : product;
+            }
+            __m512i value = _mm512_max_epi32(_mm512_cvtps_epi32(sum), _mm512_setzero_si512());
+            _mm512_mask_cvtusepi32_storeu_epi8(dst + offset, tail, value);
+        }
+
+        void ResizeAreaX(const float * src, const Base::ResizeAreaIndex & index, uint8_t * dst)
+        {
+            size_t size = index.size, alignedSize = AlignLo(size, F);
+            for (size_t i = 0; i < alignedSize; i += F)
+                ResizeAreaX(src, index, i, dst, __mmask16(-1));
+            if (alignedSize != size)
+                ResizeAreaX(src, index, alignedSize, dst, TailMask16(size - alignedSize));
+        }
+
+        ResizerByteArea::ResizerByteArea(const Base::ResParam & param)
+            : Base::ResizerByteArea(param)
+        {
+        }
+
+        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            size_t dstHeight = _param.dstH;
+            for (size_t y = 0; y < dstHeight; ++y, dst = Next(dst, dstStride))
+            {
+                const uint8_t * ps = src + _iy.index[y] * srcStride;
+                ResizeAreaY<true>(ps, _bx.size, _iy.alpha[y], _bx.data);
+                for (int k = 1; k < _iy.count[y]; ++k)
+                    ResizeAreaY<false>(ps += srcStride, _bx.size, _iy.alpha[k*dstHeight + y], _bx.data);
+                ResizeAreaX(_bx.data, _ix, dst);
+            }
+        }
+
+        void ResizeArea(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+        {
+            ResizerByteArea resizer(Base::ResParam(srcWidth, srcHeight, dstWidth, dstHeight, channelCount, SimdResizeMethodArea));
+            resizer.Run(src, srcStride, dst, dstStride);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
@@ -0,0 +1,119 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512 ResizeBicubicX(const uint8_t * src, const int * index, const float * alpha, size_t offset)
+        {
+            __m512i value = _mm512_and_si512(_mm512_i32gather_epi32(_mm512_loadu_si512(index + offset), src, 1), K32_000000FF);
+            return _mm512_mul_ps(_mm512_cvtepi32_ps(value), _mm512_loadu_ps(alpha + offset));
+        }
+
+        // Source is read by 32-bit gathers, so there must be at least 3 readable bytes after element index[k*size + i] for i < end.
+        void ResizeBicubicX(const uint8_t * src, const Base::ResizeBicubicIndex & index, size_t end, float * dst)
+        {
+            size_t size = index.size, alignedEnd = AlignLo(end, F);
+            const int * idx = index.index.data;
+            const float * alpha = index.alpha.data;
+            for (size_t i = 0; i < alignedEnd; i += F)
+            {
+                __m512 sum = ResizeBicubicX(src, idx + 0 * size, alpha + 0 * size, i);
+                sum = _mm512_add_ps(sum, ResizeBicubicX(src, idx + 1 * size, alpha + 1 * size, i));
+                sum = _mm512_add_ps(sum, ResizeBicubicX(src, idx + 2 * size, alpha + 2 * size, i));
+                sum = _mm512_add_ps(sum, ResizeBicubicX(src, idx + 3 * size, alpha + 3 * size, i));
+                _mm512_storeu_ps(dst + i, sum);
+            }
+            Base::ResizeBicubicX(src, index, alignedEnd, dst);
+        }
+
+        SIMD_INLINE void ResizeBicubicY(const float * const * src, const __m512 * alpha, size_t offset, uint8_t * dst, __mmask16 tail = -1)
+        {
+            __m512 sum = _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, src[0] + offset), alpha[0]);
+            sum = _mm512_add_ps(sum, _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, src[1] + offset), alpha[1]));
+            sum = _mm512_add_ps(sum, _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, src[2] + offset), alpha[2]));
+            sum = _mm512_add_ps(sum, _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, src[3] + offset), alpha[3]));
+            __m512i value = _mm512_max_epi32(_mm512_cvtps_epi32(sum), _mm512_setzero_si512());
+            _mm512_mask_cvtusepi32_storeu_epi8(dst + offset, tail, value);
+        }
+
+        void ResizeBicubicY(const float * const * src, const float * alpha, size_t size, uint8_t * dst)
+        {
+            __m512 _alpha[4];
+            for (size_t k = 0; k < 4; ++k)
+                _alpha[k] = _mm512_set1_ps(alpha[k]);
+            size_t alignedSize = AlignLo(size, F);
+            for (size_t i = 0; i < alignedSize; i += F)
+                ResizeBicubicY(src, _alpha, i, dst);
+            if (alignedSize != size)
+                ResizeBicubicY(src, _alpha, alignedSize, dst, TailMask16(size - alignedSize));
+        }
+
+        ResizerByteBicubic::ResizerByteBicubic(const Base::ResParam & param)
+            : Base::ResizerByteBicubic(param)
+        {
+            _lastEnd = 0;
+            ptrdiff_t lastSize = (ptrdiff_t)(_param.srcW*_param.channels) - 3;
+            while (_lastEnd < _ix.size && _ix.index[3 * _ix.size + _lastEnd] < lastSize)
+                _lastEnd++;
+        }
+
+        void ResizerByteBicubic::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            size_t dstHeight = _param.dstH;
+            _rows.Reset();
+            for (size_t y = 0; y < dstHeight; ++y, dst = Next(dst, dstStride))
+            {
+                const float * ps[4];
+                float alpha[4];
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    int sy = _iy.index[k*dstHeight + y];
+                    ps[k] = _rows.Get(sy);
+                    if (ps[k] == NULL)
+                    {
+                        float * row = _rows.Set(sy, _iy.index.data + y, dstHeight);
+                        Avx512bw::ResizeBicubicX(src + sy*srcStride, _ix, (_param.srcH - 1 - sy)*srcStride >= 3 ? _ix.size : _lastEnd, row);
+                        ps[k] = row;
+                    }
+                    alpha[k] = _iy.alpha[k*dstHeight + y];
+                }
+                ResizeBicubicY(ps, alpha, _ix.size, dst);
+            }
+        }
+
+        void ResizeBicubic(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+        {
+            ResizerByteBicubic resizer(Base::ResParam(srcWidth, srcHeight, dstWidth, dstHeight, channelCount, SimdResizeMethodBicubic));
+            resizer.Run(src, srcStride, dst, dstStride);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
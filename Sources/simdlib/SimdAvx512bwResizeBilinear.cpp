@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdResizer.h"
 #include "Simd/SimdAvx2.h"
 
 namespace Simd
@@ -31,68 +32,7 @@ namespace Simd
 #ifdef SIMD_AVX512BW_ENABLE
     namespace Avx512bw
     {
-        namespace
-        {
-            struct Buffer
-            {
-                Buffer(size_t size, size_t width, size_t height)
-                {
-                    _p = Allocate(3*size + sizeof(int)*(2*height + width));
-                    bx[0] = (uint8_t*)_p;
-                    bx[1] = bx[0] + size;
-                    ax = bx[1] + size;
-                    ix = (int*)(ax + size);
-                    iy = ix + width;
-                    ay = iy + height;
-                }
-
-                ~Buffer()
-                {
-                    Free(_p);
-                }
-
-                uint8_t * bx[2];
-                uint8_t * ax;
-                int * ix;
-                int * ay;
-                int * iy;
-            private:
-                void *_p;
-            };
-
-            struct Index
-            {
-                int src, dst;
-                uint8_t shuffle[Avx2::A];
-            };
-
-            struct BufferG
-            {
-				BufferG(size_t width, size_t blocks, size_t height)
-				{
-					_p = Allocate(3*width + sizeof(int)*2*height + blocks*sizeof(Index) + 2*A);
-					bx[0] = (uint8_t*)_p;
-					bx[1] = bx[0] + width + A;
-					ax = bx[1] + width + A;
-					ix = (Index*)(ax + width);
-					iy = (int*)(ix + blocks);
-					ay = iy + height;
-				}
-
-                ~BufferG()
-                {
-                    Free(_p);
-                }
-
-                uint8_t * bx[2];
-                uint8_t * ax;
-                Index * ix;
-                int * ay;
-                int * iy;
-            private:
-                void *_p;
-            };
-        }
+        typedef ResizerByteBilinear::Index Index;
 
         template <size_t channelCount> void EstimateAlphaIndexX(size_t srcSize, size_t dstSize, int * indexes, uint8_t * alphas)
         {
@@ -306,43 +246,35 @@ namespace Simd
             Store<false>(dst, _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(lo, hi)));
         }
 
-        template <size_t channelCount> void ResizeBilinear(
-            const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+        template <size_t channelCount> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
         {
-            assert(dstWidth >= A);
-
             struct One { uint8_t channels[channelCount]; };
             struct Two { uint8_t channels[channelCount*2]; };
 
+            size_t dstWidth = _param.dstW, dstHeight = _param.dstH;
             size_t size = 2*dstWidth*channelCount;
-            size_t bufferSize = AlignHi(dstWidth, A)*channelCount*2;
+            size_t bufferSize = _ax.size;
             size_t alignedSize = AlignHi(size, DA) - DA;
             const size_t step = A*channelCount;
-
-            Buffer buffer(bufferSize, dstWidth, dstHeight);
-
-            Base::EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1);
-
-            EstimateAlphaIndexX<channelCount>(srcWidth, dstWidth, buffer.ix, buffer.ax);
+            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
 
             ptrdiff_t previous = -2;
 
             __m512i a[2];
 
-            for(size_t yDst = 0; yDst < dstHeight; yDst++, dst += dstStride)
+            for(size_t yDst = 0; yDst < dstHeight; yDst++, dst = Next(dst, dstStride))
             {
-                a[0] = _mm512_set1_epi16(int16_t(Base::FRACTION_RANGE - buffer.ay[yDst]));
-                a[1] = _mm512_set1_epi16(int16_t(buffer.ay[yDst]));
+                a[0] = _mm512_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
+                a[1] = _mm512_set1_epi16(int16_t(_ay[yDst]));
 
-                ptrdiff_t sy = buffer.iy[yDst];
+                ptrdiff_t sy = _iy[yDst];
                 int k = 0;
 
                 if(sy == previous)
                     k = 2;
                 else if(sy == previous + 1)
                 {
-                    Swap(buffer.bx[0], buffer.bx[1]);
+                    Swap(bx[0], bx[1]);
                     k = 1;
                 }
 
@@ -350,20 +282,20 @@ namespace Simd
 
                 for(; k < 2; k++)
                 {
-                    Two * pb = (Two *)buffer.bx[k];
+                    Two * pb = (Two *)bx[k];
                     const One * psrc = (const One *)(src + (sy + k)*srcStride);
                     for(size_t x = 0; x < dstWidth; x++)
-                        pb[x] = *(Two *)(psrc + buffer.ix[x]);
+                        pb[x] = *(Two *)(psrc + _ix[x]);
 
-                    uint8_t * pbx = buffer.bx[k];
+                    uint8_t * pbx = bx[k];
                     for(size_t i = 0; i < bufferSize; i += step)
-                        InterpolateX<channelCount>(buffer.ax + i, pbx + i);
+                        InterpolateX<channelCount>(_ax.data + i, pbx + i);
                 }
 
                 for(size_t ib = 0, id = 0; ib < alignedSize; ib += DA, id += A)
-                    InterpolateY<true>(buffer.bx[0] + ib, buffer.bx[1] + ib, a, dst + id);
+                    InterpolateY<true>(bx[0] + ib, bx[1] + ib, a, dst + id);
                 size_t i = size - DA;
-                InterpolateY<false>(buffer.bx[0] + i, buffer.bx[1] + i, a, dst + i/2);
+                InterpolateY<false>(bx[0] + i, bx[1] + i, a, dst + i/2);
             }
         }
 
@@ -396,38 +328,30 @@ namespace Simd
 			_mm256_storeu_si256((__m256i*)(dst + index.dst), _mm256_maddubs_epi16(Shuffle(_src, _shuffle), _alpha));
 		}
 
-        void ResizeBilinearGray(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+        void ResizerByteBilinear::RunGray(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
         {
-            assert(dstWidth >= A);
-
-            size_t size = 2*dstWidth;
-            size_t bufferWidth = AlignHi(dstWidth, A)*2;
-			size_t blockCount = BlockCountMax(srcWidth, dstWidth);
-			size_t alignedSize = AlignHi(size, DA) - DA;
-
-            BufferG buffer(bufferWidth, blockCount, dstHeight);
-
-            Base::EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1);
-
-            EstimateAlphaIndexX((int)srcWidth, (int)dstWidth, buffer.ix, buffer.ax, blockCount);
+            size_t dstHeight = _param.dstH;
+            size_t size = 2*_param.dstW;
+            size_t alignedSize = AlignHi(size, DA) - DA;
+            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
 
             ptrdiff_t previous = -2;
 
             __m512i a[2];
 
-            for(size_t yDst = 0; yDst < dstHeight; yDst++, dst += dstStride)
+            for(size_t yDst = 0; yDst < dstHeight; yDst++, dst = Next(dst, dstStride))
             {
-                a[0] = _mm512_set1_epi16(int16_t(Base::FRACTION_RANGE - buffer.ay[yDst]));
-                a[1] = _mm512_set1_epi16(int16_t(buffer.ay[yDst]));
+                a[0] = _mm512_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
+                a[1] = _mm512_set1_epi16(int16_t(_ay[yDst]));
 
-                ptrdiff_t sy = buffer.iy[yDst];
+                ptrdiff_t sy = _iy[yDst];
                 int k = 0;
 
                 if(sy == previous)
                     k = 2;
                 else if(sy == previous + 1)
                 {
-                    Swap(buffer.bx[0], buffer.bx[1]);
+                    Swap(bx[0], bx[1]);
                     k = 1;
                 }
 
@@ -436,15 +360,69 @@ namespace Simd
                 for(; k < 2; k++)
                 {
 					const uint8_t * psrc = src + (sy + k)*srcStride;
-					uint8_t * pdst = buffer.bx[k];
-					for (size_t i = 0; i < blockCount; ++i)
-						LoadGrayIntrepolated(psrc, buffer.ix[i], buffer.ax, pdst);
+					uint8_t * pdst = bx[k];
+					for (size_t i = 0; i < _blocks; ++i)
+						LoadGrayIntrepolated(psrc, _ixg[i], _ax.data, pdst);
                 }
 
                 for(size_t ib = 0, id = 0; ib < alignedSize; ib += DA, id += A)
-                    InterpolateY<true>(buffer.bx[0] + ib, buffer.bx[1] + ib, a, dst + id);
+                    InterpolateY<true>(bx[0] + ib, bx[1] + ib, a, dst + id);
                 size_t i = size - DA;
-                InterpolateY<false>(buffer.bx[0] + i, buffer.bx[1] + i, a, dst + i/2);
+                InterpolateY<false>(bx[0] + i, bx[1] + i, a, dst + i/2);
+            }
+        }
+
+        ResizerByteBilinear::ResizerByteBilinear(const Base::ResParam & param)
+            : Base::Resizer(param)
+            , _blocks(0)
+        {
+            assert(_param.dstW >= A && _param.channels >= 1 && _param.channels <= 4);
+
+            _iy.Resize(_param.dstH);
+            _ay.Resize(_param.dstH);
+            Base::EstimateAlphaIndex(_param.srcH, _param.dstH, _iy.data, _ay.data, 1);
+
+            if (_param.channels == 1 && _param.srcW >= A && _param.srcW < 4 * _param.dstW)
+            {
+                size_t bufferWidth = AlignHi(_param.dstW, A)*2;
+                _blocks = BlockCountMax(_param.srcW, _param.dstW);
+                _bx[0].Resize(bufferWidth + A);
+                _bx[1].Resize(bufferWidth + A);
+                _ax.Resize(bufferWidth + A);
+                _ixg.Resize(_blocks);
+                EstimateAlphaIndexX((int)_param.srcW, (int)_param.dstW, _ixg.data, _ax.data, _blocks);
+            }
+            else
+            {
+                size_t bufferSize = AlignHi(_param.dstW, A)*_param.channels*2;
+                _bx[0].Resize(bufferSize);
+                _bx[1].Resize(bufferSize);
+                _ax.Resize(bufferSize);
+                _ix.Resize(_param.dstW);
+                switch (_param.channels)
+                {
+                case 1: EstimateAlphaIndexX<1>(_param.srcW, _param.dstW, _ix.data, _ax.data); break;
+                case 2: EstimateAlphaIndexX<2>(_param.srcW, _param.dstW, _ix.data, _ax.data); break;
+                case 3: EstimateAlphaIndexX<3>(_param.srcW, _param.dstW, _ix.data, _ax.data); break;
+                case 4: EstimateAlphaIndexX<4>(_param.srcW, _param.dstW, _ix.data, _ax.data); break;
+                }
+            }
+        }
+
+        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            if (_blocks)
+                RunGray(src, srcStride, dst, dstStride);
+            else
+            {
+                switch (_param.channels)
+                {
+                case 1: Run<1>(src, srcStride, dst, dstStride); break;
+                case 2: Run<2>(src, srcStride, dst, dstStride); break;
+                case 3: Run<3>(src, srcStride, dst, dstStride); break;
+                case 4: Run<4>(src, srcStride, dst, dstStride); break;
+                default: assert(0);
+                }
             }
         }
 
@@ -452,27 +430,27 @@ namespace Simd
             const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
         {
-            switch(channelCount)
+            if (channelCount >= 1 && channelCount <= 4)
             {
-            case 1: 
-                if(srcWidth >= A && srcWidth < 4*dstWidth)
-                    ResizeBilinearGray(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride); 
-                else
-                    ResizeBilinear<1>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride); 
-                break;
-			case 2: 
-			    ResizeBilinear<2>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride); 
-			    break;
-            case 3: 
-                ResizeBilinear<3>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride); 
-                break;
-            case 4: 
-                ResizeBilinear<4>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride); 
-                break;
-            default: 
-                Avx2::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount); 
+                ResizerByteBilinear resizer(Base::ResParam(srcWidth, srcHeight, dstWidth, dstHeight, channelCount, SimdResizeMethodBilinear));
+                resizer.Run(src, srcStride, dst, dstStride);
             }
-        }	
+            else
+                Base::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+        }
+
+        void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method)
+        {
+            Base::ResParam param(srcX, srcY, dstX, dstY, channels, method);
+            if (method == SimdResizeMethodBilinear && dstX >= A && channels >= 1 && channels <= 4)
+                return new ResizerByteBilinear(param);
+            else if (method == SimdResizeMethodArea && srcX >= A)
+                return new ResizerByteArea(param);
+            else if (method == SimdResizeMethodBicubic && dstX >= A)
+                return new ResizerByteBicubic(param);
+            else
+                return Avx2::ResizerInit(srcX, srcY, dstX, dstY, channels, method);
+        }
     }
 #endif//SIMD_AVX512BW_ENABLE
 }
@@ -50,7 +50,7 @@ namespace Simd
         template <bool align> void GetStatistic(const uint8_t * src, size_t stride, size_t width, size_t height, 
             uint8_t * min, uint8_t * max, uint8_t * average)
         {
-            assert(width*height && width >= A);
+            assert(width*height);
             if(align)
                 assert(Aligned(src) && Aligned(stride));
 
@@ -192,6 +192,58 @@ namespace Simd
 				Yuv444pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 		}
 
+
+		template <bool align, bool mask> SIMD_INLINE void Nv12ToBgr(const uint8_t * y0, const uint8_t * y1, const uint8_t * uv, uint8_t * bgr0, uint8_t * bgr1, const __mmask64 * tails)
+		{
+			__m512i _u, _v;
+			LoadUv<align, mask>(uv, tails + 1, _u, _v);
+			__m512i u0 = UnpackU8<0>(_u, _u);
+			__m512i u1 = UnpackU8<1>(_u, _u);
+			__m512i v0 = UnpackU8<0>(_v, _v);
+			__m512i v1 = UnpackU8<1>(_v, _v);
+			YuvToBgr<align, mask>(Load<align, mask>(y0 + 0, tails[1]), u0, v0, bgr0 + 0 * A, tails + 3);
+			YuvToBgr<align, mask>(Load<align, mask>(y0 + A, tails[2]), u1, v1, bgr0 + 3 * A, tails + 6);
+			YuvToBgr<align, mask>(Load<align, mask>(y1 + 0, tails[1]), u0, v0, bgr1 + 0 * A, tails + 3);
+			YuvToBgr<align, mask>(Load<align, mask>(y1 + A, tails[2]), u1, v1, bgr1 + 3 * A, tails + 6);
+		}
+
+		template <bool align> void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, 
+			size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+		{
+			assert((width%2 == 0) && (height%2 == 0));
+			if(align)
+				assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgr) && Aligned(bgrStride));
+
+			width /= 2;
+			size_t alignedWidth = AlignLo(width, A);
+			size_t tail = width - alignedWidth;
+			__mmask64 tailMasks[9];
+			tailMasks[0] = TailMask64(tail);
+			for (size_t i = 0; i < 2; ++i)
+				tailMasks[1 + i] = TailMask64(tail * 2 - A * i);
+			for (size_t i = 0; i < 6; ++i)
+				tailMasks[3 + i] = TailMask64(tail * 6 - A * i);
+			for(size_t row = 0; row < height; row += 2)
+			{
+				size_t col = 0;
+				for (; col < alignedWidth; col += A)
+					Nv12ToBgr<align, false>(y + col * 2, y + yStride + col * 2, uv + col * 2, bgr + col * 6, bgr + bgrStride + col * 6, tailMasks);
+				if (col < width)
+					Nv12ToBgr<align, true>(y + col * 2, y + yStride + col * 2, uv + col * 2, bgr + col * 6, bgr + bgrStride + col * 6, tailMasks);
+				y += 2*yStride;
+				uv += uvStride;
+				bgr += 2*bgrStride;
+			}
+		}
+
+		void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, 
+			size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+		{
+			if(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgr) && Aligned(bgrStride))
+				Nv12ToBgr<true>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+			else
+				Nv12ToBgr<false>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+		}
     }
 #endif// SIMD_AVX2_ENABLE
 }
@@ -200,6 +200,60 @@ namespace Simd
 			else
 				Yuv444pToBgra<false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 		}
+
+		template <bool align, bool mask> SIMD_INLINE void Nv12ToBgra(const uint8_t * y0, const uint8_t * y1, const uint8_t * uv, 
+			const __m512i & a, uint8_t * bgra0, uint8_t * bgra1, const __mmask64 * tails)
+		{
+			__m512i _u, _v;
+			LoadUv<align, mask>(uv, tails + 1, _u, _v);
+			__m512i u0 = UnpackU8<0>(_u, _u);
+			__m512i u1 = UnpackU8<1>(_u, _u);
+			__m512i v0 = UnpackU8<0>(_v, _v);
+			__m512i v1 = UnpackU8<1>(_v, _v);
+			YuvToBgra<align, mask>(Load<align, mask>(y0 + 0, tails[1]), u0, v0, a, bgra0 + 00, tails + 3);
+			YuvToBgra<align, mask>(Load<align, mask>(y0 + A, tails[2]), u1, v1, a, bgra0 + QA, tails + 7);
+			YuvToBgra<align, mask>(Load<align, mask>(y1 + 0, tails[1]), u0, v0, a, bgra1 + 00, tails + 3);
+			YuvToBgra<align, mask>(Load<align, mask>(y1 + A, tails[2]), u1, v1, a, bgra1 + QA, tails + 7);
+		}
+
+		template <bool align> void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, 
+			size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+		{
+			assert((width%2 == 0) && (height%2 == 0));
+			if(align)
+				assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgra) && Aligned(bgraStride));
+
+			__m512i a = _mm512_set1_epi8(alpha);
+			width /= 2;
+			size_t alignedWidth = AlignLo(width, A);
+			size_t tail = width - alignedWidth;
+			__mmask64 tailMasks[11];
+			tailMasks[0] = TailMask64(tail);
+			for (size_t i = 0; i < 2; ++i)
+				tailMasks[1 + i] = TailMask64(tail * 2 - A * i);
+			for (size_t i = 0; i < 8; ++i)
+				tailMasks[3 + i] = TailMask64(tail * 8 - A * i);
+			for(size_t row = 0; row < height; row += 2)
+			{
+				size_t col = 0;
+				for (; col < alignedWidth; col += A)
+					Nv12ToBgra<align, false>(y + col * 2, y + yStride + col * 2, uv + col * 2, a, bgra + col * 8, bgra + bgraStride + col * 8, tailMasks);
+				if (col < width)
+					Nv12ToBgra<align, true>(y + col * 2, y + yStride + col * 2, uv + col * 2, a, bgra + col * 8, bgra + bgraStride + col * 8, tailMasks);
+				y += 2*yStride;
+				uv += uvStride;
+				bgra += 2*bgraStride;
+			}
+		}
+
+		void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, 
+			size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+		{
+			if(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgra) && Aligned(bgraStride))
+				Nv12ToBgra<true>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+			else
+				Nv12ToBgra<false>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+		}
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
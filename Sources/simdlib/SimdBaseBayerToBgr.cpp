@@ -21,31 +21,18 @@
 * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 * SOFTWARE.
 */
-#include "Simd/SimdConversion.h"
+#include "Simd/SimdBayer.h"
 
 namespace Simd
 {
     namespace Base
     {
-        template <SimdPixelFormatType bayerFormat> void BayerToBgr(const uint8_t * src[6], 
-            size_t col0, size_t col2, size_t col4, uint8_t * dst, size_t stride)
-        {
-            BayerToBgr<bayerFormat>(src, 
-                col0, col0 + 1, col2, col2 + 1, col4, col4 + 1, 
-                dst, dst + 3, dst + stride, dst + stride + 3);
-        }
-
         template <SimdPixelFormatType bayerFormat> void BayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, uint8_t * bgr, size_t bgrStride)
         {
             const uint8_t * src[6];
             for(size_t row = 0; row < height; row += 2)
             {
-                src[0] = (row == 0 ? bayer : bayer - 2*bayerStride);
-                src[1] = src[0] + bayerStride;
-                src[2] = bayer;
-                src[3] = src[2] + bayerStride;
-                src[4] = (row == height - 2 ? bayer : bayer + 2*bayerStride);
-                src[5] = src[4] + bayerStride;
+                BayerSetRows(bayer, bayerStride, row, height, src);
 
                 BayerToBgr<bayerFormat>(src, 0, 0, 2, bgr, bgrStride);
 
@@ -0,0 +1,270 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBilateralFilter.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        size_t BilateralFilterRadius(float sigmaSpace, size_t radius)
+        {
+            if (radius == 0)
+                radius = Simd::Max(Round(1.5f*sigmaSpace), 1);
+            return radius;
+        }
+
+        static void BilateralFilterRange(float sigmaRange, size_t channelCount, float scale, Array<float> & range)
+        {
+            const float min = 1.0e-12f; // Smaller weights are set to zero to prevent denormal numbers in recursive filter.
+            range.Resize(255 * channelCount + 1);
+            float k = -0.5f / (sigmaRange*sigmaRange);
+            for (size_t i = 0; i < range.size; ++i)
+            {
+                float weight = ::exp(float(i*i)*k);
+                range[i] = weight < min ? 0.0f : scale*weight;
+            }
+        }
+
+        SIMD_INLINE void BilateralFilterExtend(const uint8_t * src, size_t width, size_t channelCount, size_t radius, size_t planeSize, uint8_t * dst)
+        {
+            for (size_t c = 0; c < channelCount; ++c, dst += planeSize)
+                for (size_t i = 0; i < planeSize; ++i)
+                    dst[i] = src[Simd::RestrictRange<ptrdiff_t>(i - radius, 0, width - 1)*channelCount + c];
+        }
+
+        void BilateralFilterExactRun(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+            float sigmaSpace, float sigmaRange, size_t radius, uint8_t * dst, size_t dstStride, BilateralFilterExactPtr exact)
+        {
+            assert(channelCount >= 1 && channelCount <= 4 && sigmaSpace > 0.0f && sigmaRange > 0.0f);
+
+            size_t window = 2 * radius + 1, tapCount = 0;
+            Array<BilateralFilterTap> taps(window*window);
+            float k = -0.5f / (sigmaSpace*sigmaSpace);
+            for (ptrdiff_t dy = -ptrdiff_t(radius); dy <= ptrdiff_t(radius); ++dy)
+            {
+                for (ptrdiff_t dx = -ptrdiff_t(radius); dx <= ptrdiff_t(radius); ++dx)
+                {
+                    ptrdiff_t distance = dx*dx + dy*dy;
+                    if (distance > ptrdiff_t(radius*radius))
+                        continue;
+                    taps[tapCount].row = int(dy + radius);
+                    taps[tapCount].col = int(dx);
+                    taps[tapCount].weight = ::exp(float(distance)*k);
+                    tapCount++;
+                }
+            }
+            Array<float> range;
+            BilateralFilterRange(sigmaRange, channelCount, 1.0f, range);
+
+            size_t planeSize = AlignHi(width + 2 * radius + BILATERAL_FILTER_BLOCK_MAX, SIMD_ALIGN);
+            Array<uint8_t> ring(window*channelCount*planeSize);
+            Array<const uint8_t*> rows(window*channelCount);
+            for (size_t row = 0, next = 0; row < height; ++row)
+            {
+                for (size_t last = Simd::Min(row + radius, height - 1); next <= last; ++next)
+                    BilateralFilterExtend(src + next*srcStride, width, channelCount, radius, planeSize, ring.data + (next%window)*channelCount*planeSize);
+                for (size_t k = 0; k < window; ++k)
+                {
+                    size_t y = Simd::RestrictRange<ptrdiff_t>(row + k - radius, 0, height - 1);
+                    for (size_t c = 0; c < channelCount; ++c)
+                        rows[c*window + k] = ring.data + ((y%window)*channelCount + c)*planeSize + radius;
+                }
+                exact(rows.data, channelCount, radius, taps.data, tapCount, range.data, width, dst + row*dstStride);
+            }
+        }
+
+        template<size_t channelCount> SIMD_INLINE int BilateralFilterDistance(const uint8_t * a, const uint8_t * b)
+        {
+            int distance = 0;
+            for (size_t c = 0; c < channelCount; ++c)
+                distance += Simd::Abs(int(a[c]) - int(b[c]));
+            return distance;
+        }
+
+        template<size_t channelCount> void BilateralFilterHorizontal(const uint8_t * src, size_t width, const float * range, float inv, float * dst, size_t stride)
+        {
+            float * factor = dst + channelCount*stride, value[channelCount], norm = 1.0f;
+            for (size_t c = 0; c < channelCount; ++c)
+                dst[c*stride] = value[c] = src[c];
+            factor[0] = norm;
+            for (size_t x = 1; x < width; ++x)
+            {
+                const uint8_t * s = src + x*channelCount;
+                float weight = range[BilateralFilterDistance<channelCount>(s, s - channelCount)];
+                for (size_t c = 0; c < channelCount; ++c)
+                    dst[c*stride + x] = value[c] = s[c] * inv + value[c] * weight;
+                factor[x] = norm = inv + norm*weight;
+            }
+            norm = 1.0f;
+            for (size_t c = 0; c < channelCount; ++c)
+                value[c] = src[(width - 1)*channelCount + c];
+            for (size_t x = width - 1; x > 0; --x)
+            {
+                for (size_t c = 0; c < channelCount; ++c)
+                    dst[c*stride + x] += value[c];
+                factor[x] += norm;
+                const uint8_t * s = src + (x - 1)*channelCount;
+                float weight = range[BilateralFilterDistance<channelCount>(s, s + channelCount)];
+                for (size_t c = 0; c < channelCount; ++c)
+                    value[c] = s[c] * inv + value[c] * weight;
+                norm = inv + norm*weight;
+            }
+            for (size_t c = 0; c < channelCount; ++c)
+                dst[c*stride] += value[c];
+            factor[0] += norm;
+        }
+
+        template<size_t channelCount> void BilateralFilterWeight(const uint8_t * a, const uint8_t * b, size_t width, const float * range, float * weight)
+        {
+            for (size_t x = 0, offset = 0; x < width; ++x, offset += channelCount)
+                weight[x] = range[BilateralFilterDistance<channelCount>(a + offset, b + offset)];
+        }
+
+        template<size_t channelCount> void BilateralFilterOutput(const float * causal, const float * anticausal, size_t width, size_t stride, uint8_t * dst)
+        {
+            const float * causalFactor = causal + channelCount*stride, * anticausalFactor = anticausal + channelCount*stride;
+            for (size_t x = 0; x < width; ++x, dst += channelCount)
+            {
+                float k = 1.0f / (causalFactor[x] + anticausalFactor[x]);
+                for (size_t c = 0; c < channelCount; ++c)
+                    dst[c] = (uint8_t)Round((causal[c*stride + x] + anticausal[c*stride + x])*k);
+            }
+        }
+
+        template<size_t channelCount> void BilateralFilterFastRun(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            float sigmaSpace, float sigmaRange, uint8_t * dst, size_t dstStride, BilateralFilterRecursivePtr recursive)
+        {
+            float alpha = ::exp(-::sqrt(2.0f) / sigmaSpace), inv = 1.0f - alpha;
+            Array<float> range, minus;
+            BilateralFilterRange(sigmaRange, channelCount, alpha, range);
+            BilateralFilterRange(sigmaRange, channelCount, -alpha, minus);
+
+            size_t planes = channelCount + 1, stride = AlignHi(width, BILATERAL_FILTER_BLOCK_MAX), rowSize = planes*stride;
+            Array<float> causal(height*rowSize), buffer(2 * rowSize), weights(2 * stride, true);
+            float * row = buffer.data, * anticausal = buffer.data + rowSize, * up = weights.data, * down = weights.data + stride;
+
+            BilateralFilterHorizontal<channelCount>(src, width, range.data, inv, causal.data, stride);
+            for (size_t y = 1; y < height; ++y)
+            {
+                BilateralFilterHorizontal<channelCount>(src + y*srcStride, width, range.data, inv, row, stride);
+                BilateralFilterWeight<channelCount>(src + y*srcStride, src + (y - 1)*srcStride, width, range.data, up);
+                recursive(row, causal.data + (y - 1)*rowSize, up, width, planes, stride, inv, causal.data + y*rowSize);
+            }
+
+            BilateralFilterHorizontal<channelCount>(src + (height - 1)*srcStride, width, range.data, inv, anticausal, stride);
+            BilateralFilterOutput<channelCount>(causal.data + (height - 1)*rowSize, anticausal, width, stride, dst + (height - 1)*dstStride);
+            for (size_t y = height - 2; y < height; --y)
+            {
+                const float * curr = causal.data + y*rowSize;
+                BilateralFilterWeight<channelCount>(src + y*srcStride, src + (y + 1)*srcStride, width, range.data, down);
+                if (y)
+                {
+                    BilateralFilterWeight<channelCount>(src + y*srcStride, src + (y - 1)*srcStride, width, minus.data, up);
+                    recursive(curr, curr - rowSize, up, width, planes, stride, 1.0f, row);
+                }
+                else
+                {
+                    memset(up, 0, stride * sizeof(float));
+                    recursive(curr, curr, up, width, planes, stride, inv, row);
+                }
+                recursive(row, anticausal, down, width, planes, stride, 1.0f, anticausal);
+                BilateralFilterOutput<channelCount>(curr, anticausal, width, stride, dst + y*dstStride);
+            }
+        }
+
+        void BilateralFilterFastRun(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+            float sigmaSpace, float sigmaRange, uint8_t * dst, size_t dstStride, BilateralFilterRecursivePtr recursive)
+        {
+            assert(channelCount >= 1 && channelCount <= 4 && sigmaSpace > 0.0f && sigmaRange > 0.0f);
+
+            switch (channelCount)
+            {
+            case 1: BilateralFilterFastRun<1>(src, srcStride, width, height, sigmaSpace, sigmaRange, dst, dstStride, recursive); break;
+            case 2: BilateralFilterFastRun<2>(src, srcStride, width, height, sigmaSpace, sigmaRange, dst, dstStride, recursive); break;
+            case 3: BilateralFilterFastRun<3>(src, srcStride, width, height, sigmaSpace, sigmaRange, dst, dstStride, recursive); break;
+            case 4: BilateralFilterFastRun<4>(src, srcStride, width, height, sigmaSpace, sigmaRange, dst, dstStride, recursive); break;
+            }
+        }
+
+        template<size_t channelCount> void BilateralFilterExact(const uint8_t * const * rows, size_t radius,
+            const BilateralFilterTap * taps, size_t tapCount, const float * range, size_t width, uint8_t * dst)
+        {
+            size_t window = 2 * radius + 1;
+            for (size_t x = 0; x < width; ++x, dst += channelCount)
+            {
+                int center[channelCount];
+                float sum[channelCount], norm = 0.0f;
+                for (size_t c = 0; c < channelCount; ++c)
+                {
+                    center[c] = rows[c*window + radius][x];
+                    sum[c] = 0.0f;
+                }
+                for (size_t t = 0; t < tapCount; ++t)
+                {
+                    int value[channelCount], distance = 0;
+                    for (size_t c = 0; c < channelCount; ++c)
+                    {
+                        value[c] = rows[c*window + taps[t].row][x + taps[t].col];
+                        distance += Simd::Abs(value[c] - center[c]);
+                    }
+                    float weight = taps[t].weight*range[distance];
+                    for (size_t c = 0; c < channelCount; ++c)
+                        sum[c] += weight*value[c];
+                    norm += weight;
+                }
+                for (size_t c = 0; c < channelCount; ++c)
+                    dst[c] = (uint8_t)Round(sum[c] / norm);
+            }
+        }
+
+        void BilateralFilterExact(const uint8_t * const * rows, size_t channelCount, size_t radius,
+            const BilateralFilterTap * taps, size_t tapCount, const float * range, size_t width, uint8_t * dst)
+        {
+            switch (channelCount)
+            {
+            case 1: BilateralFilterExact<1>(rows, radius, taps, tapCount, range, width, dst); break;
+            case 2: BilateralFilterExact<2>(rows, radius, taps, tapCount, range, width, dst); break;
+            case 3: BilateralFilterExact<3>(rows, radius, taps, tapCount, range, width, dst); break;
+            case 4: BilateralFilterExact<4>(rows, radius, taps, tapCount, range, width, dst); break;
+            }
+        }
+
+        void BilateralFilterRecursive(const float * src, const float * prev, const float * weight, size_t width, size_t planes, size_t stride, float inv, float * dst)
+        {
+            for (size_t p = 0, offset = 0; p < planes; ++p, offset += stride)
+                for (size_t x = 0; x < width; ++x)
+                    dst[offset + x] = src[offset + x] * inv + prev[offset + x] * weight[x];
+        }
+
+        void BilateralFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, SimdBilateralFilterType type,
+            float sigmaSpace, float sigmaRange, size_t radius, uint8_t * dst, size_t dstStride)
+        {
+            if (type == SimdBilateralFilterFast)
+                BilateralFilterFastRun(src, srcStride, width, height, channelCount, sigmaSpace, sigmaRange, dst, dstStride, BilateralFilterRecursive);
+            else
+                BilateralFilterExactRun(src, srcStride, width, height, channelCount, sigmaSpace, sigmaRange, 
+                    BilateralFilterRadius(sigmaSpace, radius), dst, dstStride, BilateralFilterExact);
+        }
+    }
+}
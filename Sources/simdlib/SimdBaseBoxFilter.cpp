@@ -0,0 +1,112 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBoxFilter.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<size_t channelCount> SIMD_INLINE void BoxFilterRow(const uint16_t * cols, size_t size, size_t border, uint32_t * sums)
+        {
+            uint32_t sum[channelCount];
+            for (size_t c = 0; c < channelCount; ++c)
+            {
+                sum[c] = 0;
+                for (size_t i = c; i < 2 * border + channelCount; i += channelCount)
+                    sum[c] += cols[i];
+                sums[c] = sum[c];
+            }
+            const uint16_t * add = cols + 2 * border + channelCount, * sub = cols;
+            for (size_t i = channelCount; i < size; i += channelCount, add += channelCount, sub += channelCount)
+            {
+                for (size_t c = 0; c < channelCount; ++c)
+                {
+                    sum[c] += add[c] - sub[c];
+                    sums[i + c] = sum[c];
+                }
+            }
+        }
+
+        void BoxFilterRun(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t windowX, size_t windowY,
+            uint8_t * dst, size_t dstStride, BoxFilterColPtr colUpdate, BoxFilterNormPtr normalize)
+        {
+            assert(windowX % 2 == 1 && windowY % 2 == 1 && windowX <= BOX_FILTER_WINDOW_MAX && windowY <= BOX_FILTER_WINDOW_MAX);
+
+            ptrdiff_t radiusY = windowY / 2, last = height - 1;
+            size_t size = width*channelCount, border = windowX / 2 * channelCount;
+            Array<uint16_t> buffer(size + 2 * border + SIMD_ALIGN, true);
+            Array<uint32_t> sums(size);
+            uint16_t * cols = buffer.data + border;
+            float scale = 1.0f / float(windowX*windowY);
+
+            for (ptrdiff_t dy = -radiusY; dy <= radiusY; ++dy)
+            {
+                const uint8_t * s = src + Simd::RestrictRange<ptrdiff_t>(dy, 0, last)*srcStride;
+                for (size_t i = 0; i < size; ++i)
+                    cols[i] += s[i];
+            }
+
+            for (ptrdiff_t row = 0; row <= last; ++row)
+            {
+                if (row)
+                {
+                    const uint8_t * add = src + Simd::Min(row + radiusY, last)*srcStride;
+                    const uint8_t * sub = src + Simd::Max<ptrdiff_t>(row - radiusY - 1, 0)*srcStride;
+                    colUpdate(add, sub, size, cols);
+                }
+                for (size_t i = 0; i < border; ++i)
+                {
+                    buffer[i] = cols[i%channelCount];
+                    cols[size + i] = cols[size - channelCount + i%channelCount];
+                }
+                switch (channelCount)
+                {
+                case 1: BoxFilterRow<1>(buffer.data, size, border, sums.data); break;
+                case 2: BoxFilterRow<2>(buffer.data, size, border, sums.data); break;
+                case 3: BoxFilterRow<3>(buffer.data, size, border, sums.data); break;
+                case 4: BoxFilterRow<4>(buffer.data, size, border, sums.data); break;
+                default: assert(0);
+                }
+                normalize(sums.data, size, scale, dst + row*dstStride);
+            }
+        }
+
+        void BoxFilterCol(const uint8_t * add, const uint8_t * sub, size_t size, uint16_t * cols)
+        {
+            for (size_t i = 0; i < size; ++i)
+                cols[i] += add[i] - sub[i];
+        }
+
+        void BoxFilterNorm(const uint32_t * sums, size_t size, float scale, uint8_t * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = (uint8_t)Round(float(sums[i])*scale);
+        }
+
+        void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride)
+        {
+            BoxFilterRun(src, srcStride, width, height, channelCount, windowX, windowY, dst, dstStride, BoxFilterCol, BoxFilterNorm);
+        }
+    }
+}
@@ -0,0 +1,208 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdCanny.h"
+
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        void CannyGradient(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t width, int16_t * dx, int16_t * dy, int16_t * mag)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                int _dx = (src0[x + 1] + 2 * src1[x + 1] + src2[x + 1]) - (src0[x - 1] + 2 * src1[x - 1] + src2[x - 1]);
+                int _dy = (src2[x - 1] + 2 * src2[x] + src2[x + 1]) - (src0[x - 1] + 2 * src0[x] + src0[x + 1]);
+                dx[x] = (int16_t)_dx;
+                dy[x] = (int16_t)_dy;
+                mag[x] = (int16_t)(Simd::Abs(_dx) + Simd::Abs(_dy));
+            }
+        }
+
+        void CannySuppress(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2,
+            size_t width, int16_t low, int16_t high, uint8_t * dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                int m = mag1[x];
+                if (m <= low)
+                {
+                    dst[x] = 0;
+                    continue;
+                }
+                int adx = Simd::Abs(dx[x]), ady = Simd::Abs(dy[x]), a, b;
+                if (ady * 29 < adx * 12)
+                    a = mag1[x - 1], b = mag1[x + 1];
+                else if (adx * 29 < ady * 12)
+                    a = mag0[x], b = mag2[x];
+                else if ((dx[x] ^ dy[x]) >= 0)
+                    a = mag0[x - 1], b = mag2[x + 1];
+                else
+                    a = mag0[x + 1], b = mag2[x - 1];
+                dst[x] = m > a && m >= b ? (m > high ? CANNY_STRONG : CANNY_WEAK) : 0;
+            }
+        }
+
+        void CannyNmsRun(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t low, uint16_t high,
+            uint8_t * dst, size_t dstStride, CannyGradientPtr gradient, CannySuppressPtr suppress)
+        {
+            const size_t srcSize = AlignHi(width + 2, SIMD_ALIGN), gradSize = AlignHi(width + 2, SIMD_ALIGN);
+            Array<uint8_t> source(3 * srcSize);
+            Array<int16_t> buffer(10 * gradSize, true);
+            uint8_t * rows[3];
+            int16_t * dx[3], * dy[3], * mag[3], * zero = buffer.data + 9 * gradSize + 1;
+            for (size_t i = 0; i < 3; ++i)
+            {
+                rows[i] = source.data + i * srcSize + 1;
+                dx[i] = buffer.data + (3 * i + 0) * gradSize + 1;
+                dy[i] = buffer.data + (3 * i + 1) * gradSize + 1;
+                mag[i] = buffer.data + (3 * i + 2) * gradSize + 1;
+            }
+            int16_t _low = (int16_t)Simd::Min<int>(low, SHRT_MAX), _high = (int16_t)Simd::Min<int>(high, SHRT_MAX);
+
+            for (size_t row = 0; row < height + 1; ++row)
+            {
+                if (row < height)
+                {
+                    for (size_t y = row == 0 ? 0 : row + 1; y <= row + 1 && y < height; ++y)
+                    {
+                        const uint8_t * s = src + y * srcStride;
+                        uint8_t * r = rows[y % 3];
+                        memcpy(r, s, width);
+                        r[-1] = s[0];
+                        r[width] = s[width - 1];
+                    }
+                    const uint8_t * r1 = rows[row % 3];
+                    const uint8_t * r0 = row ? rows[(row - 1) % 3] : r1;
+                    const uint8_t * r2 = row + 1 < height ? rows[(row + 1) % 3] : r1;
+                    gradient(r0, r1, r2, width, dx[row % 3], dy[row % 3], mag[row % 3]);
+                }
+                if (row)
+                {
+                    size_t y = row - 1;
+                    const int16_t * m0 = y ? mag[(y - 1) % 3] : zero;
+                    const int16_t * m2 = y + 1 < height ? mag[(y + 1) % 3] : zero;
+                    suppress(dx[y % 3], dy[y % 3], m0, mag[y % 3], m2, width, _low, _high, dst + y * dstStride);
+                }
+            }
+        }
+
+        struct CannyPoint
+        {
+            size_t x, y;
+            CannyPoint(size_t x_, size_t y_) : x(x_), y(y_) {}
+        };
+
+        typedef std::vector<CannyPoint> CannyStack;
+
+        SIMD_INLINE void CannyPush(uint8_t * dst, size_t x, size_t y, CannyStack & stack)
+        {
+            if (*dst == CANNY_WEAK || *dst == CANNY_STRONG)
+            {
+                *dst = CANNY_EDGE;
+                stack.push_back(CannyPoint(x, y));
+            }
+        }
+
+        static void CannyFlood(uint8_t * dst, size_t dstStride, size_t width, size_t height, CannyStack & stack)
+        {
+            while (!stack.empty())
+            {
+                CannyPoint p = stack.back();
+                stack.pop_back();
+                uint8_t * row = dst + p.y * dstStride + p.x;
+                bool left = p.x > 0, right = p.x + 1 < width;
+                if (p.y > 0)
+                {
+                    uint8_t * up = row - dstStride;
+                    if (left)
+                        CannyPush(up - 1, p.x - 1, p.y - 1, stack);
+                    CannyPush(up, p.x, p.y - 1, stack);
+                    if (right)
+                        CannyPush(up + 1, p.x + 1, p.y - 1, stack);
+                }
+                if (left)
+                    CannyPush(row - 1, p.x - 1, p.y, stack);
+                if (right)
+                    CannyPush(row + 1, p.x + 1, p.y, stack);
+                if (p.y + 1 < height)
+                {
+                    uint8_t * down = row + dstStride;
+                    if (left)
+                        CannyPush(down - 1, p.x - 1, p.y + 1, stack);
+                    CannyPush(down, p.x, p.y + 1, stack);
+                    if (right)
+                        CannyPush(down + 1, p.x + 1, p.y + 1, stack);
+                }
+            }
+        }
+
+        void CannyHysteresisRun(uint8_t * dst, size_t dstStride, size_t width, size_t height, CannyFindPtr find)
+        {
+            CannyStack stack;
+            for (size_t y = 0; y < height; ++y)
+            {
+                uint8_t * row = dst + y * dstStride;
+                for (size_t x = find(row, 0, width); x < width; x = find(row, x + 1, width))
+                {
+                    row[x] = CANNY_EDGE;
+                    stack.push_back(CannyPoint(x, y));
+                    CannyFlood(dst, dstStride, width, height, stack);
+                }
+            }
+        }
+
+        void CannyHysteresisSeam(uint8_t * dst, size_t dstStride, size_t width, size_t height, size_t row)
+        {
+            CannyStack stack;
+            for (size_t y = row - 1; y <= row; ++y)
+            {
+                const uint8_t * edge = dst + y * dstStride;
+                for (size_t x = 0; x < width; ++x)
+                    if (edge[x] == CANNY_EDGE)
+                        stack.push_back(CannyPoint(x, y));
+            }
+            CannyFlood(dst, dstStride, width, height, stack);
+        }
+
+        size_t CannyFind(const uint8_t * row, size_t begin, size_t width)
+        {
+            for (size_t x = begin; x < width; ++x)
+                if (row[x] == CANNY_STRONG)
+                    return x;
+            return width;
+        }
+
+        void CannyNms(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t low, uint16_t high, uint8_t * dst, size_t dstStride)
+        {
+            CannyNmsRun(src, srcStride, width, height, low, high, dst, dstStride, CannyGradient, CannySuppress);
+        }
+
+        void CannyHysteresis(uint8_t * dst, size_t dstStride, size_t width, size_t height)
+        {
+            CannyHysteresisRun(dst, dstStride, width, height, CannyFind);
+        }
+    }
+}
@@ -0,0 +1,60 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void Resizer::Run32f(const uint8_t * src, size_t srcStride, float * dst, SimdCropResizeOutputType output, float scale, float shift)
+        {
+            _row.Resize(_param.dstW*_param.channels);
+            _convert.dst = dst;
+            _convert.output = output;
+            _convert.scale = scale;
+            _convert.shift = shift;
+            Run(src, srcStride, _row.data, 0);
+            _convert.dst = NULL;
+        }
+
+        void Resizer::Convert(const uint8_t * row)
+        {
+            size_t width = _param.dstW, channels = _param.channels;
+            float * dst = _convert.dst, scale = _convert.scale, shift = _convert.shift;
+            if (_convert.output == SimdCropResizeOutputFloatChw)
+            {
+                for (size_t c = 0, plane = width*_param.dstH; c < channels; ++c, dst += plane)
+                    for (size_t x = 0; x < width; ++x)
+                        dst[x] = row[x*channels + c] * scale + shift;
+                _convert.dst += width;
+            }
+            else
+            {
+                for (size_t i = 0, n = width*channels; i < n; ++i)
+                    dst[i] = row[i] * scale + shift;
+                _convert.dst += width*channels;
+            }
+        }
+    }
+}
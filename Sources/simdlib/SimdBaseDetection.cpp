@@ -29,6 +29,7 @@
 #include <stdexcept>
 #include <iostream>
 #include <sstream>
+#include <cstdio>
 
 #define SIMD_EX(message) \
 { \
@@ -147,7 +148,7 @@ namespace Simd
             const char * rect = "rect";
         }
 
-        void * DetectionLoadA(const char * path)
+        static Data * DetectionLoadXml(const char * text, size_t size)
         {
             static const float THRESHOLD_EPS = 1e-5f;
 
@@ -155,12 +156,12 @@ namespace Simd
             try
             {
                 tinyxml2::XMLDocument xml;
-                if (xml.LoadFile(path) != tinyxml2::XML_SUCCESS)
-                    SIMD_EX("Can't load XML file '" << path << "'!");
+                if (xml.Parse(text, size) != tinyxml2::XML_SUCCESS)
+                    SIMD_EX("Can't parse XML cascade!");
 
                 tinyxml2::XMLElement * root = xml.RootElement();
                 if (root == NULL)
-                    SIMD_EX("Invalid format of XML file '" << path << "'!");
+                    SIMD_EX("Invalid format of XML cascade!");
 
                 tinyxml2::XMLElement * cascade = root->FirstChildElement(Names::cascade);
                 if (cascade == NULL)
@@ -316,6 +317,341 @@ namespace Simd
             return data;
         }
 
+        /*
+            Binary format of cascade is a serialization of Data structure: it stores already parsed and adjusted 
+            values, so its loading does not need any parsing. All fields are 32-bit values in native byte order:
+            header (magic, version, feature type, number of categories, window width and height, flags, 
+            sizes of 7 arrays) and then arrays: stages, classifiers, nodes, leaves, subsets, HAAR and LBP features.
+        */
+        namespace Binary
+        {
+            const char MAGIC[8] = { 'S', 'I', 'M', 'D', 'C', 'S', 'C', 'D' };
+            const uint32_t VERSION = 1;
+
+            enum Flags
+            {
+                FlagStumpBased = 1,
+                FlagHasTilted = 2,
+                FlagCanInt16 = 4,
+            };
+
+            class Writer
+            {
+                std::vector<uint8_t> & _buffer;
+            public:
+                Writer(std::vector<uint8_t> & buffer)
+                    : _buffer(buffer)
+                {
+                }
+
+                template<class T> void Write(T value)
+                {
+                    const uint8_t * p = (const uint8_t*)&value;
+                    _buffer.insert(_buffer.end(), p, p + sizeof(T));
+                }
+
+                void Write(const Data::Rect & rect)
+                {
+                    Write<int32_t>(rect.x), Write<int32_t>(rect.y), Write<int32_t>(rect.width), Write<int32_t>(rect.height);
+                }
+            };
+
+            class Reader
+            {
+                const uint8_t * _data;
+                size_t _size, _offset;
+            public:
+                Reader(const void * data, size_t size)
+                    : _data((const uint8_t*)data)
+                    , _size(size)
+                    , _offset(0)
+                {
+                }
+
+                template<class T> T Read()
+                {
+                    if (_offset + sizeof(T) > _size)
+                        SIMD_EX("Unexpected end of binary cascade!");
+                    T value;
+                    memcpy(&value, _data + _offset, sizeof(T));
+                    _offset += sizeof(T);
+                    return value;
+                }
+
+                void Read(Data::Rect & rect)
+                {
+                    rect.x = Read<int32_t>(), rect.y = Read<int32_t>(), rect.width = Read<int32_t>(), rect.height = Read<int32_t>();
+                }
+
+                void Check(size_t count, size_t itemSize)
+                {
+                    if (uint64_t(count) * itemSize > uint64_t(_size - _offset))
+                        SIMD_EX("Unexpected end of binary cascade!");
+                }
+
+                template<class T> void Read(std::vector<T> & values, size_t size)
+                {
+                    Check(size, sizeof(T));
+                    values.resize(size);
+                    if (size)
+                        memcpy(values.data(), _data + _offset, size * sizeof(T));
+                    _offset += size * sizeof(T);
+                }
+            };
+
+            SIMD_INLINE bool Is(const void * data, size_t size)
+            {
+                return size >= sizeof(MAGIC) && memcmp(data, MAGIC, sizeof(MAGIC)) == 0;
+            }
+
+            void Save(const Data & data, std::vector<uint8_t> & buffer)
+            {
+                Writer writer(buffer);
+                for (size_t i = 0; i < sizeof(MAGIC); ++i)
+                    writer.Write(MAGIC[i]);
+                writer.Write<uint32_t>(VERSION);
+                writer.Write<uint32_t>(data.featureType);
+                writer.Write<int32_t>(data.ncategories);
+                writer.Write<int32_t>((int32_t)data.origWinSize.x);
+                writer.Write<int32_t>((int32_t)data.origWinSize.y);
+                writer.Write<uint32_t>((data.isStumpBased ? FlagStumpBased : 0) | (data.hasTilted ? FlagHasTilted : 0) | (data.canInt16 ? FlagCanInt16 : 0));
+                writer.Write<uint32_t>((uint32_t)data.stages.size());
+                writer.Write<uint32_t>((uint32_t)data.classifiers.size());
+                writer.Write<uint32_t>((uint32_t)data.nodes.size());
+                writer.Write<uint32_t>((uint32_t)data.leaves.size());
+                writer.Write<uint32_t>((uint32_t)data.subsets.size());
+                writer.Write<uint32_t>((uint32_t)data.haarFeatures.size());
+                writer.Write<uint32_t>((uint32_t)data.lbpFeatures.size());
+                for (size_t i = 0; i < data.stages.size(); ++i)
+                {
+                    writer.Write<int32_t>(data.stages[i].first);
+                    writer.Write<int32_t>(data.stages[i].ntrees);
+                    writer.Write<float>(data.stages[i].threshold);
+                }
+                for (size_t i = 0; i < data.classifiers.size(); ++i)
+                    writer.Write<int32_t>(data.classifiers[i].nodeCount);
+                for (size_t i = 0; i < data.nodes.size(); ++i)
+                {
+                    writer.Write<int32_t>(data.nodes[i].featureIdx);
+                    writer.Write<float>(data.nodes[i].threshold);
+                    writer.Write<int32_t>(data.nodes[i].left);
+                    writer.Write<int32_t>(data.nodes[i].right);
+                }
+                for (size_t i = 0; i < data.leaves.size(); ++i)
+                    writer.Write<float>(data.leaves[i]);
+                for (size_t i = 0; i < data.subsets.size(); ++i)
+                    writer.Write<int32_t>(data.subsets[i]);
+                for (size_t i = 0; i < data.haarFeatures.size(); ++i)
+                {
+                    const Data::HaarFeature & feature = data.haarFeatures[i];
+                    writer.Write<int32_t>(feature.tilted ? 1 : 0);
+                    for (size_t j = 0; j < Data::HaarFeature::RECT_NUM; ++j)
+                    {
+                        writer.Write(feature.rect[j].r);
+                        writer.Write<float>(feature.rect[j].weight);
+                    }
+                }
+                for (size_t i = 0; i < data.lbpFeatures.size(); ++i)
+                    writer.Write(data.lbpFeatures[i].rect);
+            }
+
+            SIMD_INLINE bool Inside(int64_t begin, int64_t size, int64_t limit)
+            {
+                return begin >= 0 && size >= 0 && begin + size <= limit;
+            }
+
+            /*
+                Checks all indices which are used by CreateHidHaar, CreateHidLbp and UpdateFeaturePtrs, so a corrupted 
+                or malicious file can't lead to out of bounds access. All checks are performed in 64-bit integers.
+            */
+            void Validate(const Data & data)
+            {
+                bool haar = data.featureType == SimdDetectionInfoFeatureHaar;
+                int64_t features = haar ? data.haarFeatures.size() : data.lbpFeatures.size();
+                if (features == 0)
+                    SIMD_EX("Binary cascade has no features!");
+                int64_t subsetSize = haar ? 0 : (int64_t(data.ncategories) + 31) / 32;
+                int64_t classifiers = data.classifiers.size(), nodes = data.nodes.size();
+                int64_t leaves = data.leaves.size(), subsets = data.subsets.size();
+                if (nodes != classifiers || leaves != nodes * 2 || subsets != nodes * subsetSize)
+                    SIMD_EX("Invalid size of nodes, leaves or subsets of binary cascade!");
+                for (size_t i = 0; i < data.classifiers.size(); ++i)
+                    if (data.classifiers[i].nodeCount != 1)
+                        SIMD_EX("Invalid node count of binary cascade!");
+                for (size_t i = 0; i < data.stages.size(); ++i)
+                {
+                    if (!Inside(data.stages[i].first, data.stages[i].ntrees, classifiers))
+                        SIMD_EX("Invalid stage of binary cascade!");
+                    if (i && int64_t(data.stages[i].first) != int64_t(data.stages[i - 1].first) + data.stages[i - 1].ntrees)
+                        SIMD_EX("Stages of binary cascade are not contiguous!");
+                }
+                for (size_t i = 0; i < data.nodes.size(); ++i)
+                    if (!Inside(data.nodes[i].featureIdx, 1, features))
+                        SIMD_EX("Invalid node of binary cascade!");
+                int64_t w = data.origWinSize.x, h = data.origWinSize.y;
+                for (size_t i = 0; i < data.haarFeatures.size() && haar; ++i)
+                {
+                    const Data::HaarFeature & feature = data.haarFeatures[i];
+                    if (feature.tilted && !data.hasTilted)
+                        SIMD_EX("Tilted feature in binary cascade without tilted flag!");
+                    for (size_t j = 0; j < Data::HaarFeature::RECT_NUM; ++j)
+                    {
+                        const Data::Rect & r = feature.rect[j].r;
+                        if (feature.rect[j].weight == 0.0f)
+                        {
+                            if (j < 2)
+                                SIMD_EX("Zero weight of first two feature rectangles of binary cascade!");
+                            continue;
+                        }
+                        bool valid = feature.tilted ?
+                            Inside(int64_t(r.x) - r.height, int64_t(r.width) + r.height, w) && r.width >= 0 && Inside(r.y, int64_t(r.width) + r.height, h) && r.height >= 0 :
+                            Inside(r.x, r.width, w) && Inside(r.y, r.height, h);
+                        if (!valid)
+                            SIMD_EX("Invalid feature rectangle of binary cascade!");
+                    }
+                }
+                for (size_t i = 0; i < data.lbpFeatures.size() && !haar; ++i)
+                {
+                    const Data::Rect & r = data.lbpFeatures[i].rect;
+                    if (!Inside(r.x, int64_t(r.width) * 3, w) || !Inside(r.y, int64_t(r.height) * 3, h))
+                        SIMD_EX("Invalid feature rectangle of binary cascade!");
+                }
+            }
+
+            Data * Load(const void * buffer, size_t size)
+            {
+                Data * data = NULL;
+                try
+                {
+                    Reader reader(buffer, size);
+                    for (size_t i = 0; i < sizeof(MAGIC); ++i)
+                        reader.Read<char>();
+                    if (reader.Read<uint32_t>() != VERSION)
+                        SIMD_EX("Unsupported version of binary cascade!");
+
+                    data = new Data();
+                    data->stageType = 0;
+                    data->featureType = (SimdDetectionInfoFlags)reader.Read<uint32_t>();
+                    if (data->featureType != SimdDetectionInfoFeatureHaar && data->featureType != SimdDetectionInfoFeatureLbp)
+                        SIMD_EX("Invalid cascade feature type!");
+                    data->ncategories = reader.Read<int32_t>();
+                    data->origWinSize.x = reader.Read<int32_t>();
+                    data->origWinSize.y = reader.Read<int32_t>();
+                    if (data->origWinSize.x <= 0 || data->origWinSize.y <= 0)
+                        SIMD_EX("Invalid cascade width or height!");
+                    uint32_t flags = reader.Read<uint32_t>();
+                    data->isStumpBased = (flags & FlagStumpBased) != 0;
+                    data->hasTilted = (flags & FlagHasTilted) != 0;
+                    data->canInt16 = (flags & FlagCanInt16) != 0;
+
+                    uint32_t sizes[7];
+                    for (size_t i = 0; i < 7; ++i)
+                        sizes[i] = reader.Read<uint32_t>();
+
+                    if (!data->isStumpBased)
+                        SIMD_EX("Tree classifier cascades are not supported!");
+                    if (data->featureType == SimdDetectionInfoFeatureLbp && (data->ncategories < 256 || data->ncategories > 65536))
+                        SIMD_EX("Invalid categories count of binary cascade!");
+
+                    reader.Check(sizes[0], 12);
+                    data->stages.resize(sizes[0]);
+                    for (size_t i = 0; i < data->stages.size(); ++i)
+                    {
+                        data->stages[i].first = reader.Read<int32_t>();
+                        data->stages[i].ntrees = reader.Read<int32_t>();
+                        data->stages[i].threshold = reader.Read<float>();
+                    }
+                    reader.Check(sizes[1], 4);
+                    data->classifiers.resize(sizes[1]);
+                    for (size_t i = 0; i < data->classifiers.size(); ++i)
+                        data->classifiers[i].nodeCount = reader.Read<int32_t>();
+                    reader.Check(sizes[2], 16);
+                    data->nodes.resize(sizes[2]);
+                    for (size_t i = 0; i < data->nodes.size(); ++i)
+                    {
+                        data->nodes[i].featureIdx = reader.Read<int32_t>();
+                        data->nodes[i].threshold = reader.Read<float>();
+                        data->nodes[i].left = reader.Read<int32_t>();
+                        data->nodes[i].right = reader.Read<int32_t>();
+                    }
+                    reader.Read(data->leaves, sizes[3]);
+                    reader.Read(data->subsets, sizes[4]);
+                    reader.Check(sizes[5], 4 + Data::HaarFeature::RECT_NUM * 20);
+                    data->haarFeatures.resize(sizes[5]);
+                    for (size_t i = 0; i < data->haarFeatures.size(); ++i)
+                    {
+                        Data::HaarFeature & feature = data->haarFeatures[i];
+                        feature.tilted = reader.Read<int32_t>() != 0;
+                        for (size_t j = 0; j < Data::HaarFeature::RECT_NUM; ++j)
+                        {
+                            reader.Read(feature.rect[j].r);
+                            feature.rect[j].weight = reader.Read<float>();
+                        }
+                    }
+                    reader.Check(sizes[6], 16);
+                    data->lbpFeatures.resize(sizes[6]);
+                    for (size_t i = 0; i < data->lbpFeatures.size(); ++i)
+                        reader.Read(data->lbpFeatures[i].rect);
+
+                    Validate(*data);
+                }
+                catch (...)
+                {
+                    delete data;
+                    data = NULL;
+                }
+                return data;
+            }
+        }
+
+        void * DetectionLoadMemory(const void * buffer, size_t size)
+        {
+            if (buffer == NULL || size == 0)
+                return NULL;
+            if (Binary::Is(buffer, size))
+                return Binary::Load(buffer, size);
+            else
+                return DetectionLoadXml((const char*)buffer, size);
+        }
+
+        void * DetectionLoadA(const char * path)
+        {
+            FILE * file = ::fopen(path, "rb");
+            if (file == NULL)
+            {
+                std::cerr << "Can't open cascade file '" << path << "'!" << std::endl;
+                return NULL;
+            }
+            std::vector<char> buffer;
+            ::fseek(file, 0, SEEK_END);
+            long size = ::ftell(file);
+            ::fseek(file, 0, SEEK_SET);
+            if (size > 0)
+            {
+                buffer.resize(size);
+                if (::fread(buffer.data(), 1, size, file) != (size_t)size)
+                    buffer.clear();
+            }
+            ::fclose(file);
+            void * data = DetectionLoadMemory(buffer.data(), buffer.size());
+            if (data == NULL)
+                std::cerr << "Can't load cascade from file '" << path << "'!" << std::endl;
+            return data;
+        }
+
+        int DetectionSaveA(const void * data, const char * path)
+        {
+            if (data == NULL)
+                return 0;
+            std::vector<uint8_t> buffer;
+            Binary::Save(*(const Data*)data, buffer);
+            FILE * file = ::fopen(path, "wb");
+            if (file == NULL)
+                return 0;
+            size_t written = ::fwrite(buffer.data(), 1, buffer.size(), file);
+            return ::fclose(file) == 0 && written == buffer.size() ? 1 : 0;
+        }
+
         void DetectionInfo(const void * _data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags)
         {
             Data * data = (Data*)_data;
@@ -711,6 +1047,8 @@ namespace Simd
         int Detect32f(const HidHaarCascade & hid, size_t offset, int startStage, float norm)
         {
             typedef HidHaarCascade Hid;
+            if (startStage >= (int)hid.stages.size())
+                return 1;
             const Hid::Stage * stages = hid.stages.data();
             const Hid::Node * node = hid.nodes.data() + stages[startStage].first;
             const float * leaves = hid.leaves.data() + stages[startStage].first * 2;
@@ -0,0 +1,270 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdFilter2D.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<class T> SIMD_INLINE void Filter2DExtend(const T * src, ptrdiff_t width, ptrdiff_t begin, ptrdiff_t end, T * dst)
+        {
+            ptrdiff_t lo = Simd::Max<ptrdiff_t>(begin, 0), hi = Simd::Min(end, width);
+            for (ptrdiff_t x = begin; x < lo; ++x)
+                *dst++ = src[0];
+            memcpy(dst, src + lo, (hi - lo) * sizeof(T));
+            dst += hi - lo;
+            for (ptrdiff_t x = hi; x < end; ++x)
+                *dst++ = src[width - 1];
+        }
+
+        /*
+            Common driver: T - a type of pixel, R - a type of horizontally filtered rows of separable filter.
+            direct(rows, width, dst), row(src, width, dst) and col(rows, width, dst) are filters with bound kernel.
+            colSize - a number of row pointers passed to col (it may be greater then kernelY, the extra rows have zero weight).
+        */
+        template<class T, class R, class Direct, class Row, class Col> void Filter2DRun(const T * src, size_t srcStride, size_t width, size_t height,
+            size_t kernelX, size_t kernelY, bool separable, size_t colSize, T * dst, size_t dstStride, Direct direct, Row row, Col col)
+        {
+            size_t anchorX = kernelX / 2, anchorY = kernelY / 2, count = kernelY;
+            size_t itemSize = separable ? sizeof(R) : sizeof(T);
+            size_t blockMax = Simd::Max<size_t>(FILTER2D_CACHE / (count * itemSize), 1024);
+            size_t blocks = (width + blockMax - 1) / blockMax;
+            size_t blockWidth = (width + blocks - 1) / blocks;
+            size_t extWidth = blockWidth + kernelX - 1;
+            size_t stride = AlignHi((separable ? blockWidth * sizeof(R) : extWidth * sizeof(T)), SIMD_ALIGN);
+            Array<T> ext(separable ? extWidth : 0);
+            Array<uint8_t> ring(count * stride);
+            Array<const void*> rows(Simd::Max(count, colSize));
+
+            for (size_t block = 0; block < width; block += blockWidth)
+            {
+                size_t x = Simd::Min(block, width - blockWidth);
+                ptrdiff_t begin = ptrdiff_t(x - anchorX), end = ptrdiff_t(x + extWidth - anchorX);
+                for (size_t y = 0, next = 0; y < height; ++y)
+                {
+                    for (size_t last = Simd::Min(y + kernelY - 1 - anchorY, height - 1); next <= last; ++next)
+                    {
+                        uint8_t * buffer = ring.data + (next % count) * stride;
+                        if (separable)
+                        {
+                            Filter2DExtend(src + next * srcStride, width, begin, end, ext.data);
+                            row(ext.data, blockWidth, (R*)buffer);
+                        }
+                        else
+                            Filter2DExtend(src + next * srcStride, width, begin, end, (T*)buffer);
+                    }
+                    for (size_t k = 0; k < count; ++k)
+                    {
+                        size_t r = Simd::RestrictRange<ptrdiff_t>(y + k - anchorY, 0, height - 1);
+                        rows[k] = ring.data + (r % count) * stride;
+                    }
+                    for (size_t k = count; k < colSize; ++k)
+                        rows[k] = rows[count - 1];
+                    if (separable)
+                        col((const R * const *)rows.data, blockWidth, dst + y * dstStride + x);
+                    else
+                        direct((const T * const *)rows.data, blockWidth, dst + y * dstStride + x);
+                }
+            }
+        }
+
+        static bool Filter2D8uSeparable(const int16_t * kernel, size_t kernelX, size_t kernelY, int shift, Array<int16_t> & row, Array<int16_t> & col)
+        {
+            if (kernelX * kernelY <= 2 * (kernelX + kernelY))
+                return false;
+            int pos = 0, neg = 0;
+            for (size_t i = 0, n = kernelX * kernelY; i < n; ++i)
+                (kernel[i] > 0 ? pos : neg) += kernel[i];
+            if (pos * 255 + (shift ? 1 << (shift - 1) : 0) > SHRT_MAX || neg * 255 < SHRT_MIN)
+                return false;
+            size_t i0 = 0, j0 = 0;
+            while (i0 < kernelY && kernel[i0 * kernelX + j0] == 0)
+            {
+                if (++j0 == kernelX)
+                    j0 = 0, ++i0;
+            }
+            if (i0 == kernelY)
+                return false;
+            const int16_t * pivot = kernel + i0 * kernelX;
+            int gcd = 0, sum = 0;
+            for (size_t j = 0; j < kernelX; ++j)
+            {
+                for (int a = Simd::Abs<int>(pivot[j]), b; a; a = b)
+                    b = gcd % a, gcd = a;
+            }
+            for (size_t j = 0; j < kernelX; ++j)
+            {
+                row[j] = pivot[j] / gcd;
+                sum += Simd::Abs<int>(row[j]);
+            }
+            if (sum * 255 > SHRT_MAX)
+                return false;
+            for (size_t i = 0; i < kernelY; ++i)
+            {
+                if (kernel[i * kernelX + j0] % row[j0])
+                    return false;
+                col[i] = kernel[i * kernelX + j0] / row[j0];
+                for (size_t j = 0; j < kernelX; ++j)
+                    if (col[i] * row[j] != kernel[i * kernelX + j])
+                        return false;
+            }
+            return true;
+        }
+
+        void Filter2D8uRun(const uint8_t * src, size_t srcStride, size_t width, size_t height, const int16_t * kernel, size_t kernelX, size_t kernelY,
+            int shift, int16_t bias, uint8_t * dst, size_t dstStride, Filter2D8uDirectPtr direct, Filter2D8uRowPtr row, Filter2D8uColPtr col)
+        {
+            assert(kernelX >= 1 && kernelX <= FILTER2D_SIZE_MAX && kernelY >= 1 && kernelY <= FILTER2D_SIZE_MAX && shift >= 0 && shift < 16);
+#ifndef NDEBUG
+            for (size_t i = 0, n = kernelX * kernelY; i < n; ++i)
+                assert(kernel[i] >= -128 && kernel[i] <= 128);
+#endif
+            Array<int16_t> rowKernel(kernelX), colKernel(AlignHi(kernelY, 2), true);
+            bool separable = Filter2D8uSeparable(kernel, kernelX, kernelY, shift, rowKernel, colKernel);
+            Filter2DRun<uint8_t, int16_t>(src, srcStride, width, height, kernelX, kernelY, separable, colKernel.size, dst, dstStride,
+                [&](const uint8_t * const * rows, size_t width, uint8_t * dst) { direct(rows, width, kernel, kernelX, kernelY, shift, bias, dst); },
+                [&](const uint8_t * src, size_t width, int16_t * dst) { row(src, width, rowKernel.data, kernelX, dst); },
+                [&](const int16_t * const * rows, size_t width, uint8_t * dst) { col(rows, width, colKernel.data, colKernel.size, shift, bias, dst); });
+        }
+
+        static bool Filter2D32fSeparable(const float * kernel, size_t kernelX, size_t kernelY, Array<float> & row, Array<float> & col)
+        {
+            if (kernelX * kernelY <= 2 * (kernelX + kernelY))
+                return false;
+            size_t i0 = 0, j0 = 0;
+            for (size_t i = 0; i < kernelY; ++i)
+                for (size_t j = 0; j < kernelX; ++j)
+                    if (::fabs(kernel[i * kernelX + j]) > ::fabs(kernel[i0 * kernelX + j0]))
+                        i0 = i, j0 = j;
+            float pivot = kernel[i0 * kernelX + j0], eps = ::fabs(pivot) * FILTER2D_SEPARABLE_EPS;
+            if (pivot == 0.0f)
+                return false;
+            for (size_t j = 0; j < kernelX; ++j)
+                row[j] = kernel[i0 * kernelX + j];
+            for (size_t i = 0; i < kernelY; ++i)
+            {
+                col[i] = kernel[i * kernelX + j0] / pivot;
+                for (size_t j = 0; j < kernelX; ++j)
+                    if (::fabs(col[i] * row[j] - kernel[i * kernelX + j]) > eps)
+                        return false;
+            }
+            return true;
+        }
+
+        void Filter2D32fRun(const float * src, size_t srcStride, size_t width, size_t height, const float * kernel, size_t kernelX, size_t kernelY,
+            float * dst, size_t dstStride, Filter2D32fDirectPtr direct, Filter2D32fRowPtr row, Filter2D32fColPtr col)
+        {
+            assert(kernelX >= 1 && kernelX <= FILTER2D_SIZE_MAX && kernelY >= 1 && kernelY <= FILTER2D_SIZE_MAX);
+            Array<float> rowKernel(kernelX), colKernel(kernelY);
+            bool separable = Filter2D32fSeparable(kernel, kernelX, kernelY, rowKernel, colKernel);
+            Filter2DRun<float, float>(src, srcStride, width, height, kernelX, kernelY, separable, kernelY, dst, dstStride,
+                [&](const float * const * rows, size_t width, float * dst) { direct(rows, width, kernel, kernelX, kernelY, dst); },
+                [&](const float * src, size_t width, float * dst) { row(src, width, rowKernel.data, kernelX, dst); },
+                [&](const float * const * rows, size_t width, float * dst) { col(rows, width, colKernel.data, kernelY, dst); });
+        }
+
+        void Filter2D8uDirect(const uint8_t * const * rows, size_t width, const int16_t * kernel, size_t kernelX, size_t kernelY, int shift, int16_t bias, uint8_t * dst)
+        {
+            int round = shift ? 1 << (shift - 1) : 0;
+            for (size_t x = 0; x < width; ++x)
+            {
+                int sum = 0;
+                for (size_t ky = 0; ky < kernelY; ++ky)
+                    for (size_t kx = 0; kx < kernelX; ++kx)
+                        sum = Simd::RestrictRange(sum + rows[ky][x + kx] * kernel[ky * kernelX + kx], SHRT_MIN, SHRT_MAX);
+                sum = Simd::RestrictRange(sum + round, SHRT_MIN, SHRT_MAX) >> shift;
+                dst[x] = (uint8_t)Simd::RestrictRange(sum + bias, 0, 255);
+            }
+        }
+
+        void Filter2D8uRow(const uint8_t * src, size_t width, const int16_t * kernel, size_t size, int16_t * dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                int sum = 0;
+                for (size_t k = 0; k < size; ++k)
+                    sum += src[x + k] * kernel[k];
+                dst[x] = (int16_t)sum;
+            }
+        }
+
+        void Filter2D8uCol(const int16_t * const * rows, size_t width, const int16_t * kernel, size_t size, int shift, int16_t bias, uint8_t * dst)
+        {
+            int round = shift ? 1 << (shift - 1) : 0;
+            for (size_t x = 0; x < width; ++x)
+            {
+                int sum = round;
+                for (size_t k = 0; k < size; ++k)
+                    sum += rows[k][x] * kernel[k];
+                dst[x] = (uint8_t)Simd::RestrictRange((sum >> shift) + bias, 0, 255);
+            }
+        }
+
+        void Filter2D8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, const int16_t * kernel, size_t kernelX, size_t kernelY, 
+            int shift, int16_t bias, uint8_t * dst, size_t dstStride)
+        {
+            Filter2D8uRun(src, srcStride, width, height, kernel, kernelX, kernelY, shift, bias, dst, dstStride, Filter2D8uDirect, Filter2D8uRow, Filter2D8uCol);
+        }
+
+        void Filter2D32fDirect(const float * const * rows, size_t width, const float * kernel, size_t kernelX, size_t kernelY, float * dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                float sum = 0;
+                for (size_t ky = 0; ky < kernelY; ++ky)
+                    for (size_t kx = 0; kx < kernelX; ++kx)
+                        sum += rows[ky][x + kx] * kernel[ky * kernelX + kx];
+                dst[x] = sum;
+            }
+        }
+
+        void Filter2D32fRow(const float * src, size_t width, const float * kernel, size_t size, float * dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                float sum = 0;
+                for (size_t k = 0; k < size; ++k)
+                    sum += src[x + k] * kernel[k];
+                dst[x] = sum;
+            }
+        }
+
+        void Filter2D32fCol(const float * const * rows, size_t width, const float * kernel, size_t size, float * dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                float sum = 0;
+                for (size_t k = 0; k < size; ++k)
+                    sum += rows[k][x] * kernel[k];
+                dst[x] = sum;
+            }
+        }
+
+        void Filter2D32f(const float * src, size_t srcStride, size_t width, size_t height, const float * kernel, size_t kernelX, size_t kernelY, 
+            float * dst, size_t dstStride)
+        {
+            Filter2D32fRun(src, srcStride, width, height, kernel, kernelX, kernelY, dst, dstStride, Filter2D32fDirect, Filter2D32fRow, Filter2D32fCol);
+        }
+    }
+}
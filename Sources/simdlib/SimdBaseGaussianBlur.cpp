@@ -0,0 +1,139 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdGaussianBlur.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        size_t GaussianBlurRadius(float sigma, size_t radius)
+        {
+            if (radius == 0)
+                radius = Simd::Max<size_t>((size_t)::ceil(3.0f*sigma), 1);
+            return radius;
+        }
+
+        void GaussianBlurKernel(float sigma, size_t radius, Array<int16_t> & weights)
+        {
+            if (sigma <= 0.0f)
+                sigma = 0.3f*(radius - 1) + 0.8f;
+            size_t count = 2 * radius + 1;
+            Array<float> gauss(count);
+            float sum = 0;
+            for (size_t k = 0; k < count; ++k)
+            {
+                float x = float(k) - float(radius);
+                gauss[k] = ::exp(-x*x / (2.0f*sigma*sigma));
+                sum += gauss[k];
+            }
+            weights.Resize(AlignHi(count, 2), true);
+            int total = 0;
+            for (size_t k = 0; k < count; ++k)
+            {
+                weights[k] = (int16_t)Round(gauss[k] * (1 << GAUSSIAN_BLUR_WEIGHT_BITS) / sum);
+                total += weights[k];
+            }
+            weights[radius] += (1 << GAUSSIAN_BLUR_WEIGHT_BITS) - total;
+        }
+
+        SIMD_INLINE void GaussianBlurExtend(const uint8_t * src, ptrdiff_t width, size_t channelCount, ptrdiff_t begin, ptrdiff_t end, uint8_t * dst)
+        {
+            ptrdiff_t lo = Simd::Max<ptrdiff_t>(begin, 0), hi = Simd::Min(end, width);
+            for (ptrdiff_t x = begin; x < lo; ++x, dst += channelCount)
+                for (size_t c = 0; c < channelCount; ++c)
+                    dst[c] = src[c];
+            memcpy(dst, src + lo*channelCount, (hi - lo)*channelCount);
+            dst += (hi - lo)*channelCount;
+            src += (width - 1)*channelCount;
+            for (ptrdiff_t x = hi; x < end; ++x, dst += channelCount)
+                for (size_t c = 0; c < channelCount; ++c)
+                    dst[c] = src[c];
+        }
+
+        void GaussianBlurRun(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, float sigma, size_t radius,
+            uint8_t * dst, size_t dstStride, GaussianBlurRowPtr rowFilter, GaussianBlurColPtr colFilter)
+        {
+            Array<int16_t> weights;
+            GaussianBlurKernel(sigma, radius, weights);
+            size_t count = 2 * radius + 1, size = weights.size;
+
+            size_t blockMax = Simd::Max<size_t>(GAUSSIAN_BLUR_CACHE / (count * sizeof(int16_t)), 1024);
+            size_t blocks = (width*channelCount + blockMax - 1) / blockMax;
+            size_t blockWidth = (width + blocks - 1) / blocks;
+            size_t stride = AlignHi(blockWidth*channelCount, SIMD_ALIGN);
+            Array<uint8_t> ext((blockWidth + size)*channelCount);
+            Array<int16_t> ring(count*stride);
+            Array<const int16_t*> rows(size);
+
+            for (size_t block = 0; block < width; block += blockWidth)
+            {
+                size_t x = Simd::Min(block, width - blockWidth), rowSize = blockWidth*channelCount;
+                for (size_t row = 0, next = 0; row < height; ++row)
+                {
+                    for (size_t last = Simd::Min(row + radius, height - 1); next <= last; ++next)
+                    {
+                        GaussianBlurExtend(src + next*srcStride, width, channelCount, ptrdiff_t(x - radius), ptrdiff_t(x + blockWidth + size - radius), ext.data);
+                        rowFilter(ext.data, rowSize, channelCount, weights.data, size, ring.data + (next%count)*stride);
+                    }
+                    for (size_t k = 0; k < count; ++k)
+                    {
+                        size_t y = Simd::RestrictRange<ptrdiff_t>(row + k - radius, 0, height - 1);
+                        rows[k] = ring.data + (y%count)*stride;
+                    }
+                    for (size_t k = count; k < size; ++k)
+                        rows[k] = rows[count - 1];
+                    colFilter(rows.data, rowSize, weights.data, size, dst + row*dstStride + x*channelCount);
+                }
+            }
+        }
+
+        void GaussianBlurRow(const uint8_t * src, size_t width, size_t step, const int16_t * weights, size_t size, int16_t * dst)
+        {
+            for (size_t i = 0; i < width; ++i)
+            {
+                int sum = GAUSSIAN_BLUR_ROW_ROUND;
+                for (size_t k = 0; k < size; ++k)
+                    sum += src[i + k*step] * weights[k];
+                dst[i] = (int16_t)(sum >> GAUSSIAN_BLUR_ROW_SHIFT);
+            }
+        }
+
+        void GaussianBlurCol(const int16_t * const * rows, size_t width, const int16_t * weights, size_t size, uint8_t * dst)
+        {
+            for (size_t i = 0; i < width; ++i)
+            {
+                int sum = GAUSSIAN_BLUR_COL_ROUND;
+                for (size_t k = 0; k < size; ++k)
+                    sum += rows[k][i] * weights[k];
+                dst[i] = (uint8_t)(sum >> GAUSSIAN_BLUR_COL_SHIFT);
+            }
+        }
+
+        void GaussianBlur(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, float sigma, size_t radius, uint8_t * dst, size_t dstStride)
+        {
+            radius = GaussianBlurRadius(sigma, radius);
+            GaussianBlurRun(src, srcStride, width, height, channelCount, sigma, radius, dst, dstStride, GaussianBlurRow, GaussianBlurCol);
+        }
+    }
+}
@@ -22,6 +22,7 @@
 * SOFTWARE.
 */
 #include "Simd/SimdMath.h"
+#include "Simd/SimdMedianFilter.h"
 
 namespace Simd
 {
@@ -390,5 +391,10 @@ namespace Simd
                 }
             }
         }
+
+        void MedianFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride)
+        {
+            MedianFilterRun<MedianHistogram>(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+        }
 	}
 }
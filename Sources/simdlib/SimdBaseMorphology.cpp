@@ -0,0 +1,166 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMorphology.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        class MorphologyEngine
+        {
+        public:
+            MorphologyEngine(size_t width, size_t height, size_t windowX, size_t windowY)
+                : _width(width)
+                , _height(height)
+                , _windowX(windowX)
+                , _windowY(windowY)
+                , _stride(AlignHi(width, SIMD_ALIGN))
+            {
+                _line.Resize(width + windowX + SIMD_ALIGN);
+                _block.Resize((windowY + 1)*_stride);
+                _temp.Resize(height*_stride);
+            }
+
+            void Run(const uint8_t * src, size_t srcStride, SimdMorphologyShapeType shape, MorphologyRowPtr op, uint8_t * dst, size_t dstStride)
+            {
+                Horizontal(src, srcStride, op, _temp.data, _stride);
+                if (shape == SimdMorphologyShapeRect)
+                    Vertical(_temp.data, _stride, op, dst, dstStride);
+                else
+                {
+                    Vertical(src, srcStride, op, dst, dstStride);
+                    for (size_t row = 0; row < _height; ++row)
+                        op(dst + row*dstStride, _temp.data + row*_stride, _width, dst + row*dstStride);
+                }
+            }
+
+        private:
+            size_t _width, _height, _windowX, _windowY, _stride;
+            Array<uint8_t> _line, _block, _temp;
+
+            void Horizontal(const uint8_t * src, size_t srcStride, MorphologyRowPtr op, uint8_t * dst, size_t dstStride)
+            {
+                size_t radius = _windowX / 2, length = _width + 2 * radius, power = 1;
+                while (power * 2 <= _windowX)
+                    power *= 2;
+                uint8_t * line = _line.data;
+                for (size_t row = 0; row < _height; ++row, src += srcStride, dst += dstStride)
+                {
+                    memset(line, src[0], radius);
+                    memcpy(line + radius, src, _width);
+                    memset(line + radius + _width, src[_width - 1], radius);
+                    for (size_t step = 1; step < power; step *= 2)
+                        op(line, line + step, length - step, line);
+                    op(line, line + _windowX - power, _width, dst);
+                }
+            }
+
+            SIMD_INLINE const uint8_t * Row(const uint8_t * src, size_t srcStride, ptrdiff_t index)
+            {
+                return src + Simd::RestrictRange<ptrdiff_t>(index - _windowY / 2, 0, _height - 1)*srcStride;
+            }
+
+            void Vertical(const uint8_t * src, size_t srcStride, MorphologyRowPtr op, uint8_t * dst, size_t dstStride)
+            {
+                ptrdiff_t window = _windowY, height = _height;
+                uint8_t * tail = _block.data + window*_stride;
+                for (ptrdiff_t block = 0; block < height; block += window)
+                {
+                    uint8_t * head = _block.data + (window - 1)*_stride;
+                    memcpy(head, Row(src, srcStride, block + window - 1), _width);
+                    for (ptrdiff_t i = window - 2; i >= 0; --i, head -= _stride)
+                        op(Row(src, srcStride, block + i), head, _width, head - _stride);
+                    memcpy(dst + block*dstStride, _block.data, _width);
+                    for (ptrdiff_t i = 1; i < window && block + i < height; ++i)
+                    {
+                        if (i == 1)
+                            memcpy(tail, Row(src, srcStride, block + window), _width);
+                        else
+                            op(tail, Row(src, srcStride, block + window + i - 1), _width, tail);
+                        op(_block.data + i*_stride, tail, _width, dst + (block + i)*dstStride);
+                    }
+                }
+            }
+        };
+
+        void MorphologyRun(const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdMorphologyType type, SimdMorphologyShapeType shape,
+            size_t windowX, size_t windowY, const uint8_t * mask, size_t maskStride, uint8_t index, uint8_t * dst, size_t dstStride, const MorphologyFuncs & funcs)
+        {
+            assert(windowX % 2 == 1 && windowY % 2 == 1 && src != dst);
+
+            MorphologyEngine engine(width, height, windowX, windowY);
+            switch (type)
+            {
+            case SimdMorphologyErode:
+                engine.Run(src, srcStride, shape, funcs.min, dst, dstStride);
+                break;
+            case SimdMorphologyDilate:
+                engine.Run(src, srcStride, shape, funcs.max, dst, dstStride);
+                break;
+            case SimdMorphologyOpen:
+            case SimdMorphologyClose:
+            {
+                size_t stride = AlignHi(width, SIMD_ALIGN);
+                Array<uint8_t> buffer(height*stride);
+                engine.Run(src, srcStride, shape, type == SimdMorphologyOpen ? funcs.min : funcs.max, buffer.data, stride);
+                engine.Run(buffer.data, stride, shape, type == SimdMorphologyOpen ? funcs.max : funcs.min, dst, dstStride);
+                break;
+            }
+            default:
+                assert(0);
+            }
+            if (mask)
+            {
+                for (size_t row = 0; row < height; ++row)
+                    funcs.blend(src + row*srcStride, mask + row*maskStride, index, width, dst + row*dstStride);
+            }
+        }
+
+        void MorphologyMin(const uint8_t * a, const uint8_t * b, size_t size, uint8_t * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = Simd::Min(a[i], b[i]);
+        }
+
+        void MorphologyMax(const uint8_t * a, const uint8_t * b, size_t size, uint8_t * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = Simd::Max(a[i], b[i]);
+        }
+
+        void MorphologyBlend(const uint8_t * src, const uint8_t * mask, uint8_t index, size_t size, uint8_t * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                if (mask[i] != index)
+                    dst[i] = src[i];
+        }
+
+        void Morphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdMorphologyType type, SimdMorphologyShapeType shape,
+            size_t windowX, size_t windowY, const uint8_t * mask, size_t maskStride, uint8_t index, uint8_t * dst, size_t dstStride)
+        {
+            MorphologyFuncs funcs = { MorphologyMin, MorphologyMax, MorphologyBlend };
+            MorphologyRun(src, srcStride, width, height, type, shape, windowX, windowY, mask, maskStride, index, dst, dstStride, funcs);
+        }
+    }
+}
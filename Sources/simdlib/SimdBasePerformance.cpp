@@ -0,0 +1,166 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdPerformance.h"
+
+#ifdef SIMD_PERFORMANCE_STATISTIC
+#include <sstream>
+#include <iomanip>
+
+namespace Simd
+{
+    namespace Base
+    {
+        PerformanceMeasurer::PerformanceMeasurer()
+        {
+            Reset();
+        }
+
+        void PerformanceMeasurer::Combine(const PerformanceMeasurer & other)
+        {
+            Store(_count, Load(_count) + Load(other._count));
+            Store(_total, Load(_total) + Load(other._total));
+            Store(_min, std::min(Load(_min), Load(other._min)));
+            Store(_max, std::max(Load(_max), Load(other._max)));
+            Store(_pixels, Load(_pixels) + Load(other._pixels));
+        }
+
+        void PerformanceMeasurer::Reset()
+        {
+            Store(_count, 0);
+            Store(_total, 0);
+            Store(_min, UINT64_MAX);
+            Store(_max, 0);
+            Store(_pixels, 0);
+        }
+
+        std::string PerformanceMeasurer::Statistic(double ticksPerMs) const
+        {
+            uint64_t count = Load(_count), total = Load(_total), pixels = Load(_pixels);
+            std::stringstream ss;
+            ss << std::fixed << std::setprecision(3);
+            ss << std::setw(10) << count << " " << std::setw(12) << total / ticksPerMs << " ";
+            ss << std::setw(10) << total / ticksPerMs / count << " " << std::setw(10) << Load(_min) / ticksPerMs << " ";
+            ss << std::setw(10) << Load(_max) / ticksPerMs << " " << std::setw(10) << std::setprecision(1);
+            if (pixels)
+                ss << pixels / (total / ticksPerMs) / 1000.0;
+            else
+                ss << "-";
+            return ss.str();
+        }
+
+        PerformanceMeasurerStorage PerformanceMeasurerStorage::s_storage;
+
+        PerformanceMeasurerStorage::PerformanceMeasurerStorage()
+            : _ticks(PerformanceTicks())
+            , _time(std::chrono::steady_clock::now())
+        {
+        }
+
+        PerformanceMeasurerStorage::Thread * PerformanceMeasurerStorage::Current()
+        {
+            thread_local Thread * thread = NULL;
+            if (thread == NULL)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _threads.push_back(ThreadPtr(new Thread()));
+                thread = _threads.back().get();
+            }
+            return thread;
+        }
+
+        PerformanceMeasurer * PerformanceMeasurerStorage::Get(const char * name)
+        {
+            Thread * thread = Current();
+            std::string key(name);
+            std::map<std::string, PerformanceMeasurer>::iterator it = thread->measurers.find(key);
+            if (it != thread->measurers.end())
+                return &it->second;
+            std::lock_guard<std::mutex> lock(thread->mutex);
+            return &thread->measurers[key];
+        }
+
+        PerformanceMeasurer * PerformanceMeasurerStorage::GetStatic(const char * name)
+        {
+            Thread * thread = Current();
+            std::map<const char *, PerformanceMeasurer *>::iterator it = thread->statics.find(name);
+            if (it == thread->statics.end())
+                it = thread->statics.insert(std::make_pair(name, Get(name))).first;
+            return it->second;
+        }
+
+        void PerformanceMeasurerStorage::Push(uint64_t ticks)
+        {
+            Current()->starts.push_back(ticks);
+        }
+
+        uint64_t PerformanceMeasurerStorage::Pop()
+        {
+            Thread * thread = Current();
+            assert(thread->starts.size());
+            uint64_t ticks = thread->starts.back();
+            thread->starts.pop_back();
+            return ticks;
+        }
+
+        std::string PerformanceMeasurerStorage::Report()
+        {
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _time).count();
+            double ticksPerMs = double(PerformanceTicks() - _ticks) / std::max(ms, 0.001);
+
+            std::map<std::string, PerformanceMeasurer> combined;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                for (size_t i = 0; i < _threads.size(); ++i)
+                {
+                    std::lock_guard<std::mutex> threadLock(_threads[i]->mutex);
+                    for (std::map<std::string, PerformanceMeasurer>::const_iterator it = _threads[i]->measurers.begin(); it != _threads[i]->measurers.end(); ++it)
+                        combined[it->first].Combine(it->second);
+                }
+            }
+
+            std::stringstream ss;
+            ss << "Simd Library performance statistic (time in ms, throughput in MPixel/s):" << std::endl;
+            ss << std::setw(10) << "Calls" << " " << std::setw(12) << "Total" << " " << std::setw(10) << "Average" << " ";
+            ss << std::setw(10) << "Min" << " " << std::setw(10) << "Max" << " " << std::setw(10) << "Throughput" << " Function" << std::endl;
+            for (std::map<std::string, PerformanceMeasurer>::const_iterator it = combined.begin(); it != combined.end(); ++it)
+            {
+                if (it->second.Count())
+                    ss << it->second.Statistic(ticksPerMs) << " " << it->first << std::endl;
+            }
+            return ss.str();
+        }
+
+        void PerformanceMeasurerStorage::Reset()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (size_t i = 0; i < _threads.size(); ++i)
+            {
+                std::lock_guard<std::mutex> threadLock(_threads[i]->mutex);
+                for (std::map<std::string, PerformanceMeasurer>::iterator it = _threads[i]->measurers.begin(); it != _threads[i]->measurers.end(); ++it)
+                    it->second.Reset();
+            }
+        }
+    }
+}
+#endif//SIMD_PERFORMANCE_STATISTIC
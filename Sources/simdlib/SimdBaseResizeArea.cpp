@@ -0,0 +1,118 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void ResizeAreaIndex::Init(size_t srcSize, size_t dstSize, size_t channelCount)
+        {
+            size = dstSize*channelCount;
+            taps = 0;
+            count.Resize(dstSize);
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                size_t begin = i*srcSize, end = begin + srcSize;
+                count[i] = int((end + dstSize - 1) / dstSize - begin / dstSize);
+                taps = Simd::Max<size_t>(taps, count[i]);
+            }
+            index.Resize(taps * size);
+            alpha.Resize(taps * size);
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                size_t begin = i*srcSize, end = begin + srcSize, lo = begin / dstSize;
+                for (size_t k = 0; k < taps; ++k)
+                {
+                    size_t s = lo + Simd::Min<size_t>(k, count[i] - 1);
+                    float a = (int)k < count[i] ? float(Simd::Min(end, (s + 1)*dstSize) - Simd::Max(begin, s*dstSize)) / srcSize : 0.0f;
+                    for (size_t c = 0; c < channelCount; ++c)
+                    {
+                        size_t o = k*size + i*channelCount + c;
+                        index[o] = int(s*channelCount + c);
+                        alpha[o] = a;
+                    }
+                }
+            }
+        }
+
+        void ResizeAreaX(const float * src, const ResizeAreaIndex & index, size_t begin, uint8_t * dst)
+        {
+            size_t size = index.size;
+            for (size_t i = begin; i < size; ++i)
+            {
+                const int * pi = index.index.data + i;
+                const float * pa = index.alpha.data + i;
+                float sum = src[pi[0]] * pa[0];
+                for (size_t k = 1; k < index.taps; ++k)
+                    sum += src[pi[k*size]] * pa[k*size];
+                dst[i] = ResizeRound(sum);
+            }
+        }
+
+        SIMD_INLINE void ResizeAreaY(const uint8_t * src, size_t size, float alpha, float * dst, bool first)
+        {
+            if (first)
+            {
+                for (size_t i = 0; i < size; ++i)
+                    dst[i] = src[i] * alpha;
+            }
+            else
+            {
+                for (size_t i = 0; i < size; ++i)
+                    dst[i] += src[i] * alpha;
+            }
+        }
+
+        ResizerByteArea::ResizerByteArea(const ResParam & param)
+            : Resizer(param)
+        {
+            assert(_param.channels >= 1 && _param.channels <= 4);
+
+            _ix.Init(_param.srcW, _param.dstW, _param.channels);
+            _iy.Init(_param.srcH, _param.dstH, 1);
+            _bx.Resize(_param.srcW*_param.channels);
+        }
+
+        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            size_t dstHeight = _param.dstH;
+            for (size_t y = 0; y < dstHeight; ++y, dst = Next(dst, dstStride))
+            {
+                const uint8_t * ps = src + _iy.index[y] * srcStride;
+                for (int k = 0; k < _iy.count[y]; ++k, ps += srcStride)
+                    ResizeAreaY(ps, _bx.size, _iy.alpha[k*dstHeight + y], _bx.data, k == 0);
+                ResizeAreaX(_bx.data, _ix, 0, dst);
+            }
+        }
+
+        void ResizeArea(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+        {
+            ResizerByteArea resizer(ResParam(srcWidth, srcHeight, dstWidth, dstHeight, channelCount, SimdResizeMethodArea));
+            resizer.Run(src, srcStride, dst, dstStride);
+        }
+    }
+}
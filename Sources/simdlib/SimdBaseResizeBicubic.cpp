@@ -0,0 +1,115 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void ResizeBicubicIndex::Init(size_t srcSize, size_t dstSize, size_t channelCount)
+        {
+            size = dstSize*channelCount;
+            index.Resize(4 * size);
+            alpha.Resize(4 * size);
+            double scale = (double)srcSize / dstSize;
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                double pos = (i + 0.5)*scale - 0.5;
+                ptrdiff_t idx = (ptrdiff_t)::floor(pos);
+                float f = float(pos - idx), f2 = f*f, f3 = f2*f;
+                float a[4];
+                a[0] = (-f3 + 2.0f*f2 - f)*0.5f;
+                a[1] = (3.0f*f3 - 5.0f*f2 + 2.0f)*0.5f;
+                a[2] = (-3.0f*f3 + 4.0f*f2 + f)*0.5f;
+                a[3] = (f3 - f2)*0.5f;
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    ptrdiff_t s = Simd::RestrictRange<ptrdiff_t>(idx - 1 + k, 0, srcSize - 1);
+                    for (size_t c = 0; c < channelCount; ++c)
+                    {
+                        size_t o = k*size + i*channelCount + c;
+                        index[o] = int(s*channelCount + c);
+                        alpha[o] = a[k];
+                    }
+                }
+            }
+        }
+
+        void ResizeBicubicX(const uint8_t * src, const ResizeBicubicIndex & index, size_t begin, float * dst)
+        {
+            const int * i0 = index.index.data, * i1 = i0 + index.size, * i2 = i1 + index.size, * i3 = i2 + index.size;
+            const float * a0 = index.alpha.data, * a1 = a0 + index.size, * a2 = a1 + index.size, * a3 = a2 + index.size;
+            for (size_t i = begin; i < index.size; ++i)
+                dst[i] = src[i0[i]] * a0[i] + src[i1[i]] * a1[i] + src[i2[i]] * a2[i] + src[i3[i]] * a3[i];
+        }
+
+        SIMD_INLINE void ResizeBicubicY(const float * const * src, const float * alpha, size_t size, uint8_t * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = ResizeRound(src[0][i] * alpha[0] + src[1][i] * alpha[1] + src[2][i] * alpha[2] + src[3][i] * alpha[3]);
+        }
+
+        ResizerByteBicubic::ResizerByteBicubic(const ResParam & param)
+            : Resizer(param)
+        {
+            assert(_param.channels >= 1 && _param.channels <= 4);
+
+            _ix.Init(_param.srcW, _param.dstW, _param.channels);
+            _iy.Init(_param.srcH, _param.dstH, 1);
+            _rows.Init(_ix.size);
+        }
+
+        void ResizerByteBicubic::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            size_t dstHeight = _param.dstH;
+            _rows.Reset();
+            for (size_t y = 0; y < dstHeight; ++y, dst = Next(dst, dstStride))
+            {
+                const float * ps[4];
+                float alpha[4];
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    int sy = _iy.index[k*dstHeight + y];
+                    ps[k] = _rows.Get(sy);
+                    if (ps[k] == NULL)
+                    {
+                        float * row = _rows.Set(sy, _iy.index.data + y, dstHeight);
+                        ResizeBicubicX(src + sy*srcStride, _ix, 0, row);
+                        ps[k] = row;
+                    }
+                    alpha[k] = _iy.alpha[k*dstHeight + y];
+                }
+                ResizeBicubicY(ps, alpha, _ix.size, dst);
+            }
+        }
+
+        void ResizeBicubic(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+        {
+            ResizerByteBicubic resizer(ResParam(srcWidth, srcHeight, dstWidth, dstHeight, channelCount, SimdResizeMethodBicubic));
+            resizer.Run(src, srcStride, dst, dstStride);
+        }
+    }
+}
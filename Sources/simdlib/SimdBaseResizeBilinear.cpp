@@ -22,41 +22,12 @@
 * SOFTWARE.
 */
 #include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
 
 namespace Simd
 {
     namespace Base
     {
-        namespace
-        {
-            struct Buffer
-            {
-                Buffer(size_t width, size_t height)
-                {
-                    _p = Allocate(2*sizeof(int)*(2*width + height));
-                    ix = (int*)_p;
-                    ax = ix + width;
-                    iy = ax + width;
-                    ay = iy + height;
-                    pbx[0] = (int*)(ay + height);
-                    pbx[1] = pbx[0] + width;
-                }
-
-                ~Buffer()
-                {
-                    Free(_p);
-                }
-
-                int * ix;
-                int * ax;
-                int * iy;
-                int * ay;
-                int * pbx[2];
-            private:
-                void *_p;
-            };
-        }
-
         void EstimateAlphaIndex(size_t srcSize, size_t dstSize, int * indexes, int * alphas, size_t channelCount)
         {
             float scale = (float)srcSize/dstSize;
@@ -88,33 +59,43 @@ namespace Simd
             }
         }
 
-        void ResizeBilinear(
-            const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+        ResizerByteBilinear::ResizerByteBilinear(const ResParam & param)
+            : Resizer(param)
         {
-            assert(channelCount >= 1 && channelCount <= 4);
+            assert(_param.channels >= 1 && _param.channels <= 4);
 
-            size_t dstRowSize = channelCount*dstWidth;
+            size_t rowSize = _param.channels*_param.dstW;
+            _ix.Resize(rowSize);
+            _ax.Resize(rowSize);
+            _iy.Resize(_param.dstH);
+            _ay.Resize(_param.dstH);
+            _bx[0].Resize(rowSize);
+            _bx[1].Resize(rowSize);
 
-            Buffer buffer(dstRowSize, dstHeight);
+            EstimateAlphaIndex(_param.srcH, _param.dstH, _iy.data, _ay.data, 1);
 
-            EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1);
+            EstimateAlphaIndex(_param.srcW, _param.dstW, _ix.data, _ax.data, _param.channels);
+        }
 
-            EstimateAlphaIndex(srcWidth, dstWidth, buffer.ix, buffer.ax, channelCount);
+        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            size_t channelCount = _param.channels;
+            size_t dstRowSize = channelCount*_param.dstW;
+            int * pbx[2] = { _bx[0].data, _bx[1].data };
 
             ptrdiff_t previous = -2;
 
-            for(size_t yDst = 0; yDst < dstHeight; yDst++, dst += dstStride)
+            for(size_t yDst = 0; yDst < _param.dstH; yDst++, dst = Next(dst, dstStride))
             {
-                int fy = buffer.ay[yDst];
-                ptrdiff_t sy = buffer.iy[yDst];
+                int fy = _ay[yDst];
+                ptrdiff_t sy = _iy[yDst];
                 int k = 0;
 
                 if(sy == previous)
                     k = 2;
                 else if(sy == previous + 1)
                 {
-                    Swap(buffer.pbx[0], buffer.pbx[1]);
+                    Swap(pbx[0], pbx[1]);
                     k = 1;
                 }
 
@@ -122,12 +103,12 @@ namespace Simd
 
                 for(; k < 2; k++)
                 {
-                    int* pb = buffer.pbx[k];
+                    int* pb = pbx[k];
                     const uint8_t* ps = src + (sy + k)*srcStride;
                     for(size_t x = 0; x < dstRowSize; x++)
                     {
-                        size_t sx = buffer.ix[x];
-                        int fx = buffer.ax[x];
+                        size_t sx = _ix[x];
+                        int fx = _ax[x];
                         int t = ps[sx];
                         pb[x] = (t << LINEAR_SHIFT) + (ps[sx + channelCount] - t)*fx;
                     }
@@ -135,20 +116,41 @@ namespace Simd
 
                 if(fy == 0)
                     for(size_t xDst = 0; xDst < dstRowSize; xDst++)
-                        dst[xDst] = ((buffer.pbx[0][xDst] << LINEAR_SHIFT) + BILINEAR_ROUND_TERM) >> BILINEAR_SHIFT;
+                        dst[xDst] = ((pbx[0][xDst] << LINEAR_SHIFT) + BILINEAR_ROUND_TERM) >> BILINEAR_SHIFT;
                 else if(fy == FRACTION_RANGE)
                     for(size_t xDst = 0; xDst < dstRowSize; xDst++)
-                        dst[xDst] = ((buffer.pbx[1][xDst] << LINEAR_SHIFT) + BILINEAR_ROUND_TERM) >> BILINEAR_SHIFT;
+                        dst[xDst] = ((pbx[1][xDst] << LINEAR_SHIFT) + BILINEAR_ROUND_TERM) >> BILINEAR_SHIFT;
                 else
                 {
                     for(size_t xDst = 0; xDst < dstRowSize; xDst++)
                     {
-                        int t = buffer.pbx[0][xDst];
-                        dst[xDst] = ((t << LINEAR_SHIFT) + (buffer.pbx[1][xDst] - t)*fy + BILINEAR_ROUND_TERM) >> BILINEAR_SHIFT;
+                        int t = pbx[0][xDst];
+                        dst[xDst] = ((t << LINEAR_SHIFT) + (pbx[1][xDst] - t)*fy + BILINEAR_ROUND_TERM) >> BILINEAR_SHIFT;
                     }
                 }
             }
         }
+
+        void ResizeBilinear(
+            const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+        {
+            ResizerByteBilinear resizer(ResParam(srcWidth, srcHeight, dstWidth, dstHeight, channelCount, SimdResizeMethodBilinear));
+            resizer.Run(src, srcStride, dst, dstStride);
+        }
+
+        void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method)
+        {
+            ResParam param(srcX, srcY, dstX, dstY, channels, method);
+            if (method == SimdResizeMethodBilinear)
+                return new ResizerByteBilinear(param);
+            else if (method == SimdResizeMethodArea)
+                return new ResizerByteArea(param);
+            else if (method == SimdResizeMethodBicubic)
+                return new ResizerByteBicubic(param);
+            else
+                return NULL;
+        }
     }
 }
 
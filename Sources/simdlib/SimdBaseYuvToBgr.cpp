@@ -83,5 +83,25 @@ namespace Simd
 				bgr += bgrStride;
 			}
 		}
+
+		void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, 
+			size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+		{
+			assert((width%2 == 0) && (height%2 == 0) && (width >= 2) && (height >= 2));
+
+			for(size_t row = 0; row < height; row += 2)
+			{
+				for(size_t colY = 0, colBgr = 0; colY < width; colY += 2, colBgr += 6)
+				{
+					int u_ = uv[colY + 0];
+					int v_ = uv[colY + 1];
+					Yuv422pToBgr(y + colY, u_, v_, bgr + colBgr);
+					Yuv422pToBgr(y + yStride + colY, u_, v_, bgr + bgrStride + colBgr);
+				}
+				y += 2*yStride;
+				uv += uvStride;
+				bgr += 2*bgrStride;
+			}
+		}
 	}
 }
@@ -83,5 +83,25 @@ namespace Simd
 				bgra += bgraStride;
 			}
 		}
+
+		void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, 
+			size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+		{
+			assert((width%2 == 0) && (height%2 == 0) && (width >= 2) && (height >= 2));
+
+			for(size_t row = 0; row < height; row += 2)
+			{
+				for(size_t colY = 0, colBgra = 0; colY < width; colY += 2, colBgra += 8)
+				{
+					int u_ = uv[colY + 0];
+					int v_ = uv[colY + 1];
+					Yuv422pToBgra(y + colY, u_, v_, alpha, bgra + colBgra);
+					Yuv422pToBgra(y + yStride + colY, u_, v_, alpha, bgra + bgraStride + colBgra);
+				}
+				y += 2*yStride;
+				uv += uvStride;
+				bgra += 2*bgraStride;
+			}
+		}
    }
 }
@@ -51,6 +51,7 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdVersion.h"
 #include "Simd/SimdConst.h"
 #include "Simd/SimdLog.h"
+#include "Simd/SimdPerformance.h"
 
 #include "Simd/SimdBase.h"
 #include "Simd/SimdSse1.h"
@@ -68,6 +69,17 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdNeon.h"
 #include "Simd/SimdMsa.h"
 
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdBilateralFilter.h"
+#include "Simd/SimdCanny.h"
+
+#include "Simd/SimdParallel.hpp"
+
+#include <vector>
+#include <atomic>
+#include <mutex>
+
 using namespace Simd;
 
 SIMD_API int SimdCpuInfo()
@@ -118,6 +130,343 @@ SIMD_API int SimdCpuInfo()
     return info;
 }
 
+#define SIMD_DISPATCH_ENABLE(ext) (SimdCpuInfo() & (1 << SimdCpuInfo##ext)) != 0
+
+namespace Simd
+{
+    namespace Dispatch
+    {
+        std::atomic<bool> Sse(SIMD_DISPATCH_ENABLE(Sse));
+        std::atomic<bool> Sse2(SIMD_DISPATCH_ENABLE(Sse2));
+        std::atomic<bool> Sse3(SIMD_DISPATCH_ENABLE(Sse3));
+        std::atomic<bool> Ssse3(SIMD_DISPATCH_ENABLE(Ssse3));
+        std::atomic<bool> Sse41(SIMD_DISPATCH_ENABLE(Sse41));
+        std::atomic<bool> Sse42(SIMD_DISPATCH_ENABLE(Sse42));
+        std::atomic<bool> Avx(SIMD_DISPATCH_ENABLE(Avx));
+        std::atomic<bool> Avx2(SIMD_DISPATCH_ENABLE(Avx2));
+        std::atomic<bool> Avx512f(SIMD_DISPATCH_ENABLE(Avx512f));
+        std::atomic<bool> Avx512bw(SIMD_DISPATCH_ENABLE(Avx512bw));
+        std::atomic<bool> Vmx(SIMD_DISPATCH_ENABLE(Vmx));
+        std::atomic<bool> Vsx(SIMD_DISPATCH_ENABLE(Vsx));
+        std::atomic<bool> Neon(SIMD_DISPATCH_ENABLE(Neon));
+        std::atomic<bool> Msa(SIMD_DISPATCH_ENABLE(Msa));
+
+        typedef void(*ResolvePtr)();
+
+        SIMD_INLINE std::vector<ResolvePtr> & Resolvers()
+        {
+            static std::vector<ResolvePtr> resolvers;
+            return resolvers;
+        }
+
+        struct Register
+        {
+            Register(ResolvePtr resolve)
+            {
+                Resolvers().push_back(resolve);
+            }
+        };
+
+        SIMD_INLINE std::mutex & Mutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        int GetMask()
+        {
+            int mask = 0;
+            mask |= Sse ? (1 << SimdCpuInfoSse) : 0;
+            mask |= Sse2 ? (1 << SimdCpuInfoSse2) : 0;
+            mask |= Sse3 ? (1 << SimdCpuInfoSse3) : 0;
+            mask |= Ssse3 ? (1 << SimdCpuInfoSsse3) : 0;
+            mask |= Sse41 ? (1 << SimdCpuInfoSse41) : 0;
+            mask |= Sse42 ? (1 << SimdCpuInfoSse42) : 0;
+            mask |= Avx ? (1 << SimdCpuInfoAvx) : 0;
+            mask |= Avx2 ? (1 << SimdCpuInfoAvx2) : 0;
+            mask |= Avx512f ? (1 << SimdCpuInfoAvx512f) : 0;
+            mask |= Avx512bw ? (1 << SimdCpuInfoAvx512bw) : 0;
+            mask |= Vmx ? (1 << SimdCpuInfoVmx) : 0;
+            mask |= Vsx ? (1 << SimdCpuInfoVsx) : 0;
+            mask |= Neon ? (1 << SimdCpuInfoNeon) : 0;
+            mask |= Msa ? (1 << SimdCpuInfoMsa) : 0;
+            return mask;
+        }
+
+        int SetMask(int mask)
+        {
+            std::lock_guard<std::mutex> lock(Mutex());
+            mask &= SimdCpuInfo();
+            Sse = (mask & (1 << SimdCpuInfoSse)) != 0;
+            Sse2 = (mask & (1 << SimdCpuInfoSse2)) != 0;
+            Sse3 = (mask & (1 << SimdCpuInfoSse3)) != 0;
+            Ssse3 = (mask & (1 << SimdCpuInfoSsse3)) != 0;
+            Sse41 = (mask & (1 << SimdCpuInfoSse41)) != 0;
+            Sse42 = (mask & (1 << SimdCpuInfoSse42)) != 0;
+            Avx = (mask & (1 << SimdCpuInfoAvx)) != 0;
+            Avx2 = (mask & (1 << SimdCpuInfoAvx2)) != 0;
+            Avx512f = (mask & (1 << SimdCpuInfoAvx512f)) != 0;
+            Avx512bw = (mask & (1 << SimdCpuInfoAvx512bw)) != 0;
+            Vmx = (mask & (1 << SimdCpuInfoVmx)) != 0;
+            Vsx = (mask & (1 << SimdCpuInfoVsx)) != 0;
+            Neon = (mask & (1 << SimdCpuInfoNeon)) != 0;
+            Msa = (mask & (1 << SimdCpuInfoMsa)) != 0;
+            for (size_t i = 0; i < Resolvers().size(); ++i)
+                Resolvers()[i]();
+            return GetMask();
+        }
+
+        size_t Alignment()
+        {
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Avx512bw)
+                return sizeof(__m512i);
+#endif
+#ifdef SIMD_AVX512F_ENABLE
+            if (Avx512f)
+                return sizeof(__m512);
+#endif
+#ifdef SIMD_AVX2_ENABLE
+            if (Avx2)
+                return sizeof(__m256i);
+#endif
+#ifdef SIMD_AVX_ENABLE
+            if (Avx)
+                return sizeof(__m256);
+#endif
+#ifdef SIMD_SSE2_ENABLE
+            if (Sse2 || Ssse3 || Sse41)
+                return sizeof(__m128i);
+#endif
+#ifdef SIMD_SSE_ENABLE
+            if (Sse)
+                return sizeof(__m128);
+#endif
+#if defined(SIMD_VMX_ENABLE) || defined(SIMD_VSX_ENABLE)
+            if (Vmx || Vsx)
+                return sizeof(__vector uint8_t);
+#endif
+#ifdef SIMD_NEON_ENABLE
+            if (Neon)
+                return sizeof(uint8x16_t);
+#endif
+#ifdef SIMD_MSA_ENABLE
+            if (Msa)
+                return sizeof(v16u8);
+#endif
+            return sizeof(void *);
+        }
+
+        template<class Ptr> struct Item
+        {
+            int mask;
+            size_t min;
+            Ptr ptr;
+        };
+
+        /*
+            Function table: implementations of the function for all compiled extensions (Base is the first item). 
+            Indices of items allowed by current mask are packed by 4 bits into one word in priority order, 
+            so a call reads a consistent table even if ::SimdSetCpuInfoMask is called concurrently. 
+            Unused nibbles are zero, so the search always stops at Base implementation.
+        */
+        template<class Ptr> class Table
+        {
+        public:
+            template<size_t N> Table(const Item<Ptr>(&items)[N])
+                : _items(items)
+                , _size(N)
+                , _order(0)
+            {
+                static_assert(N <= 16, "Too many items in function table!");
+                Resolve();
+            }
+
+            void Resolve()
+            {
+                int mask = GetMask();
+                uint64_t order = 0;
+                for (size_t i = 1, shift = 0; i < _size; ++i)
+                {
+                    if ((_items[i].mask & mask) == _items[i].mask)
+                    {
+                        order |= uint64_t(i) << shift;
+                        shift += 4;
+                    }
+                }
+                _order.store(order, std::memory_order_relaxed);
+            }
+
+            SIMD_INLINE Ptr operator()(size_t key) const
+            {
+                for (uint64_t order = _order.load(std::memory_order_relaxed);; order >>= 4)
+                {
+                    const Item<Ptr> & item = _items[order & 0xF];
+                    if (key >= item.min)
+                        return item.ptr;
+                }
+            }
+
+        private:
+            const Item<Ptr> * _items;
+            size_t _size;
+            std::atomic<uint64_t> _order;
+        };
+    }
+}
+
+#define SIMD_DISPATCH_PTR(type, ptr, func) \
+    std::atomic<type> ptr(func); \
+    static void ptr##Resolve() { ptr = func; } \
+    static Simd::Dispatch::Register ptr##Register(ptr##Resolve);
+
+// Function table for implementations which require minimal image width (or other key): table(key) returns the best allowed one.
+#define SIMD_DISPATCH_TABLE(type, table, func, items) \
+    static const Simd::Dispatch::Item<type> table##Items[] = { SIMD_BASE_ITEM(func) items }; \
+    static Simd::Dispatch::Table<type> table(table##Items); \
+    static void table##Resolve() { table.Resolve(); } \
+    static Simd::Dispatch::Register table##Register(table##Resolve);
+
+SIMD_API int SimdGetCpuInfoMask()
+{
+    std::lock_guard<std::mutex> lock(Dispatch::Mutex());
+    return Dispatch::GetMask();
+}
+
+SIMD_API int SimdSetCpuInfoMask(int mask)
+{
+    return Dispatch::SetMask(mask);
+}
+
+namespace Simd
+{
+    namespace Threads
+    {
+        size_t Number = 1;
+
+        thread_local bool Nested = false;
+
+        struct NestedGuard
+        {
+            NestedGuard() { Nested = true; }
+            ~NestedGuard() { Nested = false; }
+        };
+
+        const size_t STRIPE_MIN = 16;
+
+        SIMD_INLINE size_t StripeNumber(size_t height, size_t step, size_t radius)
+        {
+            if (Nested || Number <= 1)
+                return 1;
+            return std::min(Number, height / AlignHi(std::max(STRIPE_MIN, 2 * radius), step));
+        }
+
+        // Splits image into horizontal stripes and processes them in parallel. 
+        // Function run(begin, end) must process rows [begin, end). Returns false if image was not processed.
+        template<class Run> bool Rows(size_t height, size_t step, Run run)
+        {
+            size_t number = StripeNumber(height, step, 0);
+            if (number <= 1)
+                return false;
+            size_t stripe = AlignHi((height + number - 1) / number, step);
+            Simd::Parallel(0, number, [&](size_t thread, size_t begin, size_t end)
+            {
+                NestedGuard guard;
+                for (size_t i = begin; i < end && i*stripe < height; ++i)
+                    run(i*stripe, std::min(i*stripe + stripe, height));
+            }, number);
+            return true;
+        }
+
+        // The same as Rows but for filters which use neighboring rows (radius is measured in rows of output image). 
+        // Function run(begin, end, dst, dstStride) must process rows [begin, end) as a separate image (with border 
+        // extrapolation) and store result into dst. At first the stripes are processed independently, 
+        // then the rows near stripe boundaries are recalculated with using of small temporary buffer.
+        template<class Run> bool Filter(size_t height, size_t radius, size_t rowSize, uint8_t * dst, size_t dstStride, Run run)
+        {
+            size_t number = StripeNumber(height, 1, radius);
+            if (number <= 1)
+                return false;
+            size_t stripe = (height + number - 1) / number;
+            Simd::Parallel(0, number, [&](size_t thread, size_t begin, size_t end)
+            {
+                NestedGuard guard;
+                for (size_t i = begin; i < end && i*stripe < height; ++i)
+                    run(i*stripe, std::min(i*stripe + stripe, height), dst + i*stripe*dstStride, dstStride);
+            }, number);
+            if (radius == 0)
+                return true;
+            Simd::Parallel(1, number, [&](size_t thread, size_t begin, size_t end)
+            {
+                NestedGuard guard;
+                size_t bufferStride = AlignHi(rowSize, SIMD_ALIGN);
+                uint8_t * buffer = (uint8_t*)Allocate(bufferStride * 4 * radius);
+                for (size_t i = begin; i < end && i*stripe < height; ++i)
+                {
+                    size_t border = i*stripe;
+                    size_t windowBegin = border - std::min(border, 2 * radius);
+                    size_t windowEnd = std::min(border + 2 * radius, height);
+                    run(windowBegin, windowEnd, buffer, bufferStride);
+                    for (size_t row = border - std::min(border, radius), rowEnd = std::min(border + radius, height); row < rowEnd; ++row)
+                        memcpy(dst + row*dstStride, buffer + (row - windowBegin)*bufferStride, rowSize);
+                }
+                Free(buffer);
+            }, number);
+            return true;
+        }
+    }
+}
+
+SIMD_API void SimdSetThreadNumber(size_t threadNumber)
+{
+    Threads::Number = std::max<size_t>(threadNumber, 1);
+}
+
+SIMD_API size_t SimdGetThreadNumber()
+{
+    return Threads::Number;
+}
+
+SIMD_API const char * SimdPerformanceStatistic()
+{
+#ifdef SIMD_PERFORMANCE_STATISTIC
+    thread_local std::string report;
+    report = Base::PerformanceMeasurerStorage::s_storage.Report();
+    return report.c_str();
+#else
+    return "";
+#endif
+}
+
+SIMD_API void SimdPerformanceStatisticReset()
+{
+#ifdef SIMD_PERFORMANCE_STATISTIC
+    Base::PerformanceMeasurerStorage::s_storage.Reset();
+#endif
+}
+
+SIMD_API void * SimdPerformanceMeasurerEnter(const char * name)
+{
+#ifdef SIMD_PERFORMANCE_STATISTIC
+    Base::PerformanceMeasurer * measurer = Base::PerformanceMeasurerStorage::s_storage.Get(name);
+    Base::PerformanceMeasurerStorage::s_storage.Push(Base::PerformanceTicks());
+    return measurer;
+#else
+    return NULL;
+#endif
+}
+
+SIMD_API void SimdPerformanceMeasurerLeave(void * measurer, size_t pixels)
+{
+#ifdef SIMD_PERFORMANCE_STATISTIC
+    if (measurer)
+        ((Base::PerformanceMeasurer*)measurer)->Add(Base::PerformanceTicks() - Base::PerformanceMeasurerStorage::s_storage.Pop(), pixels);
+#endif
+}
+
+// Every C API function below is measured (if SIMD_PERFORMANCE_STATISTIC is defined) except of calls for image stripes made by work threads.
+#define SIMD_PERF_API(pixels) SIMD_PERF_BLOCK(Threads::Nested ? NULL : __FUNCTION__, pixels)
+
 SIMD_API const char * SimdVersion()
 {
     return SIMD_VERSION;
@@ -140,4812 +489,2214 @@ SIMD_API size_t SimdAlign(size_t size, size_t align)
 
 SIMD_API size_t SimdAlignment()
 {
-    return Simd::ALIGNMENT;
+    return Dispatch::Alignment();
 }
 
+typedef uint32_t(*SimdCrc32cPtr) (const void * src, size_t size);
+SIMD_DISPATCH_PTR(SimdCrc32cPtr, simdCrc32c, SIMD_FUNC1(Crc32c, SIMD_SSE42_FUNC))
+
 SIMD_API uint32_t SimdCrc32c(const void * src, size_t size)
 {
-#ifdef SIMD_SSE42_ENABLE
-    if(Sse42::Enable)
-        return Sse42::Crc32c(src, size);
-    else
-#endif
-        return Base::Crc32c(src, size);
+    return simdCrc32c(src, size);
 }
 
+typedef void(*SimdAbsDifferenceSumPtr) (const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride, size_t width, size_t height, uint64_t * sum);
+SIMD_DISPATCH_TABLE(SimdAbsDifferenceSumPtr, simdAbsDifferenceSum, AbsDifferenceSum, SIMD_AVX512BW_ITEM(AbsDifferenceSum, 0) SIMD_AVX2_ITEM(AbsDifferenceSum, Avx2::A) SIMD_SSE2_ITEM(AbsDifferenceSum, Sse2::A) SIMD_VMX_ITEM(AbsDifferenceSum, Vmx::A) SIMD_NEON_ITEM(AbsDifferenceSum, Neon::A))
+
 SIMD_API void SimdAbsDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride,
                                    size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
-	else
-#endif
-        Base::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
+    SIMD_PERF_API(width*height);
+    simdAbsDifferenceSum(width)(a, aStride, b, bStride, width, height, sum);
 }
 
+typedef void(*SimdAbsDifferenceSumMaskedPtr) (const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride, const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum);
+SIMD_DISPATCH_TABLE(SimdAbsDifferenceSumMaskedPtr, simdAbsDifferenceSumMasked, AbsDifferenceSumMasked, SIMD_AVX512BW_ITEM(AbsDifferenceSumMasked, 0) SIMD_AVX2_ITEM(AbsDifferenceSumMasked, Avx2::A) SIMD_SSE2_ITEM(AbsDifferenceSumMasked, Sse2::A) SIMD_VMX_ITEM(AbsDifferenceSumMasked, Vmx::A) SIMD_NEON_ITEM(AbsDifferenceSumMasked, Neon::A))
+
 SIMD_API void SimdAbsDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
                                          const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-	else
-#endif
-        Base::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
+    SIMD_PERF_API(width*height);
+    simdAbsDifferenceSumMasked(width)(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
 }
 
+typedef void(*SimdAbsDifferenceSums3x3Ptr) (const uint8_t *current, size_t currentStride, const uint8_t * background, size_t backgroundStride, size_t width, size_t height, uint64_t * sums);
+SIMD_DISPATCH_TABLE(SimdAbsDifferenceSums3x3Ptr, simdAbsDifferenceSums3x3, AbsDifferenceSums3x3, SIMD_AVX512BW_ITEM(AbsDifferenceSums3x3, 0) SIMD_AVX2_ITEM(AbsDifferenceSums3x3, Avx2::A + 2) SIMD_SSE2_ITEM(AbsDifferenceSums3x3, Sse2::A + 2) SIMD_VMX_ITEM(AbsDifferenceSums3x3, Vmx::A + 2) SIMD_NEON_ITEM(AbsDifferenceSums3x3, Neon::A + 2))
+
 SIMD_API void SimdAbsDifferenceSums3x3(const uint8_t *current, size_t currentStride, const uint8_t * background, size_t backgroundStride,
                                        size_t width, size_t height, uint64_t * sums)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 2)
-        Vmx::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A + 2)
-		Neon::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
-	else
-#endif
-        Base::AbsDifferenceSums3x3(current, currentStride, background, backgroundStride, width, height, sums);
+    SIMD_PERF_API(width*height);
+    simdAbsDifferenceSums3x3(width)(current, currentStride, background, backgroundStride, width, height, sums);
 }
 
+typedef void(*SimdAbsDifferenceSums3x3MaskedPtr) (const uint8_t *current, size_t currentStride, const uint8_t *background, size_t backgroundStride, const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sums);
+SIMD_DISPATCH_TABLE(SimdAbsDifferenceSums3x3MaskedPtr, simdAbsDifferenceSums3x3Masked, AbsDifferenceSums3x3Masked, SIMD_AVX512BW_ITEM(AbsDifferenceSums3x3Masked, 0) SIMD_AVX2_ITEM(AbsDifferenceSums3x3Masked, Avx2::A + 2) SIMD_SSE2_ITEM(AbsDifferenceSums3x3Masked, Sse2::A + 2) SIMD_VMX_ITEM(AbsDifferenceSums3x3Masked, Vmx::A + 2) SIMD_NEON_ITEM(AbsDifferenceSums3x3Masked, Neon::A + 2))
+
 SIMD_API void SimdAbsDifferenceSums3x3Masked(const uint8_t *current, size_t currentStride, const uint8_t *background, size_t backgroundStride,
                                              const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sums)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 2)
-        Vmx::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A + 2)
-		Neon::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
-	else
-#endif
-        Base::AbsDifferenceSums3x3Masked(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
+    SIMD_PERF_API(width*height);
+    simdAbsDifferenceSums3x3Masked(width)(current, currentStride, background, backgroundStride, mask, maskStride, index, width, height, sums);
 }
 
+typedef void(*SimdAbsGradientSaturatedSumPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdAbsGradientSaturatedSumPtr, simdAbsGradientSaturatedSum, AbsGradientSaturatedSum, SIMD_AVX512BW_ITEM(AbsGradientSaturatedSum, 0) SIMD_AVX2_ITEM(AbsGradientSaturatedSum, Avx2::A) SIMD_SSE2_ITEM(AbsGradientSaturatedSum, Sse2::A) SIMD_VMX_ITEM(AbsGradientSaturatedSum, Vmx::A) SIMD_NEON_ITEM(AbsGradientSaturatedSum, Neon::A))
+
 SIMD_API void SimdAbsGradientSaturatedSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                           uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Simd::Avx512bw::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Simd::Avx2::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-        Base::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Filter(height, 1, width, dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdAbsGradientSaturatedSum(src + begin*srcStride, srcStride, width, end - begin, dst, dstStride); }))
+        return;
+
+    simdAbsGradientSaturatedSum(width)(src, srcStride, width, height, dst, dstStride);
 }
 
+typedef void(*SimdAddFeatureDifferencePtr) (const uint8_t * value, size_t valueStride, size_t width, size_t height, const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride, uint16_t weight, uint8_t * difference, size_t differenceStride);
+SIMD_DISPATCH_TABLE(SimdAddFeatureDifferencePtr, simdAddFeatureDifference, AddFeatureDifference, SIMD_AVX512BW_ITEM(AddFeatureDifference, 0) SIMD_AVX2_ITEM(AddFeatureDifference, Avx2::A) SIMD_SSE2_ITEM(AddFeatureDifference, Sse2::A) SIMD_VMX_ITEM(AddFeatureDifference, Vmx::A) SIMD_NEON_ITEM(AddFeatureDifference, Neon::A))
+
 SIMD_API void SimdAddFeatureDifference(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                        const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride,
                                        uint16_t weight, uint8_t * difference, size_t differenceStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
-	else
-#endif
-        Base::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
+    SIMD_PERF_API(width*height);
+    simdAddFeatureDifference(width)(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
 }
 
+typedef void(*SimdAlphaBlendingPtr) (const uint8_t *src, size_t srcStride, size_t width, size_t height, size_t channelCount, const uint8_t *alpha, size_t alphaStride, uint8_t *dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdAlphaBlendingPtr, simdAlphaBlending, AlphaBlending, SIMD_AVX512BW_ITEM(AlphaBlending, 0) SIMD_AVX2_ITEM(AlphaBlending, Avx2::A) SIMD_SSSE3_ITEM(AlphaBlending, Ssse3::A) SIMD_SSE2_ITEM(AlphaBlending, Sse2::A) SIMD_VMX_ITEM(AlphaBlending, Vmx::A) SIMD_NEON_ITEM(AlphaBlending, Neon::A))
+
 SIMD_API void SimdAlphaBlending(const uint8_t *src, size_t srcStride, size_t width, size_t height, size_t channelCount,
                    const uint8_t *alpha, size_t alphaStride, uint8_t *dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
-	else
-#endif
-        Base::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdAlphaBlending(src + begin*srcStride, srcStride, width, end - begin, channelCount, alpha + begin*alphaStride, alphaStride, dst + begin*dstStride, dstStride); }))
+        return;
+
+    simdAlphaBlending(width)(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
 }
 
+typedef void(*SimdBackgroundGrowRangeSlowPtr) (const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride);
+SIMD_DISPATCH_TABLE(SimdBackgroundGrowRangeSlowPtr, simdBackgroundGrowRangeSlow, BackgroundGrowRangeSlow, SIMD_AVX512BW_ITEM(BackgroundGrowRangeSlow, 0) SIMD_AVX2_ITEM(BackgroundGrowRangeSlow, Avx2::A) SIMD_SSE2_ITEM(BackgroundGrowRangeSlow, Sse2::A) SIMD_VMX_ITEM(BackgroundGrowRangeSlow, Vmx::A) SIMD_NEON_ITEM(BackgroundGrowRangeSlow, Neon::A))
+
 SIMD_API void SimdBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                           uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
-	else
-#endif
-        Base::BackgroundGrowRangeSlow(value, valueStride, width, height, lo, loStride, hi, hiStride);
+    SIMD_PERF_API(width*height);
+    simdBackgroundGrowRangeSlow(width)(value, valueStride, width, height, lo, loStride, hi, hiStride);
 }
 
+typedef void(*SimdBackgroundGrowRangeFastPtr) (const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride);
+SIMD_DISPATCH_TABLE(SimdBackgroundGrowRangeFastPtr, simdBackgroundGrowRangeFast, BackgroundGrowRangeFast, SIMD_AVX512BW_ITEM(BackgroundGrowRangeFast, 0) SIMD_AVX2_ITEM(BackgroundGrowRangeFast, Avx2::A) SIMD_SSE2_ITEM(BackgroundGrowRangeFast, Sse2::A) SIMD_VMX_ITEM(BackgroundGrowRangeFast, Vmx::A) SIMD_NEON_ITEM(BackgroundGrowRangeFast, Neon::A))
+
 SIMD_API void SimdBackgroundGrowRangeFast(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                           uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
-	else
-#endif
-        Base::BackgroundGrowRangeFast(value, valueStride, width, height, lo, loStride, hi, hiStride);
+    SIMD_PERF_API(width*height);
+    simdBackgroundGrowRangeFast(width)(value, valueStride, width, height, lo, loStride, hi, hiStride);
 }
 
+typedef void(*SimdBackgroundIncrementCountPtr) (const uint8_t * value, size_t valueStride, size_t width, size_t height, const uint8_t * loValue, size_t loValueStride, const uint8_t * hiValue, size_t hiValueStride, uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride);
+SIMD_DISPATCH_TABLE(SimdBackgroundIncrementCountPtr, simdBackgroundIncrementCount, BackgroundIncrementCount, SIMD_AVX512BW_ITEM(BackgroundIncrementCount, 0) SIMD_AVX2_ITEM(BackgroundIncrementCount, Avx2::A) SIMD_SSE2_ITEM(BackgroundIncrementCount, Sse2::A) SIMD_VMX_ITEM(BackgroundIncrementCount, Vmx::A) SIMD_NEON_ITEM(BackgroundIncrementCount, Neon::A))
+
 SIMD_API void SimdBackgroundIncrementCount(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                            const uint8_t * loValue, size_t loValueStride, const uint8_t * hiValue, size_t hiValueStride,
                                            uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx2::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
-	else
-#endif
-        Base::BackgroundIncrementCount(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
+    SIMD_PERF_API(width*height);
+    simdBackgroundIncrementCount(width)(value, valueStride, width, height, loValue, loValueStride, hiValue, hiValueStride, loCount, loCountStride, hiCount, hiCountStride);
 }
 
+typedef void(*SimdBackgroundAdjustRangePtr) (uint8_t * loCount, size_t loCountStride, size_t width, size_t height, uint8_t * loValue, size_t loValueStride, uint8_t * hiCount, size_t hiCountStride, uint8_t * hiValue, size_t hiValueStride, uint8_t threshold);
+SIMD_DISPATCH_TABLE(SimdBackgroundAdjustRangePtr, simdBackgroundAdjustRange, BackgroundAdjustRange, SIMD_AVX512BW_ITEM(BackgroundAdjustRange, 0) SIMD_AVX2_ITEM(BackgroundAdjustRange, Avx2::A) SIMD_SSE2_ITEM(BackgroundAdjustRange, Sse2::A) SIMD_VMX_ITEM(BackgroundAdjustRange, Vmx::A) SIMD_NEON_ITEM(BackgroundAdjustRange, Neon::A))
+
 SIMD_API void SimdBackgroundAdjustRange(uint8_t * loCount, size_t loCountStride, size_t width, size_t height,
                                         uint8_t * loValue, size_t loValueStride, uint8_t * hiCount, size_t hiCountStride,
                                         uint8_t * hiValue, size_t hiValueStride, uint8_t threshold)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
-			hiCount, hiCountStride, hiValue, hiValueStride, threshold);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride, hiValue, hiValueStride, threshold);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride, hiValue, hiValueStride, threshold);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride, hiValue, hiValueStride, threshold);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
-			hiCount, hiCountStride, hiValue, hiValueStride, threshold);
-	else
-#endif
-        Base::BackgroundAdjustRange(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride, hiValue, hiValueStride, threshold);
+    SIMD_PERF_API(width*height);
+    simdBackgroundAdjustRange(width)(loCount, loCountStride, width, height, loValue, loValueStride, hiCount, hiCountStride, hiValue, hiValueStride, threshold);
 }
 
+typedef void(*SimdBackgroundAdjustRangeMaskedPtr) (uint8_t * loCount, size_t loCountStride, size_t width, size_t height, uint8_t * loValue, size_t loValueStride, uint8_t * hiCount, size_t hiCountStride, uint8_t * hiValue, size_t hiValueStride, uint8_t threshold, const uint8_t * mask, size_t maskStride);
+SIMD_DISPATCH_TABLE(SimdBackgroundAdjustRangeMaskedPtr, simdBackgroundAdjustRangeMasked, BackgroundAdjustRangeMasked, SIMD_AVX512BW_ITEM(BackgroundAdjustRangeMasked, 0) SIMD_AVX2_ITEM(BackgroundAdjustRangeMasked, Avx2::A) SIMD_SSE2_ITEM(BackgroundAdjustRangeMasked, Sse2::A) SIMD_VMX_ITEM(BackgroundAdjustRangeMasked, Vmx::A) SIMD_NEON_ITEM(BackgroundAdjustRangeMasked, Neon::A))
+
 SIMD_API void SimdBackgroundAdjustRangeMasked(uint8_t * loCount, size_t loCountStride, size_t width, size_t height,
                                               uint8_t * loValue, size_t loValueStride, uint8_t * hiCount, size_t hiCountStride,
                                               uint8_t * hiValue, size_t hiValueStride, uint8_t threshold, const uint8_t * mask, size_t maskStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
-		hiCount, hiCountStride, hiValue, hiValueStride, threshold, mask, maskStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride,hiValue, hiValueStride, threshold, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride,hiValue, hiValueStride, threshold, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride,hiValue, hiValueStride, threshold, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
-			hiCount, hiCountStride, hiValue, hiValueStride, threshold, mask, maskStride);
-	else
-#endif
-        Base::BackgroundAdjustRangeMasked(loCount, loCountStride, width, height, loValue, loValueStride,
-        hiCount, hiCountStride, hiValue, hiValueStride, threshold, mask, maskStride);
+    SIMD_PERF_API(width*height);
+    simdBackgroundAdjustRangeMasked(width)(loCount, loCountStride, width, height, loValue, loValueStride, hiCount, hiCountStride, hiValue, hiValueStride, threshold, mask, maskStride);
 }
 
+typedef void(*SimdBackgroundShiftRangePtr) (const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride);
+SIMD_DISPATCH_TABLE(SimdBackgroundShiftRangePtr, simdBackgroundShiftRange, BackgroundShiftRange, SIMD_AVX512BW_ITEM(BackgroundShiftRange, 0) SIMD_AVX2_ITEM(BackgroundShiftRange, Avx2::A) SIMD_SSE2_ITEM(BackgroundShiftRange, Sse2::A) SIMD_VMX_ITEM(BackgroundShiftRange, Vmx::A) SIMD_NEON_ITEM(BackgroundShiftRange, Neon::A))
+
 SIMD_API void SimdBackgroundShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                        uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
-	else
-#endif
-        Base::BackgroundShiftRange(value, valueStride, width, height, lo, loStride, hi, hiStride);
+    SIMD_PERF_API(width*height);
+    simdBackgroundShiftRange(width)(value, valueStride, width, height, lo, loStride, hi, hiStride);
 }
 
+typedef void(*SimdBackgroundShiftRangeMaskedPtr) (const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride, const uint8_t * mask, size_t maskStride);
+SIMD_DISPATCH_TABLE(SimdBackgroundShiftRangeMaskedPtr, simdBackgroundShiftRangeMasked, BackgroundShiftRangeMasked, SIMD_AVX512BW_ITEM(BackgroundShiftRangeMasked, 0) SIMD_AVX2_ITEM(BackgroundShiftRangeMasked, Avx2::A) SIMD_SSE2_ITEM(BackgroundShiftRangeMasked, Sse2::A) SIMD_VMX_ITEM(BackgroundShiftRangeMasked, Vmx::A) SIMD_NEON_ITEM(BackgroundShiftRangeMasked, Neon::A))
+
 SIMD_API void SimdBackgroundShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                              uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride, const uint8_t * mask, size_t maskStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
-	else
-#endif
-        Base::BackgroundShiftRangeMasked(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
+    SIMD_PERF_API(width*height);
+    simdBackgroundShiftRangeMasked(width)(value, valueStride, width, height, lo, loStride, hi, hiStride, mask, maskStride);
 }
 
+typedef void(*SimdBackgroundInitMaskPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t index, uint8_t value, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdBackgroundInitMaskPtr, simdBackgroundInitMask, BackgroundInitMask, SIMD_AVX512BW_ITEM(BackgroundInitMask, 0) SIMD_AVX2_ITEM(BackgroundInitMask, Avx2::A) SIMD_SSE2_ITEM(BackgroundInitMask, Sse2::A) SIMD_VMX_ITEM(BackgroundInitMask, Vmx::A) SIMD_NEON_ITEM(BackgroundInitMask, Neon::A))
+
 SIMD_API void SimdBackgroundInitMask(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                      uint8_t index, uint8_t value, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
-	else
-#endif
-        Base::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    simdBackgroundInitMask(width)(src, srcStride, width, height, index, value, dst, dstStride);
 }
 
+typedef void(*SimdBayerToBgrPtr) (const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride);
+SIMD_DISPATCH_TABLE(SimdBayerToBgrPtr, simdBayerToBgr, BayerToBgr, SIMD_AVX512BW_ITEM(BayerToBgr, Avx512bw::A + 4) SIMD_AVX2_ITEM(BayerToBgr, Avx2::A + 4) SIMD_SSSE3_ITEM(BayerToBgr, Ssse3::A + 4) SIMD_NEON_ITEM(BayerToBgr, Neon::A + 4))
+
 SIMD_API void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
 {
-    Base::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+    SIMD_PERF_API(width*height);
+    simdBayerToBgr(width)(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
 }
 
+typedef void(*SimdBayerToBgraPtr) (const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+SIMD_DISPATCH_TABLE(SimdBayerToBgraPtr, simdBayerToBgra, BayerToBgra, SIMD_AVX512BW_ITEM(BayerToBgra, Avx512bw::A + 4) SIMD_AVX2_ITEM(BayerToBgra, Avx2::A + 4) SIMD_SSE2_ITEM(BayerToBgra, Sse2::A + 4) SIMD_NEON_ITEM(BayerToBgra, Neon::A + 4))
+
 SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
-    Base::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+    SIMD_PERF_API(width*height);
+    simdBayerToBgra(width)(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
 }
 
+typedef void(*SimdBgraToBayerPtr) (const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat);
+SIMD_DISPATCH_TABLE(SimdBgraToBayerPtr, simdBgraToBayer, BgraToBayer, SIMD_AVX512BW_ITEM(BgraToBayer, 0) SIMD_SSSE3_ITEM(BgraToBayer, Ssse3::A) SIMD_VMX_ITEM(BgraToBayer, Vmx::A) SIMD_NEON_ITEM(BgraToBayer, Neon::A))
+
 SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
-	else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
-    else
-#endif
-        Base::BgraToBayer(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
+    SIMD_PERF_API(width*height);
+    simdBgraToBayer(width)(bgra, width, height, bgraStride, bayer, bayerStride, bayerFormat);
 }
 
+typedef void(*SimdBgraToBgrPtr) (const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride);
+SIMD_DISPATCH_TABLE(SimdBgraToBgrPtr, simdBgraToBgr, BgraToBgr, SIMD_AVX512BW_ITEM(BgraToBgr, 0) SIMD_SSSE3_ITEM(BgraToBgr, Ssse3::A) SIMD_VMX_ITEM(BgraToBgr, Vmx::A) SIMD_NEON_ITEM(BgraToBgr, Neon::A))
+
 SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
-	else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
-	else
-#endif
-        Base::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdBgraToBgr(bgra + begin*bgraStride, width, end - begin, bgraStride, bgr + begin*bgrStride, bgrStride); }))
+        return;
+
+    simdBgraToBgr(width)(bgra, width, height, bgraStride, bgr, bgrStride);
 }
 
+typedef void(*SimdBgraToGrayPtr) (const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * gray, size_t grayStride);
+SIMD_DISPATCH_TABLE(SimdBgraToGrayPtr, simdBgraToGray, BgraToGray, SIMD_AVX512BW_ITEM(BgraToGray, 0) SIMD_AVX2_ITEM(BgraToGray, Avx2::A) SIMD_SSE2_ITEM(BgraToGray, Sse2::A) SIMD_VMX_ITEM(BgraToGray, Vmx::A) SIMD_NEON_ITEM(BgraToGray, Neon::HA))
+
 SIMD_API void SimdBgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::HA)
-		Neon::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-	else
-#endif
-        Base::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdBgraToGray(bgra + begin*bgraStride, width, end - begin, bgraStride, gray + begin*grayStride, grayStride); }))
+        return;
+
+    simdBgraToGray(width)(bgra, width, height, bgraStride, gray, grayStride);
 }
 
+typedef void(*SimdBgraToYuv420pPtr) (const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+SIMD_DISPATCH_TABLE(SimdBgraToYuv420pPtr, simdBgraToYuv420p, BgraToYuv420p, SIMD_AVX512BW_ITEM(BgraToYuv420p, 0) SIMD_AVX2_ITEM(BgraToYuv420p, Avx2::DA) SIMD_SSSE3_ITEM(BgraToYuv420p, Ssse3::DA) SIMD_SSE2_ITEM(BgraToYuv420p, Sse2::DA) SIMD_VMX_ITEM(BgraToYuv420p, Vmx::DA) SIMD_NEON_ITEM(BgraToYuv420p, Neon::DA))
+
 SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::DA)
-		Neon::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-	else
-#endif
-        Base::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 2, [=](size_t begin, size_t end) { SimdBgraToYuv420p(bgra + begin*bgraStride, width, end - begin, bgraStride, y + begin*yStride, yStride, u + begin/2*uStride, uStride, v + begin/2*vStride, vStride); }))
+        return;
+
+    simdBgraToYuv420p(width)(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
+typedef void(*SimdBgraToYuv422pPtr) (const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+SIMD_DISPATCH_TABLE(SimdBgraToYuv422pPtr, simdBgraToYuv422p, BgraToYuv422p, SIMD_AVX512BW_ITEM(BgraToYuv422p, 0) SIMD_AVX2_ITEM(BgraToYuv422p, Avx2::DA) SIMD_SSSE3_ITEM(BgraToYuv422p, Ssse3::DA) SIMD_SSE2_ITEM(BgraToYuv422p, Sse2::DA) SIMD_VMX_ITEM(BgraToYuv422p, Vmx::DA) SIMD_NEON_ITEM(BgraToYuv422p, Neon::DA))
+
 SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::DA)
-		Neon::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-	else
-#endif
-        Base::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdBgraToYuv422p(bgra + begin*bgraStride, width, end - begin, bgraStride, y + begin*yStride, yStride, u + begin*uStride, uStride, v + begin*vStride, vStride); }))
+        return;
+
+    simdBgraToYuv422p(width)(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
+typedef void(*SimdBgraToYuv444pPtr) (const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+SIMD_DISPATCH_TABLE(SimdBgraToYuv444pPtr, simdBgraToYuv444p, BgraToYuv444p, SIMD_AVX512BW_ITEM(BgraToYuv444p, 0) SIMD_AVX2_ITEM(BgraToYuv444p, Avx2::A) SIMD_SSE2_ITEM(BgraToYuv444p, Sse2::A) SIMD_VMX_ITEM(BgraToYuv444p, Vmx::A) SIMD_NEON_ITEM(BgraToYuv444p, Neon::A))
+
 SIMD_API void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
-	else
-#endif
-        Base::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdBgraToYuv444p(bgra + begin*bgraStride, width, end - begin, bgraStride, y + begin*yStride, yStride, u + begin*uStride, uStride, v + begin*vStride, vStride); }))
+        return;
+
+    simdBgraToYuv444p(width)(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
+typedef void(*SimdBgrToBayerPtr) (const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat);
+SIMD_DISPATCH_TABLE(SimdBgrToBayerPtr, simdBgrToBayer, BgrToBayer, SIMD_AVX512BW_ITEM(BgrToBayer, 0) SIMD_SSSE3_ITEM(BgrToBayer, Ssse3::A) SIMD_VMX_ITEM(BgrToBayer, Vmx::A) SIMD_NEON_ITEM(BgrToBayer, Neon::A))
+
 SIMD_API void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
-	else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
-    else
-#endif
-        Base::BgrToBayer(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
+    SIMD_PERF_API(width*height);
+    simdBgrToBayer(width)(bgr, width, height, bgrStride, bayer, bayerStride, bayerFormat);
 }
 
-SIMD_API void SimdBgrToBgra(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha)
-{
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
-	else
-#endif
 #if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
-	else
+#define SIMD_AVX2_BGR_ITEM(func, min) SIMD_AVX2_ITEM(func, min)
+#else
+#define SIMD_AVX2_BGR_ITEM(func, min)
 #endif
-        Base::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+
+typedef void(*SimdBgrToBgraPtr) (const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+SIMD_DISPATCH_TABLE(SimdBgrToBgraPtr, simdBgrToBgra, BgrToBgra, SIMD_AVX512BW_ITEM(BgrToBgra, 0) SIMD_AVX2_BGR_ITEM(BgrToBgra, Avx2::A) SIMD_SSSE3_ITEM(BgrToBgra, Ssse3::A) SIMD_VMX_ITEM(BgrToBgra, Vmx::A) SIMD_NEON_ITEM(BgrToBgra, Neon::A))
+
+SIMD_API void SimdBgrToBgra(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha)
+{
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdBgrToBgra(bgr + begin*bgrStride, width, end - begin, bgrStride, bgra + begin*bgraStride, bgraStride, alpha); }))
+        return;
+
+    simdBgrToBgra(width)(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
 }
 
+typedef void(*SimdBgr48pToBgra32Ptr) (const uint8_t * blue, size_t blueStride, size_t width, size_t height, const uint8_t * green, size_t greenStride, const uint8_t * red, size_t redStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+SIMD_DISPATCH_TABLE(SimdBgr48pToBgra32Ptr, simdBgr48pToBgra32, Bgr48pToBgra32, SIMD_AVX512BW_ITEM(Bgr48pToBgra32, 0) SIMD_AVX2_ITEM(Bgr48pToBgra32, Avx2::HA) SIMD_SSE2_ITEM(Bgr48pToBgra32, Sse2::HA) SIMD_VMX_ITEM(Bgr48pToBgra32, Vmx::HA) SIMD_NEON_ITEM(Bgr48pToBgra32, Neon::A))
+
 SIMD_API void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t width, size_t height,
     const uint8_t * green, size_t greenStride, const uint8_t * red, size_t redStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
-    else
-#endif
-        Base::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
+    SIMD_PERF_API(width*height);
+    simdBgr48pToBgra32(width)(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
 }
 
+typedef void(*SimdBgrToGrayPtr) (const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * gray, size_t grayStride);
+SIMD_DISPATCH_TABLE(SimdBgrToGrayPtr, simdBgrToGray, BgrToGray, SIMD_AVX512BW_ITEM(BgrToGray, 0) SIMD_AVX2_BGR_ITEM(BgrToGray, Avx2::A) SIMD_SSSE3_ITEM(BgrToGray, Ssse3::A) SIMD_SSE2_ITEM(BgrToGray, Sse2::A) SIMD_VMX_ITEM(BgrToGray, Vmx::A) SIMD_NEON_ITEM(BgrToGray, Neon::A))
+
 SIMD_API void SimdBgrToGray(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *gray, size_t grayStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-	else
-#endif
-#if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-	else
-#endif
-        Base::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdBgrToGray(bgr + begin*bgrStride, width, end - begin, bgrStride, gray + begin*grayStride, grayStride); }))
+        return;
+
+    simdBgrToGray(width)(bgr, width, height, bgrStride, gray, grayStride);
 }
 
+typedef void(*SimdBgrToHslPtr) (const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride);
+SIMD_DISPATCH_TABLE(SimdBgrToHslPtr, simdBgrToHsl, BgrToHsl, SIMD_AVX512BW_ITEM(BgrToHsl, Avx512bw::A) SIMD_AVX2_ITEM(BgrToHsl, Avx2::A) SIMD_SSSE3_ITEM(BgrToHsl, Ssse3::A) SIMD_NEON_ITEM(BgrToHsl, Neon::A))
+
 SIMD_API void SimdBgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
 {
-    Base::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdBgrToHsl(bgr + begin*bgrStride, width, end - begin, bgrStride, hsl + begin*hslStride, hslStride); }))
+        return;
+
+    simdBgrToHsl(width)(bgr, width, height, bgrStride, hsl, hslStride);
 }
 
+typedef void(*SimdBgrToHsvPtr) (const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride);
+SIMD_DISPATCH_TABLE(SimdBgrToHsvPtr, simdBgrToHsv, BgrToHsv, SIMD_AVX512BW_ITEM(BgrToHsv, Avx512bw::A) SIMD_AVX2_ITEM(BgrToHsv, Avx2::A) SIMD_SSSE3_ITEM(BgrToHsv, Ssse3::A) SIMD_NEON_ITEM(BgrToHsv, Neon::A))
+
 SIMD_API void SimdBgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
 {
-    Base::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdBgrToHsv(bgr + begin*bgrStride, width, end - begin, bgrStride, hsv + begin*hsvStride, hsvStride); }))
+        return;
+
+    simdBgrToHsv(width)(bgr, width, height, bgrStride, hsv, hsvStride);
 }
 
+typedef void(*SimdBgrToYuv420pPtr) (const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+SIMD_DISPATCH_TABLE(SimdBgrToYuv420pPtr, simdBgrToYuv420p, BgrToYuv420p, SIMD_AVX512BW_ITEM(BgrToYuv420p, 0) SIMD_AVX2_ITEM(BgrToYuv420p, Avx2::DA) SIMD_SSSE3_ITEM(BgrToYuv420p, Ssse3::DA) SIMD_VMX_ITEM(BgrToYuv420p, Vmx::DA) SIMD_NEON_ITEM(BgrToYuv420p, Neon::DA))
+
 SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::DA)
-		Neon::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-	else
-#endif
-        Base::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 2, [=](size_t begin, size_t end) { SimdBgrToYuv420p(bgr + begin*bgrStride, width, end - begin, bgrStride, y + begin*yStride, yStride, u + begin/2*uStride, uStride, v + begin/2*vStride, vStride); }))
+        return;
+
+    simdBgrToYuv420p(width)(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
 }
 
+typedef void(*SimdBgrToYuv422pPtr) (const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+SIMD_DISPATCH_TABLE(SimdBgrToYuv422pPtr, simdBgrToYuv422p, BgrToYuv422p, SIMD_AVX512BW_ITEM(BgrToYuv422p, 0) SIMD_AVX2_ITEM(BgrToYuv422p, Avx2::DA) SIMD_SSSE3_ITEM(BgrToYuv422p, Ssse3::DA) SIMD_VMX_ITEM(BgrToYuv422p, Vmx::DA) SIMD_NEON_ITEM(BgrToYuv422p, Neon::DA))
+
 SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::DA)
-		Neon::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-	else
-#endif
-        Base::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdBgrToYuv422p(bgr + begin*bgrStride, width, end - begin, bgrStride, y + begin*yStride, yStride, u + begin*uStride, uStride, v + begin*vStride, vStride); }))
+        return;
+
+    simdBgrToYuv422p(width)(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
 }
 
+typedef void(*SimdBgrToYuv444pPtr) (const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+SIMD_DISPATCH_TABLE(SimdBgrToYuv444pPtr, simdBgrToYuv444p, BgrToYuv444p, SIMD_AVX512BW_ITEM(BgrToYuv444p, 0) SIMD_AVX2_ITEM(BgrToYuv444p, Avx2::A) SIMD_SSSE3_ITEM(BgrToYuv444p, Ssse3::A) SIMD_VMX_ITEM(BgrToYuv444p, Vmx::A) SIMD_NEON_ITEM(BgrToYuv444p, Neon::A))
+
 SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
-	else
-#endif
-        Base::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdBgrToYuv444p(bgr + begin*bgrStride, width, end - begin, bgrStride, y + begin*yStride, yStride, u + begin*uStride, uStride, v + begin*vStride, vStride); }))
+        return;
+
+    simdBgrToYuv444p(width)(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+}
+
+typedef void(*SimdBilateralFilterPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, SimdBilateralFilterType type, float sigmaSpace, float sigmaRange, size_t radius, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_PTR(SimdBilateralFilterPtr, simdBilateralFilter, SIMD_FUNC4(BilateralFilter, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC))
+
+SIMD_API void SimdBilateralFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+    SimdBilateralFilterType type, float sigmaSpace, float sigmaRange, size_t radius, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PERF_API(width*height);
+    if (type == SimdBilateralFilterExact)
+    {
+        radius = Base::BilateralFilterRadius(sigmaSpace, radius);
+        if (Threads::Filter(height, radius, width*channelCount, dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdBilateralFilter(src + begin*srcStride, srcStride, width, end - begin, channelCount, type, sigmaSpace, sigmaRange, radius, dst, dstStride); }))
+            return;
+    }
+
+    simdBilateralFilter(src, srcStride, width, height, channelCount, type, sigmaSpace, sigmaRange, radius, dst, dstStride);
 }
 
+typedef void(*SimdBinarizationPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType);
+SIMD_DISPATCH_TABLE(SimdBinarizationPtr, simdBinarization, Binarization, SIMD_AVX512BW_ITEM(Binarization, 0) SIMD_AVX2_ITEM(Binarization, Avx2::A) SIMD_SSE2_ITEM(Binarization, Sse2::A) SIMD_VMX_ITEM(Binarization, Vmx::A) SIMD_NEON_ITEM(Binarization, Neon::A))
+
 SIMD_API void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                   uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
-	else
-#endif
-        Base::Binarization(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdBinarization(src + begin*srcStride, srcStride, width, end - begin, value, positive, negative, dst + begin*dstStride, dstStride, compareType); }))
+        return;
+
+    simdBinarization(width)(src, srcStride, width, height, value, positive, negative, dst, dstStride, compareType);
 }
 
+typedef void(*SimdAveragingBinarizationPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType);
+SIMD_DISPATCH_TABLE(SimdAveragingBinarizationPtr, simdAveragingBinarization, AveragingBinarization, SIMD_AVX512BW_ITEM(AveragingBinarization, 0) SIMD_AVX2_ITEM(AveragingBinarization, Avx2::A) SIMD_SSE2_ITEM(AveragingBinarization, Sse2::A) SIMD_VMX_ITEM(AveragingBinarization, Vmx::A) SIMD_NEON_ITEM(AveragingBinarization, Neon::A))
+
 SIMD_API void SimdAveragingBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                            uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative,
                            uint8_t * dst, size_t dstStride, SimdCompareType compareType)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
-	else
-#endif
-        Base::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
+    SIMD_PERF_API(width*height);
+    simdAveragingBinarization(width)(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
+}
+
+typedef void(*SimdBoxFilterPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdBoxFilterPtr, simdBoxFilter, BoxFilter, SIMD_AVX512BW_ITEM(BoxFilter, 0) SIMD_AVX2_ITEM(BoxFilter, Avx2::A) SIMD_SSE2_ITEM(BoxFilter, Sse2::A) SIMD_NEON_ITEM(BoxFilter, Neon::A))
+
+SIMD_API void SimdBoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+    size_t channelCount, size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PERF_API(width*height);
+    if (Threads::Filter(height, windowY / 2, width*channelCount, dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdBoxFilter(src + begin*srcStride, srcStride, width, end - begin, channelCount, windowX, windowY, dst, dstStride); }))
+        return;
+
+    simdBoxFilter(width*channelCount)(src, srcStride, width, height, channelCount, windowX, windowY, dst, dstStride);
 }
 
+typedef void(*SimdConditionalCount8uPtr) (const uint8_t * src, size_t stride, size_t width, size_t height, uint8_t value, SimdCompareType compareType, uint32_t * count);
+SIMD_DISPATCH_TABLE(SimdConditionalCount8uPtr, simdConditionalCount8u, ConditionalCount8u, SIMD_AVX512BW_ITEM(ConditionalCount8u, 0) SIMD_AVX2_ITEM(ConditionalCount8u, Avx2::A) SIMD_SSE2_ITEM(ConditionalCount8u, Sse2::A) SIMD_VMX_ITEM(ConditionalCount8u, Vmx::A) SIMD_NEON_ITEM(ConditionalCount8u, Neon::A))
+
 SIMD_API void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
                                    uint8_t value, SimdCompareType compareType, uint32_t * count)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::ConditionalCount8u(src, stride, width, height, value, compareType, count);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ConditionalCount8u(src, stride, width, height, value, compareType, count);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ConditionalCount8u(src, stride, width, height, value, compareType, count);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::ConditionalCount8u(src, stride, width, height, value, compareType, count);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::ConditionalCount8u(src, stride, width, height, value, compareType, count);
-	else
-#endif
-        Base::ConditionalCount8u(src, stride, width, height, value, compareType, count);
+    SIMD_PERF_API(width*height);
+    simdConditionalCount8u(width)(src, stride, width, height, value, compareType, count);
 }
 
+typedef void(*SimdConditionalCount16iPtr) (const uint8_t * src, size_t stride, size_t width, size_t height, int16_t value, SimdCompareType compareType, uint32_t * count);
+SIMD_DISPATCH_TABLE(SimdConditionalCount16iPtr, simdConditionalCount16i, ConditionalCount16i, SIMD_AVX512BW_ITEM(ConditionalCount16i, 0) SIMD_AVX2_ITEM(ConditionalCount16i, Avx2::HA) SIMD_SSE2_ITEM(ConditionalCount16i, Sse2::HA) SIMD_VMX_ITEM(ConditionalCount16i, Vmx::HA) SIMD_NEON_ITEM(ConditionalCount16i, Neon::HA))
+
 SIMD_API void SimdConditionalCount16i(const uint8_t * src, size_t stride, size_t width, size_t height,
                                      int16_t value, SimdCompareType compareType, uint32_t * count)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::ConditionalCount16i(src, stride, width, height, value, compareType, count);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::ConditionalCount16i(src, stride, width, height, value, compareType, count);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::ConditionalCount16i(src, stride, width, height, value, compareType, count);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::ConditionalCount16i(src, stride, width, height, value, compareType, count);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::HA)
-		Neon::ConditionalCount16i(src, stride, width, height, value, compareType, count);
-	else
-#endif
-        Base::ConditionalCount16i(src, stride, width, height, value, compareType, count);
+    SIMD_PERF_API(width*height);
+    simdConditionalCount16i(width)(src, stride, width, height, value, compareType, count);
 }
 
+typedef void(*SimdConditionalSumPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum);
+SIMD_DISPATCH_TABLE(SimdConditionalSumPtr, simdConditionalSum, ConditionalSum, SIMD_AVX512BW_ITEM(ConditionalSum, 0) SIMD_AVX2_ITEM(ConditionalSum, Avx2::A) SIMD_SSE2_ITEM(ConditionalSum, Sse2::A) SIMD_VMX_ITEM(ConditionalSum, Vmx::A) SIMD_NEON_ITEM(ConditionalSum, Neon::A))
+
 SIMD_API void SimdConditionalSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                  const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-	else
-#endif
-        Base::ConditionalSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+    SIMD_PERF_API(width*height);
+    simdConditionalSum(width)(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
 }
 
+typedef void(*SimdConditionalSquareSumPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum);
+SIMD_DISPATCH_TABLE(SimdConditionalSquareSumPtr, simdConditionalSquareSum, ConditionalSquareSum, SIMD_AVX512BW_ITEM(ConditionalSquareSum, 0) SIMD_AVX2_ITEM(ConditionalSquareSum, Avx2::A) SIMD_SSE2_ITEM(ConditionalSquareSum, Sse2::A) SIMD_VMX_ITEM(ConditionalSquareSum, Vmx::A) SIMD_NEON_ITEM(ConditionalSquareSum, Neon::A))
+
 SIMD_API void SimdConditionalSquareSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                        const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-	else
-#endif
-        Base::ConditionalSquareSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+    SIMD_PERF_API(width*height);
+    simdConditionalSquareSum(width)(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
 }
 
+typedef void(*SimdConditionalSquareGradientSumPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum);
+SIMD_DISPATCH_TABLE(SimdConditionalSquareGradientSumPtr, simdConditionalSquareGradientSum, ConditionalSquareGradientSum, SIMD_AVX512BW_ITEM(ConditionalSquareGradientSum, 3) SIMD_AVX2_ITEM(ConditionalSquareGradientSum, Avx2::A + 2) SIMD_SSE2_ITEM(ConditionalSquareGradientSum, Sse2::A + 2) SIMD_VMX_ITEM(ConditionalSquareGradientSum, Vmx::A + 2) SIMD_NEON_ITEM(ConditionalSquareGradientSum, Neon::A + 2))
+
 SIMD_API void SimdConditionalSquareGradientSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                        const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 2)
-        Vmx::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A + 2)
-		Neon::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
-	else
-#endif
-        Base::ConditionalSquareGradientSum(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
+    SIMD_PERF_API(width*height);
+    simdConditionalSquareGradientSum(height >= 3 ? width : 0)(src, srcStride, width, height, mask, maskStride, value, compareType, sum);
 }
 
+typedef void(*SimdConditionalFillPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, SimdCompareType compareType, uint8_t value, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdConditionalFillPtr, simdConditionalFill, ConditionalFill, SIMD_AVX512BW_ITEM(ConditionalFill, 0) SIMD_AVX2_ITEM(ConditionalFill, Avx2::A) SIMD_SSE2_ITEM(ConditionalFill, Sse2::A) SIMD_VMX_ITEM(ConditionalFill, Vmx::A) SIMD_NEON_ITEM(ConditionalFill, Neon::A))
+
 SIMD_API void SimdConditionalFill(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t threshold, SimdCompareType compareType, uint8_t value, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-	if (Avx2::Enable && width >= Avx2::A)
-		Avx2::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-	if (Sse2::Enable && width >= Sse2::A)
-		Sse2::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_VMX_ENABLE
-	if (Vmx::Enable && width >= Vmx::A)
-		Vmx::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
-	else
-#endif
-		Base::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    simdConditionalFill(width)(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
 }
 
 SIMD_API void SimdCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PERF_API(width*height);
     Base::Copy(src, srcStride, width, height, pixelSize, dst, dstStride);
 }
 
 SIMD_API void SimdCopyFrame(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize,
                            size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PERF_API(width*height);
     Base::CopyFrame(src, srcStride, width, height, pixelSize, frameLeft, frameTop, frameRight, frameBottom, dst, dstStride);
 }
 
+typedef void(*SimdDeinterleaveUvPtr) (const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+SIMD_DISPATCH_TABLE(SimdDeinterleaveUvPtr, simdDeinterleaveUv, DeinterleaveUv, SIMD_AVX512BW_ITEM(DeinterleaveUv, 0) SIMD_AVX2_ITEM(DeinterleaveUv, Avx2::A) SIMD_SSE2_ITEM(DeinterleaveUv, Sse2::A) SIMD_VMX_ITEM(DeinterleaveUv, Vmx::A) SIMD_NEON_ITEM(DeinterleaveUv, Neon::A))
+
 SIMD_API void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
                     uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
-	else
-#endif
-        Base::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdDeinterleaveUv(uv + begin*uvStride, uvStride, width, end - begin, u + begin*uStride, uStride, v + begin*vStride, vStride); }))
+        return;
+
+    simdDeinterleaveUv(width)(uv, uvStride, width, height, u, uStride, v, vStride);
 }
 
+typedef void(*SimdDeinterleaveBgrPtr) (const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride);
+SIMD_DISPATCH_TABLE(SimdDeinterleaveBgrPtr, simdDeinterleaveBgr, DeinterleaveBgr, SIMD_AVX512BW_ITEM(DeinterleaveBgr, 0) SIMD_AVX2_ITEM(DeinterleaveBgr, Avx2::A) SIMD_SSSE3_ITEM(DeinterleaveBgr, Ssse3::A) SIMD_NEON_ITEM(DeinterleaveBgr, Neon::A))
+
 SIMD_API void SimdDeinterleaveBgr(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height,
     uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
-    else
-#endif
-        Base::DeinterleaveBgr(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
+    SIMD_PERF_API(width*height);
+    simdDeinterleaveBgr(width)(bgr, bgrStride, width, height, b, bStride, g, gStride, r, rStride);
 }
 
+typedef void(*SimdDeinterleaveBgraPtr) (const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride, uint8_t * a, size_t aStride);
+SIMD_DISPATCH_TABLE(SimdDeinterleaveBgraPtr, simdDeinterleaveBgra, DeinterleaveBgra, SIMD_AVX512BW_ITEM(DeinterleaveBgra, 0) SIMD_AVX2_ITEM(DeinterleaveBgra, Avx2::A) SIMD_SSSE3_ITEM(DeinterleaveBgra, Ssse3::A) SIMD_NEON_ITEM(DeinterleaveBgra, Neon::A))
+
 SIMD_API void SimdDeinterleaveBgra(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height,
     uint8_t * b, size_t bStride, uint8_t * g, size_t gStride, uint8_t * r, size_t rStride, uint8_t * a, size_t aStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
-    else
-#endif
-        Base::DeinterleaveBgra(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
+    SIMD_PERF_API(width*height);
+    simdDeinterleaveBgra(width)(bgra, bgraStride, width, height, b, bStride, g, gStride, r, rStride, a, aStride);
 }
 
 SIMD_API void * SimdDetectionLoadA(const char * path)
 {
+    SIMD_PERF_API(0);
     return Base::DetectionLoadA(path);
 }
 
+SIMD_API void * SimdDetectionLoadMemory(const void * buffer, size_t size)
+{
+    SIMD_PERF_API(size);
+    return Base::DetectionLoadMemory(buffer, size);
+}
+
+SIMD_API int SimdDetectionSaveA(const void * data, const char * path)
+{
+    SIMD_PERF_API(0);
+    return Base::DetectionSaveA(data, path);
+}
+
 SIMD_API void SimdDetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags)
 {
+    SIMD_PERF_API(0);
     Base::DetectionInfo(data, width, height, flags);
 }
 
 SIMD_API void * SimdDetectionInit(const void * data, uint8_t * sum, size_t sumStride, size_t width, size_t height,
     uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride, int throughColumn, int int16)
 {
+    SIMD_PERF_API(width*height);
     return Base::DetectionInit(data, sum, sumStride, width, height, sqsum, sqsumStride, tilted, tiltedStride, throughColumn, int16);
 }
 
 SIMD_API void SimdDetectionPrepare(void * hid)
 {
+    SIMD_PERF_API(0);
     Base::DetectionPrepare(hid);
 }
 
+typedef void(*SimdDetectionHaarDetect32fpPtr) (const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdDetectionHaarDetect32fpPtr, simdDetectionHaarDetect32fp, DetectionHaarDetect32fp, SIMD_AVX512BW_ITEM(DetectionHaarDetect32fp, 0) SIMD_AVX2_ITEM(DetectionHaarDetect32fp, Avx2::A) SIMD_SSE41_ITEM(DetectionHaarDetect32fp, Sse41::A) SIMD_NEON_ITEM(DetectionHaarDetect32fp, Neon::A))
+
 SIMD_API void SimdDetectionHaarDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride, 
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PERF_API((right - left)*(bottom - top));
     size_t width = right - left;
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-        Base::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    simdDetectionHaarDetect32fp(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
+typedef void(*SimdDetectionHaarDetect32fiPtr) (const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdDetectionHaarDetect32fiPtr, simdDetectionHaarDetect32fi, DetectionHaarDetect32fi, SIMD_AVX512BW_ITEM(DetectionHaarDetect32fi, 0) SIMD_AVX2_ITEM(DetectionHaarDetect32fi, Avx2::A) SIMD_SSE41_ITEM(DetectionHaarDetect32fi, Sse41::A) SIMD_NEON_ITEM(DetectionHaarDetect32fi, Neon::A))
+
 SIMD_API void SimdDetectionHaarDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PERF_API((right - left)*(bottom - top));
     size_t width = right - left;
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-        Base::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    simdDetectionHaarDetect32fi(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
+typedef void(*SimdDetectionLbpDetect32fpPtr) (const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdDetectionLbpDetect32fpPtr, simdDetectionLbpDetect32fp, DetectionLbpDetect32fp, SIMD_AVX512BW_ITEM(DetectionLbpDetect32fp, 0) SIMD_AVX2_ITEM(DetectionLbpDetect32fp, Avx2::A) SIMD_SSE41_ITEM(DetectionLbpDetect32fp, Sse41::A) SIMD_NEON_ITEM(DetectionLbpDetect32fp, Neon::A))
+
 SIMD_API void SimdDetectionLbpDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PERF_API((right - left)*(bottom - top));
     size_t width = right - left;
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-        Base::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    simdDetectionLbpDetect32fp(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
+typedef void(*SimdDetectionLbpDetect32fiPtr) (const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdDetectionLbpDetect32fiPtr, simdDetectionLbpDetect32fi, DetectionLbpDetect32fi, SIMD_AVX512BW_ITEM(DetectionLbpDetect32fi, 0) SIMD_AVX2_ITEM(DetectionLbpDetect32fi, Avx2::A) SIMD_SSE41_ITEM(DetectionLbpDetect32fi, Sse41::A) SIMD_NEON_ITEM(DetectionLbpDetect32fi, Neon::A))
+
 SIMD_API void SimdDetectionLbpDetect32fi(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PERF_API((right - left)*(bottom - top));
     size_t width = right - left;
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-        Base::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    simdDetectionLbpDetect32fi(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
+typedef void(*SimdDetectionLbpDetect16ipPtr) (const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdDetectionLbpDetect16ipPtr, simdDetectionLbpDetect16ip, DetectionLbpDetect16ip, SIMD_AVX512BW_ITEM(DetectionLbpDetect16ip, 0) SIMD_AVX2_ITEM(DetectionLbpDetect16ip, Avx2::A) SIMD_SSE41_ITEM(DetectionLbpDetect16ip, Sse41::A) SIMD_NEON_ITEM(DetectionLbpDetect16ip, Neon::A))
+
 SIMD_API void SimdDetectionLbpDetect16ip(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PERF_API((right - left)*(bottom - top));
     size_t width = right - left;
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-        Base::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    simdDetectionLbpDetect16ip(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
+typedef void(*SimdDetectionLbpDetect16iiPtr) (const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdDetectionLbpDetect16iiPtr, simdDetectionLbpDetect16ii, DetectionLbpDetect16ii, SIMD_AVX512BW_ITEM(DetectionLbpDetect16ii, 0) SIMD_AVX2_ITEM(DetectionLbpDetect16ii, Avx2::A) SIMD_SSE41_ITEM(DetectionLbpDetect16ii, Sse41::A) SIMD_NEON_ITEM(DetectionLbpDetect16ii, Neon::A))
+
 SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PERF_API((right - left)*(bottom - top));
     size_t width = right - left;
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A)
-        Sse41::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
-    else
-#endif
-        Base::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    simdDetectionLbpDetect16ii(width)(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
 SIMD_API void SimdDetectionFree(void * ptr)
 {
+    SIMD_PERF_API(0);
     Base::DetectionFree(ptr);
 }
 
+typedef void(*SimdEdgeBackgroundGrowRangeSlowPtr) (const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * background, size_t backgroundStride);
+SIMD_DISPATCH_TABLE(SimdEdgeBackgroundGrowRangeSlowPtr, simdEdgeBackgroundGrowRangeSlow, EdgeBackgroundGrowRangeSlow, SIMD_AVX512BW_ITEM(EdgeBackgroundGrowRangeSlow, 0) SIMD_AVX2_ITEM(EdgeBackgroundGrowRangeSlow, Avx2::A) SIMD_SSE2_ITEM(EdgeBackgroundGrowRangeSlow, Sse2::A) SIMD_VMX_ITEM(EdgeBackgroundGrowRangeSlow, Vmx::A) SIMD_NEON_ITEM(EdgeBackgroundGrowRangeSlow, Neon::A))
+
 SIMD_API void SimdEdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                  uint8_t * background, size_t backgroundStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
-	else
-#endif
-        Base::EdgeBackgroundGrowRangeSlow(value, valueStride, width, height, background, backgroundStride);
+    SIMD_PERF_API(width*height);
+    simdEdgeBackgroundGrowRangeSlow(width)(value, valueStride, width, height, background, backgroundStride);
 }
 
+typedef void(*SimdEdgeBackgroundGrowRangeFastPtr) (const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * background, size_t backgroundStride);
+SIMD_DISPATCH_TABLE(SimdEdgeBackgroundGrowRangeFastPtr, simdEdgeBackgroundGrowRangeFast, EdgeBackgroundGrowRangeFast, SIMD_AVX512BW_ITEM(EdgeBackgroundGrowRangeFast, 0) SIMD_AVX2_ITEM(EdgeBackgroundGrowRangeFast, Avx2::A) SIMD_SSE2_ITEM(EdgeBackgroundGrowRangeFast, Sse2::A) SIMD_VMX_ITEM(EdgeBackgroundGrowRangeFast, Vmx::A) SIMD_NEON_ITEM(EdgeBackgroundGrowRangeFast, Neon::A))
+
 SIMD_API void SimdEdgeBackgroundGrowRangeFast(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                  uint8_t * background, size_t backgroundStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
-	else
-#endif
-        Base::EdgeBackgroundGrowRangeFast(value, valueStride, width, height, background, backgroundStride);
+    SIMD_PERF_API(width*height);
+    simdEdgeBackgroundGrowRangeFast(width)(value, valueStride, width, height, background, backgroundStride);
 }
 
+typedef void(*SimdEdgeBackgroundIncrementCountPtr) (const uint8_t * value, size_t valueStride, size_t width, size_t height, const uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t * backgroundCount, size_t backgroundCountStride);
+SIMD_DISPATCH_TABLE(SimdEdgeBackgroundIncrementCountPtr, simdEdgeBackgroundIncrementCount, EdgeBackgroundIncrementCount, SIMD_AVX512BW_ITEM(EdgeBackgroundIncrementCount, 0) SIMD_AVX2_ITEM(EdgeBackgroundIncrementCount, Avx2::A) SIMD_SSE2_ITEM(EdgeBackgroundIncrementCount, Sse2::A) SIMD_VMX_ITEM(EdgeBackgroundIncrementCount, Vmx::A) SIMD_NEON_ITEM(EdgeBackgroundIncrementCount, Neon::A))
+
 SIMD_API void SimdEdgeBackgroundIncrementCount(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                   const uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t * backgroundCount, size_t backgroundCountStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
-	else
-#endif
-        Base::EdgeBackgroundIncrementCount(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
+    SIMD_PERF_API(width*height);
+    simdEdgeBackgroundIncrementCount(width)(value, valueStride, width, height, backgroundValue, backgroundValueStride, backgroundCount, backgroundCountStride);
 }
 
+typedef void(*SimdEdgeBackgroundAdjustRangePtr) (uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height, uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold);
+SIMD_DISPATCH_TABLE(SimdEdgeBackgroundAdjustRangePtr, simdEdgeBackgroundAdjustRange, EdgeBackgroundAdjustRange, SIMD_AVX512BW_ITEM(EdgeBackgroundAdjustRange, 0) SIMD_AVX2_ITEM(EdgeBackgroundAdjustRange, Avx2::A) SIMD_SSE2_ITEM(EdgeBackgroundAdjustRange, Sse2::A) SIMD_VMX_ITEM(EdgeBackgroundAdjustRange, Vmx::A) SIMD_NEON_ITEM(EdgeBackgroundAdjustRange, Neon::A))
+
 SIMD_API void SimdEdgeBackgroundAdjustRange(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height,
                                uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
-	else
-#endif
-        Base::EdgeBackgroundAdjustRange(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
+    SIMD_PERF_API(width*height);
+    simdEdgeBackgroundAdjustRange(width)(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold);
 }
 
+typedef void(*SimdEdgeBackgroundAdjustRangeMaskedPtr) (uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height, uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold, const uint8_t * mask, size_t maskStride);
+SIMD_DISPATCH_TABLE(SimdEdgeBackgroundAdjustRangeMaskedPtr, simdEdgeBackgroundAdjustRangeMasked, EdgeBackgroundAdjustRangeMasked, SIMD_AVX512BW_ITEM(EdgeBackgroundAdjustRangeMasked, 0) SIMD_AVX2_ITEM(EdgeBackgroundAdjustRangeMasked, Avx2::A) SIMD_SSE2_ITEM(EdgeBackgroundAdjustRangeMasked, Sse2::A) SIMD_VMX_ITEM(EdgeBackgroundAdjustRangeMasked, Vmx::A) SIMD_NEON_ITEM(EdgeBackgroundAdjustRangeMasked, Neon::A))
+
 SIMD_API void SimdEdgeBackgroundAdjustRangeMasked(uint8_t * backgroundCount, size_t backgroundCountStride, size_t width, size_t height,
                                uint8_t * backgroundValue, size_t backgroundValueStride, uint8_t threshold, const uint8_t * mask, size_t maskStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
-	else
-#endif
-        Base::EdgeBackgroundAdjustRangeMasked(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
+    SIMD_PERF_API(width*height);
+    simdEdgeBackgroundAdjustRangeMasked(width)(backgroundCount, backgroundCountStride, width, height, backgroundValue, backgroundValueStride, threshold, mask, maskStride);
 }
 
 SIMD_API void SimdEdgeBackgroundShiftRange(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                               uint8_t * background, size_t backgroundStride)
 {
+    SIMD_PERF_API(width*height);
 	Base::EdgeBackgroundShiftRange(value, valueStride, width, height, background, backgroundStride);
 }
 
+typedef void(*SimdEdgeBackgroundShiftRangeMaskedPtr) (const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * background, size_t backgroundStride, const uint8_t * mask, size_t maskStride);
+SIMD_DISPATCH_TABLE(SimdEdgeBackgroundShiftRangeMaskedPtr, simdEdgeBackgroundShiftRangeMasked, EdgeBackgroundShiftRangeMasked, SIMD_AVX512BW_ITEM(EdgeBackgroundShiftRangeMasked, 0) SIMD_AVX2_ITEM(EdgeBackgroundShiftRangeMasked, Avx2::A) SIMD_SSE2_ITEM(EdgeBackgroundShiftRangeMasked, Sse2::A) SIMD_VMX_ITEM(EdgeBackgroundShiftRangeMasked, Vmx::A) SIMD_NEON_ITEM(EdgeBackgroundShiftRangeMasked, Neon::A))
+
 SIMD_API void SimdEdgeBackgroundShiftRangeMasked(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                               uint8_t * background, size_t backgroundStride, const uint8_t * mask, size_t maskStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
-	else
-#endif
-        Base::EdgeBackgroundShiftRangeMasked(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
+    SIMD_PERF_API(width*height);
+    simdEdgeBackgroundShiftRangeMasked(width)(value, valueStride, width, height, background, backgroundStride, mask, maskStride);
 }
 
 SIMD_API void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value)
 {
+    SIMD_PERF_API(width*height);
     Base::Fill(dst, stride, width, height, pixelSize, value);
 }
 
 SIMD_API void SimdFillFrame(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize,
                            size_t frameLeft, size_t frameTop, size_t frameRight, size_t frameBottom, uint8_t value)
 {
+    SIMD_PERF_API(width*height);
     Base::FillFrame(dst, stride, width, height, pixelSize, frameLeft, frameTop, frameRight, frameBottom, value);
 }
 
+typedef void(*SimdFillBgrPtr) (uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red);
+SIMD_DISPATCH_TABLE(SimdFillBgrPtr, simdFillBgr, FillBgr, SIMD_AVX512BW_ITEM(FillBgr, 0) SIMD_AVX2_ITEM(FillBgr, Avx2::A) SIMD_SSE2_ITEM(FillBgr, Sse2::A) SIMD_VMX_ITEM(FillBgr, Vmx::A) SIMD_NEON_ITEM(FillBgr, Neon::A))
+
 SIMD_API void SimdFillBgr(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::FillBgr(dst, stride, width, height, blue, green, red);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::FillBgr(dst, stride, width, height, blue, green, red);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::FillBgr(dst, stride, width, height, blue, green, red);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::FillBgr(dst, stride, width, height, blue, green, red);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::FillBgr(dst, stride, width, height, blue, green, red);
-    else
-#endif
-        Base::FillBgr(dst, stride, width, height, blue, green, red);
+    SIMD_PERF_API(width*height);
+    simdFillBgr(width)(dst, stride, width, height, blue, green, red);
 }
 
+typedef void(*SimdFillBgraPtr) (uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha);
+SIMD_DISPATCH_TABLE(SimdFillBgraPtr, simdFillBgra, FillBgra, SIMD_AVX512BW_ITEM(FillBgra, 0) SIMD_AVX2_ITEM(FillBgra, Avx2::A) SIMD_SSE2_ITEM(FillBgra, Sse2::A) SIMD_VMX_ITEM(FillBgra, Vmx::A) SIMD_NEON_ITEM(FillBgra, Neon::A))
+
 SIMD_API void SimdFillBgra(uint8_t * dst, size_t stride, size_t width, size_t height, uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::FillBgra(dst, stride, width, height, blue, green, red, alpha);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::FillBgra(dst, stride, width, height, blue, green, red, alpha);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::FillBgra(dst, stride, width, height, blue, green, red, alpha);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::FillBgra(dst, stride, width, height, blue, green, red, alpha);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::FillBgra(dst, stride, width, height, blue, green, red, alpha);
-    else
-#endif
-        Base::FillBgra(dst, stride, width, height, blue, green, red, alpha);
+    SIMD_PERF_API(width*height);
+    simdFillBgra(width)(dst, stride, width, height, blue, green, red, alpha);
 }
 
-SIMD_API void SimdFloat32ToFloat16(const float * src, size_t size, uint16_t * dst)
+typedef void(*SimdFilter2D8uPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, const int16_t * kernel, size_t kernelX, size_t kernelY, int shift, int16_t bias, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdFilter2D8uPtr, simdFilter2D8u, Filter2D8u, SIMD_AVX512BW_ITEM(Filter2D8u, Avx512bw::A) SIMD_AVX2_ITEM(Filter2D8u, Avx2::A) SIMD_SSE2_ITEM(Filter2D8u, Sse2::A) SIMD_NEON_ITEM(Filter2D8u, Neon::A))
+
+SIMD_API void SimdFilter2D8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, const int16_t * kernel, size_t kernelX, size_t kernelY,
+    int shift, int16_t bias, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Float32ToFloat16(src, size, dst);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::F)
-        Avx2::Float32ToFloat16(src, size, dst);
-    else
-#endif
+    SIMD_PERF_API(width*height);
+    if (Threads::Filter(height, kernelY / 2, width, dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdFilter2D8u(src + begin*srcStride, srcStride, width, end - begin, kernel, kernelX, kernelY, shift, bias, dst, dstStride); }))
+        return;
+
+    simdFilter2D8u(width)(src, srcStride, width, height, kernel, kernelX, kernelY, shift, bias, dst, dstStride);
+}
+
+typedef void(*SimdFilter2D32fPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * kernel, size_t kernelX, size_t kernelY, float * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdFilter2D32fPtr, simdFilter2D32f, Filter2D32f, SIMD_AVX512BW_ITEM(Filter2D32f, Avx512bw::F) SIMD_AVX2_ITEM(Filter2D32f, Avx2::F) SIMD_SSE2_ITEM(Filter2D32f, Sse2::F) SIMD_NEON_ITEM(Filter2D32f, Neon::F))
+
+SIMD_API void SimdFilter2D32f(const float * src, size_t srcStride, size_t width, size_t height, const float * kernel, size_t kernelX, size_t kernelY,
+    float * dst, size_t dstStride)
+{
+    SIMD_PERF_API(width*height);
+    if (Threads::Filter(height, kernelY / 2, width*sizeof(float), (uint8_t*)dst, dstStride*sizeof(float), [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdFilter2D32f(src + begin*srcStride, srcStride, width, end - begin, kernel, kernelX, kernelY, (float*)dst, dstStride/sizeof(float)); }))
+        return;
+
+    simdFilter2D32f(width)(src, srcStride, width, height, kernel, kernelX, kernelY, dst, dstStride);
+}
+
 #if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && size >= Neon::F)
-        Neon::Float32ToFloat16(src, size, dst);
-    else
+#define SIMD_NEON_FP16_ITEM(func, min) SIMD_NEON_ITEM(func, min)
+#else
+#define SIMD_NEON_FP16_ITEM(func, min)
 #endif
-        Base::Float32ToFloat16(src, size, dst);
+
+typedef void(*SimdFloat32ToFloat16Ptr) (const float * src, size_t size, uint16_t * dst);
+SIMD_DISPATCH_TABLE(SimdFloat32ToFloat16Ptr, simdFloat32ToFloat16, Float32ToFloat16, SIMD_AVX512BW_ITEM(Float32ToFloat16, 0) SIMD_AVX2_ITEM(Float32ToFloat16, Avx2::F) SIMD_NEON_FP16_ITEM(Float32ToFloat16, Neon::F))
+
+SIMD_API void SimdFloat32ToFloat16(const float * src, size_t size, uint16_t * dst)
+{
+    SIMD_PERF_API(0);
+    simdFloat32ToFloat16(size)(src, size, dst);
 }
 
+typedef void(*SimdFloat16ToFloat32Ptr) (const uint16_t * src, size_t size, float * dst);
+SIMD_DISPATCH_TABLE(SimdFloat16ToFloat32Ptr, simdFloat16ToFloat32, Float16ToFloat32, SIMD_AVX512BW_ITEM(Float16ToFloat32, 0) SIMD_AVX2_ITEM(Float16ToFloat32, Avx2::F) SIMD_NEON_FP16_ITEM(Float16ToFloat32, Neon::F))
+
 SIMD_API void SimdFloat16ToFloat32(const uint16_t * src, size_t size, float * dst)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Float16ToFloat32(src, size, dst);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::F)
-        Avx2::Float16ToFloat32(src, size, dst);
-    else
-#endif
-#if defined(SIMD_NEON_ENABLE) && defined(SIMD_NEON_FP16_ENABLE)
-    if (Neon::Enable && size >= Neon::F)
-        Neon::Float16ToFloat32(src, size, dst);
-    else
-#endif
-        Base::Float16ToFloat32(src, size, dst);
+    SIMD_PERF_API(0);
+    simdFloat16ToFloat32(size)(src, size, dst);
 }
 
+typedef void(*SimdSquaredDifferenceSum16fPtr) (const uint16_t * a, const uint16_t * b, size_t size, float * sum);
+SIMD_DISPATCH_TABLE(SimdSquaredDifferenceSum16fPtr, simdSquaredDifferenceSum16f, SquaredDifferenceSum16f, SIMD_AVX512BW_ITEM(SquaredDifferenceSum16f, 0) SIMD_AVX2_ITEM(SquaredDifferenceSum16f, Avx2::F))
+
 SIMD_API void SimdSquaredDifferenceSum16f(const uint16_t * a, const uint16_t * b, size_t size, float * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::SquaredDifferenceSum16f(a, b, size, sum);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::F)
-        Avx2::SquaredDifferenceSum16f(a, b, size, sum);
-    else
-#endif
-        Base::SquaredDifferenceSum16f(a, b, size, sum);
+    SIMD_PERF_API(0);
+    simdSquaredDifferenceSum16f(size)(a, b, size, sum);
 }
 
+typedef void(*SimdFloat32ToUint8Ptr) (const float * src, size_t size, const float * lower, const float * upper, uint8_t * dst);
+SIMD_DISPATCH_TABLE(SimdFloat32ToUint8Ptr, simdFloat32ToUint8, Float32ToUint8, SIMD_AVX512BW_ITEM(Float32ToUint8, 0) SIMD_AVX2_ITEM(Float32ToUint8, Avx2::A) SIMD_SSE2_ITEM(Float32ToUint8, Sse2::A) SIMD_NEON_ITEM(Float32ToUint8, Neon::A))
+
 SIMD_API void SimdFloat32ToUint8(const float * src, size_t size, const float * lower, const float * upper, uint8_t * dst)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Float32ToUint8(src, size, lower, upper, dst);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::A)
-        Avx2::Float32ToUint8(src, size, lower, upper, dst);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && size >= Sse2::A)
-        Sse2::Float32ToUint8(src, size, lower, upper, dst);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && size >= Neon::A)
-        Neon::Float32ToUint8(src, size, lower, upper, dst);
-    else
-#endif
-        Base::Float32ToUint8(src, size, lower, upper, dst);
+    SIMD_PERF_API(0);
+    simdFloat32ToUint8(size)(src, size, lower, upper, dst);
 }
 
+typedef void(*SimdUint8ToFloat32Ptr) (const uint8_t * src, size_t size, const float * lower, const float * upper, float * dst);
+SIMD_DISPATCH_TABLE(SimdUint8ToFloat32Ptr, simdUint8ToFloat32, Uint8ToFloat32, SIMD_AVX512BW_ITEM(Uint8ToFloat32, 0) SIMD_AVX2_ITEM(Uint8ToFloat32, Avx2::HA) SIMD_SSE2_ITEM(Uint8ToFloat32, Sse2::A) SIMD_NEON_ITEM(Uint8ToFloat32, Neon::A))
+
 SIMD_API void SimdUint8ToFloat32(const uint8_t * src, size_t size, const float * lower, const float * upper, float * dst)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Uint8ToFloat32(src, size, lower, upper, dst);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && size >= Avx2::HA)
-        Avx2::Uint8ToFloat32(src, size, lower, upper, dst);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && size >= Sse2::A)
-        Sse2::Uint8ToFloat32(src, size, lower, upper, dst);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && size >= Neon::A)
-        Neon::Uint8ToFloat32(src, size, lower, upper, dst);
-    else
-#endif
-        Base::Uint8ToFloat32(src, size, lower, upper, dst);
+    SIMD_PERF_API(0);
+    simdUint8ToFloat32(size)(src, size, lower, upper, dst);
 }
 
+typedef void(*SimdGaussianBlur3x3Ptr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdGaussianBlur3x3Ptr, simdGaussianBlur3x3, GaussianBlur3x3, SIMD_AVX512BW_ITEM(GaussianBlur3x3, Avx512bw::A) SIMD_AVX2_ITEM(GaussianBlur3x3, Avx2::A) SIMD_SSSE3_ITEM(GaussianBlur3x3, Ssse3::A) SIMD_SSE2_ITEM(GaussianBlur3x3, Sse2::A) SIMD_VMX_ITEM(GaussianBlur3x3, Vmx::A) SIMD_NEON_ITEM(GaussianBlur3x3, Neon::A))
+
 SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                      size_t channelCount, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-		Avx512bw::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-        Avx2::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && (width - 1)*channelCount >= Ssse3::A)
-        Ssse3::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-        Sse2::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-        Vmx::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-		Neon::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-	else
-#endif
-		Base::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Filter(height, 1, width*channelCount, dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdGaussianBlur3x3(src + begin*srcStride, srcStride, width, end - begin, channelCount, dst, dstStride); }))
+        return;
+
+    simdGaussianBlur3x3((width - 1)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
+}
+
+typedef void(*SimdGaussianBlurPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, float sigma, size_t radius, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdGaussianBlurPtr, simdGaussianBlur, GaussianBlur, SIMD_AVX512BW_ITEM(GaussianBlur, Avx512bw::A) SIMD_AVX2_ITEM(GaussianBlur, Avx2::A) SIMD_SSE2_ITEM(GaussianBlur, Sse2::A) SIMD_NEON_ITEM(GaussianBlur, Neon::A))
+
+SIMD_API void SimdGaussianBlur(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+    size_t channelCount, float sigma, size_t radius, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PERF_API(width*height);
+    radius = Base::GaussianBlurRadius(sigma, radius);
+    if (Threads::Filter(height, radius, width*channelCount, dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdGaussianBlur(src + begin*srcStride, srcStride, width, end - begin, channelCount, sigma, radius, dst, dstStride); }))
+        return;
+
+    simdGaussianBlur(width*channelCount)(src, srcStride, width, height, channelCount, sigma, radius, dst, dstStride);
 }
 
+typedef void(*SimdGrayToBgrPtr) (const uint8_t *gray, size_t width, size_t height, size_t grayStride, uint8_t *bgr, size_t bgrStride);
+SIMD_DISPATCH_TABLE(SimdGrayToBgrPtr, simdGrayToBgr, GrayToBgr, SIMD_AVX512BW_ITEM(GrayToBgr, 0) SIMD_AVX2_ITEM(GrayToBgr, Avx2::A) SIMD_SSSE3_ITEM(GrayToBgr, Ssse3::A) SIMD_VMX_ITEM(GrayToBgr, Vmx::A) SIMD_NEON_ITEM(GrayToBgr, Neon::A))
+
 SIMD_API void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
-	else
-#endif
-        Base::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdGrayToBgr(gray + begin*grayStride, width, end - begin, grayStride, bgr + begin*bgrStride, bgrStride); }))
+        return;
+
+    simdGrayToBgr(width)(gray, width, height, grayStride, bgr, bgrStride);
 }
 
+typedef void(*SimdGrayToBgraPtr) (const uint8_t *gray, size_t width, size_t height, size_t grayStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha);
+SIMD_DISPATCH_TABLE(SimdGrayToBgraPtr, simdGrayToBgra, GrayToBgra, SIMD_AVX512BW_ITEM(GrayToBgra, Avx512bw::A) SIMD_AVX2_ITEM(GrayToBgra, Avx2::A) SIMD_SSE2_ITEM(GrayToBgra, Sse2::A) SIMD_VMX_ITEM(GrayToBgra, Vmx::A) SIMD_NEON_ITEM(GrayToBgra, Neon::A))
+
 SIMD_API void SimdGrayToBgra(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
-	else
-#endif
-        Base::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdGrayToBgra(gray + begin*grayStride, width, end - begin, grayStride, bgra + begin*bgraStride, bgraStride, alpha); }))
+        return;
+
+    simdGrayToBgra(width)(gray, width, height, grayStride, bgra, bgraStride, alpha);
 }
 
+typedef void(*SimdAbsSecondDerivativeHistogramPtr) (const uint8_t *src, size_t width, size_t height, size_t stride, size_t step, size_t indent, uint32_t * histogram);
+SIMD_DISPATCH_TABLE(SimdAbsSecondDerivativeHistogramPtr, simdAbsSecondDerivativeHistogram, AbsSecondDerivativeHistogram, SIMD_AVX512BW_ITEM(AbsSecondDerivativeHistogram, Avx512bw::A) SIMD_AVX2_ITEM(AbsSecondDerivativeHistogram, Avx2::A) SIMD_SSE2_ITEM(AbsSecondDerivativeHistogram, Sse2::A) SIMD_VMX_ITEM(AbsSecondDerivativeHistogram, Vmx::A) SIMD_NEON_ITEM(AbsSecondDerivativeHistogram, Neon::A))
+
 SIMD_API void SimdAbsSecondDerivativeHistogram(const uint8_t *src, size_t width, size_t height, size_t stride, size_t step, size_t indent, uint32_t * histogram)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width >= Avx512bw::A + 2 * indent)
-		Avx512bw::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2*indent)
-        Avx2::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2*indent)
-        Sse2::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 2*indent)
-        Vmx::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2 * indent)
-        Neon::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
-    else
-#endif
-        Base::AbsSecondDerivativeHistogram(src, width, height, stride, step, indent, histogram);
+    SIMD_PERF_API(width*height);
+    simdAbsSecondDerivativeHistogram(width >= 2 * indent ? width - 2 * indent : 0)(src, width, height, stride, step, indent, histogram);
 }
 
 SIMD_API void SimdHistogram(const uint8_t *src, size_t width, size_t height, size_t stride, uint32_t * histogram)
 {
+    SIMD_PERF_API(width*height);
     Base::Histogram(src, width, height, stride, histogram);
 }
 
+typedef void(*SimdHistogramMaskedPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram);
+SIMD_DISPATCH_TABLE(SimdHistogramMaskedPtr, simdHistogramMasked, HistogramMasked, SIMD_AVX512BW_ITEM(HistogramMasked, 0) SIMD_AVX2_ITEM(HistogramMasked, Avx2::A) SIMD_SSE2_ITEM(HistogramMasked, Sse2::A) SIMD_VMX_ITEM(HistogramMasked, Vmx::A) SIMD_NEON_ITEM(HistogramMasked, Neon::A))
+
 SIMD_API void SimdHistogramMasked(const uint8_t *src, size_t srcStride, size_t width, size_t height, 
                                   const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
-    else
-#endif
-        Base::HistogramMasked(src, srcStride, width, height, mask, maskStride, index, histogram);
+    SIMD_PERF_API(width*height);
+    simdHistogramMasked(width)(src, srcStride, width, height, mask, maskStride, index, histogram);
 }
 
+typedef void(*SimdHistogramConditionalPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint32_t * histogram);
+SIMD_DISPATCH_TABLE(SimdHistogramConditionalPtr, simdHistogramConditional, HistogramConditional, SIMD_AVX512BW_ITEM(HistogramConditional, 0) SIMD_AVX2_ITEM(HistogramConditional, Avx2::A) SIMD_SSE2_ITEM(HistogramConditional, Sse2::A) SIMD_NEON_ITEM(HistogramConditional, Neon::A))
+
 SIMD_API void SimdHistogramConditional(const uint8_t * src, size_t srcStride, size_t width, size_t height,
     const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint32_t * histogram)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
-    else
-#endif
-        Base::HistogramConditional(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
+    SIMD_PERF_API(width*height);
+    simdHistogramConditional(width)(src, srcStride, width, height, mask, maskStride, value, compareType, histogram);
 }
 
 SIMD_API void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    SIMD_PERF_API(width*height);
     Base::NormalizeHistogram(src, srcStride, width, height, dst, dstStride);
 }
 
+typedef void(*SimdHogDirectionHistogramsPtr) (const uint8_t * src, size_t stride, size_t width, size_t height, size_t cellX, size_t cellY, size_t quantization, float * histograms);
+SIMD_DISPATCH_TABLE(SimdHogDirectionHistogramsPtr, simdHogDirectionHistograms, HogDirectionHistograms, SIMD_AVX512BW_ITEM(HogDirectionHistograms, Avx512bw::HA + 2) SIMD_AVX2_ITEM(HogDirectionHistograms, Avx2::A + 2) SIMD_SSE41_ITEM(HogDirectionHistograms, Sse41::A + 2) SIMD_SSE2_ITEM(HogDirectionHistograms, Sse2::A + 2) SIMD_VSX_ITEM(HogDirectionHistograms, Vsx::A + 2) SIMD_NEON_ITEM(HogDirectionHistograms, Neon::A + 2))
+
 SIMD_API void SimdHogDirectionHistograms(const uint8_t * src, size_t stride, size_t width, size_t height, 
                                          size_t cellX, size_t cellY, size_t quantization, float * histograms)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width >= Avx512bw::HA + 2)
-		Avx512bw::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A + 2)
-        Sse41::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
-#endif
-#ifdef SIMD_VSX_ENABLE
-    if(Vsx::Enable && width >= Vsx::A + 2)
-        Vsx::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
-    else
-#endif
-        Base::HogDirectionHistograms(src, stride, width, height, cellX, cellY, quantization, histograms);
+    SIMD_PERF_API(width*height);
+    simdHogDirectionHistograms(width)(src, stride, width, height, cellX, cellY, quantization, histograms);
 }
 
+typedef void(*SimdHogExtractFeaturesPtr) (const uint8_t * src, size_t stride, size_t width, size_t height, float * features);
+SIMD_DISPATCH_TABLE(SimdHogExtractFeaturesPtr, simdHogExtractFeatures, HogExtractFeatures, SIMD_AVX512BW_ITEM(HogExtractFeatures, Avx512bw::HA + 2) SIMD_AVX2_ITEM(HogExtractFeatures, Avx2::HA + 2) SIMD_SSE41_ITEM(HogExtractFeatures, Sse41::A + 2) SIMD_NEON_ITEM(HogExtractFeatures, Neon::A + 2))
+
 SIMD_API void SimdHogExtractFeatures(const uint8_t * src, size_t stride, size_t width, size_t height, float * features)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width >= Avx512bw::HA + 2)
-		Avx512bw::HogExtractFeatures(src, stride, width, height, features);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::HA + 2)
-        Avx2::HogExtractFeatures(src, stride, width, height, features);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if (Sse41::Enable && width >= Sse41::A + 2)
-        Sse41::HogExtractFeatures(src, stride, width, height, features);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::HogExtractFeatures(src, stride, width, height, features);
-    else
-#endif
-        Base::HogExtractFeatures(src, stride, width, height, features);
+    SIMD_PERF_API(width*height);
+    simdHogExtractFeatures(width)(src, stride, width, height, features);
 }
 
+typedef void(*SimdHogDeinterleavePtr) (const float * src, size_t srcStride, size_t width, size_t height, size_t count, float ** dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdHogDeinterleavePtr, simdHogDeinterleave, HogDeinterleave, SIMD_AVX512BW_ITEM(HogDeinterleave, Avx512bw::F) SIMD_AVX2_ITEM(HogDeinterleave, Avx2::F) SIMD_SSE_ITEM(HogDeinterleave, Sse::F) SIMD_NEON_ITEM(HogDeinterleave, Neon::F))
+
 SIMD_API void SimdHogDeinterleave(const float * src, size_t srcStride, size_t width, size_t height, size_t count, float ** dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width >= Avx512bw::F && count >= Sse::F)
-		Avx512bw::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F && count >= Sse::F)
-        Avx2::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F && count >= Sse::F)
-        Sse::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F && count >= Neon::F)
-        Neon::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
-    else
-#endif
-        Base::HogDeinterleave(src, srcStride, width, height, count, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    // SIMD implementations transpose at least 4 features at once.
+    simdHogDeinterleave(count >= 4 ? width : 0)(src, srcStride, width, height, count, dst, dstStride);
 }
 
+typedef void(*SimdHogFilterSeparablePtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * rowFilter, size_t rowSize, const float * colFilter, size_t colSize, float * dst, size_t dstStride, int add);
+SIMD_DISPATCH_TABLE(SimdHogFilterSeparablePtr, simdHogFilterSeparable, HogFilterSeparable, SIMD_AVX512BW_ITEM(HogFilterSeparable, Avx512bw::F) SIMD_AVX2_ITEM(HogFilterSeparable, Avx2::F) SIMD_SSE_ITEM(HogFilterSeparable, Sse::F) SIMD_NEON_ITEM(HogFilterSeparable, Neon::F))
+
 SIMD_API void SimdHogFilterSeparable(const float * src, size_t srcStride, size_t width, size_t height,
     const float * rowFilter, size_t rowSize, const float * colFilter, size_t colSize, float * dst, size_t dstStride, int add)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width >= Avx512bw::F + colSize - 1)
-		Avx512bw::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F + colSize - 1)
-        Avx2::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
-    else
-#endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F + colSize - 1)
-        Sse::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F + colSize - 1)
-        Neon::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
-    else
-#endif
-        Base::HogFilterSeparable(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
+    SIMD_PERF_API(width*height);
+    simdHogFilterSeparable(width + 1 >= colSize ? width + 1 - colSize : 0)(src, srcStride, width, height, rowFilter, rowSize, colFilter, colSize, dst, dstStride, add);
 }
 
+typedef void(*SimdInt16ToGrayPtr) (const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdInt16ToGrayPtr, simdInt16ToGray, Int16ToGray, SIMD_AVX512BW_ITEM(Int16ToGray, 0) SIMD_AVX2_ITEM(Int16ToGray, Avx2::A) SIMD_SSE2_ITEM(Int16ToGray, Sse2::A) SIMD_NEON_ITEM(Int16ToGray, Neon::HA))
+
 SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Int16ToGray(src, width, height, srcStride, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::Int16ToGray(src, width, height, srcStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::Int16ToGray(src, width, height, srcStride, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::Int16ToGray(src, width, height, srcStride, dst, dstStride);
-    else
-#endif
-        Base::Int16ToGray(src, width, height, srcStride, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdInt16ToGray(src + begin*srcStride, width, end - begin, srcStride, dst + begin*dstStride, dstStride); }))
+        return;
+
+    simdInt16ToGray(width)(src, width, height, srcStride, dst, dstStride);
 }
 
+typedef void(*SimdIntegralPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                      uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
+                      SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat);
+SIMD_DISPATCH_PTR(SimdIntegralPtr, simdIntegral, SIMD_FUNC2(Integral, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC))
+
 SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                       uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
                       SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-	if (Avx2::Enable)
-		Avx2::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
-	else
-#endif
-		Base::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+    SIMD_PERF_API(width*height);
+    simdIntegral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
 }
 
+typedef void(*SimdInterferenceIncrementPtr) (uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation);
+SIMD_DISPATCH_TABLE(SimdInterferenceIncrementPtr, simdInterferenceIncrement, InterferenceIncrement, SIMD_AVX512BW_ITEM(InterferenceIncrement, 0) SIMD_AVX2_ITEM(InterferenceIncrement, Avx2::HA) SIMD_SSE2_ITEM(InterferenceIncrement, Sse2::HA) SIMD_VMX_ITEM(InterferenceIncrement, Vmx::HA) SIMD_NEON_ITEM(InterferenceIncrement, Neon::HA))
+
 SIMD_API void SimdInterferenceIncrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
-    else
-#endif
-        Base::InterferenceIncrement(statistic, stride, width, height, increment, saturation);
+    SIMD_PERF_API(width*height);
+    simdInterferenceIncrement(width)(statistic, stride, width, height, increment, saturation);
 }
 
+typedef void(*SimdInterferenceIncrementMaskedPtr) (uint8_t * statistic, size_t statisticStride, size_t width, size_t height, uint8_t increment, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index);
+SIMD_DISPATCH_TABLE(SimdInterferenceIncrementMaskedPtr, simdInterferenceIncrementMasked, InterferenceIncrementMasked, SIMD_AVX512BW_ITEM(InterferenceIncrementMasked, 0) SIMD_AVX2_ITEM(InterferenceIncrementMasked, Avx2::A) SIMD_SSE2_ITEM(InterferenceIncrementMasked, Sse2::A) SIMD_VMX_ITEM(InterferenceIncrementMasked, Vmx::A) SIMD_NEON_ITEM(InterferenceIncrementMasked, Neon::A))
+
 SIMD_API void SimdInterferenceIncrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height, 
                                               uint8_t increment, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
-    else
-#endif
-        Base::InterferenceIncrementMasked(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
+    SIMD_PERF_API(width*height);
+    simdInterferenceIncrementMasked(width)(statistic, statisticStride, width, height, increment, saturation, mask, maskStride, index);
 }
 
+typedef void(*SimdInterferenceDecrementPtr) (uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t decrement, int16_t saturation);
+SIMD_DISPATCH_TABLE(SimdInterferenceDecrementPtr, simdInterferenceDecrement, InterferenceDecrement, SIMD_AVX512BW_ITEM(InterferenceDecrement, 0) SIMD_AVX2_ITEM(InterferenceDecrement, Avx2::HA) SIMD_SSE2_ITEM(InterferenceDecrement, Sse2::HA) SIMD_VMX_ITEM(InterferenceDecrement, Vmx::HA) SIMD_NEON_ITEM(InterferenceDecrement, Neon::HA))
+
 SIMD_API void SimdInterferenceDecrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t decrement, int16_t saturation)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
-    else
-#endif
-        Base::InterferenceDecrement(statistic, stride, width, height, decrement, saturation);
+    SIMD_PERF_API(width*height);
+    simdInterferenceDecrement(width)(statistic, stride, width, height, decrement, saturation);
 }
 
+typedef void(*SimdInterferenceDecrementMaskedPtr) (uint8_t * statistic, size_t statisticStride, size_t width, size_t height, uint8_t decrement, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index);
+SIMD_DISPATCH_TABLE(SimdInterferenceDecrementMaskedPtr, simdInterferenceDecrementMasked, InterferenceDecrementMasked, SIMD_AVX512BW_ITEM(InterferenceDecrementMasked, 0) SIMD_AVX2_ITEM(InterferenceDecrementMasked, Avx2::A) SIMD_SSE2_ITEM(InterferenceDecrementMasked, Sse2::A) SIMD_VMX_ITEM(InterferenceDecrementMasked, Vmx::A) SIMD_NEON_ITEM(InterferenceDecrementMasked, Neon::A))
+
 SIMD_API void SimdInterferenceDecrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height, 
                                               uint8_t decrement, int16_t saturation, const uint8_t * mask, size_t maskStride, uint8_t index)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
-    else
-#endif
-        Base::InterferenceDecrementMasked(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
+    SIMD_PERF_API(width*height);
+    simdInterferenceDecrementMasked(width)(statistic, statisticStride, width, height, decrement, saturation, mask, maskStride, index);
 }
 
+typedef void(*SimdInterleaveUvPtr) (const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * uv, size_t uvStride);
+SIMD_DISPATCH_TABLE(SimdInterleaveUvPtr, simdInterleaveUv, InterleaveUv, SIMD_AVX512BW_ITEM(InterleaveUv, 0) SIMD_AVX2_ITEM(InterleaveUv, Avx2::A) SIMD_SSE2_ITEM(InterleaveUv, Sse2::A) SIMD_VMX_ITEM(InterleaveUv, Vmx::A) SIMD_NEON_ITEM(InterleaveUv, Neon::A))
+
 SIMD_API void SimdInterleaveUv(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * uv, size_t uvStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-	if (Avx2::Enable && width >= Avx2::A)
-		Avx2::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
-	else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-	if (Sse2::Enable && width >= Sse2::A)
-		Sse2::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
-	else
-#endif
-#ifdef SIMD_VMX_ENABLE
-	if (Vmx::Enable && width >= Vmx::A)
-		Vmx::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
-	else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
-	else
-#endif
-		Base::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdInterleaveUv(u + begin*uStride, uStride, v + begin*vStride, vStride, width, end - begin, uv + begin*uvStride, uvStride); }))
+        return;
+
+    simdInterleaveUv(width)(u, uStride, v, vStride, width, height, uv, uvStride);
 }
 
+typedef void(*SimdInterleaveBgrPtr) (const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+SIMD_DISPATCH_TABLE(SimdInterleaveBgrPtr, simdInterleaveBgr, InterleaveBgr, SIMD_AVX512BW_ITEM(InterleaveBgr, 0) SIMD_AVX2_ITEM(InterleaveBgr, Avx2::A) SIMD_SSSE3_ITEM(InterleaveBgr, Ssse3::A) SIMD_NEON_ITEM(InterleaveBgr, Neon::A))
+
 SIMD_API void SimdInterleaveBgr(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride,
     size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
-    else
-#endif
-        Base::InterleaveBgr(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
+    SIMD_PERF_API(width*height);
+    simdInterleaveBgr(width)(b, bStride, g, gStride, r, rStride, width, height, bgr, bgrStride);
 }
 
+typedef void(*SimdInterleaveBgraPtr) (const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride);
+SIMD_DISPATCH_TABLE(SimdInterleaveBgraPtr, simdInterleaveBgra, InterleaveBgra, SIMD_AVX512BW_ITEM(InterleaveBgra, 0) SIMD_AVX2_ITEM(InterleaveBgra, Avx2::A) SIMD_SSSE3_ITEM(InterleaveBgra, Ssse3::A) SIMD_NEON_ITEM(InterleaveBgra, Neon::A))
+
 SIMD_API void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_t * g, size_t gStride, const uint8_t * r, size_t rStride, const uint8_t * a, size_t aStride,
     size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A)
-        Avx2::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
-    else
-#endif
-        Base::InterleaveBgra(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
+    SIMD_PERF_API(width*height);
+    simdInterleaveBgra(width)(b, bStride, g, gStride, r, rStride, a, aStride, width, height, bgra, bgraStride);
 }
 
+typedef void(*SimdLaplacePtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdLaplacePtr, simdLaplace, Laplace, SIMD_AVX512BW_ITEM(Laplace, Avx512bw::A + 1) SIMD_AVX2_ITEM(Laplace, Avx2::A + 1) SIMD_SSSE3_ITEM(Laplace, Ssse3::A + 1) SIMD_SSE2_ITEM(Laplace, Sse2::A + 1) SIMD_VMX_ITEM(Laplace, Vmx::A + 1) SIMD_NEON_ITEM(Laplace, Neon::A + 1))
+
 SIMD_API void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width > Avx512bw::A)
-		Avx512bw::Laplace(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A)
-        Sse2::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::Laplace(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width > Neon::A)
-		Neon::Laplace(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-        Base::Laplace(src, srcStride, width, height, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Filter(height, 1, width*sizeof(int16_t), dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdLaplace(src + begin*srcStride, srcStride, width, end - begin, dst, dstStride); }))
+        return;
+
+    simdLaplace(width)(src, srcStride, width, height, dst, dstStride);
 }
 
+typedef void(*SimdLaplaceAbsPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdLaplaceAbsPtr, simdLaplaceAbs, LaplaceAbs, SIMD_AVX512BW_ITEM(LaplaceAbs, Avx512bw::A + 1) SIMD_AVX2_ITEM(LaplaceAbs, Avx2::A + 1) SIMD_SSSE3_ITEM(LaplaceAbs, Ssse3::A + 1) SIMD_VMX_ITEM(LaplaceAbs, Vmx::A + 1) SIMD_NEON_ITEM(LaplaceAbs, Neon::A + 1))
+
 SIMD_API void SimdLaplaceAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width > Avx512bw::A)
-		Avx512bw::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width > Neon::A)
-		Neon::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-        Base::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Filter(height, 1, width*sizeof(uint16_t), dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdLaplaceAbs(src + begin*srcStride, srcStride, width, end - begin, dst, dstStride); }))
+        return;
+
+    simdLaplaceAbs(width)(src, srcStride, width, height, dst, dstStride);
 }
 
+typedef void(*SimdLaplaceAbsSumPtr) (const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+SIMD_DISPATCH_TABLE(SimdLaplaceAbsSumPtr, simdLaplaceAbsSum, LaplaceAbsSum, SIMD_AVX512BW_ITEM(LaplaceAbsSum, Avx512bw::A + 1) SIMD_AVX2_ITEM(LaplaceAbsSum, Avx2::A + 1) SIMD_SSSE3_ITEM(LaplaceAbsSum, Ssse3::A + 1) SIMD_VMX_ITEM(LaplaceAbsSum, Vmx::A + 1) SIMD_NEON_ITEM(LaplaceAbsSum, Neon::A + 1))
+
 SIMD_API void SimdLaplaceAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width > Avx512bw::A)
-		Avx512bw::LaplaceAbsSum(src, stride, width, height, sum);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::LaplaceAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::LaplaceAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::LaplaceAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width > Neon::A)
-		Neon::LaplaceAbsSum(src, stride, width, height, sum);
-	else
-#endif
-        Base::LaplaceAbsSum(src, stride, width, height, sum);
+    SIMD_PERF_API(width*height);
+    simdLaplaceAbsSum(width)(src, stride, width, height, sum);
 }
 
+typedef void(*SimdLbpEstimatePtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdLbpEstimatePtr, simdLbpEstimate, LbpEstimate, SIMD_AVX512BW_ITEM(LbpEstimate, 0) SIMD_AVX2_ITEM(LbpEstimate, Avx2::A + 2) SIMD_SSE2_ITEM(LbpEstimate, Sse2::A + 2) SIMD_VMX_ITEM(LbpEstimate, Vmx::A + 2) SIMD_NEON_ITEM(LbpEstimate, Neon::A + 2))
+
 SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::LbpEstimate(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::LbpEstimate(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::LbpEstimate(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 2)
-        Vmx::LbpEstimate(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A + 2)
-		Neon::LbpEstimate(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-        Base::LbpEstimate(src, srcStride, width, height, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    simdLbpEstimate(width)(src, srcStride, width, height, dst, dstStride);
 }
 
+typedef void(*SimdMeanFilter3x3Ptr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdMeanFilter3x3Ptr, simdMeanFilter3x3, MeanFilter3x3, SIMD_AVX512BW_ITEM(MeanFilter3x3, Avx512bw::A) SIMD_AVX2_ITEM(MeanFilter3x3, Avx2::A) SIMD_SSSE3_ITEM(MeanFilter3x3, Ssse3::A) SIMD_SSE2_ITEM(MeanFilter3x3, Sse2::A) SIMD_VMX_ITEM(MeanFilter3x3, Vmx::A) SIMD_NEON_ITEM(MeanFilter3x3, Neon::A))
+
 SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-		Avx512bw::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-	if (Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-		Avx2::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-	if (Ssse3::Enable && (width - 1)*channelCount >= Ssse3::A)
-		Ssse3::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-	if (Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-		Sse2::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_VMX_ENABLE
-	if (Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-		Vmx::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-        Neon::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-		Base::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Filter(height, 1, width*channelCount, dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdMeanFilter3x3(src + begin*srcStride, srcStride, width, end - begin, channelCount, dst, dstStride); }))
+        return;
+
+    simdMeanFilter3x3((width - 1)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
+typedef void(*SimdMedianFilterRhomb3x3Ptr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdMedianFilterRhomb3x3Ptr, simdMedianFilterRhomb3x3, MedianFilterRhomb3x3, SIMD_AVX512BW_ITEM(MedianFilterRhomb3x3, Avx512bw::A) SIMD_AVX2_ITEM(MedianFilterRhomb3x3, Avx2::A) SIMD_SSE2_ITEM(MedianFilterRhomb3x3, Sse2::A) SIMD_VMX_ITEM(MedianFilterRhomb3x3, Vmx::A) SIMD_NEON_ITEM(MedianFilterRhomb3x3, Neon::A))
+
 SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-		Avx512bw::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-        Avx2::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-        Sse2::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-        Vmx::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-		Neon::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-	else
-#endif
-        Base::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Filter(height, 1, width*channelCount, dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdMedianFilterRhomb3x3(src + begin*srcStride, srcStride, width, end - begin, channelCount, dst, dstStride); }))
+        return;
+
+    simdMedianFilterRhomb3x3((width - 1)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
+typedef void(*SimdMedianFilterRhomb5x5Ptr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdMedianFilterRhomb5x5Ptr, simdMedianFilterRhomb5x5, MedianFilterRhomb5x5, SIMD_AVX512BW_ITEM(MedianFilterRhomb5x5, Avx512bw::A) SIMD_AVX2_ITEM(MedianFilterRhomb5x5, Avx2::A) SIMD_SSE2_ITEM(MedianFilterRhomb5x5, Sse2::A) SIMD_VMX_ITEM(MedianFilterRhomb5x5, Vmx::A) SIMD_NEON_ITEM(MedianFilterRhomb5x5, Neon::A))
+
 SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
-		Avx512bw::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 2)*channelCount >= Avx2::A)
-        Avx2::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 2)*channelCount >= Sse2::A)
-        Sse2::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 2)*channelCount >= Vmx::A)
-        Vmx::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && (width - 2)*channelCount >= Neon::A)
-		Neon::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-	else
-#endif
-        Base::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Filter(height, 2, width*channelCount, dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdMedianFilterRhomb5x5(src + begin*srcStride, srcStride, width, end - begin, channelCount, dst, dstStride); }))
+        return;
+
+    simdMedianFilterRhomb5x5((width - 2)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
+typedef void(*SimdMedianFilterSquare3x3Ptr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdMedianFilterSquare3x3Ptr, simdMedianFilterSquare3x3, MedianFilterSquare3x3, SIMD_AVX512BW_ITEM(MedianFilterSquare3x3, Avx512bw::A) SIMD_AVX2_ITEM(MedianFilterSquare3x3, Avx2::A) SIMD_SSE2_ITEM(MedianFilterSquare3x3, Sse2::A) SIMD_VMX_ITEM(MedianFilterSquare3x3, Vmx::A) SIMD_NEON_ITEM(MedianFilterSquare3x3, Neon::A))
+
 SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-		Avx512bw::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-        Avx2::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-        Sse2::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-        Vmx::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-		Neon::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-	else
-#endif
-        Base::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Filter(height, 1, width*channelCount, dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdMedianFilterSquare3x3(src + begin*srcStride, srcStride, width, end - begin, channelCount, dst, dstStride); }))
+        return;
+
+    simdMedianFilterSquare3x3((width - 1)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
+typedef void(*SimdMedianFilterSquare5x5Ptr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdMedianFilterSquare5x5Ptr, simdMedianFilterSquare5x5, MedianFilterSquare5x5, SIMD_AVX512BW_ITEM(MedianFilterSquare5x5, Avx512bw::A) SIMD_AVX2_ITEM(MedianFilterSquare5x5, Avx2::A) SIMD_SSE2_ITEM(MedianFilterSquare5x5, Sse2::A) SIMD_VMX_ITEM(MedianFilterSquare5x5, Vmx::A) SIMD_NEON_ITEM(MedianFilterSquare5x5, Neon::A))
+
 SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
-		Avx512bw::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 2)*channelCount >= Avx2::A)
-        Avx2::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 2)*channelCount >= Sse2::A)
-        Sse2::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 2)*channelCount >= Vmx::A)
-        Vmx::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && (width - 2)*channelCount >= Neon::A)
-		Neon::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-	else
-#endif
-        Base::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Filter(height, 2, width*channelCount, dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdMedianFilterSquare5x5(src + begin*srcStride, srcStride, width, end - begin, channelCount, dst, dstStride); }))
+        return;
+
+    simdMedianFilterSquare5x5((width - 2)*channelCount)(src, srcStride, width, height, channelCount, dst, dstStride);
+}
+
+typedef void(*SimdMedianFilterPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_PTR(SimdMedianFilterPtr, simdMedianFilter, SIMD_FUNC3(MedianFilter, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC))
+
+SIMD_API void SimdMedianFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+    size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PERF_API(width*height);
+    if (Threads::Filter(height, radius, width*channelCount, dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdMedianFilter(src + begin*srcStride, srcStride, width, end - begin, channelCount, radius, dst, dstStride); }))
+        return;
+
+    simdMedianFilter(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+}
+
+SIMD_API void SimdErode(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+    size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride)
+{
+    SimdMorphology(src, srcStride, width, height, SimdMorphologyErode, SimdMorphologyShapeRect, windowX, windowY, dst, dstStride);
+}
+
+SIMD_API void SimdDilate(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+    size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride)
+{
+    SimdMorphology(src, srcStride, width, height, SimdMorphologyDilate, SimdMorphologyShapeRect, windowX, windowY, dst, dstStride);
+}
+
+SIMD_API void SimdMorphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdMorphologyType type,
+    SimdMorphologyShapeType shape, size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride)
+{
+    SimdMorphologyMasked(src, srcStride, width, height, type, shape, windowX, windowY, NULL, 0, 0, dst, dstStride);
+}
+
+typedef void(*SimdMorphologyMaskedPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdMorphologyType type, SimdMorphologyShapeType shape, size_t windowX, size_t windowY, const uint8_t * mask, size_t maskStride, uint8_t index, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdMorphologyMaskedPtr, simdMorphologyMasked, Morphology, SIMD_AVX512BW_ITEM(Morphology, 0) SIMD_AVX2_ITEM(Morphology, Avx2::A) SIMD_SSE2_ITEM(Morphology, Sse2::A) SIMD_NEON_ITEM(Morphology, Neon::A))
+
+SIMD_API void SimdMorphologyMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdMorphologyType type,
+    SimdMorphologyShapeType shape, size_t windowX, size_t windowY, const uint8_t * mask, size_t maskStride, uint8_t index, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PERF_API(width*height);
+    size_t radius = windowY / 2 * (type == SimdMorphologyOpen || type == SimdMorphologyClose ? 2 : 1);
+    if (Threads::Filter(height, radius, width, dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) 
+        { SimdMorphologyMasked(src + begin*srcStride, srcStride, width, end - begin, type, shape, windowX, windowY, mask ? mask + begin*maskStride : NULL, maskStride, index, dst, dstStride); }))
+        return;
+
+    simdMorphologyMasked(width)(src, srcStride, width, height, type, shape, windowX, windowY, mask, maskStride, index, dst, dstStride);
 }
 
+typedef void(*SimdNeuralConvertPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
+SIMD_DISPATCH_TABLE(SimdNeuralConvertPtr, simdNeuralConvert, NeuralConvert, SIMD_AVX512BW_ITEM(NeuralConvert, Avx512f::F) SIMD_AVX2_ITEM(NeuralConvert, Avx::F) SIMD_SSE2_ITEM(NeuralConvert, Sse2::A) SIMD_VSX_ITEM(NeuralConvert, Vsx::A) SIMD_NEON_ITEM(NeuralConvert, Neon::A))
+
 SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width >= Avx512f::F)
-		Avx512bw::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx::F)
-        Avx2::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A)
-        Sse2::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
-    else
-#endif
-#ifdef SIMD_VSX_ENABLE
-    if (Vsx::Enable && width >= Vsx::A)
-        Vsx::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
-    else
-#endif
-        Base::NeuralConvert(src, srcStride, width, height, dst, dstStride, inversion);
+    SIMD_PERF_API(width*height);
+    simdNeuralConvert(width)(src, srcStride, width, height, dst, dstStride, inversion);
 }
 
 typedef void(*SimdNeuralProductSumPtr) (const float * a, const float * b, size_t size, float * sum);
-SimdNeuralProductSumPtr simdNeuralProductSum = SIMD_FUNC6(NeuralProductSum, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralProductSumPtr, simdNeuralProductSum, SIMD_FUNC6(NeuralProductSum, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdNeuralProductSum(const float * a, const float * b, size_t size, float * sum)
 {
+    SIMD_PERF_API(0);
     simdNeuralProductSum(a, b, size, sum);
 }
 
 typedef void(*SimdNeuralAddVectorMultipliedByValuePtr) (const float * src, size_t size, const float * value, float * dst);
-SimdNeuralAddVectorMultipliedByValuePtr simdNeuralAddVectorMultipliedByValue = SIMD_FUNC5(NeuralAddVectorMultipliedByValue, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralAddVectorMultipliedByValuePtr, simdNeuralAddVectorMultipliedByValue, SIMD_FUNC5(NeuralAddVectorMultipliedByValue, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdNeuralAddVectorMultipliedByValue(const float * src, size_t size, const float * value, float * dst)
 {
+    SIMD_PERF_API(0);
     simdNeuralAddVectorMultipliedByValue(src, size, value, dst);
 }
 
 typedef void(*SimdNeuralAddVectorPtr) (const float * src, size_t size, float * dst);
-SimdNeuralAddVectorPtr simdNeuralAddVector = SIMD_FUNC4(NeuralAddVector, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralAddVectorPtr, simdNeuralAddVector, SIMD_FUNC4(NeuralAddVector, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdNeuralAddVector(const float * src, size_t size, float * dst)
 {
+    SIMD_PERF_API(0);
     simdNeuralAddVector(src, size, dst);
 }
 
 typedef void(*SimdNeuralAddValuePtr) (const float * value, float * dst, size_t size);
-SimdNeuralAddValuePtr simdNeuralAddValue = SIMD_FUNC4(NeuralAddValue, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralAddValuePtr, simdNeuralAddValue, SIMD_FUNC4(NeuralAddValue, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdNeuralAddValue(const float * value, float * dst, size_t size)
 {
+    SIMD_PERF_API(0);
     simdNeuralAddValue(value, dst, size);
 }
 
 typedef void(*SimdNeuralSigmoidPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralSigmoidPtr simdNeuralSigmoid = SIMD_FUNC0(NeuralSigmoid);
+SIMD_DISPATCH_PTR(SimdNeuralSigmoidPtr, simdNeuralSigmoid, SIMD_FUNC0(NeuralSigmoid))
 
 SIMD_API void SimdNeuralSigmoid(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PERF_API(0);
     simdNeuralSigmoid(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralRoughSigmoidPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralRoughSigmoidPtr simdNeuralRoughSigmoid = SIMD_FUNC5(NeuralRoughSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralRoughSigmoidPtr, simdNeuralRoughSigmoid, SIMD_FUNC5(NeuralRoughSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdNeuralRoughSigmoid(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PERF_API(0);
     simdNeuralRoughSigmoid(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralRoughSigmoid2Ptr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralRoughSigmoid2Ptr simdNeuralRoughSigmoid2 = SIMD_FUNC5(NeuralRoughSigmoid2, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralRoughSigmoid2Ptr, simdNeuralRoughSigmoid2, SIMD_FUNC5(NeuralRoughSigmoid2, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdNeuralRoughSigmoid2(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PERF_API(0);
     simdNeuralRoughSigmoid2(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralDerivativeSigmoidPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralDerivativeSigmoidPtr simdNeuralDerivativeSigmoid = SIMD_FUNC4(NeuralDerivativeSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralDerivativeSigmoidPtr, simdNeuralDerivativeSigmoid, SIMD_FUNC4(NeuralDerivativeSigmoid, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdNeuralDerivativeSigmoid(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PERF_API(0);
     simdNeuralDerivativeSigmoid(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralTanhPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralTanhPtr simdNeuralTanh = SIMD_FUNC0(NeuralTanh);
+SIMD_DISPATCH_PTR(SimdNeuralTanhPtr, simdNeuralTanh, SIMD_FUNC0(NeuralTanh))
 
 SIMD_API void SimdNeuralTanh(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PERF_API(0);
     simdNeuralTanh(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralRoughTanhPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralRoughTanhPtr simdNeuralRoughTanh = SIMD_FUNC4(NeuralRoughTanh, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralRoughTanhPtr, simdNeuralRoughTanh, SIMD_FUNC4(NeuralRoughTanh, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdNeuralRoughTanh(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PERF_API(0);
     simdNeuralRoughTanh(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralDerivativeTanhPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralDerivativeTanhPtr simdNeuralDerivativeTanh = SIMD_FUNC4(NeuralDerivativeTanh, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralDerivativeTanhPtr, simdNeuralDerivativeTanh, SIMD_FUNC4(NeuralDerivativeTanh, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdNeuralDerivativeTanh(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PERF_API(0);
     simdNeuralDerivativeTanh(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralReluPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralReluPtr simdNeuralRelu = SIMD_FUNC4(NeuralRelu, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralReluPtr, simdNeuralRelu, SIMD_FUNC4(NeuralRelu, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdNeuralRelu(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PERF_API(0);
     simdNeuralRelu(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralDerivativeReluPtr) (const float * src, size_t size, const float * slope, float * dst);
-SimdNeuralDerivativeReluPtr simdNeuralDerivativeRelu = SIMD_FUNC4(NeuralDerivativeRelu, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralDerivativeReluPtr, simdNeuralDerivativeRelu, SIMD_FUNC4(NeuralDerivativeRelu, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdNeuralDerivativeRelu(const float * src, size_t size, const float * slope, float * dst)
 {
+    SIMD_PERF_API(0);
     simdNeuralDerivativeRelu(src, size, slope, dst);
 }
 
 typedef void(*SimdNeuralUpdateWeightsPtr) (const float * x, size_t size, const float * a, const float * b, float * d, float * w);
-SimdNeuralUpdateWeightsPtr simdNeuralUpdateWeights = SIMD_FUNC4(NeuralUpdateWeights, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralUpdateWeightsPtr, simdNeuralUpdateWeights, SIMD_FUNC4(NeuralUpdateWeights, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdNeuralUpdateWeights(const float * x, size_t size, const float * a, const float * b, float * d, float * w)
 {
+    SIMD_PERF_API(0);
     simdNeuralUpdateWeights(x, size, a, b, d, w);
 }
 
 typedef void(*SimdNeuralAdaptiveGradientUpdatePtr) (const float * delta, size_t size, size_t batch, const float * alpha, const float * epsilon, float * gradient, float * weight);
-SimdNeuralAdaptiveGradientUpdatePtr simdNeuralAdaptiveGradientUpdate = SIMD_FUNC4(NeuralAdaptiveGradientUpdate, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralAdaptiveGradientUpdatePtr, simdNeuralAdaptiveGradientUpdate, SIMD_FUNC4(NeuralAdaptiveGradientUpdate, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdNeuralAdaptiveGradientUpdate(const float * delta, size_t size, size_t batch, const float * alpha, const float * epsilon, float * gradient, float * weight)
 {
+    SIMD_PERF_API(0);
     simdNeuralAdaptiveGradientUpdate(delta, size, batch, alpha, epsilon, gradient, weight);
 }
 
+typedef void(*SimdNeuralAddConvolution2x2ForwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdNeuralAddConvolution2x2ForwardPtr, simdNeuralAddConvolution2x2Forward, NeuralAddConvolution2x2Forward, SIMD_AVX512F_ITEM(NeuralAddConvolution2x2Forward, Avx512f::F) SIMD_AVX2_ITEM(NeuralAddConvolution2x2Forward, Avx2::F) SIMD_AVX_ITEM(NeuralAddConvolution2x2Forward, Avx::F) SIMD_SSE_ITEM(NeuralAddConvolution2x2Forward, Sse::F) SIMD_NEON_ITEM(NeuralAddConvolution2x2Forward, Neon::F))
+
 SIMD_API void SimdNeuralAddConvolution2x2Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512F_ENABLE
-	if (Avx512f::Enable && width >= Avx512f::F)
-		Avx512f::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-        Base::NeuralAddConvolution2x2Forward(src, srcStride, width, height, weights, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    simdNeuralAddConvolution2x2Forward(width)(src, srcStride, width, height, weights, dst, dstStride);
 }
 
+typedef void(*SimdNeuralAddConvolution3x3ForwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdNeuralAddConvolution3x3ForwardPtr, simdNeuralAddConvolution3x3Forward, NeuralAddConvolution3x3Forward, SIMD_AVX512F_ITEM(NeuralAddConvolution3x3Forward, Avx512f::F) SIMD_AVX2_ITEM(NeuralAddConvolution3x3Forward, Avx2::F) SIMD_AVX_ITEM(NeuralAddConvolution3x3Forward, Avx::F) SIMD_SSE_ITEM(NeuralAddConvolution3x3Forward, Sse::F) SIMD_NEON_ITEM(NeuralAddConvolution3x3Forward, Neon::F))
+
 SIMD_API void SimdNeuralAddConvolution3x3Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512F_ENABLE
-	if (Avx512f::Enable && width >= Avx512f::F)
-		Avx512f::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-        Base::NeuralAddConvolution3x3Forward(src, srcStride, width, height, weights, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    simdNeuralAddConvolution3x3Forward(width)(src, srcStride, width, height, weights, dst, dstStride);
 }
 
+typedef void(*SimdNeuralAddConvolution4x4ForwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdNeuralAddConvolution4x4ForwardPtr, simdNeuralAddConvolution4x4Forward, NeuralAddConvolution4x4Forward, SIMD_AVX512F_ITEM(NeuralAddConvolution4x4Forward, Avx512f::F) SIMD_AVX2_ITEM(NeuralAddConvolution4x4Forward, Avx2::F) SIMD_AVX_ITEM(NeuralAddConvolution4x4Forward, Avx::F) SIMD_SSE_ITEM(NeuralAddConvolution4x4Forward, Sse::F) SIMD_NEON_ITEM(NeuralAddConvolution4x4Forward, Neon::F))
+
 SIMD_API void SimdNeuralAddConvolution4x4Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512F_ENABLE
-	if (Avx512f::Enable && width >= Avx512f::F)
-		Avx512f::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-        Base::NeuralAddConvolution4x4Forward(src, srcStride, width, height, weights, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    simdNeuralAddConvolution4x4Forward(width)(src, srcStride, width, height, weights, dst, dstStride);
 }
 
+typedef void(*SimdNeuralAddConvolution5x5ForwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdNeuralAddConvolution5x5ForwardPtr, simdNeuralAddConvolution5x5Forward, NeuralAddConvolution5x5Forward, SIMD_AVX512F_ITEM(NeuralAddConvolution5x5Forward, Avx512f::F) SIMD_AVX2_ITEM(NeuralAddConvolution5x5Forward, Avx2::F) SIMD_AVX_ITEM(NeuralAddConvolution5x5Forward, Avx::F) SIMD_SSE_ITEM(NeuralAddConvolution5x5Forward, Sse::F) SIMD_NEON_ITEM(NeuralAddConvolution5x5Forward, Neon::F))
+
 SIMD_API void SimdNeuralAddConvolution5x5Forward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512F_ENABLE
-	if (Avx512f::Enable && width >= Avx512f::F)
-		Avx512f::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
-    else
-#endif
-        Base::NeuralAddConvolution5x5Forward(src, srcStride, width, height, weights, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    simdNeuralAddConvolution5x5Forward(width)(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 typedef void(*SimdNeuralAddConvolution2x2BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-SimdNeuralAddConvolution2x2BackwardPtr simdNeuralAddConvolution2x2Backward = SIMD_FUNC5(NeuralAddConvolution2x2Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralAddConvolution2x2BackwardPtr, simdNeuralAddConvolution2x2Backward, SIMD_FUNC5(NeuralAddConvolution2x2Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdNeuralAddConvolution2x2Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
+    SIMD_PERF_API(width*height);
     simdNeuralAddConvolution2x2Backward(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 typedef void(*SimdNeuralAddConvolution3x3BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-SimdNeuralAddConvolution3x3BackwardPtr simdNeuralAddConvolution3x3Backward = SIMD_FUNC5(NeuralAddConvolution3x3Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralAddConvolution3x3BackwardPtr, simdNeuralAddConvolution3x3Backward, SIMD_FUNC5(NeuralAddConvolution3x3Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdNeuralAddConvolution3x3Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
+    SIMD_PERF_API(width*height);
     simdNeuralAddConvolution3x3Backward(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 typedef void(*SimdNeuralAddConvolution4x4BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-SimdNeuralAddConvolution4x4BackwardPtr simdNeuralAddConvolution4x4Backward = SIMD_FUNC5(NeuralAddConvolution4x4Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralAddConvolution4x4BackwardPtr, simdNeuralAddConvolution4x4Backward, SIMD_FUNC5(NeuralAddConvolution4x4Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdNeuralAddConvolution4x4Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
+    SIMD_PERF_API(width*height);
     simdNeuralAddConvolution4x4Backward(src, srcStride, width, height, weights, dst, dstStride);
 }
 
 typedef void(*SimdNeuralAddConvolution5x5BackwardPtr) (const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride);
-SimdNeuralAddConvolution5x5BackwardPtr simdNeuralAddConvolution5x5Backward = SIMD_FUNC5(NeuralAddConvolution5x5Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralAddConvolution5x5BackwardPtr, simdNeuralAddConvolution5x5Backward, SIMD_FUNC5(NeuralAddConvolution5x5Backward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdNeuralAddConvolution5x5Backward(const float * src, size_t srcStride, size_t width, size_t height, const float * weights, float * dst, size_t dstStride)
 {
+    SIMD_PERF_API(width*height);
     simdNeuralAddConvolution5x5Backward(src, srcStride, width, height, weights, dst, dstStride);
 }
 
+typedef void(*SimdNeuralAddConvolution2x2SumPtr) (const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+SIMD_DISPATCH_TABLE(SimdNeuralAddConvolution2x2SumPtr, simdNeuralAddConvolution2x2Sum, NeuralAddConvolution2x2Sum, SIMD_AVX512F_ITEM(NeuralAddConvolution2x2Sum, Avx512f::F) SIMD_AVX2_ITEM(NeuralAddConvolution2x2Sum, Avx2::F) SIMD_AVX_ITEM(NeuralAddConvolution2x2Sum, Avx::F) SIMD_SSE3_ITEM(NeuralAddConvolution2x2Sum, Sse3::F) SIMD_SSE_ITEM(NeuralAddConvolution2x2Sum, Sse::F) SIMD_NEON_ITEM(NeuralAddConvolution2x2Sum, Neon::F))
+
 SIMD_API void SimdNeuralAddConvolution2x2Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
 {
-#ifdef SIMD_AVX512F_ENABLE
-	if (Avx512f::Enable && width >= Avx512f::F)
-		Avx512f::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE3_ENABLE
-    if (Sse3::Enable && width >= Sse3::F)
-        Sse3::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-        Base::NeuralAddConvolution2x2Sum(src, srcStride, dst, dstStride, width, height, sums);
+    SIMD_PERF_API(width*height);
+    simdNeuralAddConvolution2x2Sum(width)(src, srcStride, dst, dstStride, width, height, sums);
 }
 
+typedef void(*SimdNeuralAddConvolution3x3SumPtr) (const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+SIMD_DISPATCH_TABLE(SimdNeuralAddConvolution3x3SumPtr, simdNeuralAddConvolution3x3Sum, NeuralAddConvolution3x3Sum, SIMD_AVX512F_ITEM(NeuralAddConvolution3x3Sum, Avx512f::F) SIMD_AVX2_ITEM(NeuralAddConvolution3x3Sum, Avx2::F) SIMD_AVX_ITEM(NeuralAddConvolution3x3Sum, Avx::F) SIMD_SSE3_ITEM(NeuralAddConvolution3x3Sum, Sse3::F) SIMD_SSE_ITEM(NeuralAddConvolution3x3Sum, Sse::F) SIMD_NEON_ITEM(NeuralAddConvolution3x3Sum, Neon::F))
+
 SIMD_API void SimdNeuralAddConvolution3x3Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
 {
-#ifdef SIMD_AVX512F_ENABLE
-	if (Avx512f::Enable && width >= Avx512f::F)
-		Avx512f::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE3_ENABLE
-    if (Sse3::Enable && width >= Sse3::F)
-        Sse3::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-        Base::NeuralAddConvolution3x3Sum(src, srcStride, dst, dstStride, width, height, sums);
+    SIMD_PERF_API(width*height);
+    simdNeuralAddConvolution3x3Sum(width)(src, srcStride, dst, dstStride, width, height, sums);
 }
 
+typedef void(*SimdNeuralAddConvolution4x4SumPtr) (const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+SIMD_DISPATCH_TABLE(SimdNeuralAddConvolution4x4SumPtr, simdNeuralAddConvolution4x4Sum, NeuralAddConvolution4x4Sum, SIMD_AVX512F_ITEM(NeuralAddConvolution4x4Sum, Avx512f::F) SIMD_AVX2_ITEM(NeuralAddConvolution4x4Sum, Avx2::F) SIMD_AVX_ITEM(NeuralAddConvolution4x4Sum, Avx::F) SIMD_SSE3_ITEM(NeuralAddConvolution4x4Sum, Sse3::F) SIMD_SSE_ITEM(NeuralAddConvolution4x4Sum, Sse::F) SIMD_NEON_ITEM(NeuralAddConvolution4x4Sum, Neon::F))
+
 SIMD_API void SimdNeuralAddConvolution4x4Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
 {
-#ifdef SIMD_AVX512F_ENABLE
-	if (Avx512f::Enable && width >= Avx512f::F)
-		Avx512f::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-	if (Avx2::Enable && width >= Avx2::F)
-		Avx2::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-	else
-#endif
-#ifdef SIMD_AVX_ENABLE
-	if (Avx::Enable && width >= Avx::F)
-		Avx::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-	else
-#endif
-#ifdef SIMD_SSE3_ENABLE
-	if (Sse3::Enable && width >= Sse3::F)
-		Sse3::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-	else
-#endif
-#ifdef SIMD_SSE_ENABLE
-	if (Sse::Enable && width >= Sse::F)
-		Sse::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-	else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::F)
-		Neon::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
-	else
-#endif
-		Base::NeuralAddConvolution4x4Sum(src, srcStride, dst, dstStride, width, height, sums);
+    SIMD_PERF_API(width*height);
+    simdNeuralAddConvolution4x4Sum(width)(src, srcStride, dst, dstStride, width, height, sums);
 }
 
+typedef void(*SimdNeuralAddConvolution5x5SumPtr) (const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums);
+SIMD_DISPATCH_TABLE(SimdNeuralAddConvolution5x5SumPtr, simdNeuralAddConvolution5x5Sum, NeuralAddConvolution5x5Sum, SIMD_AVX512F_ITEM(NeuralAddConvolution5x5Sum, Avx512f::F) SIMD_AVX2_ITEM(NeuralAddConvolution5x5Sum, Avx2::F) SIMD_AVX_ITEM(NeuralAddConvolution5x5Sum, Avx::F) SIMD_SSE3_ITEM(NeuralAddConvolution5x5Sum, Sse3::F) SIMD_SSE_ITEM(NeuralAddConvolution5x5Sum, Sse::F) SIMD_NEON_ITEM(NeuralAddConvolution5x5Sum, Neon::F))
+
 SIMD_API void SimdNeuralAddConvolution5x5Sum(const float * src, size_t srcStride, const float * dst, size_t dstStride, size_t width, size_t height, float * sums)
 {
-#ifdef SIMD_AVX512F_ENABLE
-	if (Avx512f::Enable && width >= Avx512f::F)
-		Avx512f::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::F)
-        Avx2::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::F)
-        Avx::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE3_ENABLE
-    if (Sse3::Enable && width >= Sse3::F)
-        Sse3::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::F)
-        Sse::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::F)
-        Neon::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
-    else
-#endif
-        Base::NeuralAddConvolution5x5Sum(src, srcStride, dst, dstStride, width, height, sums);
+    SIMD_PERF_API(width*height);
+    simdNeuralAddConvolution5x5Sum(width)(src, srcStride, dst, dstStride, width, height, sums);
 }
 
+typedef void(*SimdNeuralPooling1x1Max3x3Ptr) (const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdNeuralPooling1x1Max3x3Ptr, simdNeuralPooling1x1Max3x3, NeuralPooling1x1Max3x3, SIMD_AVX512F_ITEM(NeuralPooling1x1Max3x3, Avx512f::F + 1) SIMD_AVX2_ITEM(NeuralPooling1x1Max3x3, Avx2::F + 1) SIMD_SSE_ITEM(NeuralPooling1x1Max3x3, Sse::F + 1) SIMD_NEON_ITEM(NeuralPooling1x1Max3x3, Neon::F + 1))
+
 SIMD_API void SimdNeuralPooling1x1Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512F_ENABLE
-	if (Avx512f::Enable && width > Avx512f::F)
-		Avx512f::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width > Avx2::F)
-        Avx2::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width > Sse::F)
-        Sse::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::F)
-        Neon::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::NeuralPooling1x1Max3x3(src, srcStride, width, height, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    simdNeuralPooling1x1Max3x3(width)(src, srcStride, width, height, dst, dstStride);
 }
 
+typedef void(*SimdNeuralPooling2x2Max2x2Ptr) (const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdNeuralPooling2x2Max2x2Ptr, simdNeuralPooling2x2Max2x2, NeuralPooling2x2Max2x2, SIMD_AVX512F_ITEM(NeuralPooling2x2Max2x2, Avx512f::DF) SIMD_AVX_ITEM(NeuralPooling2x2Max2x2, Avx::DF) SIMD_SSE_ITEM(NeuralPooling2x2Max2x2, Sse::DF) SIMD_NEON_ITEM(NeuralPooling2x2Max2x2, Neon::DF))
+
 SIMD_API void SimdNeuralPooling2x2Max2x2(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512F_ENABLE
-	if (Avx512f::Enable && width >= Avx512f::DF)
-		Avx512f::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if (Avx::Enable && width >= Avx::DF)
-        Avx::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width >= Sse::DF)
-        Sse::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::DF)
-        Neon::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::NeuralPooling2x2Max2x2(src, srcStride, width, height, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    simdNeuralPooling2x2Max2x2(width)(src, srcStride, width, height, dst, dstStride);
 }
 
+typedef void(*SimdNeuralPooling2x2Max3x3Ptr) (const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdNeuralPooling2x2Max3x3Ptr, simdNeuralPooling2x2Max3x3, NeuralPooling2x2Max3x3, SIMD_AVX512F_ITEM(NeuralPooling2x2Max3x3, Avx512f::DF + 1) SIMD_AVX2_ITEM(NeuralPooling2x2Max3x3, Avx2::DF + 1) SIMD_SSE_ITEM(NeuralPooling2x2Max3x3, Sse::DF + 1) SIMD_NEON_ITEM(NeuralPooling2x2Max3x3, Neon::DF + 1))
+
 SIMD_API void SimdNeuralPooling2x2Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512F_ENABLE
-	if (Avx512f::Enable && width > Avx512f::DF)
-		Avx512f::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width > Avx2::DF)
-        Avx2::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE_ENABLE
-    if (Sse::Enable && width > Sse::DF)
-        Sse::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::DF)
-        Neon::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-        Base::NeuralPooling2x2Max3x3(src, srcStride, width, height, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    simdNeuralPooling2x2Max3x3(width)(src, srcStride, width, height, dst, dstStride);
 }
 
 typedef void(*SimdNeuralConvolutionForwardPtr) (const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, 
     const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, 
     void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
-volatile SimdNeuralConvolutionForwardPtr simdNeuralConvolutionForward = SIMD_FUNC3(NeuralConvolutionForward, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE3_FUNC);
+SIMD_DISPATCH_PTR(SimdNeuralConvolutionForwardPtr, simdNeuralConvolutionForward, SIMD_FUNC3(NeuralConvolutionForward, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE3_FUNC))
 
 SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, 
     const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, 
     void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add)
 {
+    SIMD_PERF_API(srcWidth*srcHeight);
     simdNeuralConvolutionForward(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
 }
 
+typedef void(*SimdNv12ToBgrPtr) (const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+SIMD_DISPATCH_TABLE(SimdNv12ToBgrPtr, simdNv12ToBgr, Nv12ToBgr, SIMD_AVX512BW_ITEM(Nv12ToBgr, Avx512bw::A) SIMD_AVX2_ITEM(Nv12ToBgr, Avx2::DA) SIMD_SSSE3_ITEM(Nv12ToBgr, Ssse3::DA) SIMD_NEON_ITEM(Nv12ToBgr, Neon::DA))
+
+SIMD_API void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+{
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 2, [=](size_t begin, size_t end) { SimdNv12ToBgr(y + begin*yStride, yStride, uv + begin/2*uvStride, uvStride, width, end - begin, bgr + begin*bgrStride, bgrStride); }))
+        return;
+
+    simdNv12ToBgr(width)(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+}
+
+typedef void(*SimdNv12ToBgraPtr) (const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+SIMD_DISPATCH_TABLE(SimdNv12ToBgraPtr, simdNv12ToBgra, Nv12ToBgra, SIMD_AVX512BW_ITEM(Nv12ToBgra, Avx512bw::A) SIMD_AVX2_ITEM(Nv12ToBgra, Avx2::DA) SIMD_SSE2_ITEM(Nv12ToBgra, Sse2::DA) SIMD_NEON_ITEM(Nv12ToBgra, Neon::DA))
+
+SIMD_API void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+{
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 2, [=](size_t begin, size_t end) { SimdNv12ToBgra(y + begin*yStride, yStride, uv + begin/2*uvStride, uvStride, width, end - begin, bgra + begin*bgraStride, bgraStride, alpha); }))
+        return;
+
+    simdNv12ToBgra(width)(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+}
+
+typedef void(*SimdOperationBinary8uPtr) (const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
+SIMD_DISPATCH_TABLE(SimdOperationBinary8uPtr, simdOperationBinary8u, OperationBinary8u, SIMD_AVX512BW_ITEM(OperationBinary8u, 0) SIMD_AVX2_ITEM(OperationBinary8u, Avx2::A) SIMD_SSE2_ITEM(OperationBinary8u, Sse2::A) SIMD_VMX_ITEM(OperationBinary8u, Vmx::A) SIMD_NEON_ITEM(OperationBinary8u, Neon::A) SIMD_MSA_ITEM(OperationBinary8u, Msa::A))
+
 SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
                size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width*channelCount >= Avx2::A)
-        Avx2::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width*channelCount >= Sse2::A)
-        Sse2::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width*channelCount >= Vmx::A)
-        Vmx::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width*channelCount >= Neon::A)
-		Neon::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-	else
-#endif
-#ifdef SIMD_MSA_ENABLE
-    if (Msa::Enable && width*channelCount >= Msa::A)
-        Msa::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
-#endif
-        Base::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdOperationBinary8u(a + begin*aStride, aStride, b + begin*bStride, bStride, width, end - begin, channelCount, dst + begin*dstStride, dstStride, type); }))
+        return;
+
+    simdOperationBinary8u(width*channelCount)(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
 }
 
+typedef void(*SimdOperationBinary16iPtr) (const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type);
+SIMD_DISPATCH_TABLE(SimdOperationBinary16iPtr, simdOperationBinary16i, OperationBinary16i, SIMD_AVX512BW_ITEM(OperationBinary16i, 0) SIMD_AVX2_ITEM(OperationBinary16i, Avx2::HA) SIMD_SSE2_ITEM(OperationBinary16i, Sse2::HA) SIMD_VMX_ITEM(OperationBinary16i, Vmx::HA) SIMD_NEON_ITEM(OperationBinary16i, Neon::HA) SIMD_MSA_ITEM(OperationBinary16i, Msa::HA))
+
 SIMD_API void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
                                     size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::HA)
-		Neon::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-	else
-#endif
-#ifdef SIMD_MSA_ENABLE
-    if (Msa::Enable && width >= Msa::HA)
-        Msa::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
-#endif
-		Base::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+    SIMD_PERF_API(width*height);
+    simdOperationBinary16i(width)(a, aStride, b, bStride, width, height, dst, dstStride, type);
 }
 
+typedef void(*SimdVectorProductPtr) (const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height);
+SIMD_DISPATCH_TABLE(SimdVectorProductPtr, simdVectorProduct, VectorProduct, SIMD_AVX512BW_ITEM(VectorProduct, 0) SIMD_AVX2_ITEM(VectorProduct, Avx2::A) SIMD_SSE2_ITEM(VectorProduct, Sse2::A) SIMD_VMX_ITEM(VectorProduct, Vmx::A) SIMD_NEON_ITEM(VectorProduct, Neon::A))
+
 SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::VectorProduct(vertical, horizontal, dst, stride, width, height);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::VectorProduct(vertical, horizontal, dst, stride, width, height);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::VectorProduct(vertical, horizontal, dst, stride, width, height);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::VectorProduct(vertical, horizontal, dst, stride, width, height);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::VectorProduct(vertical, horizontal, dst, stride, width, height);
-	else
-#endif
-        Base::VectorProduct(vertical, horizontal, dst, stride, width, height);
+    SIMD_PERF_API(width*height);
+    simdVectorProduct(width)(vertical, horizontal, dst, stride, width, height);
 }
 
 SIMD_API void SimdPseudoHogExtractHistogram8x8x8(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * histogram, size_t histogramStride)
 {
+    SIMD_PERF_API(width*height);
 	Base::PseudoHogExtractHistogram8x8x8(src, srcStride, width, height, histogram, histogramStride);
 }
 
+typedef void(*SimdReduceGray2x2Ptr) (const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdReduceGray2x2Ptr, simdReduceGray2x2, ReduceGray2x2, SIMD_AVX512BW_ITEM(ReduceGray2x2, 0) SIMD_AVX2_ITEM(ReduceGray2x2, Avx2::DA) SIMD_SSSE3_ITEM(ReduceGray2x2, Ssse3::DA) SIMD_SSE2_ITEM(ReduceGray2x2, Sse2::DA) SIMD_VMX_ITEM(ReduceGray2x2, Vmx::DA) SIMD_NEON_ITEM(ReduceGray2x2, Neon::DA))
+
 SIMD_API void SimdReduceGray2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && srcWidth >= Avx2::DA)
-        Avx2::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && srcWidth >= Ssse3::DA)
-        Ssse3::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && srcWidth >= Sse2::DA)
-        Sse2::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && srcWidth >= Vmx::DA)
-        Vmx::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && srcWidth >= Neon::DA)
-		Neon::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-	else
-#endif
-        Base::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+    SIMD_PERF_API(srcWidth*srcHeight);
+    if (Threads::Rows(dstHeight, 1, [=](size_t begin, size_t end) { SimdReduceGray2x2(src + 2*begin*srcStride, srcWidth, std::min(2*end, srcHeight) - 2*begin, srcStride, dst + begin*dstStride, dstWidth, end - begin, dstStride); }))
+        return;
+
+    simdReduceGray2x2(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
 }
 
+typedef void(*SimdReduceGray3x3Ptr) (const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
+SIMD_DISPATCH_TABLE(SimdReduceGray3x3Ptr, simdReduceGray3x3, ReduceGray3x3, SIMD_AVX512BW_ITEM(ReduceGray3x3, Avx512bw::DA) SIMD_AVX2_ITEM(ReduceGray3x3, Avx2::DA) SIMD_SSE2_ITEM(ReduceGray3x3, Sse2::A) SIMD_VMX_ITEM(ReduceGray3x3, Vmx::DA) SIMD_NEON_ITEM(ReduceGray3x3, Neon::DA))
+
 SIMD_API void SimdReduceGray3x3(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && srcWidth >= Avx512bw::DA)
-		Avx512bw::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && srcWidth >= Avx2::DA)
-        Avx2::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && srcWidth >= Sse2::A)
-        Sse2::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && srcWidth >= Vmx::DA)
-        Vmx::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && srcWidth >= Neon::DA)
-		Neon::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-	else
-#endif
-        Base::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
+    SIMD_PERF_API(srcWidth*srcHeight);
+    if (Threads::Filter(dstHeight, 1, dstWidth, dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdReduceGray3x3(src + 2*begin*srcStride, srcWidth, std::min(2*end, srcHeight) - 2*begin, srcStride, dst, dstWidth, end - begin, dstStride, compensation); }))
+        return;
+
+    simdReduceGray3x3(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
 }
 
+typedef void(*SimdReduceGray4x4Ptr) (const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdReduceGray4x4Ptr, simdReduceGray4x4, ReduceGray4x4, SIMD_AVX512BW_ITEM(ReduceGray4x4, Avx512bw::DA + 1) SIMD_AVX2_ITEM(ReduceGray4x4, Avx2::DA + 1) SIMD_SSSE3_ITEM(ReduceGray4x4, Ssse3::A + 1) SIMD_SSE2_ITEM(ReduceGray4x4, Sse2::A + 1) SIMD_VMX_ITEM(ReduceGray4x4, Vmx::DA) SIMD_NEON_ITEM(ReduceGray4x4, Neon::DA))
+
 SIMD_API void SimdReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && srcWidth > Avx512bw::DA)
-		Avx512bw::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && srcWidth > Avx2::DA)
-        Avx2::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && srcWidth > Ssse3::A)
-        Ssse3::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && srcWidth > Sse2::A)
-        Sse2::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && srcWidth >= Vmx::DA)
-        Vmx::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && srcWidth >= Neon::DA)
-		Neon::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-	else
-#endif
-        Base::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+    SIMD_PERF_API(srcWidth*srcHeight);
+    if (Threads::Filter(dstHeight, 1, dstWidth, dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdReduceGray4x4(src + 2*begin*srcStride, srcWidth, std::min(2*end, srcHeight) - 2*begin, srcStride, dst, dstWidth, end - begin, dstStride); }))
+        return;
+
+    simdReduceGray4x4(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
 }
 
+typedef void(*SimdReduceGray5x5Ptr) (const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
+SIMD_DISPATCH_TABLE(SimdReduceGray5x5Ptr, simdReduceGray5x5, ReduceGray5x5, SIMD_AVX512BW_ITEM(ReduceGray5x5, Avx512bw::DA) SIMD_AVX2_ITEM(ReduceGray5x5, Avx2::DA) SIMD_SSE2_ITEM(ReduceGray5x5, Sse2::A) SIMD_VMX_ITEM(ReduceGray5x5, Vmx::DA) SIMD_NEON_ITEM(ReduceGray5x5, Neon::DA))
+
 SIMD_API void SimdReduceGray5x5(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && srcWidth >= Avx512bw::DA)
-		Avx512bw::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && srcWidth >= Avx2::DA)
-        Avx2::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && srcWidth >= Sse2::A)
-        Sse2::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && srcWidth >= Vmx::DA)
-        Vmx::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && srcWidth >= Neon::DA)
-		Neon::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
-	else
-#endif
-		Base::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
+    SIMD_PERF_API(srcWidth*srcHeight);
+    if (Threads::Filter(dstHeight, 1, dstWidth, dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdReduceGray5x5(src + 2*begin*srcStride, srcWidth, std::min(2*end, srcHeight) - 2*begin, srcStride, dst, dstWidth, end - begin, dstStride, compensation); }))
+        return;
+
+    simdReduceGray5x5(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, compensation);
 }
 
+typedef void(*SimdReorder16bitPtr) (const uint8_t * src, size_t size, uint8_t * dst);
+SIMD_DISPATCH_TABLE(SimdReorder16bitPtr, simdReorder16bit, Reorder16bit, SIMD_AVX512BW_ITEM(Reorder16bit, 0) SIMD_AVX2_ITEM(Reorder16bit, Avx2::A) SIMD_SSSE3_ITEM(Reorder16bit, Ssse3::A) SIMD_SSE2_ITEM(Reorder16bit, Sse2::A) SIMD_VMX_ITEM(Reorder16bit, Vmx::A) SIMD_NEON_ITEM(Reorder16bit, Neon::A))
+
 SIMD_API void SimdReorder16bit(const uint8_t * src, size_t size, uint8_t * dst)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Reorder16bit(src, size, dst);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && size >= Avx2::A)
-        Avx2::Reorder16bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && size >= Ssse3::A)
-        Ssse3::Reorder16bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && size >= Sse2::A)
-        Sse2::Reorder16bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && size >= Vmx::A)
-        Vmx::Reorder16bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && size >= Neon::A)
-		Neon::Reorder16bit(src, size, dst);
-	else
-#endif
-        Base::Reorder16bit(src, size, dst);
+    SIMD_PERF_API(0);
+    simdReorder16bit(size)(src, size, dst);
 }
 
+typedef void(*SimdReorder32bitPtr) (const uint8_t * src, size_t size, uint8_t * dst);
+SIMD_DISPATCH_TABLE(SimdReorder32bitPtr, simdReorder32bit, Reorder32bit, SIMD_AVX512BW_ITEM(Reorder32bit, 0) SIMD_AVX2_ITEM(Reorder32bit, Avx2::A) SIMD_SSSE3_ITEM(Reorder32bit, Ssse3::A) SIMD_SSE2_ITEM(Reorder32bit, Sse2::A) SIMD_VMX_ITEM(Reorder32bit, Vmx::A) SIMD_NEON_ITEM(Reorder32bit, Neon::A))
+
 SIMD_API void SimdReorder32bit(const uint8_t * src, size_t size, uint8_t * dst)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Reorder32bit(src, size, dst);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && size >= Avx2::A)
-        Avx2::Reorder32bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && size >= Ssse3::A)
-        Ssse3::Reorder32bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && size >= Sse2::A)
-        Sse2::Reorder32bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && size >= Vmx::A)
-        Vmx::Reorder32bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && size >= Neon::A)
-		Neon::Reorder32bit(src, size, dst);
-	else
-#endif
-        Base::Reorder32bit(src, size, dst);
+    SIMD_PERF_API(0);
+    simdReorder32bit(size)(src, size, dst);
 }
 
+typedef void(*SimdReorder64bitPtr) (const uint8_t * src, size_t size, uint8_t * dst);
+SIMD_DISPATCH_TABLE(SimdReorder64bitPtr, simdReorder64bit, Reorder64bit, SIMD_AVX512BW_ITEM(Reorder64bit, 0) SIMD_AVX2_ITEM(Reorder64bit, Avx2::A) SIMD_SSSE3_ITEM(Reorder64bit, Ssse3::A) SIMD_SSE2_ITEM(Reorder64bit, Sse2::A) SIMD_VMX_ITEM(Reorder64bit, Vmx::A) SIMD_NEON_ITEM(Reorder64bit, Neon::A))
+
 SIMD_API void SimdReorder64bit(const uint8_t * src, size_t size, uint8_t * dst)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Reorder64bit(src, size, dst);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && size >= Avx2::A)
-        Avx2::Reorder64bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && size >= Ssse3::A)
-        Ssse3::Reorder64bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && size >= Sse2::A)
-        Sse2::Reorder64bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && size >= Vmx::A)
-        Vmx::Reorder64bit(src, size, dst);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && size >= Neon::A)
-		Neon::Reorder64bit(src, size, dst);
-	else
-#endif
-        Base::Reorder64bit(src, size, dst);
+    SIMD_PERF_API(0);
+    simdReorder64bit(size)(src, size, dst);
+}
+
+typedef void(*SimdResizeAreaPtr) (const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
+SIMD_DISPATCH_TABLE(SimdResizeAreaPtr, simdResizeArea, ResizeArea, SIMD_AVX512BW_ITEM(ResizeArea, Avx512bw::A) SIMD_AVX2_ITEM(ResizeArea, Avx2::A) SIMD_SSE2_ITEM(ResizeArea, Sse2::A) SIMD_NEON_ITEM(ResizeArea, Neon::A))
+
+SIMD_API void SimdResizeArea(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+{
+    SIMD_PERF_API(srcWidth*srcHeight);
+    simdResizeArea(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+}
+
+typedef void(*SimdResizeBicubicPtr) (const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
+SIMD_DISPATCH_TABLE(SimdResizeBicubicPtr, simdResizeBicubic, ResizeBicubic, SIMD_AVX512BW_ITEM(ResizeBicubic, Avx512bw::A) SIMD_AVX2_ITEM(ResizeBicubic, Avx2::A) SIMD_SSE2_ITEM(ResizeBicubic, Sse2::A) SIMD_NEON_ITEM(ResizeBicubic, Neon::A))
+
+SIMD_API void SimdResizeBicubic(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+{
+    SIMD_PERF_API(srcWidth*srcHeight);
+    simdResizeBicubic(dstWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
 }
 
+typedef void(*SimdResizeBilinearPtr) (const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
+SIMD_DISPATCH_TABLE(SimdResizeBilinearPtr, simdResizeBilinear, ResizeBilinear, SIMD_AVX512BW_ITEM(ResizeBilinear, Avx512bw::A) SIMD_AVX2_ITEM(ResizeBilinear, Avx2::A) SIMD_SSSE3_ITEM(ResizeBilinear, Ssse3::A) SIMD_SSE2_ITEM(ResizeBilinear, Sse2::A) SIMD_VMX_ITEM(ResizeBilinear, Vmx::A) SIMD_NEON_ITEM(ResizeBilinear, Neon::A))
+
 SIMD_API void SimdResizeBilinear(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
     uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && dstWidth >= Avx2::A)
-        Avx2::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && dstWidth >= Ssse3::A)
-        Ssse3::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && dstWidth >= Sse2::A)
-        Sse2::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && dstWidth >= Vmx::A)
-        Vmx::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+    SIMD_PERF_API(srcWidth*srcHeight);
+    simdResizeBilinear(dstWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+}
+
+typedef void *(*SimdResizerInitPtr) (size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method);
+SIMD_DISPATCH_TABLE(SimdResizerInitPtr, simdResizerInit, ResizerInit, SIMD_AVX512BW_ITEM(ResizerInit, Avx512bw::A) SIMD_AVX2_ITEM(ResizerInit, Avx2::A) SIMD_SSSE3_ITEM(ResizerInit, Ssse3::A) SIMD_SSE2_ITEM(ResizerInit, Sse2::A) SIMD_VMX_ITEM(ResizerInit, Vmx::A) SIMD_NEON_ITEM(ResizerInit, Neon::A))
+
+static void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method)
+{
+    size_t width = method == SimdResizeMethodArea ? srcX : dstX;
+    return simdResizerInit(width)(srcX, srcY, dstX, dstY, channels, method);
+}
+
+SIMD_API void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method)
+{
+    SIMD_PERF_API(0);
+    return ResizerInit(srcX, srcY, dstX, dstY, channels, method);
+}
+
+SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    Base::Resizer * r = (Base::Resizer*)resizer;
+    SIMD_PERF_API(r->Param().srcW*r->Param().srcH);
+    r->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API void SimdResizerFree(void * resizer)
+{
+    SIMD_PERF_API(0);
+    delete (Base::Resizer*)resizer;
+}
+
+SIMD_API void SimdCropResizeBatch(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t channels,
+    const ptrdiff_t * rects, size_t count, size_t dstWidth, size_t dstHeight, SimdResizeMethodType method,
+    SimdCropResizeOutputType output, float scale, float shift, void * dst)
+{
+    SIMD_PERF_API(count*dstWidth*dstHeight);
+    size_t size = dstWidth*dstHeight*channels;
+    size_t itemSize = size*(output == SimdCropResizeOutputUint8 ? 1 : sizeof(float));
+    auto run = [&](size_t begin, size_t end)
+    {
+        Base::Resizer * resizer = NULL;
+        for (size_t i = begin; i < end; ++i)
+        {
+            const ptrdiff_t * rect = rects + 4 * i;
+            ptrdiff_t left = std::max<ptrdiff_t>(rect[0], 0), top = std::max<ptrdiff_t>(rect[1], 0);
+            ptrdiff_t right = std::min<ptrdiff_t>(rect[2], srcWidth), bottom = std::min<ptrdiff_t>(rect[3], srcHeight);
+            uint8_t * item = (uint8_t*)dst + i*itemSize;
+            if (left < right && top < bottom)
+            {
+                if (resizer == NULL || resizer->Param().srcW != size_t(right - left) || resizer->Param().srcH != size_t(bottom - top))
+                {
+                    delete resizer;
+                    resizer = (Base::Resizer*)ResizerInit(right - left, bottom - top, dstWidth, dstHeight, channels, method);
+                }
+                const uint8_t * crop = src + top*srcStride + left*channels;
+                if (output == SimdCropResizeOutputUint8)
+                    resizer->Run(crop, srcStride, item, dstWidth*channels);
+                else
+                    resizer->Run32f(crop, srcStride, (float*)item, output, scale, shift);
+            }
+            else if (output == SimdCropResizeOutputUint8)
+                memset(item, 0, size);
+            else
+                std::fill((float*)item, (float*)item + size, shift);
+        }
+        delete resizer;
+    };
+    size_t number = Threads::Nested ? 1 : std::min(Threads::Number, count);
+    if (number > 1)
+    {
+        Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+        {
+            Threads::NestedGuard guard;
+            run(begin, end);
+        }, number);
+    }
     else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && dstWidth >= Neon::A)
-		Neon::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
-	else
-#endif
-        Base::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+        run(0, count);
 }
 
+typedef void(*SimdSegmentationChangeIndexPtr) (uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex);
+SIMD_DISPATCH_TABLE(SimdSegmentationChangeIndexPtr, simdSegmentationChangeIndex, SegmentationChangeIndex, SIMD_AVX512BW_ITEM(SegmentationChangeIndex, 0) SIMD_AVX2_ITEM(SegmentationChangeIndex, Avx2::A) SIMD_SSE2_ITEM(SegmentationChangeIndex, Sse2::A) SIMD_VMX_ITEM(SegmentationChangeIndex, Vmx::A) SIMD_NEON_ITEM(SegmentationChangeIndex, Neon::A))
+
 SIMD_API void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
-	else
-#endif
-        Base::SegmentationChangeIndex(mask, stride, width, height, oldIndex, newIndex);
+    SIMD_PERF_API(width*height);
+    simdSegmentationChangeIndex(width)(mask, stride, width, height, oldIndex, newIndex);
 }
 
+typedef void(*SimdSegmentationFillSingleHolesPtr) (uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index);
+SIMD_DISPATCH_TABLE(SimdSegmentationFillSingleHolesPtr, simdSegmentationFillSingleHoles, SegmentationFillSingleHoles, SIMD_AVX512BW_ITEM(SegmentationFillSingleHoles, 0) SIMD_AVX2_ITEM(SegmentationFillSingleHoles, Avx2::A + 3) SIMD_SSE2_ITEM(SegmentationFillSingleHoles, Sse2::A + 3) SIMD_VMX_ITEM(SegmentationFillSingleHoles, Vmx::A + 3) SIMD_NEON_ITEM(SegmentationFillSingleHoles, Neon::A + 3))
+
 SIMD_API void SimdSegmentationFillSingleHoles(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::SegmentationFillSingleHoles(mask, stride, width, height, index);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A + 2)
-        Avx2::SegmentationFillSingleHoles(mask, stride, width, height, index);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A + 2)
-        Sse2::SegmentationFillSingleHoles(mask, stride, width, height, index);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A + 2)
-        Vmx::SegmentationFillSingleHoles(mask, stride, width, height, index);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-		if (Neon::Enable && width > Neon::A + 2)
-			Neon::SegmentationFillSingleHoles(mask, stride, width, height, index);
-		else
-#endif
-        Base::SegmentationFillSingleHoles(mask, stride, width, height, index);
+    SIMD_PERF_API(width*height);
+    simdSegmentationFillSingleHoles(width)(mask, stride, width, height, index);
 }
 
+typedef void(*SimdSegmentationPropagate2x2Ptr) (const uint8_t * parent, size_t parentStride, size_t width, size_t height, uint8_t * child, size_t childStride, const uint8_t * difference, size_t differenceStride, uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold);
+SIMD_DISPATCH_TABLE(SimdSegmentationPropagate2x2Ptr, simdSegmentationPropagate2x2, SegmentationPropagate2x2, SIMD_AVX512BW_ITEM(SegmentationPropagate2x2, 0) SIMD_AVX2_ITEM(SegmentationPropagate2x2, Avx2::A + 1) SIMD_SSE2_ITEM(SegmentationPropagate2x2, Sse2::A + 1) SIMD_VMX_ITEM(SegmentationPropagate2x2, Vmx::A + 1) SIMD_NEON_ITEM(SegmentationPropagate2x2, Neon::A + 1))
+
 SIMD_API void SimdSegmentationPropagate2x2(const uint8_t * parent, size_t parentStride, size_t width, size_t height, 
                                            uint8_t * child, size_t childStride, const uint8_t * difference, size_t differenceStride, 
                                            uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
-		difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A + 1)
-        Avx2::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
-        difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A + 1)
-        Sse2::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
-        difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A + 1)
-        Vmx::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
-        difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A + 1)
-		Neon::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
-			difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
-	else
-#endif
-        Base::SegmentationPropagate2x2(parent, parentStride, width, height, child, childStride,
-        difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
+    SIMD_PERF_API(width*height);
+    simdSegmentationPropagate2x2(width)(parent, parentStride, width, height, child, childStride, difference, differenceStride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
 }
 
+typedef void(*SimdSegmentationShrinkRegionPtr) (const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index, ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom);
+SIMD_DISPATCH_TABLE(SimdSegmentationShrinkRegionPtr, simdSegmentationShrinkRegion, SegmentationShrinkRegion, SIMD_AVX512BW_ITEM(SegmentationShrinkRegion, 0) SIMD_AVX2_ITEM(SegmentationShrinkRegion, Avx2::A) SIMD_SSE41_ITEM(SegmentationShrinkRegion, Sse41::A) SIMD_VMX_ITEM(SegmentationShrinkRegion, Vmx::A) SIMD_NEON_ITEM(SegmentationShrinkRegion, Neon::A))
+
 SIMD_API void SimdSegmentationShrinkRegion(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
                                            ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::SegmentationShrinkRegion(mask, stride, width, height, index, left, top, right, bottom);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A && *right - *left >= (ptrdiff_t)Avx2::A)
-        Avx2::SegmentationShrinkRegion(mask, stride, width, height, index, left, top, right, bottom);
-    else
-#endif
-#ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::A && *right - *left >= (ptrdiff_t)Sse41::A)
-        Sse41::SegmentationShrinkRegion(mask, stride, width, height, index, left, top, right, bottom);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A && *right - *left >= (ptrdiff_t)Vmx::A)
-        Vmx::SegmentationShrinkRegion(mask, stride, width, height, index, left, top, right, bottom);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A && *right - *left >= (ptrdiff_t)Neon::A)
-        Neon::SegmentationShrinkRegion(mask, stride, width, height, index, left, top, right, bottom);
-    else
-#endif
-        Base::SegmentationShrinkRegion(mask, stride, width, height, index, left, top, right, bottom);
+    SIMD_PERF_API(width*height);
+    simdSegmentationShrinkRegion(std::min<size_t>(width, std::max<ptrdiff_t>(*right - *left, 0)))(mask, stride, width, height, index, left, top, right, bottom);
 }
 
+typedef void(*SimdShiftBilinearPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, const uint8_t * bkg, size_t bkgStride, const double * shiftX, const double * shiftY, size_t cropLeft, size_t cropTop, size_t cropRight, size_t cropBottom, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdShiftBilinearPtr, simdShiftBilinear, ShiftBilinear, SIMD_AVX512BW_ITEM(ShiftBilinear, 0) SIMD_AVX2_ITEM(ShiftBilinear, 0) SIMD_SSE2_ITEM(ShiftBilinear, 0) SIMD_VMX_ITEM(ShiftBilinear, 0) SIMD_NEON_ITEM(ShiftBilinear, 0))
+
 SIMD_API void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
     const uint8_t * bkg, size_t bkgStride, const double * shiftX, const double * shiftY,
     size_t cropLeft, size_t cropTop, size_t cropRight, size_t cropBottom, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
-		shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable)
-        Avx2::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
-        shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable)
-        Sse2::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
-        shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable)
-        Vmx::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
-        shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable)
-		Neon::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
-		shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
-	else
-#endif
-        Base::ShiftBilinear(src, srcStride, width, height, channelCount, bkg, bkgStride,
-        shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    simdShiftBilinear(0)(src, srcStride, width, height, channelCount, bkg, bkgStride, shiftX, shiftY, cropLeft, cropTop, cropRight, cropBottom, dst, dstStride);
 }
 
-SIMD_API void SimdSobelDx(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
-{
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width > Avx512bw::A)
-		Avx512bw::SobelDx(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A)
-        Sse2::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width > Neon::A)
-		Neon::SobelDx(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-        Base::SobelDx(src, srcStride, width, height, dst, dstStride);
+typedef void(*SimdSobelDxPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdSobelDxPtr, simdSobelDx, SobelDx, SIMD_AVX512BW_ITEM(SobelDx, Avx512bw::A + 1) SIMD_AVX2_ITEM(SobelDx, Avx2::A + 1) SIMD_SSSE3_ITEM(SobelDx, Ssse3::A + 1) SIMD_SSE2_ITEM(SobelDx, Sse2::A + 1) SIMD_VMX_ITEM(SobelDx, Vmx::A + 1) SIMD_NEON_ITEM(SobelDx, Neon::A + 1))
+
+SIMD_API void SimdSobelDx(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PERF_API(width*height);
+    if (Threads::Filter(height, 1, width*sizeof(int16_t), dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdSobelDx(src + begin*srcStride, srcStride, width, end - begin, dst, dstStride); }))
+        return;
+
+    simdSobelDx(width)(src, srcStride, width, height, dst, dstStride);
 }
 
+typedef void(*SimdSobelDxAbsPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdSobelDxAbsPtr, simdSobelDxAbs, SobelDxAbs, SIMD_AVX512BW_ITEM(SobelDxAbs, Avx512bw::A + 1) SIMD_AVX2_ITEM(SobelDxAbs, Avx2::A + 1) SIMD_SSSE3_ITEM(SobelDxAbs, Ssse3::A + 1) SIMD_VMX_ITEM(SobelDxAbs, Vmx::A + 1) SIMD_NEON_ITEM(SobelDxAbs, Neon::A + 1))
+
 SIMD_API void SimdSobelDxAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width > Avx512bw::A)
-		Avx512bw::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width > Neon::A)
-		Neon::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-        Base::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Filter(height, 1, width*sizeof(uint16_t), dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdSobelDxAbs(src + begin*srcStride, srcStride, width, end - begin, dst, dstStride); }))
+        return;
+
+    simdSobelDxAbs(width)(src, srcStride, width, height, dst, dstStride);
 }
 
+typedef void(*SimdSobelDxAbsSumPtr) (const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+SIMD_DISPATCH_TABLE(SimdSobelDxAbsSumPtr, simdSobelDxAbsSum, SobelDxAbsSum, SIMD_AVX512BW_ITEM(SobelDxAbsSum, Avx512bw::A + 1) SIMD_AVX2_ITEM(SobelDxAbsSum, Avx2::A + 1) SIMD_SSSE3_ITEM(SobelDxAbsSum, Ssse3::A + 1) SIMD_VMX_ITEM(SobelDxAbsSum, Vmx::A + 1) SIMD_NEON_ITEM(SobelDxAbsSum, Neon::A + 1))
+
 SIMD_API void SimdSobelDxAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width > Avx512bw::A)
-		Avx512bw::SobelDxAbsSum(src, stride, width, height, sum);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDxAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::SobelDxAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDxAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width > Neon::A)
-		Neon::SobelDxAbsSum(src, stride, width, height, sum);
-	else
-#endif
-        Base::SobelDxAbsSum(src, stride, width, height, sum);
+    SIMD_PERF_API(width*height);
+    simdSobelDxAbsSum(width)(src, stride, width, height, sum);
 }
 
+typedef void(*SimdSobelDyPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdSobelDyPtr, simdSobelDy, SobelDy, SIMD_AVX512BW_ITEM(SobelDy, Avx512bw::A + 1) SIMD_AVX2_ITEM(SobelDy, Avx2::A + 1) SIMD_SSSE3_ITEM(SobelDy, Ssse3::A + 1) SIMD_SSE2_ITEM(SobelDy, Sse2::A + 1) SIMD_VMX_ITEM(SobelDy, Vmx::A + 1) SIMD_NEON_ITEM(SobelDy, Neon::A + 1))
+
 SIMD_API void SimdSobelDy(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width > Avx512bw::A)
-		Avx512bw::SobelDy(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A)
-        Sse2::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width > Neon::A)
-		Neon::SobelDy(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-		Base::SobelDy(src, srcStride, width, height, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Filter(height, 1, width*sizeof(int16_t), dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdSobelDy(src + begin*srcStride, srcStride, width, end - begin, dst, dstStride); }))
+        return;
+
+    simdSobelDy(width)(src, srcStride, width, height, dst, dstStride);
 }
 
+typedef void(*SimdSobelDyAbsPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdSobelDyAbsPtr, simdSobelDyAbs, SobelDyAbs, SIMD_AVX512BW_ITEM(SobelDyAbs, Avx512bw::A + 1) SIMD_AVX2_ITEM(SobelDyAbs, Avx2::A + 1) SIMD_SSSE3_ITEM(SobelDyAbs, Ssse3::A + 1) SIMD_VMX_ITEM(SobelDyAbs, Vmx::A + 1) SIMD_NEON_ITEM(SobelDyAbs, Neon::A + 1))
+
 SIMD_API void SimdSobelDyAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width > Avx512bw::A)
-		Avx512bw::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width > Neon::A)
-		Neon::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-        Base::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Filter(height, 1, width*sizeof(uint16_t), dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { SimdSobelDyAbs(src + begin*srcStride, srcStride, width, end - begin, dst, dstStride); }))
+        return;
+
+    simdSobelDyAbs(width)(src, srcStride, width, height, dst, dstStride);
 }
 
+typedef void(*SimdSobelDyAbsSumPtr) (const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+SIMD_DISPATCH_TABLE(SimdSobelDyAbsSumPtr, simdSobelDyAbsSum, SobelDyAbsSum, SIMD_AVX512BW_ITEM(SobelDyAbsSum, Avx512bw::A + 1) SIMD_AVX2_ITEM(SobelDyAbsSum, Avx2::A + 1) SIMD_SSSE3_ITEM(SobelDyAbsSum, Ssse3::A + 1) SIMD_VMX_ITEM(SobelDyAbsSum, Vmx::A + 1) SIMD_NEON_ITEM(SobelDyAbsSum, Neon::A + 1))
+
 SIMD_API void SimdSobelDyAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width > Avx512bw::A)
-		Avx512bw::SobelDyAbsSum(src, stride, width, height, sum);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDyAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::SobelDyAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDyAbsSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width > Neon::A)
-		Neon::SobelDyAbsSum(src, stride, width, height, sum);
-	else
-#endif
-		Base::SobelDyAbsSum(src, stride, width, height, sum);
+    SIMD_PERF_API(width*height);
+    simdSobelDyAbsSum(width)(src, stride, width, height, sum);
 }
 
+typedef void(*SimdContourMetricsPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdContourMetricsPtr, simdContourMetrics, ContourMetrics, SIMD_AVX512BW_ITEM(ContourMetrics, Avx512bw::A + 1) SIMD_AVX2_ITEM(ContourMetrics, Avx2::A + 1) SIMD_SSSE3_ITEM(ContourMetrics, Ssse3::A + 1) SIMD_VMX_ITEM(ContourMetrics, Vmx::A + 1) SIMD_NEON_ITEM(ContourMetrics, Neon::A + 1))
+
 SIMD_API void SimdContourMetrics(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width > Avx512bw::A)
-		Avx512bw::ContourMetrics(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::ContourMetrics(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::ContourMetrics(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::ContourMetrics(src, srcStride, width, height, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width > Neon::A)
-		Neon::ContourMetrics(src, srcStride, width, height, dst, dstStride);
-	else
-#endif
-        Base::ContourMetrics(src, srcStride, width, height, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    simdContourMetrics(width)(src, srcStride, width, height, dst, dstStride);
 }
 
+typedef void(*SimdContourMetricsMaskedPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t indexMin, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdContourMetricsMaskedPtr, simdContourMetricsMasked, ContourMetricsMasked, SIMD_AVX512BW_ITEM(ContourMetricsMasked, Avx512bw::A + 1) SIMD_AVX2_ITEM(ContourMetricsMasked, Avx2::A + 1) SIMD_SSSE3_ITEM(ContourMetricsMasked, Ssse3::A + 1) SIMD_VMX_ITEM(ContourMetricsMasked, Vmx::A + 1) SIMD_NEON_ITEM(ContourMetricsMasked, Neon::A + 1))
+
 SIMD_API void SimdContourMetricsMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                        const uint8_t * mask, size_t maskStride, uint8_t indexMin, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width > Avx512bw::A)
-		Avx512bw::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width > Neon::A)
-		Neon::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
-	else
-#endif
-        Base::ContourMetricsMasked(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    simdContourMetricsMasked(width)(src, srcStride, width, height, mask, maskStride, indexMin, dst, dstStride);
 }
 
+typedef void(*SimdContourAnchorsPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t step, int16_t threshold, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdContourAnchorsPtr, simdContourAnchors, ContourAnchors, SIMD_AVX512BW_ITEM(ContourAnchors, Avx512bw::A + 1) SIMD_AVX2_ITEM(ContourAnchors, Avx2::A + 1) SIMD_SSE2_ITEM(ContourAnchors, Sse2::A + 1) SIMD_VMX_ITEM(ContourAnchors, Vmx::A + 1) SIMD_NEON_ITEM(ContourAnchors, Neon::A + 1))
+
 SIMD_API void SimdContourAnchors(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t step, int16_t threshold, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width > Avx512bw::A)
-		Avx512bw::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A)
-        Sse2::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    simdContourAnchors(width)(src, srcStride, width, height, step, threshold, dst, dstStride);
+}
+
+typedef void(*SimdCannyNmsPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t low, uint16_t high, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdCannyNmsPtr, simdCannyNms, CannyNms, SIMD_AVX512BW_ITEM(CannyNms, Avx512bw::HA) SIMD_AVX2_ITEM(CannyNms, Avx2::HA) SIMD_SSE2_ITEM(CannyNms, Sse2::HA) SIMD_NEON_ITEM(CannyNms, Neon::HA))
+
+static void CannyNms(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t low, uint16_t high, uint8_t * dst, size_t dstStride)
+{
+    simdCannyNms(width)(src, srcStride, width, height, low, high, dst, dstStride);
+}
+
+typedef void(*SimdCannyHysteresisPtr) (uint8_t * dst, size_t dstStride, size_t width, size_t height);
+SIMD_DISPATCH_PTR(SimdCannyHysteresisPtr, simdCannyHysteresis, SIMD_FUNC4(CannyHysteresis, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC, SIMD_NEON_FUNC))
+
+static void CannyHysteresis(uint8_t * dst, size_t dstStride, size_t width, size_t height)
+{
+    simdCannyHysteresis(dst, dstStride, width, height);
+}
+
+SIMD_API void SimdCanny(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t low, uint16_t high, uint8_t * dst, size_t dstStride)
+{
+    SIMD_PERF_API(width*height);
+    if (!Threads::Filter(height, 2, width, dst, dstStride, [=](size_t begin, size_t end, uint8_t * dst, size_t dstStride) { CannyNms(src + begin*srcStride, srcStride, width, end - begin, low, high, dst, dstStride); }))
+        CannyNms(src, srcStride, width, height, low, high, dst, dstStride);
+
+    std::vector<uint8_t> stripes(height, 0);
+    if (Threads::Rows(height, 1, [&](size_t begin, size_t end) { CannyHysteresis(dst + begin*dstStride, dstStride, width, end - begin); stripes[begin] = 1; }))
+    {
+        for (size_t row = 1; row < height; ++row)
+            if (stripes[row])
+                Base::CannyHysteresisSeam(dst, dstStride, width, height, row);
+    }
     else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width > Neon::A)
-		Neon::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
-	else
-#endif
-        Base::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
+        CannyHysteresis(dst, dstStride, width, height);
+
+    SimdBinarization(dst, dstStride, width, height, Base::CANNY_EDGE, 0xFF, 0, dst, dstStride, SimdCompareEqual);
 }
 
+typedef void(*SimdSquaredDifferenceSumPtr) (const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride, size_t width, size_t height, uint64_t * sum);
+SIMD_DISPATCH_TABLE(SimdSquaredDifferenceSumPtr, simdSquaredDifferenceSum, SquaredDifferenceSum, SIMD_AVX512BW_ITEM(SquaredDifferenceSum, 0) SIMD_AVX2_ITEM(SquaredDifferenceSum, Avx2::A) SIMD_SSSE3_ITEM(SquaredDifferenceSum, Ssse3::A) SIMD_SSE2_ITEM(SquaredDifferenceSum, Sse2::A) SIMD_VMX_ITEM(SquaredDifferenceSum, Vmx::A) SIMD_NEON_ITEM(SquaredDifferenceSum, Neon::A))
+
 SIMD_API void SimdSquaredDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
                           size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
-	else
-#endif
-        Base::SquaredDifferenceSum(a, aStride, b, bStride, width, height, sum);
+    SIMD_PERF_API(width*height);
+    simdSquaredDifferenceSum(width)(a, aStride, b, bStride, width, height, sum);
 }
 
+typedef void(*SimdSquaredDifferenceSumMaskedPtr) (const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride, const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum);
+SIMD_DISPATCH_TABLE(SimdSquaredDifferenceSumMaskedPtr, simdSquaredDifferenceSumMasked, SquaredDifferenceSumMasked, SIMD_AVX512BW_ITEM(SquaredDifferenceSumMasked, 0) SIMD_AVX2_ITEM(SquaredDifferenceSumMasked, Avx2::A) SIMD_SSSE3_ITEM(SquaredDifferenceSumMasked, Ssse3::A) SIMD_SSE2_ITEM(SquaredDifferenceSumMasked, Sse2::A) SIMD_VMX_ITEM(SquaredDifferenceSumMasked, Vmx::A) SIMD_NEON_ITEM(SquaredDifferenceSumMasked, Neon::A))
+
 SIMD_API void SimdSquaredDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
                           const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
-	else
-#endif
-        Base::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
+    SIMD_PERF_API(width*height);
+    simdSquaredDifferenceSumMasked(width)(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
 }
 
 typedef void (* SimdSquaredDifferenceSum32fPtr) (const float * a, const float * b, size_t size, float * sum);
-SimdSquaredDifferenceSum32fPtr simdSquaredDifferenceSum32f = SIMD_FUNC5(SquaredDifferenceSum32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdSquaredDifferenceSum32fPtr, simdSquaredDifferenceSum32f, SIMD_FUNC5(SquaredDifferenceSum32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdSquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum)
 {
+    SIMD_PERF_API(0);
     simdSquaredDifferenceSum32f(a, b, size, sum);
 }
 
 typedef void (* SimdSquaredDifferenceKahanSum32fPtr) (const float * a, const float * b, size_t size, float * sum);
-SimdSquaredDifferenceKahanSum32fPtr simdSquaredDifferenceKahanSum32f = SIMD_FUNC5(SquaredDifferenceKahanSum32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC);
+SIMD_DISPATCH_PTR(SimdSquaredDifferenceKahanSum32fPtr, simdSquaredDifferenceKahanSum32f, SIMD_FUNC5(SquaredDifferenceKahanSum32f, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC))
 
 SIMD_API void SimdSquaredDifferenceKahanSum32f(const float * a, const float * b, size_t size, float * sum)
 {
+    SIMD_PERF_API(0);
     simdSquaredDifferenceKahanSum32f(a, b, size, sum);
 }
 
+typedef void(*SimdGetStatisticPtr) (const uint8_t * src, size_t stride, size_t width, size_t height, uint8_t * min, uint8_t * max, uint8_t * average);
+SIMD_DISPATCH_TABLE(SimdGetStatisticPtr, simdGetStatistic, GetStatistic, SIMD_AVX512BW_ITEM(GetStatistic, 0) SIMD_AVX2_ITEM(GetStatistic, Avx2::A) SIMD_SSE2_ITEM(GetStatistic, Sse2::A) SIMD_VMX_ITEM(GetStatistic, Vmx::A) SIMD_NEON_ITEM(GetStatistic, Neon::A))
+
 SIMD_API void SimdGetStatistic(const uint8_t * src, size_t stride, size_t width, size_t height,
                   uint8_t * min, uint8_t * max, uint8_t * average)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::GetStatistic(src, stride, width, height, min, max, average);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetStatistic(src, stride, width, height, min, max, average);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetStatistic(src, stride, width, height, min, max, average);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetStatistic(src, stride, width, height, min, max, average);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::GetStatistic(src, stride, width, height, min, max, average);
-	else
-#endif
-        Base::GetStatistic(src, stride, width, height, min, max, average);
+    SIMD_PERF_API(width*height);
+    simdGetStatistic(width)(src, stride, width, height, min, max, average);
 }
 
+typedef void(*SimdGetMomentsPtr) (const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index, uint64_t * area, uint64_t * x, uint64_t * y, uint64_t * xx, uint64_t * xy, uint64_t * yy);
+SIMD_DISPATCH_TABLE(SimdGetMomentsPtr, simdGetMoments, GetMoments, SIMD_AVX512BW_ITEM(GetMoments, 1) SIMD_AVX2_ITEM(GetMoments, Avx2::A) SIMD_SSE2_ITEM(GetMoments, Sse2::A) SIMD_VMX_ITEM(GetMoments, Vmx::A) SIMD_NEON_ITEM(GetMoments, Neon::A))
+
 SIMD_API void SimdGetMoments(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
                 uint64_t * area, uint64_t * x, uint64_t * y, uint64_t * xx, uint64_t * xy, uint64_t * yy)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable && width < SHRT_MAX && height < SHRT_MAX)
-		Avx512bw::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A && width < SHRT_MAX && height < SHRT_MAX)
-        Avx2::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A && width < SHRT_MAX && height < SHRT_MAX)
-        Sse2::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A && width < SHRT_MAX && height < SHRT_MAX)
-        Vmx::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A && width < SHRT_MAX && height < SHRT_MAX)
-		Neon::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
-	else
-#endif
-		Base::GetMoments(mask, stride, width, height, index, area, x, y, xx, xy, yy);
+    SIMD_PERF_API(width*height);
+    simdGetMoments(width < SHRT_MAX && height < SHRT_MAX ? width : 0)(mask, stride, width, height, index, area, x, y, xx, xy, yy);
 }
 
+typedef void(*SimdGetRowSumsPtr) (const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+SIMD_DISPATCH_TABLE(SimdGetRowSumsPtr, simdGetRowSums, GetRowSums, SIMD_AVX512BW_ITEM(GetRowSums, 0) SIMD_AVX2_ITEM(GetRowSums, Avx2::A) SIMD_SSE2_ITEM(GetRowSums, Sse2::A) SIMD_VMX_ITEM(GetRowSums, Vmx::A) SIMD_NEON_ITEM(GetRowSums, Neon::A))
+
 SIMD_API void SimdGetRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::GetRowSums(src, stride, width, height, sums);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetRowSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetRowSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetRowSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::GetRowSums(src, stride, width, height, sums);
-	else
-#endif
-        Base::GetRowSums(src, stride, width, height, sums);
+    SIMD_PERF_API(width*height);
+    simdGetRowSums(width)(src, stride, width, height, sums);
 }
 
+typedef void(*SimdGetColSumsPtr) (const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+SIMD_DISPATCH_TABLE(SimdGetColSumsPtr, simdGetColSums, GetColSums, SIMD_AVX512BW_ITEM(GetColSums, 0) SIMD_AVX2_ITEM(GetColSums, Avx2::A) SIMD_SSE2_ITEM(GetColSums, Sse2::A) SIMD_VMX_ITEM(GetColSums, Vmx::A) SIMD_NEON_ITEM(GetColSums, Neon::A))
+
 SIMD_API void SimdGetColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::GetColSums(src, stride, width, height, sums);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetColSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetColSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetColSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::GetColSums(src, stride, width, height, sums);
-	else
-#endif
-        Base::GetColSums(src, stride, width, height, sums);
+    SIMD_PERF_API(width*height);
+    simdGetColSums(width)(src, stride, width, height, sums);
 }
 
+typedef void(*SimdGetAbsDyRowSumsPtr) (const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+SIMD_DISPATCH_TABLE(SimdGetAbsDyRowSumsPtr, simdGetAbsDyRowSums, GetAbsDyRowSums, SIMD_AVX512BW_ITEM(GetAbsDyRowSums, 0) SIMD_AVX2_ITEM(GetAbsDyRowSums, Avx2::A) SIMD_SSE2_ITEM(GetAbsDyRowSums, Sse2::A) SIMD_VMX_ITEM(GetAbsDyRowSums, Vmx::A) SIMD_NEON_ITEM(GetAbsDyRowSums, Neon::A))
+
 SIMD_API void SimdGetAbsDyRowSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::GetAbsDyRowSums(src, stride, width, height, sums);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetAbsDyRowSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetAbsDyRowSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetAbsDyRowSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::GetAbsDyRowSums(src, stride, width, height, sums);
-	else
-#endif
-        Base::GetAbsDyRowSums(src, stride, width, height, sums);
+    SIMD_PERF_API(width*height);
+    simdGetAbsDyRowSums(width)(src, stride, width, height, sums);
 }
-
-SIMD_API void SimdGetAbsDxColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
-{
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::GetAbsDxColSums(src, stride, width, height, sums);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::GetAbsDxColSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::GetAbsDxColSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::GetAbsDxColSums(src, stride, width, height, sums);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::GetAbsDxColSums(src, stride, width, height, sums);
-	else
-#endif
-        Base::GetAbsDxColSums(src, stride, width, height, sums);
+
+typedef void(*SimdGetAbsDxColSumsPtr) (const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums);
+SIMD_DISPATCH_TABLE(SimdGetAbsDxColSumsPtr, simdGetAbsDxColSums, GetAbsDxColSums, SIMD_AVX512BW_ITEM(GetAbsDxColSums, 0) SIMD_AVX2_ITEM(GetAbsDxColSums, Avx2::A) SIMD_SSE2_ITEM(GetAbsDxColSums, Sse2::A) SIMD_VMX_ITEM(GetAbsDxColSums, Vmx::A) SIMD_NEON_ITEM(GetAbsDxColSums, Neon::A))
+
+SIMD_API void SimdGetAbsDxColSums(const uint8_t * src, size_t stride, size_t width, size_t height, uint32_t * sums)
+{
+    SIMD_PERF_API(width*height);
+    simdGetAbsDxColSums(width)(src, stride, width, height, sums);
 }
 
+typedef void(*SimdValueSumPtr) (const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+SIMD_DISPATCH_TABLE(SimdValueSumPtr, simdValueSum, ValueSum, SIMD_AVX512BW_ITEM(ValueSum, 0) SIMD_AVX2_ITEM(ValueSum, Avx2::A) SIMD_SSE2_ITEM(ValueSum, Sse2::A) SIMD_VMX_ITEM(ValueSum, Vmx::A) SIMD_NEON_ITEM(ValueSum, Neon::A))
+
 SIMD_API void SimdValueSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::ValueSum(src, stride, width, height, sum);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::ValueSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::ValueSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::ValueSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::ValueSum(src, stride, width, height, sum);
-	else
-#endif
-        Base::ValueSum(src, stride, width, height, sum);
+    SIMD_PERF_API(width*height);
+    simdValueSum(width)(src, stride, width, height, sum);
 }
 
+typedef void(*SimdSquareSumPtr) (const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
+SIMD_DISPATCH_TABLE(SimdSquareSumPtr, simdSquareSum, SquareSum, SIMD_AVX512BW_ITEM(SquareSum, 0) SIMD_AVX2_ITEM(SquareSum, Avx2::A) SIMD_SSE2_ITEM(SquareSum, Sse2::A) SIMD_VMX_ITEM(SquareSum, Vmx::A) SIMD_NEON_ITEM(SquareSum, Neon::A))
+
 SIMD_API void SimdSquareSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::SquareSum(src, stride, width, height, sum);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::SquareSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::SquareSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::SquareSum(src, stride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::SquareSum(src, stride, width, height, sum);
-	else
-#endif
-        Base::SquareSum(src, stride, width, height, sum);
+    SIMD_PERF_API(width*height);
+    simdSquareSum(width)(src, stride, width, height, sum);
 }
 
+typedef void(*SimdCorrelationSumPtr) (const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum);
+SIMD_DISPATCH_TABLE(SimdCorrelationSumPtr, simdCorrelationSum, CorrelationSum, SIMD_AVX512BW_ITEM(CorrelationSum, 0) SIMD_AVX2_ITEM(CorrelationSum, Avx2::A) SIMD_SSE2_ITEM(CorrelationSum, Sse2::A) SIMD_VMX_ITEM(CorrelationSum, Vmx::A) SIMD_NEON_ITEM(CorrelationSum, Neon::A))
+
 SIMD_API void SimdCorrelationSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::CorrelationSum(a, aStride, b, bStride, width, height, sum);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::CorrelationSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::CorrelationSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::CorrelationSum(a, aStride, b, bStride, width, height, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::CorrelationSum(a, aStride, b, bStride, width, height, sum);
-	else
-#endif
-        Base::CorrelationSum(a, aStride, b, bStride, width, height, sum);
+    SIMD_PERF_API(width*height);
+    simdCorrelationSum(width)(a, aStride, b, bStride, width, height, sum);
 }
 
+typedef void(*SimdStretchGray2x2Ptr) (const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdStretchGray2x2Ptr, simdStretchGray2x2, StretchGray2x2, SIMD_AVX512BW_ITEM(StretchGray2x2, 0) SIMD_AVX2_ITEM(StretchGray2x2, Avx2::A) SIMD_SSE2_ITEM(StretchGray2x2, Sse2::A) SIMD_VMX_ITEM(StretchGray2x2, Vmx::A) SIMD_NEON_ITEM(StretchGray2x2, Neon::A))
+
 SIMD_API void SimdStretchGray2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                     uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && srcWidth >= Avx2::A)
-        Avx2::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && srcWidth >= Sse2::A)
-        Sse2::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && srcWidth >= Vmx::A)
-        Vmx::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && srcWidth >= Neon::A)
-		Neon::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
-	else
-#endif
-        Base::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+    SIMD_PERF_API(srcWidth*srcHeight);
+    if (Threads::Rows(srcHeight, 1, [=](size_t begin, size_t end) { SimdStretchGray2x2(src + begin*srcStride, srcWidth, end - begin, srcStride, dst + 2*begin*dstStride, dstWidth, 2*(end - begin), dstStride); }))
+        return;
+
+    simdStretchGray2x2(srcWidth)(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
 }
 
+typedef void(*SimdSvmSumLinearPtr) (const float * x, const float * svs, const float * weights, size_t length, size_t count, float * sum);
+SIMD_DISPATCH_PTR(SimdSvmSumLinearPtr, simdSvmSumLinear, SIMD_FUNC5(SvmSumLinear, SIMD_AVX512F_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_VSX_FUNC, SIMD_NEON_FUNC))
+
 SIMD_API void SimdSvmSumLinear(const float * x, const float * svs, const float * weights, size_t length, size_t count, float * sum)
 {
-#ifdef SIMD_AVX512F_ENABLE
-	if (Avx512f::Enable)
-		Avx512f::SvmSumLinear(x, svs, weights, length, count, sum);
-	else
-#endif
-#ifdef SIMD_AVX_ENABLE
-    if(Avx::Enable)
-        Avx::SvmSumLinear(x, svs, weights, length, count, sum);
-    else
-#endif
-#ifdef SIMD_SSE_ENABLE
-    if(Sse::Enable)
-        Sse::SvmSumLinear(x, svs, weights, length, count, sum);
-    else
-#endif
-#ifdef SIMD_VSX_ENABLE
-    if(Vsx::Enable)
-        Vsx::SvmSumLinear(x, svs, weights, length, count, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable)
-        Neon::SvmSumLinear(x, svs, weights, length, count, sum);
-    else
-#endif
-        Base::SvmSumLinear(x, svs, weights, length, count, sum);
+    SIMD_PERF_API(0);
+    simdSvmSumLinear(x, svs, weights, length, count, sum);
 }
 
+typedef void(*SimdTextureBoostedSaturatedGradientPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride);
+SIMD_DISPATCH_TABLE(SimdTextureBoostedSaturatedGradientPtr, simdTextureBoostedSaturatedGradient, TextureBoostedSaturatedGradient, SIMD_AVX512BW_ITEM(TextureBoostedSaturatedGradient, 0) SIMD_AVX2_ITEM(TextureBoostedSaturatedGradient, Avx2::A) SIMD_SSSE3_ITEM(TextureBoostedSaturatedGradient, Ssse3::A) SIMD_SSE2_ITEM(TextureBoostedSaturatedGradient, Sse2::A) SIMD_VMX_ITEM(TextureBoostedSaturatedGradient, Vmx::A) SIMD_NEON_ITEM(TextureBoostedSaturatedGradient, Neon::A))
+
 SIMD_API void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                      uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
-	else
-#endif
-        Base::TextureBoostedSaturatedGradient(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
+    SIMD_PERF_API(width*height);
+    simdTextureBoostedSaturatedGradient(width)(src, srcStride, width, height, saturation, boost, dx, dxStride, dy, dyStride);
 }
 
+typedef void(*SimdTextureBoostedUvPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t boost, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdTextureBoostedUvPtr, simdTextureBoostedUv, TextureBoostedUv, SIMD_AVX512BW_ITEM(TextureBoostedUv, 0) SIMD_AVX2_ITEM(TextureBoostedUv, Avx2::A) SIMD_SSE2_ITEM(TextureBoostedUv, Sse2::A) SIMD_VMX_ITEM(TextureBoostedUv, Vmx::A) SIMD_NEON_ITEM(TextureBoostedUv, Neon::A))
+
 SIMD_API void SimdTextureBoostedUv(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                       uint8_t boost, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
-	else
-#endif
-        Base::TextureBoostedUv(src, srcStride, width, height, boost, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    simdTextureBoostedUv(width)(src, srcStride, width, height, boost, dst, dstStride);
 }
 
+typedef void(*SimdTextureGetDifferenceSumPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride, int64_t * sum);
+SIMD_DISPATCH_TABLE(SimdTextureGetDifferenceSumPtr, simdTextureGetDifferenceSum, TextureGetDifferenceSum, SIMD_AVX512BW_ITEM(TextureGetDifferenceSum, 0) SIMD_AVX2_ITEM(TextureGetDifferenceSum, Avx2::A) SIMD_SSE2_ITEM(TextureGetDifferenceSum, Sse2::A) SIMD_VMX_ITEM(TextureGetDifferenceSum, Vmx::A) SIMD_NEON_ITEM(TextureGetDifferenceSum, Neon::A))
+
 SIMD_API void SimdTextureGetDifferenceSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                              const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride, int64_t * sum)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
-	else
-#endif
-        Base::TextureGetDifferenceSum(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
+    SIMD_PERF_API(width*height);
+    simdTextureGetDifferenceSum(width)(src, srcStride, width, height, lo, loStride, hi, hiStride, sum);
 }
 
+typedef void(*SimdTexturePerformCompensationPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, int shift, uint8_t * dst, size_t dstStride);
+SIMD_DISPATCH_TABLE(SimdTexturePerformCompensationPtr, simdTexturePerformCompensation, TexturePerformCompensation, SIMD_AVX512BW_ITEM(TexturePerformCompensation, 0) SIMD_AVX2_ITEM(TexturePerformCompensation, Avx2::A) SIMD_SSE2_ITEM(TexturePerformCompensation, Sse2::A) SIMD_VMX_ITEM(TexturePerformCompensation, Vmx::A) SIMD_NEON_ITEM(TexturePerformCompensation, Neon::A))
+
 SIMD_API void SimdTexturePerformCompensation(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                 int shift, uint8_t * dst, size_t dstStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-	if (Vmx::Enable && width >= Vmx::A)
-		Vmx::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
-	else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
-	else
-#endif
-        Base::TexturePerformCompensation(src, srcStride, width, height, shift, dst, dstStride);
+    SIMD_PERF_API(width*height);
+    simdTexturePerformCompensation(width)(src, srcStride, width, height, shift, dst, dstStride);
 }
 
+typedef void(*SimdYuv420pToBgrPtr) (const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+SIMD_DISPATCH_TABLE(SimdYuv420pToBgrPtr, simdYuv420pToBgr, Yuv420pToBgr, SIMD_AVX512BW_ITEM(Yuv420pToBgr, 0) SIMD_AVX2_ITEM(Yuv420pToBgr, Avx2::DA) SIMD_SSSE3_ITEM(Yuv420pToBgr, Ssse3::DA) SIMD_VMX_ITEM(Yuv420pToBgr, Vmx::DA) SIMD_NEON_ITEM(Yuv420pToBgr, Neon::DA))
+
 SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::DA)
-		Neon::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-	else
-#endif
-        Base::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 2, [=](size_t begin, size_t end) { SimdYuv420pToBgr(y + begin*yStride, yStride, u + begin/2*uStride, uStride, v + begin/2*vStride, vStride, width, end - begin, bgr + begin*bgrStride, bgrStride); }))
+        return;
+
+    simdYuv420pToBgr(width)(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
+typedef void(*SimdYuv422pToBgrPtr) (const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+SIMD_DISPATCH_TABLE(SimdYuv422pToBgrPtr, simdYuv422pToBgr, Yuv422pToBgr, SIMD_AVX512BW_ITEM(Yuv422pToBgr, 0) SIMD_AVX2_ITEM(Yuv422pToBgr, Avx2::DA) SIMD_SSSE3_ITEM(Yuv422pToBgr, Ssse3::DA) SIMD_VMX_ITEM(Yuv422pToBgr, Vmx::DA) SIMD_NEON_ITEM(Yuv422pToBgr, Neon::DA))
+
 SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::DA)
-        Ssse3::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::DA)
-		Neon::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-	else
-#endif
-        Base::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdYuv422pToBgr(y + begin*yStride, yStride, u + begin*uStride, uStride, v + begin*vStride, vStride, width, end - begin, bgr + begin*bgrStride, bgrStride); }))
+        return;
+
+    simdYuv422pToBgr(width)(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
+typedef void(*SimdYuv444pToBgrPtr) (const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+SIMD_DISPATCH_TABLE(SimdYuv444pToBgrPtr, simdYuv444pToBgr, Yuv444pToBgr, SIMD_AVX512BW_ITEM(Yuv444pToBgr, 0) SIMD_AVX2_ITEM(Yuv444pToBgr, Avx2::A) SIMD_SSSE3_ITEM(Yuv444pToBgr, Ssse3::A) SIMD_VMX_ITEM(Yuv444pToBgr, Vmx::A) SIMD_NEON_ITEM(Yuv444pToBgr, Neon::A))
+
 SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
-	else
-#endif
-        Base::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdYuv444pToBgr(y + begin*yStride, yStride, u + begin*uStride, uStride, v + begin*vStride, vStride, width, end - begin, bgr + begin*bgrStride, bgrStride); }))
+        return;
+
+    simdYuv444pToBgr(width)(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
+typedef void(*SimdYuv420pToBgraPtr) (const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+SIMD_DISPATCH_TABLE(SimdYuv420pToBgraPtr, simdYuv420pToBgra, Yuv420pToBgra, SIMD_AVX512BW_ITEM(Yuv420pToBgra, 0) SIMD_AVX2_ITEM(Yuv420pToBgra, Avx2::DA) SIMD_SSE2_ITEM(Yuv420pToBgra, Sse2::DA) SIMD_VMX_ITEM(Yuv420pToBgra, Vmx::DA) SIMD_NEON_ITEM(Yuv420pToBgra, Neon::DA))
+
 SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::DA)
-		Neon::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-	else
-#endif
-        Base::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 2, [=](size_t begin, size_t end) { SimdYuv420pToBgra(y + begin*yStride, yStride, u + begin/2*uStride, uStride, v + begin/2*vStride, vStride, width, end - begin, bgra + begin*bgraStride, bgraStride, alpha); }))
+        return;
+
+    simdYuv420pToBgra(width)(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
+typedef void(*SimdYuv422pToBgraPtr) (const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+SIMD_DISPATCH_TABLE(SimdYuv422pToBgraPtr, simdYuv422pToBgra, Yuv422pToBgra, SIMD_AVX512BW_ITEM(Yuv422pToBgra, 0) SIMD_AVX2_ITEM(Yuv422pToBgra, Avx2::DA) SIMD_SSE2_ITEM(Yuv422pToBgra, Sse2::DA) SIMD_VMX_ITEM(Yuv422pToBgra, Vmx::DA) SIMD_NEON_ITEM(Yuv422pToBgra, Neon::DA))
+
 SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                 size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::DA)
-        Vmx::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::DA)
-		Neon::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-	else
-#endif
-        Base::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdYuv422pToBgra(y + begin*yStride, yStride, u + begin*uStride, uStride, v + begin*vStride, vStride, width, end - begin, bgra + begin*bgraStride, bgraStride, alpha); }))
+        return;
+
+    simdYuv422pToBgra(width)(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
+typedef void(*SimdYuv444pToBgraPtr) (const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+SIMD_DISPATCH_TABLE(SimdYuv444pToBgraPtr, simdYuv444pToBgra, Yuv444pToBgra, SIMD_AVX512BW_ITEM(Yuv444pToBgra, 0) SIMD_AVX2_ITEM(Yuv444pToBgra, Avx2::A) SIMD_SSE2_ITEM(Yuv444pToBgra, Sse2::A) SIMD_VMX_ITEM(Yuv444pToBgra, Vmx::A) SIMD_NEON_ITEM(Yuv444pToBgra, Neon::A))
+
 SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
-	else
-#endif
-        Base::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdYuv444pToBgra(y + begin*yStride, yStride, u + begin*uStride, uStride, v + begin*vStride, vStride, width, end - begin, bgra + begin*bgraStride, bgraStride, alpha); }))
+        return;
+
+    simdYuv444pToBgra(width)(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
+typedef void(*SimdYuv444pToHslPtr) (const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hsl, size_t hslStride);
+SIMD_DISPATCH_TABLE(SimdYuv444pToHslPtr, simdYuv444pToHsl, Yuv444pToHsl, SIMD_AVX512BW_ITEM(Yuv444pToHsl, Avx512bw::A) SIMD_AVX2_ITEM(Yuv444pToHsl, Avx2::A) SIMD_SSSE3_ITEM(Yuv444pToHsl, Ssse3::A) SIMD_NEON_ITEM(Yuv444pToHsl, Neon::A))
+
 SIMD_API void SimdYuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * hsl, size_t hslStride)
 {
-    Base::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdYuv444pToHsl(y + begin*yStride, yStride, u + begin*uStride, uStride, v + begin*vStride, vStride, width, end - begin, hsl + begin*hslStride, hslStride); }))
+        return;
+
+    simdYuv444pToHsl(width)(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
 }
 
+typedef void(*SimdYuv444pToHsvPtr) (const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hsv, size_t hsvStride);
+SIMD_DISPATCH_TABLE(SimdYuv444pToHsvPtr, simdYuv444pToHsv, Yuv444pToHsv, SIMD_AVX512BW_ITEM(Yuv444pToHsv, Avx512bw::A) SIMD_AVX2_ITEM(Yuv444pToHsv, Avx2::A) SIMD_SSSE3_ITEM(Yuv444pToHsv, Ssse3::A) SIMD_NEON_ITEM(Yuv444pToHsv, Neon::A))
+
 SIMD_API void SimdYuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * hsv, size_t hsvStride)
 {
-    Base::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+    SIMD_PERF_API(width*height);
+    if (Threads::Rows(height, 1, [=](size_t begin, size_t end) { SimdYuv444pToHsv(y + begin*yStride, yStride, u + begin*uStride, uStride, v + begin*vStride, vStride, width, end - begin, hsv + begin*hsvStride, hsvStride); }))
+        return;
+
+    simdYuv444pToHsv(width)(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
 }
 
+typedef void(*SimdYuv420pToHuePtr) (const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hue, size_t hueStride);
+SIMD_DISPATCH_TABLE(SimdYuv420pToHuePtr, simdYuv420pToHue, Yuv420pToHue, SIMD_AVX512BW_ITEM(Yuv420pToHue, 0) SIMD_AVX2_ITEM(Yuv420pToHue, Avx2::DA) SIMD_SSE2_ITEM(Yuv420pToHue, Sse2::DA) SIMD_VSX_ITEM(Yuv420pToHue, Vsx::DA) SIMD_NEON_ITEM(Yuv420pToHue, Neon::DA))
+
 SIMD_API void SimdYuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * hue, size_t hueStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::DA)
-        Avx2::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::DA)
-        Sse2::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
-#endif
-#ifdef SIMD_VSX_ENABLE
-    if(Vsx::Enable && width >= Vsx::DA)
-        Vsx::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::DA)
-		Neon::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-	else
-#endif
-        Base::Yuv420pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+    SIMD_PERF_API(width*height);
+    simdYuv420pToHue(width)(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
 }
 
+typedef void(*SimdYuv444pToHuePtr) (const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hue, size_t hueStride);
+SIMD_DISPATCH_TABLE(SimdYuv444pToHuePtr, simdYuv444pToHue, Yuv444pToHue, SIMD_AVX512BW_ITEM(Yuv444pToHue, Avx512bw::A) SIMD_AVX2_ITEM(Yuv444pToHue, Avx2::A) SIMD_SSE2_ITEM(Yuv444pToHue, Sse2::A) SIMD_VSX_ITEM(Yuv444pToHue, Vsx::A) SIMD_NEON_ITEM(Yuv444pToHue, Neon::A))
+
 SIMD_API void SimdYuv444pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * hue, size_t hueStride)
 {
-#ifdef SIMD_AVX512BW_ENABLE
-	if (Avx512bw::Enable)
-		Avx512bw::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-	else
-#endif
-#ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
-#endif
-#ifdef SIMD_VSX_ENABLE
-    if(Vsx::Enable && width >= Vsx::A)
-        Vsx::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-	if (Neon::Enable && width >= Neon::A)
-		Neon::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
-	else
-#endif
-        Base::Yuv444pToHue(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
+    SIMD_PERF_API(width*height);
+    simdYuv444pToHue(width)(y, yStride, u, uStride, v, vStride, width, height, hue, hueStride);
 }
 
 
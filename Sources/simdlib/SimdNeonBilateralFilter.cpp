@@ -0,0 +1,134 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBilateralFilter.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+	namespace Neon
+	{
+		const size_t BILATERAL_FILTER_BLOCK = 8;
+
+		template<size_t channelCount> SIMD_INLINE void BilateralFilterExact(const uint8_t * const * rows, size_t window, size_t radius, 
+			const Base::BilateralFilterTap * taps, size_t tapCount, const float * range, size_t offset, uint8_t * dst)
+		{
+			SIMD_ALIGNED(16) uint16_t distance[BILATERAL_FILTER_BLOCK];
+			SIMD_ALIGNED(16) float gathered[BILATERAL_FILTER_BLOCK];
+			uint8x8_t center[channelCount];
+			float32x4_t sum[channelCount][2], norm[2] = { vdupq_n_f32(0.0f), vdupq_n_f32(0.0f) };
+			for (size_t c = 0; c < channelCount; ++c)
+			{
+				center[c] = vld1_u8(rows[c*window + radius] + offset);
+				sum[c][0] = vdupq_n_f32(0.0f);
+				sum[c][1] = vdupq_n_f32(0.0f);
+			}
+			for (size_t t = 0; t < tapCount; ++t)
+			{
+				uint16x8_t value[channelCount], dist = vdupq_n_u16(0);
+				for (size_t c = 0; c < channelCount; ++c)
+				{
+					uint8x8_t _value = vld1_u8(rows[c*window + taps[t].row] + offset + taps[t].col);
+					dist = vaddq_u16(dist, vabdl_u8(_value, center[c]));
+					value[c] = vmovl_u8(_value);
+				}
+				vst1q_u16(distance, dist);
+				for (size_t i = 0; i < BILATERAL_FILTER_BLOCK; ++i)
+					gathered[i] = range[distance[i]];
+				float32x4_t w0 = vmulq_n_f32(vld1q_f32(gathered + 0), taps[t].weight);
+				float32x4_t w1 = vmulq_n_f32(vld1q_f32(gathered + 4), taps[t].weight);
+				norm[0] = vaddq_f32(norm[0], w0);
+				norm[1] = vaddq_f32(norm[1], w1);
+				for (size_t c = 0; c < channelCount; ++c)
+				{
+					sum[c][0] = vmlaq_f32(sum[c][0], vcvtq_f32_u32(vmovl_u16(vget_low_u16(value[c]))), w0);
+					sum[c][1] = vmlaq_f32(sum[c][1], vcvtq_f32_u32(vmovl_u16(vget_high_u16(value[c]))), w1);
+				}
+			}
+			SIMD_ALIGNED(16) uint8_t buffer[channelCount][BILATERAL_FILTER_BLOCK];
+			for (size_t c = 0; c < channelCount; ++c)
+			{
+				const float32x4_t _0_5 = vdupq_n_f32(0.5f);
+				uint32x4_t lo = vcvtq_u32_f32(vaddq_f32(Div<1>(sum[c][0], norm[0]), _0_5));
+				uint32x4_t hi = vcvtq_u32_f32(vaddq_f32(Div<1>(sum[c][1], norm[1]), _0_5));
+				vst1_u8(buffer[c], vqmovn_u16(vcombine_u16(vmovn_u32(lo), vmovn_u32(hi))));
+			}
+			for (size_t i = 0; i < BILATERAL_FILTER_BLOCK; ++i)
+				for (size_t c = 0; c < channelCount; ++c)
+					dst[i*channelCount + c] = buffer[c][i];
+		}
+
+		template<size_t channelCount> void BilateralFilterExact(const uint8_t * const * rows, size_t radius,
+			const Base::BilateralFilterTap * taps, size_t tapCount, const float * range, size_t width, uint8_t * dst)
+		{
+			size_t window = 2 * radius + 1, alignedWidth = AlignLo(width, BILATERAL_FILTER_BLOCK);
+			for (size_t x = 0; x < alignedWidth; x += BILATERAL_FILTER_BLOCK)
+				BilateralFilterExact<channelCount>(rows, window, radius, taps, tapCount, range, x, dst + x*channelCount);
+			if (alignedWidth != width)
+			{
+				uint8_t tail[BILATERAL_FILTER_BLOCK*channelCount];
+				BilateralFilterExact<channelCount>(rows, window, radius, taps, tapCount, range, alignedWidth, tail);
+				memcpy(dst + alignedWidth*channelCount, tail, (width - alignedWidth)*channelCount);
+			}
+		}
+
+		void BilateralFilterExact(const uint8_t * const * rows, size_t channelCount, size_t radius,
+			const Base::BilateralFilterTap * taps, size_t tapCount, const float * range, size_t width, uint8_t * dst)
+		{
+			switch (channelCount)
+			{
+			case 1: BilateralFilterExact<1>(rows, radius, taps, tapCount, range, width, dst); break;
+			case 2: BilateralFilterExact<2>(rows, radius, taps, tapCount, range, width, dst); break;
+			case 3: BilateralFilterExact<3>(rows, radius, taps, tapCount, range, width, dst); break;
+			case 4: BilateralFilterExact<4>(rows, radius, taps, tapCount, range, width, dst); break;
+			}
+		}
+
+		void BilateralFilterRecursive(const float * src, const float * prev, const float * weight, size_t width, size_t planes, size_t stride, float inv, float * dst)
+		{
+			size_t alignedWidth = AlignLo(width, F);
+			float32x4_t _inv = vdupq_n_f32(inv);
+			for (size_t p = 0, offset = 0; p < planes; ++p, offset += stride)
+			{
+				for (size_t x = 0; x < alignedWidth; x += F)
+					vst1q_f32(dst + offset + x, vmlaq_f32(vmulq_f32(vld1q_f32(src + offset + x), _inv), 
+						vld1q_f32(prev + offset + x), vld1q_f32(weight + x)));
+				for (size_t x = alignedWidth; x < width; ++x)
+					dst[offset + x] = src[offset + x] * inv + prev[offset + x] * weight[x];
+			}
+		}
+
+		void BilateralFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, SimdBilateralFilterType type,
+			float sigmaSpace, float sigmaRange, size_t radius, uint8_t * dst, size_t dstStride)
+		{
+			if (type == SimdBilateralFilterFast)
+				Base::BilateralFilterFastRun(src, srcStride, width, height, channelCount, sigmaSpace, sigmaRange, dst, dstStride, BilateralFilterRecursive);
+			else
+				Base::BilateralFilterExactRun(src, srcStride, width, height, channelCount, sigmaSpace, sigmaRange,
+					Base::BilateralFilterRadius(sigmaSpace, radius), dst, dstStride, BilateralFilterExact);
+		}
+	}
+#endif// SIMD_NEON_ENABLE
+}
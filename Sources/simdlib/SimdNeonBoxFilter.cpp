@@ -0,0 +1,82 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBoxFilter.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        SIMD_INLINE void BoxFilterCol(const uint8_t * add, const uint8_t * sub, uint16_t * cols)
+        {
+            uint8x16_t _add = vld1q_u8(add);
+            uint8x16_t _sub = vld1q_u8(sub);
+            uint16x8_t lo = vsubl_u8(vget_low_u8(_add), vget_low_u8(_sub));
+            uint16x8_t hi = vsubl_u8(vget_high_u8(_add), vget_high_u8(_sub));
+            vst1q_u16(cols + 0, vaddq_u16(vld1q_u16(cols + 0), lo));
+            vst1q_u16(cols + 8, vaddq_u16(vld1q_u16(cols + 8), hi));
+        }
+
+        void BoxFilterCol(const uint8_t * add, const uint8_t * sub, size_t size, uint16_t * cols)
+        {
+            size_t alignedSize = AlignLo(size, A), i = 0;
+            for (; i < alignedSize; i += A)
+                BoxFilterCol(add + i, sub + i, cols + i);
+            for (; i < size; ++i)
+                cols[i] += add[i] - sub[i];
+        }
+
+        SIMD_INLINE uint16x4_t BoxFilterNorm(const uint32_t * sums, float32x4_t scale)
+        {
+            float32x4_t value = vmulq_f32(vcvtq_f32_u32(vld1q_u32(sums)), scale);
+            return vqmovn_u32(vcvtq_u32_f32(vaddq_f32(value, vdupq_n_f32(0.5f))));
+        }
+
+        SIMD_INLINE void BoxFilterNorm(const uint32_t * sums, float32x4_t scale, uint8_t * dst)
+        {
+            uint8x8_t lo = vqmovn_u16(vcombine_u16(BoxFilterNorm(sums + 0, scale), BoxFilterNorm(sums + 4, scale)));
+            uint8x8_t hi = vqmovn_u16(vcombine_u16(BoxFilterNorm(sums + 8, scale), BoxFilterNorm(sums + 12, scale)));
+            vst1q_u8(dst, vcombine_u8(lo, hi));
+        }
+
+        void BoxFilterNorm(const uint32_t * sums, size_t size, float scale, uint8_t * dst)
+        {
+            assert(size >= A);
+            float32x4_t _scale = vdupq_n_f32(scale);
+            size_t alignedSize = AlignLo(size, A);
+            for (size_t i = 0; i < alignedSize; i += A)
+                BoxFilterNorm(sums + i, _scale, dst + i);
+            if (alignedSize != size)
+                BoxFilterNorm(sums + size - A, _scale, dst + size - A);
+        }
+
+        void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride)
+        {
+            Base::BoxFilterRun(src, srcStride, width, height, channelCount, windowX, windowY, dst, dstStride, BoxFilterCol, BoxFilterNorm);
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
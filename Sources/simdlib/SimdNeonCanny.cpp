@@ -0,0 +1,119 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdCanny.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+	namespace Neon
+	{
+		SIMD_INLINE int16x8_t LoadCanny(const uint8_t * p)
+		{
+			return (int16x8_t)vmovl_u8(vld1_u8(p));
+		}
+
+		SIMD_INLINE void CannyGradientBlock(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t x, int16_t * dx, int16_t * dy, int16_t * mag)
+		{
+			int16x8_t s0l = LoadCanny(src0 + x - 1), s0c = LoadCanny(src0 + x), s0r = LoadCanny(src0 + x + 1);
+			int16x8_t s1l = LoadCanny(src1 + x - 1), s1r = LoadCanny(src1 + x + 1);
+			int16x8_t s2l = LoadCanny(src2 + x - 1), s2c = LoadCanny(src2 + x), s2r = LoadCanny(src2 + x + 1);
+			int16x8_t _dx = vsubq_s16(vaddq_s16(vaddq_s16(s0r, s2r), vshlq_n_s16(s1r, 1)), vaddq_s16(vaddq_s16(s0l, s2l), vshlq_n_s16(s1l, 1)));
+			int16x8_t _dy = vsubq_s16(vaddq_s16(vaddq_s16(s2l, s2r), vshlq_n_s16(s2c, 1)), vaddq_s16(vaddq_s16(s0l, s0r), vshlq_n_s16(s0c, 1)));
+			vst1q_s16(dx + x, _dx);
+			vst1q_s16(dy + x, _dy);
+			vst1q_s16(mag + x, vaddq_s16(vabsq_s16(_dx), vabsq_s16(_dy)));
+		}
+
+		void CannyGradient(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t width, int16_t * dx, int16_t * dy, int16_t * mag)
+		{
+			assert(width >= HA);
+			size_t alignedWidth = AlignLo(width, HA);
+			for (size_t x = 0; x < alignedWidth; x += HA)
+				CannyGradientBlock(src0, src1, src2, x, dx, dy, mag);
+			if (alignedWidth != width)
+				CannyGradientBlock(src0, src1, src2, width - HA, dx, dy, mag);
+		}
+
+		SIMD_INLINE void CannySuppressBlock(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2,
+			size_t x, int16x8_t low, int16x8_t high, uint8_t * dst)
+		{
+			int16x8_t _dx = vld1q_s16(dx + x), _dy = vld1q_s16(dy + x);
+			int16x8_t adx = vabsq_s16(_dx), ady = vabsq_s16(_dy);
+			uint16x8_t hor = vcltq_s16(vmulq_n_s16(ady, 29), vmulq_n_s16(adx, 12));
+			uint16x8_t ver = vcltq_s16(vmulq_n_s16(adx, 29), vmulq_n_s16(ady, 12));
+			uint16x8_t same = vcgeq_s16(veorq_s16(_dx, _dy), vdupq_n_s16(0));
+			int16x8_t a = vbslq_s16(same, vld1q_s16(mag0 + x - 1), vld1q_s16(mag0 + x + 1));
+			int16x8_t b = vbslq_s16(same, vld1q_s16(mag2 + x + 1), vld1q_s16(mag2 + x - 1));
+			a = vbslq_s16(ver, vld1q_s16(mag0 + x), a);
+			b = vbslq_s16(ver, vld1q_s16(mag2 + x), b);
+			a = vbslq_s16(hor, vld1q_s16(mag1 + x - 1), a);
+			b = vbslq_s16(hor, vld1q_s16(mag1 + x + 1), b);
+			int16x8_t m = vld1q_s16(mag1 + x);
+			uint16x8_t max = vandq_u16(vcgtq_s16(m, a), vcgeq_s16(m, b));
+			uint16x8_t label = vandq_u16(max, vsubq_u16(vdupq_n_u16(0), vaddq_u16(vcgtq_s16(m, low), vcgtq_s16(m, high))));
+			vst1_u8(dst + x, vmovn_u16(label));
+		}
+
+		void CannySuppress(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2,
+			size_t width, int16_t low, int16_t high, uint8_t * dst)
+		{
+			assert(width >= HA);
+			size_t alignedWidth = AlignLo(width, HA);
+			int16x8_t _low = vdupq_n_s16(low), _high = vdupq_n_s16(high);
+			for (size_t x = 0; x < alignedWidth; x += HA)
+				CannySuppressBlock(dx, dy, mag0, mag1, mag2, x, _low, _high, dst);
+			if (alignedWidth != width)
+				CannySuppressBlock(dx, dy, mag0, mag1, mag2, width - HA, _low, _high, dst);
+		}
+
+		size_t CannyFind(const uint8_t * row, size_t begin, size_t width)
+		{
+			const uint8x16_t strong = vdupq_n_u8(Base::CANNY_STRONG);
+			size_t x = begin;
+			for (; x + A <= width; x += A)
+			{
+				uint64x2_t found = (uint64x2_t)vceqq_u8(vld1q_u8(row + x), strong);
+				if (vgetq_lane_u64(found, 0) | vgetq_lane_u64(found, 1))
+					break;
+			}
+			for (; x < width; ++x)
+				if (row[x] == Base::CANNY_STRONG)
+					return x;
+			return width;
+		}
+
+		void CannyNms(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t low, uint16_t high, uint8_t * dst, size_t dstStride)
+		{
+			Base::CannyNmsRun(src, srcStride, width, height, low, high, dst, dstStride, CannyGradient, CannySuppress);
+		}
+
+		void CannyHysteresis(uint8_t * dst, size_t dstStride, size_t width, size_t height)
+		{
+			Base::CannyHysteresisRun(dst, dstStride, width, height, CannyFind);
+		}
+	}
+#endif// SIMD_NEON_ENABLE
+}
@@ -0,0 +1,222 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdFilter2D.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+	namespace Neon
+	{
+		SIMD_INLINE int16x8_t LoadFilter2D(const uint8_t * p)
+		{
+			return (int16x8_t)vmovl_u8(vld1_u8(p));
+		}
+
+		SIMD_INLINE void Filter2D8uDirect(const uint8_t * const * rows, size_t offset, const int16_t * kernel, size_t kernelX, size_t kernelY,
+			int16x8_t round, int16x8_t shift, int16x8_t bias, uint8_t * dst)
+		{
+			int16x8_t sum0 = vdupq_n_s16(0), sum1 = vdupq_n_s16(0);
+			for (size_t ky = 0; ky < kernelY; ++ky, kernel += kernelX)
+			{
+				const uint8_t * row = rows[ky] + offset;
+				for (size_t kx = 0; kx < kernelX; ++kx)
+				{
+					sum0 = vqaddq_s16(sum0, vmulq_n_s16(LoadFilter2D(row + kx), kernel[kx]));
+					sum1 = vqaddq_s16(sum1, vmulq_n_s16(LoadFilter2D(row + kx + HA), kernel[kx]));
+				}
+			}
+			sum0 = vqaddq_s16(vshlq_s16(vqaddq_s16(sum0, round), shift), bias);
+			sum1 = vqaddq_s16(vshlq_s16(vqaddq_s16(sum1, round), shift), bias);
+			vst1q_u8(dst, PackSaturatedI16(sum0, sum1));
+		}
+
+		void Filter2D8uDirect(const uint8_t * const * rows, size_t width, const int16_t * kernel, size_t kernelX, size_t kernelY, int shift, int16_t bias, uint8_t * dst)
+		{
+			assert(width >= A);
+			size_t alignedWidth = AlignLo(width, A);
+			int16x8_t _round = vdupq_n_s16(shift ? 1 << (shift - 1) : 0), _shift = vdupq_n_s16(-shift), _bias = vdupq_n_s16(bias);
+			for (size_t x = 0; x < alignedWidth; x += A)
+				Filter2D8uDirect(rows, x, kernel, kernelX, kernelY, _round, _shift, _bias, dst + x);
+			if (alignedWidth != width)
+				Filter2D8uDirect(rows, width - A, kernel, kernelX, kernelY, _round, _shift, _bias, dst + width - A);
+		}
+
+		SIMD_INLINE void Filter2D8uRow(const uint8_t * src, const int16_t * kernel, size_t size, int16_t * dst)
+		{
+			int16x8_t sum0 = vdupq_n_s16(0), sum1 = vdupq_n_s16(0);
+			for (size_t k = 0; k < size; ++k)
+			{
+				sum0 = vmlaq_n_s16(sum0, LoadFilter2D(src + k), kernel[k]);
+				sum1 = vmlaq_n_s16(sum1, LoadFilter2D(src + k + HA), kernel[k]);
+			}
+			vst1q_s16(dst + 0, sum0);
+			vst1q_s16(dst + HA, sum1);
+		}
+
+		void Filter2D8uRow(const uint8_t * src, size_t width, const int16_t * kernel, size_t size, int16_t * dst)
+		{
+			assert(width >= A);
+			size_t alignedWidth = AlignLo(width, A);
+			for (size_t x = 0; x < alignedWidth; x += A)
+				Filter2D8uRow(src + x, kernel, size, dst + x);
+			if (alignedWidth != width)
+				Filter2D8uRow(src + width - A, kernel, size, dst + width - A);
+		}
+
+		SIMD_INLINE int16x4_t Filter2D8uColRound(int32x4_t sum, int32x4_t round, int32x4_t shift, int32x4_t bias)
+		{
+			return vqmovn_s32(vaddq_s32(vshlq_s32(vaddq_s32(sum, round), shift), bias));
+		}
+
+		SIMD_INLINE void Filter2D8uCol(const int16_t * const * rows, size_t offset, const int16_t * kernel, size_t size,
+			int32x4_t round, int32x4_t shift, int32x4_t bias, uint8_t * dst)
+		{
+			int32x4_t sums[4] = { vdupq_n_s32(0), vdupq_n_s32(0), vdupq_n_s32(0), vdupq_n_s32(0) };
+			for (size_t k = 0; k < size; ++k)
+			{
+				const int16_t * row = rows[k] + offset;
+				int16x8_t s0 = vld1q_s16(row), s1 = vld1q_s16(row + HA);
+				sums[0] = vmlal_n_s16(sums[0], vget_low_s16(s0), kernel[k]);
+				sums[1] = vmlal_n_s16(sums[1], vget_high_s16(s0), kernel[k]);
+				sums[2] = vmlal_n_s16(sums[2], vget_low_s16(s1), kernel[k]);
+				sums[3] = vmlal_n_s16(sums[3], vget_high_s16(s1), kernel[k]);
+			}
+			int16x8_t lo = vcombine_s16(Filter2D8uColRound(sums[0], round, shift, bias), Filter2D8uColRound(sums[1], round, shift, bias));
+			int16x8_t hi = vcombine_s16(Filter2D8uColRound(sums[2], round, shift, bias), Filter2D8uColRound(sums[3], round, shift, bias));
+			vst1q_u8(dst, PackSaturatedI16(lo, hi));
+		}
+
+		void Filter2D8uCol(const int16_t * const * rows, size_t width, const int16_t * kernel, size_t size, int shift, int16_t bias, uint8_t * dst)
+		{
+			assert(width >= A);
+			size_t alignedWidth = AlignLo(width, A);
+			int32x4_t _round = vdupq_n_s32(shift ? 1 << (shift - 1) : 0), _shift = vdupq_n_s32(-shift), _bias = vdupq_n_s32(bias);
+			for (size_t x = 0; x < alignedWidth; x += A)
+				Filter2D8uCol(rows, x, kernel, size, _round, _shift, _bias, dst + x);
+			if (alignedWidth != width)
+				Filter2D8uCol(rows, width - A, kernel, size, _round, _shift, _bias, dst + width - A);
+		}
+
+		void Filter2D8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, const int16_t * kernel, size_t kernelX, size_t kernelY,
+			int shift, int16_t bias, uint8_t * dst, size_t dstStride)
+		{
+			Base::Filter2D8uRun(src, srcStride, width, height, kernel, kernelX, kernelY, shift, bias, dst, dstStride, Filter2D8uDirect, Filter2D8uRow, Filter2D8uCol);
+		}
+
+		template<size_t count> SIMD_INLINE void Filter2D32fDirect(const float * const * rows, size_t offset, const float * kernel, size_t kernelX, size_t kernelY, float * dst)
+		{
+			float32x4_t sums[count];
+			for (size_t i = 0; i < count; ++i)
+				sums[i] = vdupq_n_f32(0.0f);
+			for (size_t ky = 0; ky < kernelY; ++ky, kernel += kernelX)
+			{
+				const float * row = rows[ky] + offset;
+				for (size_t kx = 0; kx < kernelX; ++kx)
+				{
+					float32x4_t w = vdupq_n_f32(kernel[kx]);
+					for (size_t i = 0; i < count; ++i)
+						sums[i] = vmlaq_f32(sums[i], vld1q_f32(row + kx + i * F), w);
+				}
+			}
+			for (size_t i = 0; i < count; ++i)
+				vst1q_f32(dst + i * F, sums[i]);
+		}
+
+		void Filter2D32fDirect(const float * const * rows, size_t width, const float * kernel, size_t kernelX, size_t kernelY, float * dst)
+		{
+			assert(width >= F);
+			size_t widthQF = AlignLo(width, QF), widthF = AlignLo(width, F), x = 0;
+			for (; x < widthQF; x += QF)
+				Filter2D32fDirect<4>(rows, x, kernel, kernelX, kernelY, dst + x);
+			for (; x < widthF; x += F)
+				Filter2D32fDirect<1>(rows, x, kernel, kernelX, kernelY, dst + x);
+			if (widthF != width)
+				Filter2D32fDirect<1>(rows, width - F, kernel, kernelX, kernelY, dst + width - F);
+		}
+
+		template<size_t count> SIMD_INLINE void Filter2D32fRow(const float * src, const float * kernel, size_t size, float * dst)
+		{
+			float32x4_t sums[count];
+			for (size_t i = 0; i < count; ++i)
+				sums[i] = vdupq_n_f32(0.0f);
+			for (size_t k = 0; k < size; ++k)
+			{
+				float32x4_t w = vdupq_n_f32(kernel[k]);
+				for (size_t i = 0; i < count; ++i)
+					sums[i] = vmlaq_f32(sums[i], vld1q_f32(src + k + i * F), w);
+			}
+			for (size_t i = 0; i < count; ++i)
+				vst1q_f32(dst + i * F, sums[i]);
+		}
+
+		void Filter2D32fRow(const float * src, size_t width, const float * kernel, size_t size, float * dst)
+		{
+			assert(width >= F);
+			size_t widthQF = AlignLo(width, QF), widthF = AlignLo(width, F), x = 0;
+			for (; x < widthQF; x += QF)
+				Filter2D32fRow<4>(src + x, kernel, size, dst + x);
+			for (; x < widthF; x += F)
+				Filter2D32fRow<1>(src + x, kernel, size, dst + x);
+			if (widthF != width)
+				Filter2D32fRow<1>(src + width - F, kernel, size, dst + width - F);
+		}
+
+		template<size_t count> SIMD_INLINE void Filter2D32fCol(const float * const * rows, size_t offset, const float * kernel, size_t size, float * dst)
+		{
+			float32x4_t sums[count];
+			for (size_t i = 0; i < count; ++i)
+				sums[i] = vdupq_n_f32(0.0f);
+			for (size_t k = 0; k < size; ++k)
+			{
+				float32x4_t w = vdupq_n_f32(kernel[k]);
+				const float * row = rows[k] + offset;
+				for (size_t i = 0; i < count; ++i)
+					sums[i] = vmlaq_f32(sums[i], vld1q_f32(row + i * F), w);
+			}
+			for (size_t i = 0; i < count; ++i)
+				vst1q_f32(dst + i * F, sums[i]);
+		}
+
+		void Filter2D32fCol(const float * const * rows, size_t width, const float * kernel, size_t size, float * dst)
+		{
+			assert(width >= F);
+			size_t widthQF = AlignLo(width, QF), widthF = AlignLo(width, F), x = 0;
+			for (; x < widthQF; x += QF)
+				Filter2D32fCol<4>(rows, x, kernel, size, dst + x);
+			for (; x < widthF; x += F)
+				Filter2D32fCol<1>(rows, x, kernel, size, dst + x);
+			if (widthF != width)
+				Filter2D32fCol<1>(rows, width - F, kernel, size, dst + width - F);
+		}
+
+		void Filter2D32f(const float * src, size_t srcStride, size_t width, size_t height, const float * kernel, size_t kernelX, size_t kernelY,
+			float * dst, size_t dstStride)
+		{
+			Base::Filter2D32fRun(src, srcStride, width, height, kernel, kernelX, kernelY, dst, dstStride, Filter2D32fDirect, Filter2D32fRow, Filter2D32fCol);
+		}
+	}
+#endif// SIMD_NEON_ENABLE
+}
@@ -0,0 +1,99 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdGaussianBlur.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        SIMD_INLINE void GaussianBlurRow(const uint8_t * src, size_t step, const int16_t * weights, size_t size, int16_t * dst)
+        {
+            int32x4_t sums[4] = { vdupq_n_s32(0), vdupq_n_s32(0), vdupq_n_s32(0), vdupq_n_s32(0) };
+            for (size_t k = 0; k < size; k += 1, src += step)
+            {
+                uint8x16_t s = vld1q_u8(src);
+                int16x8_t lo = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(s)));
+                int16x8_t hi = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(s)));
+                sums[0] = vmlal_n_s16(sums[0], vget_low_s16(lo), weights[k]);
+                sums[1] = vmlal_n_s16(sums[1], vget_high_s16(lo), weights[k]);
+                sums[2] = vmlal_n_s16(sums[2], vget_low_s16(hi), weights[k]);
+                sums[3] = vmlal_n_s16(sums[3], vget_high_s16(hi), weights[k]);
+            }
+            vst1q_s16(dst + 0, vcombine_s16(vmovn_s32(vrshrq_n_s32(sums[0], Base::GAUSSIAN_BLUR_ROW_SHIFT)), vmovn_s32(vrshrq_n_s32(sums[1], Base::GAUSSIAN_BLUR_ROW_SHIFT))));
+            vst1q_s16(dst + 8, vcombine_s16(vmovn_s32(vrshrq_n_s32(sums[2], Base::GAUSSIAN_BLUR_ROW_SHIFT)), vmovn_s32(vrshrq_n_s32(sums[3], Base::GAUSSIAN_BLUR_ROW_SHIFT))));
+        }
+
+        void GaussianBlurRow(const uint8_t * src, size_t width, size_t step, const int16_t * weights, size_t size, int16_t * dst)
+        {
+            assert(width >= A);
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t i = 0; i < alignedWidth; i += A)
+                GaussianBlurRow(src + i, step, weights, size, dst + i);
+            if (alignedWidth != width)
+                GaussianBlurRow(src + width - A, step, weights, size, dst + width - A);
+        }
+
+        SIMD_INLINE uint16x4_t GaussianBlurColRound(int32x4_t sum)
+        {
+            return vqmovun_s32(vrshrq_n_s32(sum, Base::GAUSSIAN_BLUR_COL_SHIFT));
+        }
+
+        SIMD_INLINE void GaussianBlurCol(const int16_t * const * rows, const int16_t * weights, size_t size, size_t offset, uint8_t * dst)
+        {
+            int32x4_t sums[4] = { vdupq_n_s32(0), vdupq_n_s32(0), vdupq_n_s32(0), vdupq_n_s32(0) };
+            for (size_t k = 0; k < size; ++k)
+            {
+                int16x8_t lo = vld1q_s16(rows[k] + offset + 0);
+                int16x8_t hi = vld1q_s16(rows[k] + offset + 8);
+                sums[0] = vmlal_n_s16(sums[0], vget_low_s16(lo), weights[k]);
+                sums[1] = vmlal_n_s16(sums[1], vget_high_s16(lo), weights[k]);
+                sums[2] = vmlal_n_s16(sums[2], vget_low_s16(hi), weights[k]);
+                sums[3] = vmlal_n_s16(sums[3], vget_high_s16(hi), weights[k]);
+            }
+            uint8x8_t lo = vqmovn_u16(vcombine_u16(GaussianBlurColRound(sums[0]), GaussianBlurColRound(sums[1])));
+            uint8x8_t hi = vqmovn_u16(vcombine_u16(GaussianBlurColRound(sums[2]), GaussianBlurColRound(sums[3])));
+            vst1q_u8(dst, vcombine_u8(lo, hi));
+        }
+
+        void GaussianBlurCol(const int16_t * const * rows, size_t width, const int16_t * weights, size_t size, uint8_t * dst)
+        {
+            assert(width >= A);
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t i = 0; i < alignedWidth; i += A)
+                GaussianBlurCol(rows, weights, size, i, dst + i);
+            if (alignedWidth != width)
+                GaussianBlurCol(rows, weights, size, width - A, dst + width - A);
+        }
+
+        void GaussianBlur(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, float sigma, size_t radius, uint8_t * dst, size_t dstStride)
+        {
+            radius = Base::GaussianBlurRadius(sigma, radius);
+            Base::GaussianBlurRun(src, srcStride, width, height, channelCount, sigma, radius, dst, dstStride, GaussianBlurRow, GaussianBlurCol);
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
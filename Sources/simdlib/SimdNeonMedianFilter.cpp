@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdMedianFilter.h"
 
 namespace Simd
 {
@@ -506,6 +507,57 @@ namespace Simd
 			else
 				MedianFilterSquare5x5<false>(src, srcStride, width, height, channelCount, dst, dstStride);
 		}
+
+		struct MedianHistogram
+		{
+			static SIMD_INLINE void Add(const uint16_t * src, uint16_t * dst)
+			{
+				vst1q_u16(dst + 0, vaddq_u16(vld1q_u16(dst + 0), vld1q_u16(src + 0)));
+				vst1q_u16(dst + 8, vaddq_u16(vld1q_u16(dst + 8), vld1q_u16(src + 8)));
+			}
+
+			static SIMD_INLINE void Sub(const uint16_t * src, uint16_t * dst)
+			{
+				vst1q_u16(dst + 0, vsubq_u16(vld1q_u16(dst + 0), vld1q_u16(src + 0)));
+				vst1q_u16(dst + 8, vsubq_u16(vld1q_u16(dst + 8), vld1q_u16(src + 8)));
+			}
+
+			static SIMD_INLINE void AddSub(const uint16_t * add, const uint16_t * sub, uint16_t * dst)
+			{
+				vst1q_u16(dst + 0, vaddq_u16(vld1q_u16(dst + 0), vsubq_u16(vld1q_u16(add + 0), vld1q_u16(sub + 0))));
+				vst1q_u16(dst + 8, vaddq_u16(vld1q_u16(dst + 8), vsubq_u16(vld1q_u16(add + 8), vld1q_u16(sub + 8))));
+			}
+
+			static SIMD_INLINE size_t Find(const uint16_t * hist, size_t & sum, size_t threshold)
+			{
+				SIMD_ALIGNED(16) uint16_t prefix[24];
+				const uint16x8_t zero = vdupq_n_u16(0);
+				uint16x8_t lo = vld1q_u16(hist + 0);
+				uint16x8_t hi = vld1q_u16(hist + 8);
+				lo = vaddq_u16(lo, vextq_u16(zero, lo, 7));
+				hi = vaddq_u16(hi, vextq_u16(zero, hi, 7));
+				lo = vaddq_u16(lo, vextq_u16(zero, lo, 6));
+				hi = vaddq_u16(hi, vextq_u16(zero, hi, 6));
+				lo = vaddq_u16(lo, vextq_u16(zero, lo, 4));
+				hi = vaddq_u16(hi, vextq_u16(zero, hi, 4));
+				lo = vaddq_u16(lo, vdupq_n_u16((uint16_t)sum));
+				hi = vaddq_u16(hi, vdupq_n_u16(vgetq_lane_u16(lo, 7)));
+				uint16x8_t _threshold = vdupq_n_u16((uint16_t)threshold);
+				uint16x8_t lesser = vaddq_u16(vshrq_n_u16(vcleq_u16(lo, _threshold), 15), vshrq_n_u16(vcleq_u16(hi, _threshold), 15));
+				uint64x2_t count = vpaddlq_u32(vpaddlq_u16(lesser));
+				size_t index = size_t(vgetq_lane_u64(count, 0) + vgetq_lane_u64(count, 1));
+				prefix[7] = (uint16_t)sum;
+				vst1q_u16(prefix + 8, lo);
+				vst1q_u16(prefix + 16, hi);
+				sum = prefix[7 + index];
+				return index;
+			}
+		};
+
+		void MedianFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride)
+		{
+			Base::MedianFilterRun<MedianHistogram>(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+		}
 	}
 #endif// SIMD_NEON_ENABLE
 }
@@ -0,0 +1,69 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMorphology.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        template<bool dilate> SIMD_INLINE uint8x16_t MorphologyOp(uint8x16_t a, uint8x16_t b)
+        {
+            return dilate ? vmaxq_u8(a, b) : vminq_u8(a, b);
+        }
+
+        template<bool dilate> void MorphologyRow(const uint8_t * a, const uint8_t * b, size_t size, uint8_t * dst)
+        {
+            size_t alignedSize = AlignLo(size, A), i = 0;
+            for (; i < alignedSize; i += A)
+                vst1q_u8(dst + i, MorphologyOp<dilate>(vld1q_u8(a + i), vld1q_u8(b + i)));
+            for (; i < size; ++i)
+                dst[i] = dilate ? Simd::Max(a[i], b[i]) : Simd::Min(a[i], b[i]);
+        }
+
+        void MorphologyBlend(const uint8_t * src, const uint8_t * mask, uint8_t index, size_t size, uint8_t * dst)
+        {
+            uint8x16_t _index = vdupq_n_u8(index);
+            size_t alignedSize = AlignLo(size, A), i = 0;
+            for (; i < alignedSize; i += A)
+            {
+                uint8x16_t _mask = vceqq_u8(vld1q_u8(mask + i), _index);
+                vst1q_u8(dst + i, vbslq_u8(_mask, vld1q_u8(dst + i), vld1q_u8(src + i)));
+            }
+            for (; i < size; ++i)
+                if (mask[i] != index)
+                    dst[i] = src[i];
+        }
+
+        void Morphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdMorphologyType type, SimdMorphologyShapeType shape,
+            size_t windowX, size_t windowY, const uint8_t * mask, size_t maskStride, uint8_t index, uint8_t * dst, size_t dstStride)
+        {
+            Base::MorphologyFuncs funcs = { MorphologyRow<false>, MorphologyRow<true>, MorphologyBlend };
+            Base::MorphologyRun(src, srcStride, width, height, type, shape, windowX, windowY, mask, maskStride, index, dst, dstStride, funcs);
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
@@ -0,0 +1,82 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        template<bool first> SIMD_INLINE void ResizeAreaY(uint32x4_t src, float32x4_t alpha, float * dst)
+        {
+            float32x4_t value = vmulq_f32(vcvtq_f32_u32(src), alpha);
+            Store<false>(dst, first ? value : vaddq_f32(Load<false>(dst), value));
+        }
+
+        template<bool first> void ResizeAreaY(const uint8_t * src, size_t size, float alpha, float * dst)
+        {
+            size_t alignedSize = AlignLo(size, A);
+            float32x4_t _alpha = vdupq_n_f32(alpha);
+            for (size_t i = 0; i < alignedSize; i += A)
+            {
+                uint8x16_t _src = Load<false>(src + i);
+                uint16x8_t lo = UnpackU8<0>(_src), hi = UnpackU8<1>(_src);
+                ResizeAreaY<first>(UnpackU16<0>(lo), _alpha, dst + i + 0 * F);
+                ResizeAreaY<first>(UnpackU16<1>(lo), _alpha, dst + i + 1 * F);
+                ResizeAreaY<first>(UnpackU16<0>(hi), _alpha, dst + i + 2 * F);
+                ResizeAreaY<first>(UnpackU16<1>(hi), _alpha, dst + i + 3 * F);
+            }
+            for (size_t i = alignedSize; i < size; ++i)
+                dst[i] = first ? src[i] * alpha : dst[i] + src[i] * alpha;
+        }
+
+        ResizerByteArea::ResizerByteArea(const Base::ResParam & param)
+            : Base::ResizerByteArea(param)
+        {
+        }
+
+        void ResizerByteArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            size_t dstHeight = _param.dstH;
+            for (size_t y = 0; y < dstHeight; ++y, dst = Next(dst, dstStride))
+            {
+                const uint8_t * ps = src + _iy.index[y] * srcStride;
+                ResizeAreaY<true>(ps, _bx.size, _iy.alpha[y], _bx.data);
+                for (int k = 1; k < _iy.count[y]; ++k)
+                    ResizeAreaY<false>(ps += srcStride, _bx.size, _iy.alpha[k*dstHeight + y], _bx.data);
+                Base::ResizeAreaX(_bx.data, _ix, 0, dst);
+            }
+        }
+
+        void ResizeArea(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+        {
+            ResizerByteArea resizer(Base::ResParam(srcWidth, srcHeight, dstWidth, dstHeight, channelCount, SimdResizeMethodArea));
+            resizer.Run(src, srcStride, dst, dstStride);
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
@@ -0,0 +1,101 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        SIMD_INLINE uint32x4_t ResizeBicubicY(const float * const * src, const float32x4_t * alpha, size_t offset)
+        {
+            float32x4_t sum = vmulq_f32(Load<false>(src[0] + offset), alpha[0]);
+            sum = vaddq_f32(sum, vmulq_f32(Load<false>(src[1] + offset), alpha[1]));
+            sum = vaddq_f32(sum, vmulq_f32(Load<false>(src[2] + offset), alpha[2]));
+            sum = vaddq_f32(sum, vmulq_f32(Load<false>(src[3] + offset), alpha[3]));
+            sum = vminq_f32(vmaxq_f32(sum, vdupq_n_f32(0.0f)), vdupq_n_f32(255.0f));
+            return vcvtq_u32_f32(vaddq_f32(sum, vdupq_n_f32(0.5f)));
+        }
+
+        SIMD_INLINE void ResizeBicubicY(const float * const * src, const float32x4_t * alpha, size_t offset, uint8_t * dst)
+        {
+            uint16x8_t lo = PackU32(ResizeBicubicY(src, alpha, offset + 0 * F), ResizeBicubicY(src, alpha, offset + 1 * F));
+            uint16x8_t hi = PackU32(ResizeBicubicY(src, alpha, offset + 2 * F), ResizeBicubicY(src, alpha, offset + 3 * F));
+            Store<false>(dst + offset, PackU16(lo, hi));
+        }
+
+        void ResizeBicubicY(const float * const * src, const float * alpha, size_t size, uint8_t * dst)
+        {
+            assert(size >= A);
+
+            float32x4_t _alpha[4];
+            for (size_t k = 0; k < 4; ++k)
+                _alpha[k] = vdupq_n_f32(alpha[k]);
+            size_t alignedSize = AlignLo(size, A);
+            for (size_t i = 0; i < alignedSize; i += A)
+                ResizeBicubicY(src, _alpha, i, dst);
+            if (alignedSize != size)
+                ResizeBicubicY(src, _alpha, size - A, dst);
+        }
+
+        ResizerByteBicubic::ResizerByteBicubic(const Base::ResParam & param)
+            : Base::ResizerByteBicubic(param)
+        {
+        }
+
+        void ResizerByteBicubic::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            size_t dstHeight = _param.dstH;
+            _rows.Reset();
+            for (size_t y = 0; y < dstHeight; ++y, dst = Next(dst, dstStride))
+            {
+                const float * ps[4];
+                float alpha[4];
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    int sy = _iy.index[k*dstHeight + y];
+                    ps[k] = _rows.Get(sy);
+                    if (ps[k] == NULL)
+                    {
+                        float * row = _rows.Set(sy, _iy.index.data + y, dstHeight);
+                        Base::ResizeBicubicX(src + sy*srcStride, _ix, 0, row);
+                        ps[k] = row;
+                    }
+                    alpha[k] = _iy.alpha[k*dstHeight + y];
+                }
+                ResizeBicubicY(ps, alpha, _ix.size, dst);
+            }
+        }
+
+        void ResizeBicubic(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+        {
+            ResizerByteBicubic resizer(Base::ResParam(srcWidth, srcHeight, dstWidth, dstHeight, channelCount, SimdResizeMethodBicubic));
+            resizer.Run(src, srcStride, dst, dstStride);
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
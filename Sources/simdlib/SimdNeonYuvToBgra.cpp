@@ -193,6 +193,51 @@ namespace Simd
 			else
 				Yuv444pToBgra<false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 		}
+
+		template <bool align> void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, 
+			size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+		{
+			assert((width%2 == 0) && (height%2 == 0) && (width >= DA) && (height >= 2));
+			if(align)
+				assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgra) && Aligned(bgraStride));
+
+			uint8x16_t _alpha = vdupq_n_u8(alpha);
+			size_t bodyWidth = AlignLo(width, DA);
+			size_t tail = width - bodyWidth;
+			uint8x16x2_t _uv, _u, _v;
+			for(size_t row = 0; row < height; row += 2)
+			{
+				for(size_t colY = 0, colBgra = 0; colY < bodyWidth; colY += DA, colBgra += OA)
+				{
+					_uv = Load2<align>(uv + colY);
+					_u = vzipq_u8(_uv.val[0], _uv.val[0]);
+					_v = vzipq_u8(_uv.val[1], _uv.val[1]);
+					Yuv422pToBgra<align>(y + colY, _u, _v, _alpha, bgra + colBgra);
+					Yuv422pToBgra<align>(y + colY + yStride, _u, _v, _alpha, bgra + colBgra + bgraStride);
+				}
+				if(tail)
+				{
+					size_t offset = width - DA;
+					_uv = Load2<false>(uv + offset);
+					_u = vzipq_u8(_uv.val[0], _uv.val[0]);
+					_v = vzipq_u8(_uv.val[1], _uv.val[1]);
+					Yuv422pToBgra<false>(y + offset, _u, _v, _alpha, bgra + 4*offset);
+					Yuv422pToBgra<false>(y + offset + yStride, _u, _v, _alpha, bgra + 4*offset + bgraStride);
+				}
+				y += 2*yStride;
+				uv += uvStride;
+				bgra += 2*bgraStride;
+			}
+		}
+
+		void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, 
+			size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+		{
+			if(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgra) && Aligned(bgraStride))
+				Nv12ToBgra<true>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+			else
+				Nv12ToBgra<false>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+		}
     }
 #endif// SIMD_NEON_ENABLE
 }
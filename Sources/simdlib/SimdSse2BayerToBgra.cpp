@@ -0,0 +1,99 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBayer.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        SIMD_INLINE void StoreBgra(__m128i blue, __m128i green, __m128i red, const __m128i & alpha, uint8_t * bgra)
+        {
+            __m128i bg0 = UnpackU8<0>(blue, green);
+            __m128i bg1 = UnpackU8<1>(blue, green);
+            __m128i ra0 = UnpackU8<0>(red, alpha);
+            __m128i ra1 = UnpackU8<1>(red, alpha);
+            Store<false>((__m128i*)bgra + 0, UnpackU16<0>(bg0, ra0));
+            Store<false>((__m128i*)bgra + 1, UnpackU16<1>(bg0, ra0));
+            Store<false>((__m128i*)bgra + 2, UnpackU16<0>(bg1, ra1));
+            Store<false>((__m128i*)bgra + 3, UnpackU16<1>(bg1, ra1));
+        }
+
+        template <SimdPixelFormatType bayerFormat> SIMD_INLINE void BayerToBgra(const uint8_t * src[6], size_t col, const __m128i & alpha, uint8_t * bgra, size_t stride)
+        {
+            __m128i s[6][6], d[12];
+            LoadBayer(src, col, s);
+            BayerToBgr<bayerFormat>(s, d);
+            StoreBgra(Merge16(d[0], d[3]), Merge16(d[1], d[4]), Merge16(d[2], d[5]), alpha, bgra);
+            StoreBgra(Merge16(d[6], d[9]), Merge16(d[7], d[10]), Merge16(d[8], d[11]), alpha, bgra + stride);
+        }
+
+        template <SimdPixelFormatType bayerFormat> void BayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            const uint8_t * src[6];
+            __m128i _alpha = _mm_set1_epi8(alpha);
+            size_t bodyEnd = 2 + AlignLo(width - 4, A);
+            for(size_t row = 0; row < height; row += 2)
+            {
+                Base::BayerSetRows(bayer, bayerStride, row, height, src);
+
+                Base::BayerToBgra<bayerFormat>(src, 0, 0, 2, bgra, bgraStride, alpha);
+                for(size_t col = 2; col < bodyEnd; col += A)
+                    BayerToBgra<bayerFormat>(src, col, _alpha, bgra + 4*col, bgraStride);
+                if(bodyEnd != width - 2)
+                    BayerToBgra<bayerFormat>(src, width - 2 - A, _alpha, bgra + 4*(width - 2 - A), bgraStride);
+                Base::BayerToBgra<bayerFormat>(src, width - 4, width - 2, width - 2, bgra + 4*(width - 2), bgraStride, alpha);
+
+                bayer += 2*bayerStride;
+                bgra += 2*bgraStride;
+            }
+        }
+
+        void BayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width%2 == 0) && (height%2 == 0) && (width >= A + 4));
+
+            switch(bayerFormat)
+            {
+            case SimdPixelFormatBayerGrbg: 
+                BayerToBgra<SimdPixelFormatBayerGrbg>(bayer, width, height, bayerStride, bgra, bgraStride, alpha);
+                break;
+            case SimdPixelFormatBayerGbrg:
+                BayerToBgra<SimdPixelFormatBayerGbrg>(bayer, width, height, bayerStride, bgra, bgraStride, alpha);
+                break;
+            case SimdPixelFormatBayerRggb:
+                BayerToBgra<SimdPixelFormatBayerRggb>(bayer, width, height, bayerStride, bgra, bgraStride, alpha);
+                break;
+            case SimdPixelFormatBayerBggr:
+                BayerToBgra<SimdPixelFormatBayerBggr>(bayer, width, height, bayerStride, bgra, bgraStride, alpha);
+                break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
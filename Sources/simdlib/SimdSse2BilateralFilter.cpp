@@ -0,0 +1,132 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBilateralFilter.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        const size_t BILATERAL_FILTER_BLOCK = 8;
+
+        template<size_t channelCount> SIMD_INLINE void BilateralFilterExact(const uint8_t * const * rows, size_t window, size_t radius, 
+            const Base::BilateralFilterTap * taps, size_t tapCount, const float * range, size_t offset, uint8_t * dst)
+        {
+            SIMD_ALIGNED(16) uint16_t distance[BILATERAL_FILTER_BLOCK];
+            __m128i center[channelCount];
+            __m128 sum[channelCount][2], norm[2] = { _mm_setzero_ps(), _mm_setzero_ps() };
+            for (size_t c = 0; c < channelCount; ++c)
+            {
+                center[c] = _mm_loadl_epi64((__m128i*)(rows[c*window + radius] + offset));
+                sum[c][0] = _mm_setzero_ps();
+                sum[c][1] = _mm_setzero_ps();
+            }
+            for (size_t t = 0; t < tapCount; ++t)
+            {
+                __m128i value[channelCount], dist = K_ZERO;
+                for (size_t c = 0; c < channelCount; ++c)
+                {
+                    value[c] = _mm_loadl_epi64((__m128i*)(rows[c*window + taps[t].row] + offset + taps[t].col));
+                    __m128i absDiff = _mm_or_si128(_mm_subs_epu8(value[c], center[c]), _mm_subs_epu8(center[c], value[c]));
+                    dist = _mm_add_epi16(dist, _mm_unpacklo_epi8(absDiff, K_ZERO));
+                    value[c] = _mm_unpacklo_epi8(value[c], K_ZERO);
+                }
+                _mm_store_si128((__m128i*)distance, dist);
+                __m128 weight = _mm_set1_ps(taps[t].weight);
+                __m128 w0 = _mm_mul_ps(weight, _mm_setr_ps(range[distance[0]], range[distance[1]], range[distance[2]], range[distance[3]]));
+                __m128 w1 = _mm_mul_ps(weight, _mm_setr_ps(range[distance[4]], range[distance[5]], range[distance[6]], range[distance[7]]));
+                norm[0] = _mm_add_ps(norm[0], w0);
+                norm[1] = _mm_add_ps(norm[1], w1);
+                for (size_t c = 0; c < channelCount; ++c)
+                {
+                    sum[c][0] = _mm_add_ps(sum[c][0], _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(value[c], K_ZERO)), w0));
+                    sum[c][1] = _mm_add_ps(sum[c][1], _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(value[c], K_ZERO)), w1));
+                }
+            }
+            SIMD_ALIGNED(16) uint8_t buffer[channelCount][A];
+            for (size_t c = 0; c < channelCount; ++c)
+            {
+                __m128i lo = _mm_cvtps_epi32(_mm_div_ps(sum[c][0], norm[0]));
+                __m128i hi = _mm_cvtps_epi32(_mm_div_ps(sum[c][1], norm[1]));
+                _mm_store_si128((__m128i*)buffer[c], _mm_packus_epi16(_mm_packs_epi32(lo, hi), K_ZERO));
+            }
+            for (size_t i = 0; i < BILATERAL_FILTER_BLOCK; ++i)
+                for (size_t c = 0; c < channelCount; ++c)
+                    dst[i*channelCount + c] = buffer[c][i];
+        }
+
+        template<size_t channelCount> void BilateralFilterExact(const uint8_t * const * rows, size_t radius,
+            const Base::BilateralFilterTap * taps, size_t tapCount, const float * range, size_t width, uint8_t * dst)
+        {
+            size_t window = 2 * radius + 1, alignedWidth = AlignLo(width, BILATERAL_FILTER_BLOCK);
+            for (size_t x = 0; x < alignedWidth; x += BILATERAL_FILTER_BLOCK)
+                BilateralFilterExact<channelCount>(rows, window, radius, taps, tapCount, range, x, dst + x*channelCount);
+            if (alignedWidth != width)
+            {
+                uint8_t tail[BILATERAL_FILTER_BLOCK*channelCount];
+                BilateralFilterExact<channelCount>(rows, window, radius, taps, tapCount, range, alignedWidth, tail);
+                memcpy(dst + alignedWidth*channelCount, tail, (width - alignedWidth)*channelCount);
+            }
+        }
+
+        void BilateralFilterExact(const uint8_t * const * rows, size_t channelCount, size_t radius,
+            const Base::BilateralFilterTap * taps, size_t tapCount, const float * range, size_t width, uint8_t * dst)
+        {
+            switch (channelCount)
+            {
+            case 1: BilateralFilterExact<1>(rows, radius, taps, tapCount, range, width, dst); break;
+            case 2: BilateralFilterExact<2>(rows, radius, taps, tapCount, range, width, dst); break;
+            case 3: BilateralFilterExact<3>(rows, radius, taps, tapCount, range, width, dst); break;
+            case 4: BilateralFilterExact<4>(rows, radius, taps, tapCount, range, width, dst); break;
+            }
+        }
+
+        void BilateralFilterRecursive(const float * src, const float * prev, const float * weight, size_t width, size_t planes, size_t stride, float inv, float * dst)
+        {
+            size_t alignedWidth = AlignLo(width, F);
+            __m128 _inv = _mm_set1_ps(inv);
+            for (size_t p = 0, offset = 0; p < planes; ++p, offset += stride)
+            {
+                for (size_t x = 0; x < alignedWidth; x += F)
+                    _mm_storeu_ps(dst + offset + x, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + offset + x), _inv), 
+                        _mm_mul_ps(_mm_loadu_ps(prev + offset + x), _mm_loadu_ps(weight + x))));
+                for (size_t x = alignedWidth; x < width; ++x)
+                    dst[offset + x] = src[offset + x] * inv + prev[offset + x] * weight[x];
+            }
+        }
+
+        void BilateralFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, SimdBilateralFilterType type,
+            float sigmaSpace, float sigmaRange, size_t radius, uint8_t * dst, size_t dstStride)
+        {
+            if (type == SimdBilateralFilterFast)
+                Base::BilateralFilterFastRun(src, srcStride, width, height, channelCount, sigmaSpace, sigmaRange, dst, dstStride, BilateralFilterRecursive);
+            else
+                Base::BilateralFilterExactRun(src, srcStride, width, height, channelCount, sigmaSpace, sigmaRange,
+                    Base::BilateralFilterRadius(sigmaSpace, radius), dst, dstStride, BilateralFilterExact);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -0,0 +1,126 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdCanny.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        SIMD_INLINE __m128i LoadCanny(const uint8_t * p)
+        {
+            return _mm_unpacklo_epi8(_mm_loadl_epi64((__m128i*)p), K_ZERO);
+        }
+
+        SIMD_INLINE __m128i AbsCanny(__m128i a)
+        {
+            return _mm_max_epi16(a, _mm_sub_epi16(K_ZERO, a));
+        }
+
+        SIMD_INLINE void CannyGradientBlock(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t x, int16_t * dx, int16_t * dy, int16_t * mag)
+        {
+            __m128i s0l = LoadCanny(src0 + x - 1), s0c = LoadCanny(src0 + x), s0r = LoadCanny(src0 + x + 1);
+            __m128i s1l = LoadCanny(src1 + x - 1), s1r = LoadCanny(src1 + x + 1);
+            __m128i s2l = LoadCanny(src2 + x - 1), s2c = LoadCanny(src2 + x), s2r = LoadCanny(src2 + x + 1);
+            __m128i _dx = _mm_sub_epi16(_mm_add_epi16(_mm_add_epi16(s0r, s2r), _mm_slli_epi16(s1r, 1)),
+                _mm_add_epi16(_mm_add_epi16(s0l, s2l), _mm_slli_epi16(s1l, 1)));
+            __m128i _dy = _mm_sub_epi16(_mm_add_epi16(_mm_add_epi16(s2l, s2r), _mm_slli_epi16(s2c, 1)),
+                _mm_add_epi16(_mm_add_epi16(s0l, s0r), _mm_slli_epi16(s0c, 1)));
+            _mm_storeu_si128((__m128i*)(dx + x), _dx);
+            _mm_storeu_si128((__m128i*)(dy + x), _dy);
+            _mm_storeu_si128((__m128i*)(mag + x), _mm_add_epi16(AbsCanny(_dx), AbsCanny(_dy)));
+        }
+
+        void CannyGradient(const uint8_t * src0, const uint8_t * src1, const uint8_t * src2, size_t width, int16_t * dx, int16_t * dy, int16_t * mag)
+        {
+            assert(width >= HA);
+            size_t alignedWidth = AlignLo(width, HA);
+            for (size_t x = 0; x < alignedWidth; x += HA)
+                CannyGradientBlock(src0, src1, src2, x, dx, dy, mag);
+            if (alignedWidth != width)
+                CannyGradientBlock(src0, src1, src2, width - HA, dx, dy, mag);
+        }
+
+        SIMD_INLINE void CannySuppressBlock(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2,
+            size_t x, __m128i low, __m128i high, uint8_t * dst)
+        {
+            static const __m128i K16_0012 = SIMD_MM_SET1_EPI16(12);
+            static const __m128i K16_0029 = SIMD_MM_SET1_EPI16(29);
+            __m128i _dx = _mm_loadu_si128((__m128i*)(dx + x)), _dy = _mm_loadu_si128((__m128i*)(dy + x));
+            __m128i adx = AbsCanny(_dx), ady = AbsCanny(_dy);
+            __m128i hor = _mm_cmplt_epi16(_mm_mullo_epi16(ady, K16_0029), _mm_mullo_epi16(adx, K16_0012));
+            __m128i ver = _mm_cmplt_epi16(_mm_mullo_epi16(adx, K16_0029), _mm_mullo_epi16(ady, K16_0012));
+            __m128i same = _mm_cmpgt_epi16(_mm_xor_si128(_dx, _dy), _mm_set1_epi16(-1));
+            __m128i a = Combine(same, _mm_loadu_si128((__m128i*)(mag0 + x - 1)), _mm_loadu_si128((__m128i*)(mag0 + x + 1)));
+            __m128i b = Combine(same, _mm_loadu_si128((__m128i*)(mag2 + x + 1)), _mm_loadu_si128((__m128i*)(mag2 + x - 1)));
+            a = Combine(ver, _mm_loadu_si128((__m128i*)(mag0 + x)), a);
+            b = Combine(ver, _mm_loadu_si128((__m128i*)(mag2 + x)), b);
+            a = Combine(hor, _mm_loadu_si128((__m128i*)(mag1 + x - 1)), a);
+            b = Combine(hor, _mm_loadu_si128((__m128i*)(mag1 + x + 1)), b);
+            __m128i m = _mm_loadu_si128((__m128i*)(mag1 + x));
+            __m128i weak = _mm_cmpgt_epi16(m, low), strong = _mm_cmpgt_epi16(m, high);
+            __m128i max = _mm_andnot_si128(_mm_cmpgt_epi16(b, m), _mm_cmpgt_epi16(m, a));
+            __m128i label = _mm_and_si128(max, _mm_sub_epi16(K_ZERO, _mm_add_epi16(weak, strong)));
+            _mm_storel_epi64((__m128i*)(dst + x), _mm_packus_epi16(label, K_ZERO));
+        }
+
+        void CannySuppress(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2,
+            size_t width, int16_t low, int16_t high, uint8_t * dst)
+        {
+            assert(width >= HA);
+            size_t alignedWidth = AlignLo(width, HA);
+            __m128i _low = _mm_set1_epi16(low), _high = _mm_set1_epi16(high);
+            for (size_t x = 0; x < alignedWidth; x += HA)
+                CannySuppressBlock(dx, dy, mag0, mag1, mag2, x, _low, _high, dst);
+            if (alignedWidth != width)
+                CannySuppressBlock(dx, dy, mag0, mag1, mag2, width - HA, _low, _high, dst);
+        }
+
+        size_t CannyFind(const uint8_t * row, size_t begin, size_t width)
+        {
+            const __m128i strong = _mm_set1_epi8(Base::CANNY_STRONG);
+            size_t x = begin;
+            for (; x + A <= width; x += A)
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)(row + x)), strong)))
+                    break;
+            for (; x < width; ++x)
+                if (row[x] == Base::CANNY_STRONG)
+                    return x;
+            return width;
+        }
+
+        void CannyNms(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t low, uint16_t high, uint8_t * dst, size_t dstStride)
+        {
+            Base::CannyNmsRun(src, srcStride, width, height, low, high, dst, dstStride, CannyGradient, CannySuppress);
+        }
+
+        void CannyHysteresis(uint8_t * dst, size_t dstStride, size_t width, size_t height)
+        {
+            Base::CannyHysteresisRun(dst, dstStride, width, height, CannyFind);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdMedianFilter.h"
 
 namespace Simd
 {
@@ -506,6 +507,62 @@ namespace Simd
             else
                 MedianFilterSquare5x5<false>(src, srcStride, width, height, channelCount, dst, dstStride);
         }
+
+        struct MedianHistogram
+        {
+            static SIMD_INLINE void Add(const uint16_t * src, uint16_t * dst)
+            {
+                __m128i * d = (__m128i*)dst;
+                _mm_storeu_si128(d + 0, _mm_add_epi16(_mm_loadu_si128(d + 0), _mm_loadu_si128((__m128i*)src + 0)));
+                _mm_storeu_si128(d + 1, _mm_add_epi16(_mm_loadu_si128(d + 1), _mm_loadu_si128((__m128i*)src + 1)));
+            }
+
+            static SIMD_INLINE void Sub(const uint16_t * src, uint16_t * dst)
+            {
+                __m128i * d = (__m128i*)dst;
+                _mm_storeu_si128(d + 0, _mm_sub_epi16(_mm_loadu_si128(d + 0), _mm_loadu_si128((__m128i*)src + 0)));
+                _mm_storeu_si128(d + 1, _mm_sub_epi16(_mm_loadu_si128(d + 1), _mm_loadu_si128((__m128i*)src + 1)));
+            }
+
+            static SIMD_INLINE void AddSub(const uint16_t * add, const uint16_t * sub, uint16_t * dst)
+            {
+                __m128i * d = (__m128i*)dst;
+                _mm_storeu_si128(d + 0, _mm_add_epi16(_mm_loadu_si128(d + 0), _mm_sub_epi16(_mm_loadu_si128((__m128i*)add + 0), _mm_loadu_si128((__m128i*)sub + 0))));
+                _mm_storeu_si128(d + 1, _mm_add_epi16(_mm_loadu_si128(d + 1), _mm_sub_epi16(_mm_loadu_si128((__m128i*)add + 1), _mm_loadu_si128((__m128i*)sub + 1))));
+            }
+
+            static SIMD_INLINE size_t Find(const uint16_t * hist, size_t & sum, size_t threshold)
+            {
+                SIMD_ALIGNED(16) uint16_t prefix[24];
+                __m128i lo = _mm_loadu_si128((__m128i*)hist + 0);
+                __m128i hi = _mm_loadu_si128((__m128i*)hist + 1);
+                lo = _mm_add_epi16(lo, _mm_slli_si128(lo, 2));
+                hi = _mm_add_epi16(hi, _mm_slli_si128(hi, 2));
+                lo = _mm_add_epi16(lo, _mm_slli_si128(lo, 4));
+                hi = _mm_add_epi16(hi, _mm_slli_si128(hi, 4));
+                lo = _mm_add_epi16(lo, _mm_slli_si128(lo, 8));
+                hi = _mm_add_epi16(hi, _mm_slli_si128(hi, 8));
+                lo = _mm_add_epi16(lo, _mm_set1_epi16((short)sum));
+                __m128i last = _mm_shufflehi_epi16(lo, 0xFF);
+                hi = _mm_add_epi16(hi, _mm_unpackhi_epi64(last, last));
+                __m128i _threshold = _mm_set1_epi16((short)threshold);
+                __m128i lesser = _mm_packs_epi16(
+                    _mm_cmpeq_epi16(_mm_subs_epu16(lo, _threshold), K_ZERO),
+                    _mm_cmpeq_epi16(_mm_subs_epu16(hi, _threshold), K_ZERO));
+                __m128i count = _mm_sad_epu8(_mm_and_si128(lesser, K8_01), K_ZERO);
+                size_t index = _mm_cvtsi128_si32(count) + _mm_extract_epi16(count, 4);
+                prefix[7] = (uint16_t)sum;
+                _mm_store_si128((__m128i*)prefix + 1, lo);
+                _mm_store_si128((__m128i*)prefix + 2, hi);
+                sum = prefix[7 + index];
+                return index;
+            }
+        };
+
+        void MedianFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride)
+        {
+            Base::MedianFilterRun<MedianHistogram>(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+        }
 	}
 #endif// SIMD_SSE2_ENABLE
 }
@@ -0,0 +1,70 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMorphology.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        template<bool dilate> SIMD_INLINE __m128i MorphologyOp(__m128i a, __m128i b)
+        {
+            return dilate ? _mm_max_epu8(a, b) : _mm_min_epu8(a, b);
+        }
+
+        template<bool dilate> void MorphologyRow(const uint8_t * a, const uint8_t * b, size_t size, uint8_t * dst)
+        {
+            size_t alignedSize = AlignLo(size, A), i = 0;
+            for (; i < alignedSize; i += A)
+                _mm_storeu_si128((__m128i*)(dst + i), MorphologyOp<dilate>(_mm_loadu_si128((__m128i*)(a + i)), _mm_loadu_si128((__m128i*)(b + i))));
+            for (; i < size; ++i)
+                dst[i] = dilate ? Simd::Max(a[i], b[i]) : Simd::Min(a[i], b[i]);
+        }
+
+        void MorphologyBlend(const uint8_t * src, const uint8_t * mask, uint8_t index, size_t size, uint8_t * dst)
+        {
+            __m128i _index = _mm_set1_epi8(index);
+            size_t alignedSize = AlignLo(size, A), i = 0;
+            for (; i < alignedSize; i += A)
+            {
+                __m128i _mask = _mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)(mask + i)), _index);
+                __m128i _dst = _mm_loadu_si128((__m128i*)(dst + i)), _src = _mm_loadu_si128((__m128i*)(src + i));
+                _mm_storeu_si128((__m128i*)(dst + i), Combine(_mask, _dst, _src));
+            }
+            for (; i < size; ++i)
+                if (mask[i] != index)
+                    dst[i] = src[i];
+        }
+
+        void Morphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdMorphologyType type, SimdMorphologyShapeType shape,
+            size_t windowX, size_t windowY, const uint8_t * mask, size_t maskStride, uint8_t index, uint8_t * dst, size_t dstStride)
+        {
+            Base::MorphologyFuncs funcs = { MorphologyRow<false>, MorphologyRow<true>, MorphologyBlend };
+            Base::MorphologyRun(src, srcStride, width, height, type, shape, windowX, windowY, mask, maskStride, index, dst, dstStride, funcs);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -91,8 +91,9 @@ namespace Simd
                 {
                     size_t srcCol = srcWidth - A - lastOddCol;
                     size_t dstCol = dstWidth - HA - lastOddCol;
-                    _mm_storel_epi64((__m128i*)(dst + dstCol), ReduceRow<compensation>(ReduceColBody<false>(s0 + srcCol), 
-                        ReduceColBody<false>(s1 + srcCol), ReduceColBody<false>(s2 + srcCol)));
+                    if(srcCol)
+                        _mm_storel_epi64((__m128i*)(dst + dstCol), ReduceRow<compensation>(ReduceColBody<false>(s0 + srcCol), 
+                            ReduceColBody<false>(s1 + srcCol), ReduceColBody<false>(s2 + srcCol)));
                     if(lastOddCol)
                         dst[dstWidth - 1] = Base::GaussianBlur3x3<compensation>(s0 + srcWidth, s1 + srcWidth, s2 + srcWidth, -2, -1, -1);
                 }
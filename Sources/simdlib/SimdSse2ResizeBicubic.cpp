@@ -0,0 +1,100 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        SIMD_INLINE __m128i ResizeBicubicY(const float * const * src, const __m128 * alpha, size_t offset)
+        {
+            __m128 sum = _mm_mul_ps(_mm_loadu_ps(src[0] + offset), alpha[0]);
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src[1] + offset), alpha[1]));
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src[2] + offset), alpha[2]));
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src[3] + offset), alpha[3]));
+            return _mm_cvtps_epi32(sum);
+        }
+
+        SIMD_INLINE void ResizeBicubicY(const float * const * src, const __m128 * alpha, size_t offset, uint8_t * dst)
+        {
+            __m128i lo = _mm_packs_epi32(ResizeBicubicY(src, alpha, offset + 0 * F), ResizeBicubicY(src, alpha, offset + 1 * F));
+            __m128i hi = _mm_packs_epi32(ResizeBicubicY(src, alpha, offset + 2 * F), ResizeBicubicY(src, alpha, offset + 3 * F));
+            _mm_storeu_si128((__m128i*)(dst + offset), _mm_packus_epi16(lo, hi));
+        }
+
+        void ResizeBicubicY(const float * const * src, const float * alpha, size_t size, uint8_t * dst)
+        {
+            assert(size >= A);
+
+            __m128 _alpha[4];
+            for (size_t k = 0; k < 4; ++k)
+                _alpha[k] = _mm_set1_ps(alpha[k]);
+            size_t alignedSize = AlignLo(size, A);
+            for (size_t i = 0; i < alignedSize; i += A)
+                ResizeBicubicY(src, _alpha, i, dst);
+            if (alignedSize != size)
+                ResizeBicubicY(src, _alpha, size - A, dst);
+        }
+
+        ResizerByteBicubic::ResizerByteBicubic(const Base::ResParam & param)
+            : Base::ResizerByteBicubic(param)
+        {
+        }
+
+        void ResizerByteBicubic::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            size_t dstHeight = _param.dstH;
+            _rows.Reset();
+            for (size_t y = 0; y < dstHeight; ++y, dst = Next(dst, dstStride))
+            {
+                const float * ps[4];
+                float alpha[4];
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    int sy = _iy.index[k*dstHeight + y];
+                    ps[k] = _rows.Get(sy);
+                    if (ps[k] == NULL)
+                    {
+                        float * row = _rows.Set(sy, _iy.index.data + y, dstHeight);
+                        Base::ResizeBicubicX(src + sy*srcStride, _ix, 0, row);
+                        ps[k] = row;
+                    }
+                    alpha[k] = _iy.alpha[k*dstHeight + y];
+                }
+                ResizeBicubicY(ps, alpha, _ix.size, dst);
+            }
+        }
+
+        void ResizeBicubic(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+        {
+            ResizerByteBicubic resizer(Base::ResParam(srcWidth, srcHeight, dstWidth, dstHeight, channelCount, SimdResizeMethodBicubic));
+            resizer.Run(src, srcStride, dst, dstStride);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -24,42 +24,13 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdResizer.h"
 
 namespace Simd
 {
 #ifdef SIMD_SSE2_ENABLE
     namespace Sse2
     {
-        namespace
-        {
-            struct Buffer
-            {
-                Buffer(size_t size, size_t width, size_t height)
-                {
-                    _p = Allocate(2*size + sizeof(int16_t)*2*width + sizeof(int)*(2*height + width));
-                    bx[0] = (uint8_t*)_p;
-                    bx[1] = bx[0] + size;
-                    ax = (int16_t*)(bx[1] + size);
-                    ix = (int*)(ax + 2*width);
-                    iy = ix + width;
-                    ay = iy + height;
-                }
-
-                ~Buffer()
-                {
-                    Free(_p);
-                }
-
-                uint8_t * bx[2];
-                int16_t * ax;
-                int * ix;
-                int * ay;
-                int * iy;
-            private:
-                void *_p;
-            };
-        }
-
         void EstimateAlphaIndexX(size_t srcSize, size_t dstSize, int * indexes, int16_t * alphas)
         {
             float scale = (float)srcSize/dstSize;
@@ -135,45 +106,54 @@ namespace Simd
             Store<false>((__m128i*)dst, _mm_packus_epi16(lo, hi));
         }
 
-        template <size_t channelCount> void ResizeBilinear(
-            const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+        ResizerByteBilinear::ResizerByteBilinear(const Base::ResParam & param)
+            : Base::Resizer(param)
         {
-            assert(dstWidth >= A);
+            assert(_param.dstW >= A && (_param.channels == 1 || _param.channels == 2));
+
+            size_t bufferSize = AlignHi(_param.dstW, A)*_param.channels*2;
+            _bx[0].Resize(bufferSize);
+            _bx[1].Resize(bufferSize);
+            _ax.Resize(AlignHi(_param.dstW, A)*2);
+            _ix.Resize(_param.dstW);
+            _iy.Resize(_param.dstH);
+            _ay.Resize(_param.dstH);
+
+            Base::EstimateAlphaIndex(_param.srcH, _param.dstH, _iy.data, _ay.data, 1);
+
+            EstimateAlphaIndexX(_param.srcW, _param.dstW, _ix.data, _ax.data);
+        }
 
+        template <size_t channelCount> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
             struct One { uint8_t channels[channelCount]; };
             struct Two { uint8_t channels[channelCount*2]; };
 
+            size_t dstWidth = _param.dstW, dstHeight = _param.dstH;
             size_t size = 2*dstWidth*channelCount;
-            size_t bufferSize = AlignHi(dstWidth, A)*channelCount*2;
             size_t alignedSize = AlignHi(size, DA) - DA;
-            Buffer buffer(bufferSize, dstWidth, dstHeight);
-
             const size_t stepB = A/channelCount;
             const size_t stepA = DA/channelCount;
             size_t bufferWidth = AlignHi(dstWidth, stepB);
-
-            Base::EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1);
-
-            EstimateAlphaIndexX(srcWidth, dstWidth, buffer.ix, buffer.ax);
+            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
 
             ptrdiff_t previous = -2;
 
             __m128i a[2];
 
-            for(size_t yDst = 0; yDst < dstHeight; yDst++, dst += dstStride)
+            for(size_t yDst = 0; yDst < dstHeight; yDst++, dst = Next(dst, dstStride))
             {
-                a[0] = _mm_set1_epi16(int16_t(Base::FRACTION_RANGE - buffer.ay[yDst]));
-                a[1] = _mm_set1_epi16(int16_t(buffer.ay[yDst]));
+                a[0] = _mm_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
+                a[1] = _mm_set1_epi16(int16_t(_ay[yDst]));
 
-                ptrdiff_t sy = buffer.iy[yDst];
+                ptrdiff_t sy = _iy[yDst];
                 int k = 0;
 
                 if(sy == previous)
                     k = 2;
                 else if(sy == previous + 1)
                 {
-                    Swap(buffer.bx[0], buffer.bx[1]);
+                    Swap(bx[0], bx[1]);
                     k = 1;
                 }
 
@@ -181,19 +161,29 @@ namespace Simd
 
                 for(; k < 2; k++)
                 {
-                    Two * pb = (Two *)buffer.bx[k];
+                    Two * pb = (Two *)bx[k];
                     const One * ps = (const One *)(src + (sy + k)*srcStride);
                     for(size_t x = 0; x < dstWidth; x++)
-                        pb[x] = *(Two *)(ps + buffer.ix[x]);
+                        pb[x] = *(Two *)(ps + _ix[x]);
 
                     for(size_t ib = 0, ia = 0; ib < bufferWidth; ib += stepB, ia += stepA)
-                        InterpolateX<channelCount>((__m128i*)(buffer.ax + ia), (__m128i*)(pb + ib));
+                        InterpolateX<channelCount>((__m128i*)(_ax.data + ia), (__m128i*)(pb + ib));
                 }
 
                 for(size_t ib = 0, id = 0; ib < alignedSize; ib += DA, id += A)
-                    InterpolateY<true>(buffer.bx[0] + ib, buffer.bx[1] + ib, a, dst + id);
+                    InterpolateY<true>(bx[0] + ib, bx[1] + ib, a, dst + id);
                 size_t i = size - DA;
-                InterpolateY<false>(buffer.bx[0] + i, buffer.bx[1] + i, a, dst + i/2);
+                InterpolateY<false>(bx[0] + i, bx[1] + i, a, dst + i/2);
+            }
+        }
+
+        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            switch(_param.channels)
+            {
+            case 1: Run<1>(src, srcStride, dst, dstStride); break;
+            case 2: Run<2>(src, srcStride, dst, dstStride); break;
+            default: assert(0);
             }
         }
 
@@ -201,18 +191,27 @@ namespace Simd
             const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
         {
-            switch(channelCount)
+            if (channelCount == 1 || channelCount == 2)
             {
-            case 1: 
-                ResizeBilinear<1>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride); 
-                break;
-            case 2: 
-                ResizeBilinear<2>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride); 
-                break;
-            default: 
-                Base::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount); 
+                ResizerByteBilinear resizer(Base::ResParam(srcWidth, srcHeight, dstWidth, dstHeight, channelCount, SimdResizeMethodBilinear));
+                resizer.Run(src, srcStride, dst, dstStride);
             }
-        }	
+            else
+                Base::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+        }
+
+        void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method)
+        {
+            Base::ResParam param(srcX, srcY, dstX, dstY, channels, method);
+            if (method == SimdResizeMethodBilinear && dstX >= A && (channels == 1 || channels == 2))
+                return new ResizerByteBilinear(param);
+            else if (method == SimdResizeMethodArea && srcX >= A)
+                return new ResizerByteArea(param);
+            else if (method == SimdResizeMethodBicubic && dstX >= A)
+                return new ResizerByteBicubic(param);
+            else
+                return Base::ResizerInit(srcX, srcY, dstX, dstY, channels, method);
+        }
     }
 #endif//SIMD_SSE2_ENABLE
 }
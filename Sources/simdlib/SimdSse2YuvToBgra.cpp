@@ -201,6 +201,47 @@ namespace Simd
             else
                 Yuv422pToBgra<false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
         }
+
+		template <bool align> void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, 
+			size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+		{
+			assert((width%2 == 0) && (height%2 == 0) && (width >= DA) && (height >= 2));
+			if(align)
+				assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgra) && Aligned(bgraStride));
+
+			__m128i a_0 = _mm_slli_si128(_mm_set1_epi16(alpha), 1);
+			size_t bodyWidth = AlignLo(width, DA);
+			size_t tail = width - bodyWidth;
+			__m128i u_, v_;
+			for(size_t row = 0; row < height; row += 2)
+			{
+				for(size_t colY = 0, colBgra = 0; colY < bodyWidth; colY += DA, colBgra += OA)
+				{
+					LoadUv<align>(uv + colY, u_, v_);
+					Yuv422pToBgra<align>(y + colY, u_, v_, a_0, bgra + colBgra);
+					Yuv422pToBgra<align>(y + colY + yStride, u_, v_, a_0, bgra + colBgra + bgraStride);
+				}
+				if(tail)
+				{
+					size_t offset = width - DA;
+					LoadUv<false>(uv + offset, u_, v_);
+					Yuv422pToBgra<false>(y + offset, u_, v_, a_0, bgra + 4*offset);
+					Yuv422pToBgra<false>(y + offset + yStride, u_, v_, a_0, bgra + 4*offset + bgraStride);
+				}
+				y += 2*yStride;
+				uv += uvStride;
+				bgra += 2*bgraStride;
+			}
+		}
+
+		void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, 
+			size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+		{
+			if(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgra) && Aligned(bgraStride))
+				Nv12ToBgra<true>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+			else
+				Nv12ToBgra<false>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
+		}
     }
 #endif// SIMD_SSE2_ENABLE
 }
@@ -0,0 +1,75 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSSE3_ENABLE    
+    namespace Ssse3
+    {
+        template <bool align> SIMD_INLINE void BgrToHsv(const uint8_t * bgr, uint8_t * hsv, const __m128 & KF_255_DIV_6)
+        {
+            __m128i _bgr[3];
+            _bgr[0] = Load<align>((__m128i*)bgr + 0);
+            _bgr[1] = Load<align>((__m128i*)bgr + 1);
+            _bgr[2] = Load<align>((__m128i*)bgr + 2);
+            __m128i blue = BgrToBlue(_bgr), green = BgrToGreen(_bgr), red = BgrToRed(_bgr);
+            __m128i hue, saturation, value;
+            Sse2::BgrToHsv(blue, green, red, KF_255_DIV_6, hue, saturation, value);
+            Store<align>((__m128i*)hsv + 0, InterleaveBgr<0>(hue, saturation, value));
+            Store<align>((__m128i*)hsv + 1, InterleaveBgr<1>(hue, saturation, value));
+            Store<align>((__m128i*)hsv + 2, InterleaveBgr<2>(hue, saturation, value));
+        }
+
+        template <bool align> void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(bgr) && Aligned(bgrStride) && Aligned(hsv) && Aligned(hsvStride));
+
+            const __m128 KF_255_DIV_6 = _mm_set1_ps(Base::KF_255_DIV_6);
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    BgrToHsv<align>(bgr + 3*col, hsv + 3*col, KF_255_DIV_6);
+                if (alignedWidth != width)
+                    BgrToHsv<false>(bgr + 3*(width - A), hsv + 3*(width - A), KF_255_DIV_6);
+                bgr += bgrStride;
+                hsv += hsvStride;
+            }
+        }
+
+        void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
+        {
+            if (Aligned(bgr) && Aligned(bgrStride) && Aligned(hsv) && Aligned(hsvStride))
+                BgrToHsv<true>(bgr, width, height, bgrStride, hsv, hsvStride);
+            else
+                BgrToHsv<false>(bgr, width, height, bgrStride, hsv, hsvStride);
+        }
+    }
+#endif// SIMD_SSSE3_ENABLE
+}
@@ -182,6 +182,47 @@ namespace Simd
 			else
 				Yuv444pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 		}
+
+		template <bool align> void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, 
+			size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+		{
+			assert((width%2 == 0) && (height%2 == 0) && (width >= DA) && (height >= 2));
+			if(align)
+				assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgr) && Aligned(bgrStride));
+
+			size_t bodyWidth = AlignLo(width, DA);
+			size_t tail = width - bodyWidth;
+			size_t A6 = A*6;
+			__m128i u_, v_;
+			for(size_t row = 0; row < height; row += 2)
+			{
+				for(size_t colY = 0, colBgr = 0; colY < bodyWidth; colY += DA, colBgr += A6)
+				{
+					LoadUv<align>(uv + colY, u_, v_);
+					Yuv422pToBgr<align>(y + colY, u_, v_, bgr + colBgr);
+					Yuv422pToBgr<align>(y + colY + yStride, u_, v_, bgr + colBgr + bgrStride);
+				}
+				if(tail)
+				{
+					size_t offset = width - DA;
+					LoadUv<false>(uv + offset, u_, v_);
+					Yuv422pToBgr<false>(y + offset, u_, v_, bgr + 3*offset);
+					Yuv422pToBgr<false>(y + offset + yStride, u_, v_, bgr + 3*offset + bgrStride);
+				}
+				y += 2*yStride;
+				uv += uvStride;
+				bgr += 2*bgrStride;
+			}
+		}
+
+		void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, 
+			size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+		{
+			if(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(bgr) && Aligned(bgrStride))
+				Nv12ToBgr<true>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+			else
+				Nv12ToBgr<false>(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
+		}
     }
 #endif// SIMD_SSSE3_ENABLE
 }
@@ -24,6 +24,7 @@
 #include "Simd/SimdBase.h"
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdResizer.h"
 #include "Simd/SimdSet.h"
 
 namespace Simd
@@ -31,36 +32,6 @@ namespace Simd
 #ifdef SIMD_VMX_ENABLE  
     namespace Vmx
     {
-        namespace
-        {
-            struct Buffer
-            {
-                Buffer(size_t size, size_t width, size_t height)
-                {
-                    _p = Allocate(3*size + sizeof(int)*(2*height + width));
-                    bx[0] = (uint8_t*)_p;
-                    bx[1] = bx[0] + size;
-                    ax = bx[1] + size;
-                    ix = (int*)(ax + size);
-                    iy = ix + width;
-                    ay = iy + height;
-                }
-
-                ~Buffer()
-                {
-                    Free(_p);
-                }
-
-                uint8_t * bx[2];
-                uint8_t * ax;
-                int * ix;
-                int * ay;
-                int * iy;
-            private:
-                void *_p;
-            };
-        }
-
         template <size_t channelCount> void EstimateAlphaIndexX(size_t srcSize, size_t dstSize, int * indexes, uint8_t * alphas)
         {
             float scale = (float)srcSize/dstSize;
@@ -164,43 +135,35 @@ namespace Simd
             return vec_pack(lo, hi);
         }
 
-        template <size_t channelCount, bool align> void ResizeBilinear(
-            const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+        template <size_t channelCount, bool align> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
         {
-            assert(dstWidth >= A);
-
             struct One { uint8_t channels[channelCount]; };
             struct Two { uint8_t channels[channelCount*2]; };
 
+            size_t dstWidth = _param.dstW, dstHeight = _param.dstH;
             size_t size = 2*dstWidth*channelCount;
-            size_t bufferSize = AlignHi(dstWidth, A)*channelCount*2;
+            size_t bufferSize = _ax.size;
             size_t alignedSize = AlignHi(size, DA) - DA;
             const size_t step = A*channelCount;
-
-            Buffer buffer(bufferSize, dstWidth, dstHeight);
-
-            Base::EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1);
-
-            EstimateAlphaIndexX<channelCount>(srcWidth, dstWidth, buffer.ix, buffer.ax);
+            uint8_t * bx[2] = { _bx[0].data, _bx[1].data };
 
             ptrdiff_t previous = -2;
 
             v128_u16 a[2];
 
-            for(size_t yDst = 0; yDst < dstHeight; yDst++, dst += dstStride)
+            for(size_t yDst = 0; yDst < dstHeight; yDst++, dst = Next(dst, dstStride))
             {
-                a[0] = SetU16(int16_t(Base::FRACTION_RANGE - buffer.ay[yDst]));
-                a[1] = SetU16(int16_t(buffer.ay[yDst]));
+                a[0] = SetU16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
+                a[1] = SetU16(int16_t(_ay[yDst]));
 
-                ptrdiff_t sy = buffer.iy[yDst];
+                ptrdiff_t sy = _iy[yDst];
                 int k = 0;
 
                 if(sy == previous)
                     k = 2;
                 else if(sy == previous + 1)
                 {
-                    Swap(buffer.bx[0], buffer.bx[1]);
+                    Swap(bx[0], bx[1]);
                     k = 1;
                 }
 
@@ -208,58 +171,90 @@ namespace Simd
 
                 for(; k < 2; k++)
                 {
-                    Two * pb = (Two *)buffer.bx[k];
+                    Two * pb = (Two *)bx[k];
                     const One * psrc = (const One *)(src + (sy + k)*srcStride);
                     for(size_t x = 0; x < dstWidth; x++)
-                        pb[x] = *(Two *)(psrc + buffer.ix[x]);
+                        pb[x] = *(Two *)(psrc + _ix[x]);
 
-                    uint8_t * pbx = buffer.bx[k];
+                    uint8_t * pbx = bx[k];
                     for(size_t i = 0; i < bufferSize; i += step)
-                        InterpolateX<channelCount>(buffer.ax + i, pbx + i);
+                        InterpolateX<channelCount>(_ax.data + i, pbx + i);
                 }
 
                 Storer<align> _dst(dst);
-                Store<align, true>(_dst, InterpolateY<true>(buffer.bx[0], buffer.bx[1], a));
+                Store<align, true>(_dst, InterpolateY<true>(bx[0], bx[1], a));
                 for(size_t i = DA; i < alignedSize; i += DA)
-                    Store<align, false>(_dst, InterpolateY<true>(buffer.bx[0] + i, buffer.bx[1] + i, a));
+                    Store<align, false>(_dst, InterpolateY<true>(bx[0] + i, bx[1] + i, a));
                 Flush(_dst);
                 size_t i = size - DA;
-                Store<false>(dst + i/2, InterpolateY<false>(buffer.bx[0] + i, buffer.bx[1] + i, a));
+                Store<false>(dst + i/2, InterpolateY<false>(bx[0] + i, bx[1] + i, a));
             }
         }
 
-        template <size_t channelCount> void ResizeBilinear(
-            const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+        template <size_t channelCount> void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
         {
             if(Aligned(dst) && Aligned(dstStride))
-                ResizeBilinear<channelCount, true>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                Run<channelCount, true>(src, srcStride, dst, dstStride);
             else
-                ResizeBilinear<channelCount, false>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                Run<channelCount, false>(src, srcStride, dst, dstStride);
+        }
+
+        ResizerByteBilinear::ResizerByteBilinear(const Base::ResParam & param)
+            : Base::Resizer(param)
+        {
+            assert(_param.dstW >= A && _param.channels >= 1 && _param.channels <= 4);
+
+            size_t bufferSize = AlignHi(_param.dstW, A)*_param.channels*2;
+            _bx[0].Resize(bufferSize);
+            _bx[1].Resize(bufferSize);
+            _ax.Resize(bufferSize);
+            _ix.Resize(_param.dstW);
+            _iy.Resize(_param.dstH);
+            _ay.Resize(_param.dstH);
+
+            Base::EstimateAlphaIndex(_param.srcH, _param.dstH, _iy.data, _ay.data, 1);
+
+            switch (_param.channels)
+            {
+            case 1: EstimateAlphaIndexX<1>(_param.srcW, _param.dstW, _ix.data, _ax.data); break;
+            case 2: EstimateAlphaIndexX<2>(_param.srcW, _param.dstW, _ix.data, _ax.data); break;
+            case 3: EstimateAlphaIndexX<3>(_param.srcW, _param.dstW, _ix.data, _ax.data); break;
+            case 4: EstimateAlphaIndexX<4>(_param.srcW, _param.dstW, _ix.data, _ax.data); break;
+            }
+        }
+
+        void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            switch (_param.channels)
+            {
+            case 1: Run<1>(src, srcStride, dst, dstStride); break;
+            case 2: Run<2>(src, srcStride, dst, dstStride); break;
+            case 3: Run<3>(src, srcStride, dst, dstStride); break;
+            case 4: Run<4>(src, srcStride, dst, dstStride); break;
+            default: assert(0);
+            }
         }
 
         void ResizeBilinear(
             const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
         {
-            switch(channelCount)
+            if (channelCount >= 1 && channelCount <= 4)
             {
-            case 1: 
-                ResizeBilinear<1>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride); 
-                break;
-            case 2: 
-                ResizeBilinear<2>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride); 
-                break;
-            case 3: 
-                ResizeBilinear<3>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride); 
-                break;
-            case 4: 
-                ResizeBilinear<4>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride); 
-                break;
-            default: 
-                Base::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount); 
+                ResizerByteBilinear resizer(Base::ResParam(srcWidth, srcHeight, dstWidth, dstHeight, channelCount, SimdResizeMethodBilinear));
+                resizer.Run(src, srcStride, dst, dstStride);
             }
-        }	
+            else
+                Base::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+        }
+
+        void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method)
+        {
+            if (method == SimdResizeMethodBilinear && dstX >= A && channels >= 1 && channels <= 4)
+                return new ResizerByteBilinear(Base::ResParam(srcX, srcY, dstX, dstY, channels, method));
+            else
+                return Base::ResizerInit(srcX, srcY, dstX, dstY, channels, method);
+        }
     }
 #endif// SIMD_VMX_ENABLE
 }
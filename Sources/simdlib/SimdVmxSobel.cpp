@@ -529,7 +529,6 @@ namespace Simd
             dst += dstStride;
             for(size_t row = 1; row < height - 1; row += step)
             {
-                dst[0] = 0;
                 Anchor<false>(src + 1, srcStride, _threshold, dst + 1);
                 if(bodyWidth >= DA)
                 {
@@ -540,6 +539,7 @@ namespace Simd
                     Flush(_dst);
                 }
                 Anchor<false>(src + width - A - 1, srcStride, _threshold, dst + width - A - 1);
+                dst[0] = 0;
                 dst[width - 1] = 0;
                 src += step*srcStride;
                 dst += step*dstStride;
@@ -211,6 +211,55 @@ enum SimdReduceType
     SimdReduce5x5, /*!< Using of function ::SimdReduceGray5x5 for image reducing. */
 };
 
+/*! @ingroup c_types
+    Describes method of image resizing (see function Simd::Resize).
+*/
+typedef enum
+{
+    SimdResizeMethodBilinear, /*!< Bilinear interpolation (function ::SimdResizeBilinear). */
+    SimdResizeMethodArea, /*!< Pixel area averaging (function ::SimdResizeArea). It is preferable for large image downscale. */
+    SimdResizeMethodBicubic, /*!< Bicubic interpolation (function ::SimdResizeBicubic). */
+} SimdResizeMethodType;
+
+/*! @ingroup c_types
+    Describes format of output tensor of function ::SimdCropResizeBatch.
+*/
+typedef enum
+{
+    SimdCropResizeOutputUint8, /*!< 8-bit interleaved images (HWC order) with the same channel count as input image. */
+    SimdCropResizeOutputFloatHwc, /*!< 32-bit float interleaved images (HWC order). Every value is equal to src*scale + shift. */
+    SimdCropResizeOutputFloatChw, /*!< 32-bit float planar images (CHW order). Every value is equal to src*scale + shift. */
+} SimdCropResizeOutputType;
+
+/*! @ingroup c_types
+    Describes morphological operation (see functions ::SimdMorphology and ::SimdMorphologyMasked).
+*/
+typedef enum
+{
+    SimdMorphologyErode, /*!< Erosion: minimum over structuring element (function ::SimdErode). */
+    SimdMorphologyDilate, /*!< Dilation: maximum over structuring element (function ::SimdDilate). */
+    SimdMorphologyOpen, /*!< Opening: erosion followed by dilation. */
+    SimdMorphologyClose, /*!< Closing: dilation followed by erosion. */
+} SimdMorphologyType;
+
+/*! @ingroup c_types
+    Describes shape of structuring element of morphological operation (see function ::SimdMorphology).
+*/
+typedef enum
+{
+    SimdMorphologyShapeRect, /*!< Rectangle windowX x windowY. */
+    SimdMorphologyShapeCross, /*!< Cross: union of horizontal line windowX x 1 and vertical line 1 x windowY with common center. */
+} SimdMorphologyShapeType;
+
+/*! @ingroup c_types
+    Describes type of bilateral filter (see function ::SimdBilateralFilter).
+*/
+typedef enum
+{
+    SimdBilateralFilterExact, /*!< Direct summation over circular window. */
+    SimdBilateralFilterFast, /*!< Recursive bilateral filter (approximation with cost independent of spatial sigma). */
+} SimdBilateralFilterType;
+
 #if defined(WIN32) && !defined(SIMD_STATIC)
 #  ifdef SIMD_EXPORTS
 #    define SIMD_API __declspec(dllexport)
@@ -274,6 +323,131 @@ extern "C"
     */
     SIMD_API int SimdCpuInfo();
 
+    /*! @ingroup info
+
+        \fn int SimdGetCpuInfoMask();
+
+        \short Gets info about SIMD extensions which are currently used by %Simd Library.
+
+        By default it is equal to the result of function ::SimdCpuInfo. It can be restricted with using of function ::SimdSetCpuInfoMask.
+
+        \note See enumeration ::SimdCpuInfoFlags.
+
+        \return an integer value which bits contains information about SIMD extensions used by %Simd Library.
+    */
+    SIMD_API int SimdGetCpuInfoMask();
+
+    /*! @ingroup info
+
+        \fn int SimdSetCpuInfoMask(int mask);
+
+        \short Restricts set of SIMD extensions which are used by %Simd Library.
+
+        All dispatched functions of the library are switched once to the best implementation allowed by the mask. 
+        It allows to compare different implementations (for example AVX2 and SSE2) at runtime without rebuilding of the library.
+        Extensions which are not supported by CPU (see function ::SimdCpuInfo) are ignored. 
+        To restore default state call this function with mask equal to -1.
+
+        \note This function can be called while other threads use %Simd Library: every concurrent call uses either previous or new set of extensions.
+
+        Using example:
+        \verbatim
+        #include "Simd/SimdLib.h"
+
+        int main()
+        {
+            int sse2Only = (1 << SimdCpuInfoSse) | (1 << SimdCpuInfoSse2);
+            SimdSetCpuInfoMask(sse2Only); // All next calls use only SSE and SSE2 implementations.
+            //...
+            SimdSetCpuInfoMask(-1); // Restores default state.
+            return 0;
+        }
+        \endverbatim
+
+        \param [in] mask - an integer value which bits contains information about allowed SIMD extensions (see enumeration ::SimdCpuInfoFlags).
+        \return an integer value which bits contains information about SIMD extensions actually used by %Simd Library after this call.
+    */
+    SIMD_API int SimdSetCpuInfoMask(int mask);
+
+    /*! @ingroup thread
+
+        \fn void SimdSetThreadNumber(size_t threadNumber);
+
+        \short Sets number of threads which are used by %Simd Library to process one image.
+
+        By default every function of the library uses only the calling thread. 
+        If the number is greater than 1 then the functions which process image rows independently (color conversions, 
+        3x3 and 5x5 filters, image reducing and so on) split large images into horizontal stripes and process them in parallel.
+        The rows near stripe boundaries are processed with taking into account of neighboring rows, so the result 
+        is identical to the result of single-threaded processing. Nested calls are always single-threaded.
+
+        \note This function is not thread safe. Work threads are taken from process-wide pool Simd::ThreadPool::Global.
+
+        \param [in] threadNumber - a number of threads (1 disables multithreading).
+    */
+    SIMD_API void SimdSetThreadNumber(size_t threadNumber);
+
+    /*! @ingroup thread
+
+        \fn size_t SimdGetThreadNumber();
+
+        \short Gets number of threads which are used by %Simd Library to process one image (see function ::SimdSetThreadNumber).
+
+        \return a number of threads.
+    */
+    SIMD_API size_t SimdGetThreadNumber();
+
+    /*! @ingroup performance
+
+        \fn const char * SimdPerformanceStatistic();
+
+        \short Gets internal performance statistics of %Simd Library.
+
+        The statistics is collected only if the library is built with defined macro SIMD_PERFORMANCE_STATISTIC (see file SimdConfig.h).
+        It contains a number of calls, total, average, minimal and maximal time and throughput (for functions which process images) 
+        of every called C API function and of every user code block measured with using of function ::SimdPerformanceMeasurerEnter 
+        (for example stages of Simd::Detection, Simd::Motion::Detector and Simd::Neural which are marked with macro SIMD_CHECK_PERFORMANCE). 
+        Calls from all threads are combined. Stripes of images processed by work threads (see function ::SimdSetThreadNumber) are not counted separately.
+
+        \note The returned string is valid until the next call of this function in the same thread.
+
+        \return a string with performance report or empty string if the statistics is not collected.
+    */
+    SIMD_API const char * SimdPerformanceStatistic();
+
+    /*! @ingroup performance
+
+        \fn void SimdPerformanceStatisticReset();
+
+        \short Resets internal performance statistics of %Simd Library (see function ::SimdPerformanceStatistic).
+    */
+    SIMD_API void SimdPerformanceStatisticReset();
+
+    /*! @ingroup performance
+
+        \fn void * SimdPerformanceMeasurerEnter(const char * name);
+
+        \short Starts measurement of user code block and adds it to internal performance statistics of %Simd Library.
+
+        Every call of this function must be paired with call of function ::SimdPerformanceMeasurerLeave in the same thread. 
+        Nested blocks are allowed. C++ class Simd::PerformanceScope does it automatically.
+
+        \param [in] name - a name of the block. Blocks with equal names are accumulated together.
+        \return a handle of the measurer or NULL if the statistics is not collected.
+    */
+    SIMD_API void * SimdPerformanceMeasurerEnter(const char * name);
+
+    /*! @ingroup performance
+
+        \fn void SimdPerformanceMeasurerLeave(void * measurer, size_t pixels);
+
+        \short Finishes measurement of user code block started by function ::SimdPerformanceMeasurerEnter.
+
+        \param [in] measurer - a handle returned by function ::SimdPerformanceMeasurerEnter (it can be NULL).
+        \param [in] pixels - a number of pixels processed by the block (0 if the throughput is not required).
+    */
+    SIMD_API void SimdPerformanceMeasurerLeave(void * measurer, size_t pixels);
+
     /*! @ingroup memory
 
         \fn void * SimdAllocate(size_t size, size_t align);
@@ -320,6 +494,8 @@ extern "C"
 
         \short Gets alignment required for the most productive work of the Simd Library.
 
+        It depends on SIMD extensions which are currently used by the library (see function ::SimdSetCpuInfoMask).
+
         \return a required alignment.
     */
     SIMD_API size_t SimdAlignment();
@@ -1180,6 +1356,41 @@ extern "C"
 	*/
     SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup other_filter
+
+        \fn void SimdBilateralFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, SimdBilateralFilterType type, float sigmaSpace, float sigmaRange, size_t radius, uint8_t * dst, size_t dstStride);
+
+        \short Performs bilateral (edge-preserving) filtration of the image. 
+
+        For every point:
+        \verbatim
+        dst[p] = sum(src[q]*S(|p - q|)*R(|src[p] - src[q]|))/sum(S(|p - q|)*R(|src[p] - src[q]|));
+        S(d) = exp(-d*d/(2*sigmaSpace*sigmaSpace)), R(d) = exp(-d*d/(2*sigmaRange*sigmaRange));
+        \endverbatim
+        where the range distance |src[p] - src[q]| is the sum of absolute differences of all channels. Border pixels are replicated.
+
+        ::SimdBilateralFilterExact sums over circular window of given radius, its cost grows quadratically with radius.
+        ::SimdBilateralFilterFast uses the recursive bilateral filter, its cost does not depend on sigmaSpace, so it is preferable for large radii.
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function has a C++ wrapper Simd::BilateralFilter(const View<A>& src, float sigmaSpace, float sigmaRange, View<A>& dst, SimdBilateralFilterType type, size_t radius).
+
+        \param [in] src - a pointer to pixels data of source image.
+        \param [in] srcStride - a row size of the src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channelCount - a channel count.
+        \param [in] type - a type of the filter (see ::SimdBilateralFilterType).
+        \param [in] sigmaSpace - a standard deviation of spatial Gaussian (in pixels). It must be positive.
+        \param [in] sigmaRange - a standard deviation of range Gaussian (in intensity units). It must be positive.
+        \param [in] radius - a radius of the window of exact filter. If it is equal to 0 then it is calculated from sigmaSpace as round(1.5*sigmaSpace) (at least 1). It is ignored by fast filter.
+        \param [out] dst - a pointer to pixels data of destination image.
+        \param [in] dstStride - a row size of the dst image.
+    */
+    SIMD_API void SimdBilateralFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, 
+        SimdBilateralFilterType type, float sigmaSpace, float sigmaRange, size_t radius, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup binarization
 
         \fn void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType);
@@ -1256,6 +1467,39 @@ extern "C"
         uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative,
         uint8_t * dst, size_t dstStride, SimdCompareType compareType);
 
+    /*! @ingroup other_filter
+
+        \fn void SimdBoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride);
+
+        \short Performs an averaging with rectangular window of arbitrary odd size. 
+
+        For every point:
+        \verbatim
+        sum = 0;
+        for(dy = -windowY/2; dy <= windowY/2; ++dy) 
+            for(dx = -windowX/2; dx <= windowX/2; ++dx) 
+                sum += src[x + dx, y + dy];
+        dst[x, y] = Round(sum/(windowX*windowY));
+        \endverbatim
+        Border pixels are replicated. The function uses running column and row sums, so its cost does not depend on window size.
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function has a C++ wrapper Simd::BoxFilter(const View<A>& src, size_t windowX, size_t windowY, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of source image.
+        \param [in] srcStride - a row size of the src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channelCount - a channel count.
+        \param [in] windowX - a width of the window. It must be odd and not greater than 255.
+        \param [in] windowY - a height of the window. It must be odd and not greater than 255.
+        \param [out] dst - a pointer to pixels data of destination image.
+        \param [in] dstStride - a row size of the dst image.
+    */
+    SIMD_API void SimdBoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup conditional
 
         \fn void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height, uint8_t value, SimdCompareType compareType, uint32_t * count);
@@ -1558,6 +1802,7 @@ extern "C"
         
         This function supports OpenCV HAAR and LBP cascades type.         
         Tree based cascades and old cascade formats are not supported.
+        It also loads cascades in Simd binary format (see ::SimdDetectionSaveA), the format is detected automatically.
 
         \note This function is used for implementation of Simd::Detection.
 
@@ -1567,6 +1812,40 @@ extern "C"
     */
     SIMD_API void * SimdDetectionLoadA(const char * path);
 
+    /*! @ingroup object_detection
+
+        \fn void * SimdDetectionLoadMemory(const void * buffer, size_t size);
+
+        \short Loads a classifier cascade from memory buffer. 
+
+        The buffer can contain OpenCV HAAR or LBP cascade in XML format or a cascade in Simd binary format (see ::SimdDetectionSaveA).
+        Loading of binary format does not need any parsing, so it is much faster. The buffer can be a memory mapped file, 
+        it is not used after return of the function.
+
+        \note This function is used for implementation of Simd::Detection.
+
+        \param [in] buffer - a pointer to the buffer with cascade.
+        \param [in] size - a size of the buffer (in bytes).
+        \return a pointer to loaded cascade. On error it returns NULL. 
+                This pointer is used in functions ::SimdDetectionInfo and ::SimdDetectionInit, and must be released with using function ::SimdDetectionFree.
+    */
+    SIMD_API void * SimdDetectionLoadMemory(const void * buffer, size_t size);
+
+    /*! @ingroup object_detection
+
+        \fn int SimdDetectionSaveA(const void * data, const char * path);
+
+        \short Saves a classifier cascade to file in Simd binary format. 
+
+        The binary format stores already parsed cascade and is versioned. It uses native byte order. 
+        Saved file can be loaded with using of functions ::SimdDetectionLoadA or ::SimdDetectionLoadMemory.
+
+        \param [in] data - a pointer to cascade which was received with using of function ::SimdDetectionLoadA or ::SimdDetectionLoadMemory. 
+        \param [in] path - a path to output file.
+        \return 1 on success and 0 on error.
+    */
+    SIMD_API int SimdDetectionSaveA(const void * data, const char * path);
+
     /*! @ingroup object_detection
 
         \fn void SimdDetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags);
@@ -2064,6 +2343,72 @@ extern "C"
     SIMD_API void SimdFillBgra(uint8_t * dst, size_t stride, size_t width, size_t height,
         uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha);
 
+    /*! @ingroup other_filter
+
+        \fn void SimdFilter2D8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, const int16_t * kernel, size_t kernelX, size_t kernelY, int shift, int16_t bias, uint8_t * dst, size_t dstStride);
+
+        \short Performs a 2D filtration of 8-bit gray image with arbitrary integer kernel.
+
+        For every point:
+        \verbatim
+        sum = 0;
+        for(ky = 0; ky < kernelY; ++ky)
+            for(kx = 0; kx < kernelX; ++kx)
+                sum = SaturateI16(sum + src[x + kx - kernelX/2, y + ky - kernelY/2]*kernel[ky*kernelX + kx]);
+        sum = SaturateI16(sum + (shift ? 1 << (shift - 1) : 0)) >> shift;
+        dst[x, y] = SaturateU8(sum + bias);
+        \endverbatim
+        Border pixels are replicated. 
+        The function finds separable kernels itself and applies them as two 1D filters when it does not change the result.
+
+        All images must have 8-bit gray format and the same width and height.
+
+        \note This function has a C++ wrapper Simd::Filter2D(const View<A>& src, const int16_t * kernel, size_t kernelX, size_t kernelY, int shift, int16_t bias, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of source image.
+        \param [in] srcStride - a row size of the src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] kernel - a pointer to the kernel (kernelX*kernelY values, row by row). Its values must be in range [-128, 128].
+        \param [in] kernelX - a width of the kernel. It must be in range [1, 15].
+        \param [in] kernelY - a height of the kernel. It must be in range [1, 15].
+        \param [in] shift - a right shift of the sum. It must be in range [0, 15].
+        \param [in] bias - a value which is added to the shifted sum.
+        \param [out] dst - a pointer to pixels data of destination image.
+        \param [in] dstStride - a row size of the dst image.
+    */
+    SIMD_API void SimdFilter2D8u(const uint8_t * src, size_t srcStride, size_t width, size_t height, const int16_t * kernel, size_t kernelX, size_t kernelY,
+        int shift, int16_t bias, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdFilter2D32f(const float * src, size_t srcStride, size_t width, size_t height, const float * kernel, size_t kernelX, size_t kernelY, float * dst, size_t dstStride);
+
+        \short Performs a 2D filtration of 32-bit float image with arbitrary kernel.
+
+        For every point:
+        \verbatim
+        dst[x, y] = 0;
+        for(ky = 0; ky < kernelY; ++ky)
+            for(kx = 0; kx < kernelX; ++kx)
+                dst[x, y] += src[x + kx - kernelX/2, y + ky - kernelY/2]*kernel[ky*kernelX + kx];
+        \endverbatim
+        Border pixels are replicated. 
+        The function finds separable kernels itself and applies them as two 1D filters (the result may differ in the last bits).
+
+        \param [in] src - a pointer to the source image.
+        \param [in] srcStride - a row size of the src image (in 32-float values).
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] kernel - a pointer to the kernel (kernelX*kernelY values, row by row).
+        \param [in] kernelX - a width of the kernel. It must be in range [1, 15].
+        \param [in] kernelY - a height of the kernel. It must be in range [1, 15].
+        \param [out] dst - a pointer to the destination image.
+        \param [in] dstStride - a row size of the dst image (in 32-float values).
+    */
+    SIMD_API void SimdFilter2D32f(const float * src, size_t srcStride, size_t width, size_t height, const float * kernel, size_t kernelX, size_t kernelY,
+        float * dst, size_t dstStride);
+
     /*! @ingroup float16
 
         \fn void SimdFloat32ToFloat16(const float * src, size_t size, uint16_t * dst);
@@ -2174,6 +2519,36 @@ extern "C"
     SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         size_t channelCount, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup other_filter
+
+        \fn void SimdGaussianBlur(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, float sigma, size_t radius, uint8_t * dst, size_t dstStride);
+
+        \short Performs Gaussian blur filtration with arbitrary sigma. 
+
+        The filter is separable: at first every row is convolved with 1D Gaussian kernel of size 2*radius + 1, 
+        then every column of the result is convolved with the same kernel. Border pixels are replicated. 
+        The calculations are performed in fixed point (14-bit kernel weights, 16-bit intermediate rows), 
+        so the result does not depend on the used instruction set. Filtered rows are kept in a ring buffer, 
+        wide images are processed by vertical blocks to keep this buffer in cache. 
+        The cost of the filtration grows linearly with radius.
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function has a C++ wrapper Simd::GaussianBlur(const View<A>& src, View<A>& dst, float sigma, size_t radius).
+
+        \param [in] src - a pointer to pixels data of source image.
+        \param [in] srcStride - a row size of the src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channelCount - a channel count.
+        \param [in] sigma - a standard deviation of Gaussian kernel. If it is not positive then it is calculated from radius as 0.3*(radius - 1) + 0.8.
+        \param [in] radius - a radius of Gaussian kernel. If it is equal to 0 then it is calculated from sigma as ceil(3*sigma) (at least 1).
+        \param [out] dst - a pointer to pixels data of destination image.
+        \param [in] dstStride - a row size of the dst image.
+    */
+    SIMD_API void SimdGaussianBlur(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, float sigma, size_t radius, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup gray_conversion
 
         \fn void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride);
@@ -2869,6 +3244,148 @@ extern "C"
     SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         size_t channelCount, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup median_filter
+
+        \fn void SimdMedianFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+
+        \short Performs median filtration of input image with square window of arbitrary size (2*radius + 1)x(2*radius + 1). 
+
+        Every channel is filtered independently. Border pixels are replicated. 
+        The function uses histogram based sliding window (Perreault-Hebert algorithm), so its cost per pixel does not depend on radius.
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function has a C++ wrappers: Simd::MedianFilter(const View<A>& src, size_t radius, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of original input image.
+        \param [in] srcStride - a row size of src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channelCount - a channel count.
+        \param [in] radius - a radius of the window. It must not be greater than 127.
+        \param [out] dst - a pointer to pixels data of filtered output image.
+        \param [in] dstStride - a row size of dst image.
+    */
+    SIMD_API void SimdMedianFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdErode(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride);
+
+        \short Performs erosion of 8-bit gray image with rectangular structuring element. 
+
+        For every point:
+        \verbatim
+        dst[x, y] = min(src[x + dx, y + dy]), where |dx| <= windowX/2, |dy| <= windowY/2.
+        \endverbatim
+        Points outside of the image are ignored. The cost of the function does not depend on window size (see ::SimdMorphology).
+
+        All images must have the same width and height. Input and output images must be different.
+
+        \note This function has a C++ wrapper Simd::Erode(const View<A>& src, size_t windowX, size_t windowY, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] windowX - a width of structuring element. It must be odd.
+        \param [in] windowY - a height of structuring element. It must be odd.
+        \param [out] dst - a pointer to pixels data of output 8-bit gray image.
+        \param [in] dstStride - a row size of the dst image.
+    */
+    SIMD_API void SimdErode(const uint8_t * src, size_t srcStride, size_t width, size_t height, 
+        size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdDilate(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride);
+
+        \short Performs dilation of 8-bit gray image with rectangular structuring element. 
+
+        For every point:
+        \verbatim
+        dst[x, y] = max(src[x + dx, y + dy]), where |dx| <= windowX/2, |dy| <= windowY/2.
+        \endverbatim
+        Points outside of the image are ignored. The cost of the function does not depend on window size (see ::SimdMorphology).
+
+        All images must have the same width and height. Input and output images must be different.
+
+        \note This function has a C++ wrapper Simd::Dilate(const View<A>& src, size_t windowX, size_t windowY, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] windowX - a width of structuring element. It must be odd.
+        \param [in] windowY - a height of structuring element. It must be odd.
+        \param [out] dst - a pointer to pixels data of output 8-bit gray image.
+        \param [in] dstStride - a row size of the dst image.
+    */
+    SIMD_API void SimdDilate(const uint8_t * src, size_t srcStride, size_t width, size_t height, 
+        size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdMorphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdMorphologyType type, SimdMorphologyShapeType shape, size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride);
+
+        \short Performs morphological operation (erosion, dilation, opening or closing) of 8-bit gray image. 
+
+        The structuring element is a rectangle or a cross (see ::SimdMorphologyShapeType) with odd sizes windowX and windowY. 
+        Points outside of the image are ignored. The vertical pass uses van Herk/Gil-Werman algorithm 
+        (3 minimum/maximum operations per point for any window height), the horizontal pass uses doubling of window 
+        (log2(windowX) + 1 operations per point).
+
+        All images must have the same width and height. Input and output images must be different.
+
+        \note This function has a C++ wrapper Simd::Morphology(const View<A>& src, SimdMorphologyType type, SimdMorphologyShapeType shape, size_t windowX, size_t windowY, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] type - a type of morphological operation (see ::SimdMorphologyType).
+        \param [in] shape - a shape of structuring element (see ::SimdMorphologyShapeType).
+        \param [in] windowX - a width of structuring element. It must be odd.
+        \param [in] windowY - a height of structuring element. It must be odd.
+        \param [out] dst - a pointer to pixels data of output 8-bit gray image.
+        \param [in] dstStride - a row size of the dst image.
+    */
+    SIMD_API void SimdMorphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdMorphologyType type, 
+        SimdMorphologyShapeType shape, size_t windowX, size_t windowY, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdMorphologyMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdMorphologyType type, SimdMorphologyShapeType shape, size_t windowX, size_t windowY, const uint8_t * mask, size_t maskStride, uint8_t index, uint8_t * dst, size_t dstStride);
+
+        \short Performs morphological operation of 8-bit gray image based on gray 8-bit mask. 
+
+        It is the same as ::SimdMorphology for points where mask[i] == index, other points are copied from input image:
+        \verbatim
+        dst[i] = mask[i] == index ? morphology(src)[i] : src[i];
+        \endverbatim
+
+        All images must have the same width and height. Input and output images must be different.
+
+        \note This function has a C++ wrapper Simd::Morphology(const View<A>& src, SimdMorphologyType type, SimdMorphologyShapeType shape, size_t windowX, size_t windowY, const View<A>& mask, uint8_t index, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] type - a type of morphological operation (see ::SimdMorphologyType).
+        \param [in] shape - a shape of structuring element (see ::SimdMorphologyShapeType).
+        \param [in] windowX - a width of structuring element. It must be odd.
+        \param [in] windowY - a height of structuring element. It must be odd.
+        \param [in] mask - a pointer to pixels data of 8-bit gray mask image.
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] index - a mask index.
+        \param [out] dst - a pointer to pixels data of output 8-bit gray image.
+        \param [in] dstStride - a row size of the dst image.
+    */
+    SIMD_API void SimdMorphologyMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdMorphologyType type, 
+        SimdMorphologyShapeType shape, size_t windowX, size_t windowY, const uint8_t * mask, size_t maskStride, uint8_t index, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup neural
 
         \fn void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
@@ -3554,6 +4071,55 @@ extern "C"
     */
     SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+        \short Converts NV12 image to 24-bit BGR image. 
+
+        The input Y and output BGR images must have the same width and height. 
+        The input UV plane has interleaved U and V components and half size relative to Y component. 
+        The UV plane is read in place without deinterleaving to temporary U and V planes.
+
+        \note This function has a C++ wrappers: Simd::Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, 
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+        \short Converts NV12 image to 32-bit BGRA image. 
+
+        The input Y and output BGRA images must have the same width and height. 
+        The input UV plane has interleaved U and V components and half size relative to Y component. 
+        The UV plane is read in place without deinterleaving to temporary U and V planes.
+
+        \note This function has a C++ wrappers: Simd::Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+    */
+    SIMD_API void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, 
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
     /*! @ingroup operation
 
         \fn void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
@@ -3815,6 +4381,57 @@ extern "C"
     */
     SIMD_API void SimdReorder64bit(const uint8_t * src, size_t size, uint8_t * dst);
 
+    /*! @ingroup resizing
+
+        \fn void SimdResizeArea(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
+
+        \short Performs resizing of input image with using pixel area averaging.
+
+        All images must have the same format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        Every output pixel is an exact weighted average of the input pixels covered by its area (for arbitrary scale ratio). 
+        So this method does not produce aliasing at large downscale.
+
+        \note This function has a C++ wrappers: Simd::Resize(const View<A>& src, View<A>& dst, SimdResizeMethodType method).
+
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [out] dst - a pointer to pixels data of the resized output image.
+        \param [in] dstWidth - a width of the output image.
+        \param [in] dstHeight - a height of the output image.
+        \param [in] dstStride - a row size of the output image.
+        \param [in] channelCount - a channel count.
+    */
+    SIMD_API void SimdResizeArea(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
+
+    /*! @ingroup resizing
+
+        \fn void SimdResizeBicubic(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
+
+        \short Performs resizing of input image with using bicubic interpolation.
+
+        All images must have the same format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        It uses a 4x4 neighborhood of input pixels with Catmull-Rom spline coefficients (a = -0.5). Border pixels are replicated.
+
+        \note This function has a C++ wrappers: Simd::Resize(const View<A>& src, View<A>& dst, SimdResizeMethodType method).
+
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [out] dst - a pointer to pixels data of the resized output image.
+        \param [in] dstWidth - a width of the output image.
+        \param [in] dstHeight - a height of the output image.
+        \param [in] dstStride - a row size of the output image.
+        \param [in] channelCount - a channel count.
+    */
+    SIMD_API void SimdResizeBicubic(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
+
     /*! @ingroup resizing
 
         \fn void SimdResizeBilinear(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
@@ -3823,7 +4440,7 @@ extern "C"
 
         All images must have the same format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
 
-        \note This function has a C++ wrappers: Simd::ResizeBilinear(const View<A>& src, View<A>& dst).
+        \note This function has a C++ wrappers: Simd::ResizeBilinear(const View<A>& src, View<A>& dst) and Simd::Resize(const View<A>& src, View<A>& dst, SimdResizeMethodType method).
 
         \param [in] src - a pointer to pixels data of the original input image.
         \param [in] srcWidth - a width of the input image.
@@ -3838,6 +4455,95 @@ extern "C"
     SIMD_API void SimdResizeBilinear(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
         uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount);
 
+    /*! @ingroup resizing
+
+        \fn void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method);
+
+        \short Creates resize context for given geometry. 
+
+        The context keeps all index and coefficient tables and intermediate row buffers, 
+        so it allows to resize a sequence of images with the same sizes without repeated estimation of tables and memory allocation.
+        The result of resizing is the same as result of functions ::SimdResizeBilinear, ::SimdResizeArea and ::SimdResizeBicubic.
+
+        \note This function has a C++ wrapper: Simd::Resizer.
+
+        \param [in] srcX - a width of the input image.
+        \param [in] srcY - a height of the input image.
+        \param [in] dstX - a width of the output image.
+        \param [in] dstY - a height of the output image.
+        \param [in] channels - a channel count (1, 2, 3 or 4).
+        \param [in] method - a resizing method. 
+        \return a pointer to resize context. On error it returns NULL.
+                This pointer is used in function ::SimdResizerRun and must be released with using function ::SimdResizerFree.
+    */
+    SIMD_API void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method);
+
+    /*! @ingroup resizing
+
+        \fn void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs resizing of image with using of resize context. 
+
+        Input and output images must have sizes and channel count given in function ::SimdResizerInit.
+        The context must not be used simultaneously in several threads.
+
+        \note This function has a C++ wrapper: Simd::Resizer.
+
+        \param [in] resizer - a resize context. It must be created by function ::SimdResizerInit.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [out] dst - a pointer to pixels data of the resized output image.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup resizing
+
+        \fn void SimdResizerFree(void * resizer);
+
+        \short Releases resize context created by function ::SimdResizerInit.
+
+        \param [in] resizer - a resize context.
+    */
+    SIMD_API void SimdResizerFree(void * resizer);
+
+    /*! @ingroup resizing
+
+        \fn void SimdCropResizeBatch(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t channels, const ptrdiff_t * rects, size_t count, size_t dstWidth, size_t dstHeight, SimdResizeMethodType method, SimdCropResizeOutputType output, float scale, float shift, void * dst);
+
+        \short Crops a set of rectangles from input image and resizes each of them to the same output size. 
+
+        The results are stored one after another into a contiguous output tensor (batch of count images), 
+        so it can be passed directly to an input of a neural network. 
+        For float output every value is equal to:
+        \verbatim
+        dst = src*scale + shift;
+        \endverbatim
+        Rectangles are clipped by bounds of input image. An empty rectangle gives the same output as a black (zero) image.
+        Rectangles are processed in parallel (see ::SimdSetThreadNumber).
+
+        \note This function has a C++ wrapper: Simd::CropResizeBatch(const View<A> & src, const std::vector<Rectangle<ptrdiff_t>> & rects, size_t width, size_t height, SimdCropResizeOutputType output, float scale, float shift, void * dst, SimdResizeMethodType method).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] channels - a channel count (1, 2, 3 or 4).
+        \param [in] rects - a pointer to array of rectangles. Every rectangle is given by 4 values: left, top, right, bottom.
+        \param [in] count - a number of rectangles.
+        \param [in] dstWidth - a width of output images.
+        \param [in] dstHeight - a height of output images.
+        \param [in] method - a resizing method.
+        \param [in] output - a format of output tensor.
+        \param [in] scale - a scale of float output values. It is ignored for 8-bit output.
+        \param [in] shift - a shift of float output values. It is ignored for 8-bit output.
+        \param [out] dst - a pointer to output tensor. Its size must be equal to count*dstWidth*dstHeight*channels elements 
+                           (uint8_t or float depending on output format).
+    */
+    SIMD_API void SimdCropResizeBatch(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t channels,
+        const ptrdiff_t * rects, size_t count, size_t dstWidth, size_t dstHeight, SimdResizeMethodType method,
+        SimdCropResizeOutputType output, float scale, float shift, void * dst);
+
     /*! @ingroup segmentation
 
         \fn void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex);
@@ -4192,6 +4898,38 @@ extern "C"
     */
     SIMD_API void SimdContourAnchors(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t step, int16_t threshold, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup contour
+
+        \fn void SimdCanny(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t low, uint16_t high, uint8_t * dst, size_t dstStride);
+
+        \short Detects edges in the image with using of Canny algorithm. 
+
+        All images must have the same width and height. Input and output images must have 8-bit gray format. 
+
+        At first Sobel's filter is applied to the image (with replicated border), magnitude of the gradient is estimated as:
+        \verbatim
+        dy = (src[x-1,y+1] + 2*src[x, y+1] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x, y-1] + src[x+1, y-1]);
+        dx = (src[x+1,y-1] + 2*src[x+1, y] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x-1, y] + src[x-1, y+1]);
+        mag[x, y] = abs(dx) + abs(dy);
+        \endverbatim
+        Then non-maximum suppression along quantized direction of the gradient is performed (magnitude outside the image is equal to zero), 
+        the local maxima with magnitude greater than high threshold are strong edges, other local maxima with magnitude greater than low threshold are weak edges.
+        Finally all strong edges and weak edges connected with them (8-connectivity) are marked by 255, other points are set to 0. 
+        Sobel's filter, direction quantization and non-maximum suppression are fused in one pass.
+
+        \note This function has a C++ wrappers: Simd::Canny(const View<A>& src, View<A>& dst, uint16_t low, uint16_t high).
+
+        \param [in] src - a pointer to pixels data of the input 8-bit gray image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] low - a low threshold of gradient magnitude (magnitude is in range [0, 2040]).
+        \param [in] high - a high threshold of gradient magnitude.
+        \param [out] dst - a pointer to pixels data of the output 8-bit gray edge mask.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdCanny(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint16_t low, uint16_t high, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup correlation
 
         \fn void SimdSquaredDifferenceSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum);